@@ -23,14 +23,15 @@ template<int dim>
 double IntegratedFissionSource<dim>::CellValue(
     domain::CellPtr<dim> cell_ptr,
     system::moments::SphericalHarmonicI* system_moments_ptr) const {
-  const int material_id = cell_ptr->material_id();
+  const auto& table = cross_sections_ptr_->table;
+  const int material = table.MaterialIndex(cell_ptr->material_id());
   double fission_source = 0;
 
-  if (cross_sections_ptr_->is_material_fissile.at(material_id)) {
+  if (table.is_material_fissile(material)) {
     finite_element_ptr_->SetCell(cell_ptr);
 
     const int total_groups = system_moments_ptr->total_groups();
-    const auto nu_sigma_f = cross_sections_ptr_->nu_sigma_f.at(material_id);
+    const auto nu_sigma_f = table.nu_sigma_f(material);
 
     for (int group = 0; group < total_groups; ++group) {
 
@@ -41,7 +42,7 @@ double IntegratedFissionSource<dim>::CellValue(
       for (int q = 0; q < cell_quadrature_points_; ++q) {
         double scalar_flux = scalar_flux_at_cell_quadrature.at(q) *
             finite_element_ptr_->Jacobian(q);
-        fission_source += nu_sigma_f.at(group) * scalar_flux;
+        fission_source += nu_sigma_f[group] * scalar_flux;
       }
     }
   }
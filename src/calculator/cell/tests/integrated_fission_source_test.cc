@@ -10,6 +10,7 @@
 #include "system/moments/tests/spherical_harmonic_mock.h"
 #include "test_helpers/gmock_wrapper.h"
 #include "test_helpers/dealii_test_domain.h"
+#include "test_helpers/test_helper_functions.h"
 
 
 namespace  {
@@ -124,10 +125,8 @@ TYPED_TEST(CalcCellIntegratedFissionSourceTest, CellValueMPI) {
     std::vector<double> group_0_flux{1, 2, 3, 4};
     std::vector<double> group_1_flux{4, 3, 2, 1};
 
-    system::moments::MomentVector group_0_flux_vector(group_0_flux.begin(),
-                                                      group_0_flux.end());
-    system::moments::MomentVector group_1_flux_vector(group_1_flux.begin(),
-                                                      group_1_flux.end());
+    auto group_0_flux_vector = test_helpers::MakeMPIVector(group_0_flux);
+    auto group_1_flux_vector = test_helpers::MakeMPIVector(group_1_flux);
 
     system::moments::MomentIndex group_0_index{0,0,0};
     system::moments::MomentIndex group_1_index{1,0,0};
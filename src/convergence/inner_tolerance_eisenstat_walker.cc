@@ -0,0 +1,62 @@
+#include "convergence/inner_tolerance_eisenstat_walker.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <deal.II/base/exceptions.h>
+
+namespace bart {
+
+namespace convergence {
+
+InnerToleranceEisenstatWalker::InnerToleranceEisenstatWalker(
+    const double min_tolerance,
+    const double max_tolerance,
+    const double gamma,
+    const double alpha,
+    const double outer_factor)
+    : min_tolerance_(min_tolerance),
+      max_tolerance_(max_tolerance),
+      gamma_(gamma),
+      alpha_(alpha),
+      outer_factor_(outer_factor),
+      tolerance_(max_tolerance) {
+  AssertThrow(min_tolerance_ > 0,
+              dealii::ExcMessage("Minimum inner tolerance must be > 0"));
+  AssertThrow(max_tolerance_ >= min_tolerance_,
+              dealii::ExcMessage("Maximum inner tolerance must be >= minimum "
+                                 "inner tolerance"));
+  AssertThrow(gamma_ > 0 && gamma_ <= 1,
+              dealii::ExcMessage("Eisenstat-Walker gamma must be in (0, 1]"));
+  AssertThrow(alpha_ > 1 && alpha_ <= 2,
+              dealii::ExcMessage("Eisenstat-Walker alpha must be in (1, 2]"));
+  AssertThrow(outer_factor_ > 0,
+              dealii::ExcMessage("Outer factor must be > 0"));
+}
+
+void InnerToleranceEisenstatWalker::Update(const double outer_delta) {
+  AssertThrow(outer_delta >= 0,
+              dealii::ExcMessage("Outer delta must be >= 0"));
+  double forcing_term = max_tolerance_;
+
+  if (previous_delta_.has_value() && previous_delta_.value() > 0) {
+    forcing_term = gamma_ * std::pow(outer_delta/previous_delta_.value(),
+                                     alpha_);
+    const double safeguard = gamma_ * std::pow(tolerance_, alpha_);
+    if (safeguard > 0.1)
+      forcing_term = std::max(forcing_term, safeguard);
+  }
+
+  forcing_term = std::min(forcing_term, outer_factor_ * outer_delta);
+  tolerance_ = std::clamp(forcing_term, min_tolerance_, max_tolerance_);
+  previous_delta_ = outer_delta;
+}
+
+void InnerToleranceEisenstatWalker::Reset() {
+  tolerance_ = max_tolerance_;
+  previous_delta_ = std::nullopt;
+}
+
+} // namespace convergence
+
+} // namespace bart
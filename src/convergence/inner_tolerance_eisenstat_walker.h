@@ -0,0 +1,77 @@
+#ifndef BART_SRC_CONVERGENCE_INNER_TOLERANCE_EISENSTAT_WALKER_H_
+#define BART_SRC_CONVERGENCE_INNER_TOLERANCE_EISENSTAT_WALKER_H_
+
+#include <optional>
+
+#include "convergence/inner_tolerance_i.h"
+
+namespace bart {
+
+namespace convergence {
+
+/*! \brief Inner tolerance driven by the outer iteration (Eisenstat-Walker).
+ *
+ * After outer iteration \f$k\f$ with outer delta \f$\Delta_k\f$ the forcing
+ * term is
+ *
+ * \f[
+ * \eta_k = \min\left(\gamma\left(\frac{\Delta_k}{\Delta_{k-1}}\right)^{\alpha},
+ * c\Delta_k\right)
+ * \f]
+ *
+ * with the Eisenstat-Walker safeguard
+ * \f$\eta_k = \max(\eta_k, \gamma\eta_{k-1}^\alpha)\f$ applied when
+ * \f$\gamma\eta_{k-1}^\alpha > 0.1\f$. The second term of the minimum ensures
+ * the inner tolerance tightens as the outer iteration converges, even when
+ * the outer convergence rate (e.g. the dominance ratio of a power iteration)
+ * is slow. The returned tolerance is \f$\eta_k\f$ clamped to
+ * \f$[\eta_{\min}, \eta_{\max}]\f$; before the first update it is
+ * \f$\eta_{\max}\f$.
+ *
+ */
+class InnerToleranceEisenstatWalker : public InnerToleranceI {
+ public:
+  /*! \brief Constructor.
+   *
+   * \param min_tolerance tightest tolerance that will be returned.
+   * \param max_tolerance loosest tolerance, used for the first outer iteration.
+   * \param gamma Eisenstat-Walker scaling factor, \f$\gamma \in (0, 1]\f$.
+   * \param alpha Eisenstat-Walker exponent, \f$\alpha \in (1, 2]\f$.
+   * \param outer_factor factor \f$c\f$ relating the inner tolerance to the
+   * outer delta.
+   */
+  explicit InnerToleranceEisenstatWalker(const double min_tolerance,
+                                         const double max_tolerance = 1e-2,
+                                         const double gamma = 0.9,
+                                         const double alpha = 2.0,
+                                         const double outer_factor = 0.1);
+  ~InnerToleranceEisenstatWalker() = default;
+
+  void Update(const double outer_delta) override;
+  double tolerance() const override { return tolerance_; }
+  void Reset() override;
+
+  double min_tolerance() const { return min_tolerance_; }
+  double max_tolerance() const { return max_tolerance_; }
+  double gamma() const { return gamma_; }
+  double alpha() const { return alpha_; }
+  double outer_factor() const { return outer_factor_; }
+
+ private:
+  const double min_tolerance_;
+  const double max_tolerance_;
+  const double gamma_;
+  const double alpha_;
+  const double outer_factor_;
+
+  //! Current inner tolerance
+  double tolerance_;
+  //! Outer delta from the previous update
+  std::optional<double> previous_delta_ = std::nullopt;
+};
+
+} // namespace convergence
+
+} // namespace bart
+
+#endif //BART_SRC_CONVERGENCE_INNER_TOLERANCE_EISENSTAT_WALKER_H_
@@ -0,0 +1,39 @@
+#ifndef BART_SRC_CONVERGENCE_INNER_TOLERANCE_I_H_
+#define BART_SRC_CONVERGENCE_INNER_TOLERANCE_I_H_
+
+namespace bart {
+
+namespace convergence {
+
+/*! \brief Interface for policies that set the tolerance of inner solves.
+ *
+ * Inner solves (in-group source iterations and the linear solves inside them)
+ * do not need to be converged tightly while the outer iteration is still far
+ * from converged. Classes implementing this interface are updated with the
+ * change in the outer iteration parameter and provide a relative tolerance
+ * that inner solvers may use in place of their fixed tolerance.
+ *
+ */
+class InnerToleranceI {
+ public:
+  virtual ~InnerToleranceI() = default;
+
+  /*! \brief Update the inner tolerance using the last outer iteration delta.
+   *
+   * \param outer_delta change in the outer iteration parameter from the last
+   * outer iteration.
+   */
+  virtual void Update(const double outer_delta) = 0;
+
+  /*! \brief Returns the current relative inner tolerance. */
+  virtual double tolerance() const = 0;
+
+  /*! \brief Resets to the initial (loosest) tolerance. */
+  virtual void Reset() = 0;
+};
+
+} // namespace convergence
+
+} // namespace bart
+
+#endif //BART_SRC_CONVERGENCE_INNER_TOLERANCE_I_H_
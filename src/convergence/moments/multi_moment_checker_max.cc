@@ -26,7 +26,7 @@ bool MultiMomentCheckerMax::CheckIfConverged(
     // Check that l = m = 0 (scalar flux)
     if (index[1] == 0 && index[2] == 0) {
       try {
-        auto current_moment = current_iteration.at(index);
+        const auto& current_moment = current_iteration.at(index);
 
         if (!checker_->CheckIfConverged(current_moment, previous_moment)) {
           is_converged_ = false;
@@ -1,5 +1,7 @@
 #include "convergence/moments/single_moment_checker_l1_norm.h"
 
+#include <algorithm>
+
 namespace bart {
 
 namespace convergence {
@@ -9,10 +11,18 @@ namespace moments {
 bool SingleMomentCheckerL1Norm::CheckIfConverged(
     const system::moments::MomentVector &current_iteration,
     const system::moments::MomentVector &previous_iteration) {
-  system::moments::MomentVector difference(current_iteration);
+  // Moments may be ghosted, the difference is only taken over the locally
+  // owned entries and the norms are reduced over all processors.
+  system::moments::MomentVector difference;
+  difference.reinit(current_iteration.locally_owned_elements(),
+                    current_iteration.get_mpi_communicator());
+  difference = current_iteration;
   difference -= previous_iteration;
   delta_ = difference.l1_norm()/current_iteration.l1_norm();
-  is_converged_ = delta_ <= max_delta_;
+  double max_delta = max_delta_;
+  if (inner_tolerance_ptr_ != nullptr)
+    max_delta = std::max(max_delta, inner_tolerance_ptr_->tolerance());
+  is_converged_ = delta_ <= max_delta;
   return is_converged_;
 }
 
@@ -1,6 +1,9 @@
 #ifndef BART_SRC_CONVERGENCE_MOMENTS_SINGLE_MOMENT_L1_NORM_H_
 #define BART_SRC_CONVERGENCE_MOMENTS_SINGLE_MOMENT_L1_NORM_H_
 
+#include <memory>
+
+#include "convergence/inner_tolerance_i.h"
 #include "convergence/moments/single_moment_checker_i.h"
 
 namespace bart {
@@ -19,6 +22,10 @@ namespace moments {
  * \f]
  *
  * Convergence is achieved if \f$\Delta_i \leq \Delta_{\text{max}}\f$.
+ *
+ * If an inner tolerance policy is provided, convergence is achieved if
+ * \f$\Delta_i \leq \max(\Delta_{\text{max}}, \eta)\f$ where \f$\eta\f$ is the
+ * current tolerance given by the policy.
  * */
 
 class SingleMomentCheckerL1Norm : public SingleMomentCheckerI {
@@ -29,11 +36,26 @@ class SingleMomentCheckerL1Norm : public SingleMomentCheckerI {
     max_delta_ = max_delta;
   };
 
+  /*! \brief Constructor with an inner tolerance policy that may loosen the
+   * convergence criteria. */
+  SingleMomentCheckerL1Norm(
+      const double max_delta,
+      const std::shared_ptr<InnerToleranceI>& inner_tolerance_ptr)
+      : inner_tolerance_ptr_(inner_tolerance_ptr) {
+    max_delta_ = max_delta;
+  };
+
   ~SingleMomentCheckerL1Norm() = default;
 
   bool CheckIfConverged(
       const system::moments::MomentVector &current_iteration,
       const system::moments::MomentVector &previous_iteration) override;
+
+  InnerToleranceI* inner_tolerance_ptr() const {
+    return inner_tolerance_ptr_.get(); }
+
+ private:
+  std::shared_ptr<InnerToleranceI> inner_tolerance_ptr_ = nullptr;
 };
 
 } // namespace moments
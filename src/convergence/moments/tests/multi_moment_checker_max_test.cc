@@ -38,8 +38,7 @@ void MultiMomentCheckerMaxTest::SetUp() {
     for (int l = 0; l <= max_l; ++l) {
       for (int m = -l; m <= max_l; ++m) {
         auto random_vector = test_helpers::RandomVector(5, 0, 10);
-        bart::system::moments::MomentVector temp_moment(random_vector.cbegin(),
-                                             random_vector.cend());
+        auto temp_moment = test_helpers::MakeMPIVector(random_vector);
         moments_map_one[{group, l, m}] = temp_moment;
         moments_map_two[{group, l, m}] = temp_moment;
       }
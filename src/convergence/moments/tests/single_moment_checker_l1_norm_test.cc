@@ -3,6 +3,7 @@
 
 #include <gtest/gtest.h>
 
+#include "convergence/tests/inner_tolerance_mock.h"
 #include "convergence/tests/single_checker_test.h"
 #include "system/moments/spherical_harmonic_types.h"
 #include "test_helpers/test_helper_functions.h"
@@ -22,13 +23,9 @@ class SingleMomentCheckerL1NormTest :
 };
 
 void SingleMomentCheckerL1NormTest::SetUp() {
-  moment_one.reinit(5);
-  moment_two.reinit(5);
   auto random_vector = test_helpers::RandomVector(5, 0, 2);
-  for (unsigned int i = 0; i < moment_one.size(); ++i) {
-    moment_one(i) = random_vector[i];
-    moment_two(i) = random_vector[i];
-  }
+  moment_one = test_helpers::MakeMPIVector(random_vector);
+  moment_two = test_helpers::MakeMPIVector(random_vector);
 }
 
 TEST_F(SingleMomentCheckerL1NormTest, BaseMethods) {
@@ -43,6 +40,7 @@ TEST_F(SingleMomentCheckerL1NormTest, SameVector) {
 TEST_F(SingleMomentCheckerL1NormTest, OneThresholdAway) {
   double to_add = moment_one.l1_norm() * 0.99 * checker.max_delta();
   moment_two(2) += to_add;
+  moment_two.compress(dealii::VectorOperation::add);
 
   EXPECT_TRUE(checker.CheckIfConverged(moment_one, moment_two));
   EXPECT_TRUE(checker.CheckIfConverged(moment_two, moment_one));
@@ -55,6 +53,7 @@ TEST_F(SingleMomentCheckerL1NormTest, OneThresholdAway) {
 TEST_F(SingleMomentCheckerL1NormTest, TwoThresholdAway) {
   double to_add = moment_one.l1_norm() * 2 * checker.max_delta();
   moment_two(2) += to_add;
+  moment_two.compress(dealii::VectorOperation::add);
 
   EXPECT_FALSE(checker.CheckIfConverged(moment_one, moment_two));
   EXPECT_FALSE(checker.CheckIfConverged(moment_two, moment_one));
@@ -71,10 +70,33 @@ TEST_F(SingleMomentCheckerL1NormTest, SetMaxDelta) {
 
   double to_add = moment_one.l1_norm() * 0.99 * to_set;
   moment_two(2) += to_add;
+  moment_two.compress(dealii::VectorOperation::add);
 
   EXPECT_TRUE(checker.CheckIfConverged(moment_one, moment_two));
   EXPECT_TRUE(checker.CheckIfConverged(moment_two, moment_one));
 
 }
 
+TEST_F(SingleMomentCheckerL1NormTest, InnerTolerance) {
+  auto inner_tolerance_ptr =
+      std::make_shared<bart::convergence::InnerToleranceMock>();
+  bart::convergence::moments::SingleMomentCheckerL1Norm adaptive_checker(
+      1e-6, inner_tolerance_ptr);
+  EXPECT_EQ(adaptive_checker.inner_tolerance_ptr(), inner_tolerance_ptr.get());
+
+  double to_add = moment_one.l1_norm() * 1e-4;
+  moment_two(2) += to_add;
+  moment_two.compress(dealii::VectorOperation::add);
+
+  EXPECT_CALL(*inner_tolerance_ptr, tolerance())
+      .WillOnce(::testing::Return(1e-3))
+      .WillOnce(::testing::Return(1e-5))
+      .WillRepeatedly(::testing::Return(1e-12));
+
+  EXPECT_TRUE(adaptive_checker.CheckIfConverged(moment_two, moment_one));
+  EXPECT_FALSE(adaptive_checker.CheckIfConverged(moment_two, moment_one));
+  EXPECT_FALSE(adaptive_checker.CheckIfConverged(moment_two, moment_one));
+  EXPECT_TRUE(adaptive_checker.CheckIfConverged(moment_one, moment_one));
+}
+
 } // namespace
\ No newline at end of file
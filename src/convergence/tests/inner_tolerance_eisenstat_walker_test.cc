@@ -0,0 +1,88 @@
+#include "convergence/inner_tolerance_eisenstat_walker.h"
+
+#include <cmath>
+
+#include "test_helpers/gmock_wrapper.h"
+
+namespace {
+
+using namespace bart;
+
+class ConvergenceInnerToleranceEisenstatWalkerTest : public ::testing::Test {
+ protected:
+  const double min_tolerance = 1e-10;
+  const double max_tolerance = 1e-2;
+  convergence::InnerToleranceEisenstatWalker test_tolerance{min_tolerance,
+                                                            max_tolerance};
+};
+
+TEST_F(ConvergenceInnerToleranceEisenstatWalkerTest, Constructor) {
+  EXPECT_EQ(test_tolerance.min_tolerance(), min_tolerance);
+  EXPECT_EQ(test_tolerance.max_tolerance(), max_tolerance);
+  EXPECT_EQ(test_tolerance.gamma(), 0.9);
+  EXPECT_EQ(test_tolerance.alpha(), 2.0);
+  EXPECT_EQ(test_tolerance.outer_factor(), 0.1);
+  EXPECT_EQ(test_tolerance.tolerance(), max_tolerance);
+}
+
+TEST_F(ConvergenceInnerToleranceEisenstatWalkerTest, ConstructorBadValues) {
+  using InnerTolerance = convergence::InnerToleranceEisenstatWalker;
+  EXPECT_ANY_THROW({ InnerTolerance test(0); });
+  EXPECT_ANY_THROW({ InnerTolerance test(1e-2, 1e-4); });
+  EXPECT_ANY_THROW({ InnerTolerance test(1e-10, 1e-2, 1.5); });
+  EXPECT_ANY_THROW({ InnerTolerance test(1e-10, 1e-2, 0.9, 1.0); });
+  EXPECT_ANY_THROW({ InnerTolerance test(1e-10, 1e-2, 0.9, 2.0, 0); });
+}
+
+TEST_F(ConvergenceInnerToleranceEisenstatWalkerTest, FirstUpdateLargeDelta) {
+  test_tolerance.Update(1.0);
+  EXPECT_EQ(test_tolerance.tolerance(), max_tolerance);
+}
+
+TEST_F(ConvergenceInnerToleranceEisenstatWalkerTest, FirstUpdateSmallDelta) {
+  test_tolerance.Update(1e-4);
+  EXPECT_NEAR(test_tolerance.tolerance(), 1e-5, 1e-12);
+}
+
+TEST_F(ConvergenceInnerToleranceEisenstatWalkerTest, FastOuterConvergence) {
+  test_tolerance.Update(1.0);
+  test_tolerance.Update(0.5);
+  // gamma * (0.5)^2 = 0.225 is limited by max tolerance
+  EXPECT_EQ(test_tolerance.tolerance(), max_tolerance);
+  test_tolerance.Update(0.005);
+  // gamma * (0.01)^2 = 9e-5, outer_factor * delta = 5e-4
+  EXPECT_NEAR(test_tolerance.tolerance(), 9e-5, 1e-12);
+}
+
+TEST_F(ConvergenceInnerToleranceEisenstatWalkerTest, SlowOuterConvergence) {
+  double outer_delta = 1e-2;
+  double last_tolerance = test_tolerance.tolerance();
+  for (int i = 0; i < 10; ++i) {
+    outer_delta *= 0.9;
+    test_tolerance.Update(outer_delta);
+    EXPECT_LE(test_tolerance.tolerance(), last_tolerance);
+    EXPECT_LE(test_tolerance.tolerance(), 0.1 * outer_delta + 1e-15);
+    last_tolerance = test_tolerance.tolerance();
+  }
+}
+
+TEST_F(ConvergenceInnerToleranceEisenstatWalkerTest, MinimumTolerance) {
+  test_tolerance.Update(1.0);
+  test_tolerance.Update(1e-15);
+  EXPECT_EQ(test_tolerance.tolerance(), min_tolerance);
+}
+
+TEST_F(ConvergenceInnerToleranceEisenstatWalkerTest, Reset) {
+  test_tolerance.Update(1e-8);
+  EXPECT_LT(test_tolerance.tolerance(), max_tolerance);
+  test_tolerance.Reset();
+  EXPECT_EQ(test_tolerance.tolerance(), max_tolerance);
+  test_tolerance.Update(1.0);
+  EXPECT_EQ(test_tolerance.tolerance(), max_tolerance);
+}
+
+TEST_F(ConvergenceInnerToleranceEisenstatWalkerTest, NegativeDelta) {
+  EXPECT_ANY_THROW(test_tolerance.Update(-1.0));
+}
+
+} // namespace
@@ -0,0 +1,23 @@
+#ifndef BART_SRC_CONVERGENCE_TESTS_INNER_TOLERANCE_MOCK_H_
+#define BART_SRC_CONVERGENCE_TESTS_INNER_TOLERANCE_MOCK_H_
+
+#include "convergence/inner_tolerance_i.h"
+
+#include "test_helpers/gmock_wrapper.h"
+
+namespace bart {
+
+namespace convergence {
+
+class InnerToleranceMock : public InnerToleranceI {
+ public:
+  MOCK_METHOD1(Update, void(const double outer_delta));
+  MOCK_CONST_METHOD0(tolerance, double());
+  MOCK_METHOD0(Reset, void());
+};
+
+} // namespace convergence
+
+} // namespace bart
+
+#endif //BART_SRC_CONVERGENCE_TESTS_INNER_TOLERANCE_MOCK_H_
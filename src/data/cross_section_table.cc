@@ -0,0 +1,207 @@
+#include "data/cross_section_table.h"
+
+#include <algorithm>
+#include <set>
+
+#include "common/numbers.h"
+
+namespace bart {
+
+namespace data {
+
+namespace  {
+
+using MaterialID = CrossSectionTable::MaterialID;
+using VectorMap = std::unordered_map<MaterialID, std::vector<double>>;
+using MatrixMap = std::unordered_map<MaterialID, dealii::FullMatrix<double>>;
+using MatrixListMap =
+    std::unordered_map<MaterialID, std::vector<dealii::FullMatrix<double>>>;
+
+void FillVectors(double* const to_fill,
+                 const VectorMap& values,
+                 const std::vector<int>& material_index,
+                 const int n_groups) {
+  for (const auto& [material_id, group_values] : values) {
+    const int offset = material_index[material_id] * n_groups;
+    std::copy(group_values.cbegin(), group_values.cend(), to_fill + offset);
+  }
+}
+
+void FillMatrix(double* const to_fill,
+                const dealii::FullMatrix<double>& matrix,
+                const int n_groups,
+                const double scale = 1.0) {
+  for (unsigned int i = 0; i < matrix.m(); ++i) {
+    for (unsigned int j = 0; j < matrix.n(); ++j)
+      to_fill[i * n_groups + j] = scale * matrix(i, j);
+  }
+}
+
+void FillMatrices(double* const to_fill,
+                  const MatrixMap& values,
+                  const std::vector<int>& material_index,
+                  const int n_groups) {
+  for (const auto& [material_id, matrix] : values) {
+    const int offset = material_index[material_id] * n_groups * n_groups;
+    FillMatrix(to_fill + offset, matrix, n_groups);
+  }
+}
+
+/* Fills the source coefficients (2l + 1)/(4pi) sigma_s,l of moments
+ * l = 1, ..., max_order, stored by moment and then by material. */
+void FillScatteringMoments(double* const to_fill,
+                           const MatrixListMap& values,
+                           const std::vector<int>& material_index,
+                           const int n_materials,
+                           const int n_groups) {
+  const int matrix_size = n_groups * n_groups;
+  for (const auto& [material_id, matrices] : values) {
+    for (std::size_t moment = 0; moment < matrices.size(); ++moment) {
+      const int l = static_cast<int>(moment) + 1;
+      const int offset =
+          (moment * n_materials + material_index[material_id]) * matrix_size;
+      FillMatrix(to_fill + offset, matrices[moment], n_groups,
+                 (2 * l + 1) * bconst::kInvFourPi);
+    }
+  }
+}
+
+/* Appends, for each group g of each material, the incident groups g' for
+ * which any of the given transfer matrices is nonzero. If transpose is false
+ * the transfer into g is entry (g, g'), otherwise (g', g). */
+template <typename SourceGroupLists>
+void FillSourceGroups(
+    SourceGroupLists& to_fill,
+    const std::vector<const double*>& transfers,
+    const int n_materials,
+    const int n_groups,
+    const bool transpose) {
+  for (int material = 0; material < n_materials; ++material) {
+    const int offset = material * n_groups * n_groups;
+    for (int group = 0; group < n_groups; ++group) {
+      for (int group_in = 0; group_in < n_groups; ++group_in) {
+        const int entry = transpose ? group_in * n_groups + group
+                                    : group * n_groups + group_in;
+        const bool is_nonzero = std::any_of(
+            transfers.cbegin(), transfers.cend(),
+            [&](const double* transfer) {
+              return transfer[offset + entry] != 0; });
+        if (is_nonzero)
+          to_fill.groups.push_back(group_in);
+      }
+      to_fill.offsets.push_back(static_cast<int>(to_fill.groups.size()));
+    }
+  }
+}
+
+} // namespace
+
+CrossSectionTable::CrossSectionTable(const MaterialBase& materials,
+                                     const bool use_node_shared_memory) {
+  // Material properties are only held while the table is built
+  const std::vector<VectorMap> vector_maps{
+      materials.GetDiffusionCoef(), materials.GetSigT(),
+      materials.GetInvSigT(), materials.GetQ(), materials.GetQPerSter(),
+      materials.GetNuSigF()};
+  const std::vector<MatrixMap> matrix_maps{
+      materials.GetSigS(), materials.GetSigSPerSter(),
+      materials.GetChiNuSigF(), materials.GetChiNuSigFPerSter()};
+  const auto scattering_moments = materials.GetSigSLegendre();
+  const auto is_material_fissile = materials.GetFissileIDMap();
+
+  // Collect all material IDs and the number of groups
+  std::set<MaterialID> material_ids;
+  for (const auto& vector_map : vector_maps) {
+    for (const auto& [material_id, group_values] : vector_map) {
+      material_ids.insert(material_id);
+      n_groups_ = std::max(n_groups_, static_cast<int>(group_values.size()));
+    }
+  }
+  for (const auto& matrix_map : matrix_maps) {
+    for (const auto& [material_id, matrix] : matrix_map) {
+      material_ids.insert(material_id);
+      n_groups_ = std::max({n_groups_, static_cast<int>(matrix.m()),
+                            static_cast<int>(matrix.n())});
+    }
+  }
+  for (const auto& [material_id, matrices] : scattering_moments) {
+    material_ids.insert(material_id);
+    max_scattering_order_ = std::max(max_scattering_order_,
+                                     static_cast<int>(matrices.size()));
+    for (const auto& matrix : matrices) {
+      n_groups_ = std::max({n_groups_, static_cast<int>(matrix.m()),
+                            static_cast<int>(matrix.n())});
+    }
+  }
+  for (const auto& id_fissile_pair : is_material_fissile)
+    material_ids.insert(id_fissile_pair.first);
+
+  // Dense material indexing
+  material_ids_.assign(material_ids.cbegin(), material_ids.cend());
+  if (!material_ids_.empty()) {
+    AssertThrow(material_ids_.front() >= 0,
+                dealii::ExcMessage("Error in CrossSectionTable, material IDs "
+                                   "must be non-negative"));
+    material_index_.resize(material_ids_.back() + 1, -1);
+  }
+  for (int i = 0; i < n_materials(); ++i)
+    material_index_[material_ids_[i]] = i;
+
+  const int n_materials = this->n_materials();
+  const std::size_t vector_size = n_materials * n_groups_;
+  const std::size_t matrix_size = vector_size * n_groups_;
+  for (int quantity = 0; quantity < kNQuantities; ++quantity) {
+    std::size_t quantity_size = quantity < kSigmaS ? vector_size : matrix_size;
+    if (quantity == kScatteringMomentsPerSter)
+      quantity_size *= max_scattering_order_;
+    offsets_[quantity + 1] = offsets_[quantity] + quantity_size;
+  }
+
+  is_material_fissile_.resize(n_materials, false);
+  for (const auto& [material_id, is_fissile] : is_material_fissile)
+    is_material_fissile_[material_index_[material_id]] = is_fissile;
+
+  auto fill_values = [&](double* const to_fill) {
+    std::fill(to_fill, to_fill + offsets_[kNQuantities], 0.0);
+    for (int quantity = 0; quantity < kSigmaS; ++quantity) {
+      FillVectors(to_fill + offsets_[quantity], vector_maps[quantity],
+                  material_index_, n_groups_);
+    }
+    for (int quantity = kSigmaS; quantity < kScatteringMomentsPerSter;
+         ++quantity) {
+      FillMatrices(to_fill + offsets_[quantity],
+                   matrix_maps[quantity - kSigmaS], material_index_,
+                   n_groups_);
+    }
+    FillScatteringMoments(to_fill + offsets_[kScatteringMomentsPerSter],
+                          scattering_moments, material_index_, n_materials,
+                          n_groups_);
+  };
+
+  if (use_node_shared_memory) {
+    shared_values_ = std::make_shared<utility::NodeSharedArray<double>>(
+        offsets_[kNQuantities], fill_values);
+  } else {
+    local_values_.resize(offsets_[kNQuantities]);
+    fill_values(local_values_.begin());
+  }
+
+  const double* all_values = values();
+  std::vector<const double*> scattering_transfers{
+      all_values + offsets_[kSigmaS], all_values + offsets_[kSigmaSPerSter]};
+  for (int moment = 0; moment < max_scattering_order_; ++moment) {
+    scattering_transfers.push_back(all_values +
+                                   offsets_[kScatteringMomentsPerSter] +
+                                   moment * matrix_size);
+  }
+  FillSourceGroups(scattering_sources_, scattering_transfers,
+                   n_materials, n_groups_, false);
+  FillSourceGroups(fission_sources_,
+                   {all_values + offsets_[kFissTransfer],
+                    all_values + offsets_[kFissTransferPerSter]},
+                   n_materials, n_groups_, true);
+}
+
+} // namespace data
+
+} // namespace bart
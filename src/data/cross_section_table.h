@@ -0,0 +1,202 @@
+#ifndef BART_SRC_DATA_CROSS_SECTION_TABLE_H_
+#define BART_SRC_DATA_CROSS_SECTION_TABLE_H_
+
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/array_view.h>
+#include <deal.II/base/exceptions.h>
+
+#include "material/material_base.h"
+#include "utility/node_shared_array.h"
+
+namespace bart {
+
+namespace data {
+
+/*! \brief Dense structure-of-arrays storage of cross-sections.
+ *
+ * Material IDs are mapped to a dense material index \f$k\f$ once, after which
+ * every quantity is read from a contiguous, cache-aligned array without hashing
+ * or copying. Group-wise quantities are stored as \f$[k][g]\f$ and group
+ * transfer matrices as \f$[k][i][j]\f$, using the same row and column
+ * convention as the matrices provided by MaterialBase. All materials share the
+ * same number of groups, quantities that are missing for a material (for
+ * example fission data of a non-fissile material) are zero.
+ *
+ * Anisotropic scattering is stored as the source coefficients
+ * \f$(2\ell + 1)\sigma_{\mathrm{s},\ell}/(4\pi)\f$ of the Legendre moments
+ * \f$\ell = 1, \dots, L\f$ of the scattering matrices, \f$L\f$ is the highest
+ * moment provided for any material.
+ *
+ * Transfer matrices of large group structures are mostly zero (down-scatter
+ * libraries are lower-triangular bands). For each material and group the table
+ * therefore also stores the ascending list of incident groups with a nonzero
+ * transfer into that group, so source terms only visit contributing groups.
+ *
+ * All values are held in a single contiguous buffer. If constructed with
+ * node-shared storage the buffer is allocated once per compute node in an MPI
+ * shared-memory window (see utility::NodeSharedArray) and all ranks on the
+ * node read from the same memory.
+ *
+ * \code{cpp}
+ * const auto& table = cross_sections.table;
+ * const int material = table.MaterialIndex(cell->material_id());
+ * const double sigma_t = table.sigma_t(material)[group];
+ * for (const int group_in : table.scattering_source_groups(material, group))
+ *   source += table.sigma_s(material)(group, group_in) * phi[group_in];
+ * \endcode
+ */
+class CrossSectionTable {
+ public:
+  using MaterialID = int;
+  using VectorView = dealii::ArrayView<const double>;
+  using GroupList = dealii::ArrayView<const int>;
+
+  /*! \brief Non-owning view of a square group transfer matrix. */
+  class MatrixView {
+   public:
+    MatrixView(const double* data, const int n_groups)
+        : data_(data), n_groups_(n_groups) {}
+    double operator()(const int row, const int column) const {
+      return data_[row * n_groups_ + column]; }
+    VectorView row(const int row) const {
+      return VectorView(data_ + row * n_groups_, n_groups_); }
+   private:
+    const double* data_;
+    const int n_groups_;
+  };
+
+  /*! \brief Builds the table from the properties of materials, if
+   * use_node_shared_memory is true the values are stored once per node.
+   * Collective over MPI_COMM_WORLD in that case. */
+  explicit CrossSectionTable(const MaterialBase& materials,
+                             bool use_node_shared_memory = false);
+
+  /*! \brief Returns the dense index of a material ID, throws if the material
+   * has no cross-sections. */
+  int MaterialIndex(const MaterialID material_id) const {
+    AssertThrow(material_id >= 0 &&
+                material_id < static_cast<int>(material_index_.size()) &&
+                material_index_[material_id] >= 0,
+                dealii::ExcMessage("Error in CrossSectionTable, no "
+                                   "cross-sections for material ID " +
+                                   std::to_string(material_id)));
+    return material_index_[material_id]; }
+
+  VectorView diffusion_coef(const int material_index) const {
+    return Row(kDiffusionCoef, material_index); }
+  VectorView sigma_t(const int material_index) const {
+    return Row(kSigmaT, material_index); }
+  VectorView inverse_sigma_t(const int material_index) const {
+    return Row(kInverseSigmaT, material_index); }
+  VectorView q(const int material_index) const {
+    return Row(kQ, material_index); }
+  VectorView q_per_ster(const int material_index) const {
+    return Row(kQPerSter, material_index); }
+  VectorView nu_sigma_f(const int material_index) const {
+    return Row(kNuSigmaF, material_index); }
+
+  MatrixView sigma_s(const int material_index) const {
+    return Matrix(kSigmaS, material_index); }
+  MatrixView sigma_s_per_ster(const int material_index) const {
+    return Matrix(kSigmaSPerSter, material_index); }
+  MatrixView fiss_transfer(const int material_index) const {
+    return Matrix(kFissTransfer, material_index); }
+  MatrixView fiss_transfer_per_ster(const int material_index) const {
+    return Matrix(kFissTransferPerSter, material_index); }
+
+  /*! \brief Scattering source coefficients of Legendre moment \f$\ell\f$,
+   * \f$(2\ell + 1)\sigma_{\mathrm{s},\ell}/(4\pi)\f$, for
+   * \f$0 \leq \ell \leq L\f$. Moment 0 is sigma_s_per_ster, moments not
+   * provided for a material are zero. */
+  MatrixView scattering_moment_per_ster(const int material_index,
+                                        const int l) const {
+    AssertThrow(l >= 0 && l <= max_scattering_order_,
+                dealii::ExcMessage("Error in CrossSectionTable, no scattering "
+                                   "moment " + std::to_string(l)));
+    if (l == 0)
+      return sigma_s_per_ster(material_index);
+    return MatrixView(values() + offsets_[kScatteringMomentsPerSter] +
+                      ((l - 1) * n_materials() + material_index) *
+                      n_groups_ * n_groups_, n_groups_); }
+
+  /*! \brief Incident groups \f$g'\f$ with \f$\sigma_{\mathrm{s},g'\to g}
+   * \neq 0\f$ (nonzero entries of row \f$g\f$ of sigma_s or of any scattering
+   * moment), ascending. */
+  GroupList scattering_source_groups(const int material_index,
+                                     const int group) const {
+    return SourceGroups(scattering_sources_, material_index, group); }
+  /*! \brief Incident groups \f$g'\f$ with a nonzero fission transfer into
+   * group \f$g\f$ (nonzero entries of column \f$g\f$ of fiss_transfer),
+   * ascending. */
+  GroupList fission_source_groups(const int material_index,
+                                  const int group) const {
+    return SourceGroups(fission_sources_, material_index, group); }
+
+  bool is_material_fissile(const int material_index) const {
+    return is_material_fissile_[material_index]; }
+
+  int n_materials() const { return static_cast<int>(material_ids_.size()); }
+  int n_groups() const { return n_groups_; }
+  /*! \brief Highest Legendre moment \f$L\f$ of scattering, 0 if all materials
+   * scatter isotropically. */
+  int max_scattering_order() const { return max_scattering_order_; }
+  /*! \brief Material IDs, ordered by dense material index. */
+  const std::vector<MaterialID>& material_ids() const { return material_ids_; }
+  /*! \brief Returns true if the values are stored in node-shared memory. */
+  bool is_node_shared() const { return shared_values_ != nullptr; }
+
+ private:
+  //! Quantities stored in the value buffer, in buffer order
+  enum Quantity {
+    kDiffusionCoef = 0, kSigmaT, kInverseSigmaT, kQ, kQPerSter, kNuSigmaF,
+    kSigmaS, kSigmaSPerSter, kFissTransfer, kFissTransferPerSter,
+    kScatteringMomentsPerSter, kNQuantities
+  };
+
+  /*! \brief Compressed lists of contributing incident groups, the list for
+   * material \f$k\f$ and group \f$g\f$ is
+   * groups[offsets[k*G + g]] to groups[offsets[k*G + g + 1]]. */
+  struct SourceGroupLists {
+    std::vector<int> offsets{0};
+    std::vector<int> groups;
+  };
+
+  GroupList SourceGroups(const SourceGroupLists& lists,
+                         const int material_index, const int group) const {
+    const int list = material_index * n_groups_ + group;
+    return GroupList(lists.groups.data() + lists.offsets[list],
+                     lists.offsets[list + 1] - lists.offsets[list]); }
+  const double* values() const {
+    return shared_values_ ? shared_values_->data() : local_values_.data(); }
+  VectorView Row(const Quantity quantity, const int material_index) const {
+    return VectorView(values() + offsets_[quantity] +
+                      material_index * n_groups_, n_groups_); }
+  MatrixView Matrix(const Quantity quantity, const int material_index) const {
+    return MatrixView(values() + offsets_[quantity] +
+                      material_index * n_groups_ * n_groups_, n_groups_); }
+
+  int n_groups_ = 0;
+  int max_scattering_order_ = 0;
+  std::vector<MaterialID> material_ids_;
+  std::vector<int> material_index_;
+
+  //! Offset of each quantity in the value buffer
+  std::array<std::size_t, kNQuantities + 1> offsets_{};
+  //! Value buffer if stored per rank
+  dealii::AlignedVector<double> local_values_;
+  //! Value buffer if stored per node
+  std::shared_ptr<utility::NodeSharedArray<double>> shared_values_ = nullptr;
+  std::vector<bool> is_material_fissile_;
+  SourceGroupLists scattering_sources_, fission_sources_;
+};
+
+} // namespace data
+
+} // namespace bart
+
+#endif // BART_SRC_DATA_CROSS_SECTION_TABLE_H_
@@ -1,54 +1,80 @@
 #ifndef BART_SRC_DATA_CROSS_SECTIONS_H_
 #define BART_SRC_DATA_CROSS_SECTIONS_H_
 
-#include <unordered_map>
-#include <vector>
-
-#include <deal.II/lac/full_matrix.h>
-
 #include "../material/material_base.h"
+#include "data/cross_section_table.h"
 
 namespace bart {
 
 namespace data {
 
+/*! \brief Cross-sections of all materials, accessed by material ID.
+ *
+ * All values are stored only in the dense table, the accessors read directly
+ * from it. No per-material maps are retained after construction, so if the
+ * table is stored in node-shared memory each rank only holds the material
+ * indexing.
+ */
 struct CrossSections {
   typedef int MaterialID;
-  
-  CrossSections(MaterialBase &materials);
+  using VectorView = CrossSectionTable::VectorView;
+  using MatrixView = CrossSectionTable::MatrixView;
+
+  /*! If use_node_shared_memory is true the dense table is stored once per
+   * compute node, construction is then collective over MPI_COMM_WORLD. */
+  CrossSections(MaterialBase &materials, bool use_node_shared_memory = false);
 
-  //! Diffusion coefficient of all groups for all materials.
-  const std::unordered_map<MaterialID, std::vector<double>> diffusion_coef;
+  //! Diffusion coefficient of all groups for a material.
+  VectorView diffusion_coef(const MaterialID id) const {
+    return table.diffusion_coef(table.MaterialIndex(id)); }
 
-  //! \f$\sigma_\mathrm{t}\f$ of all groups for all materials.
-  const std::unordered_map<MaterialID, std::vector<double>> sigma_t;
+  //! \f$\sigma_\mathrm{t}\f$ of all groups for a material.
+  VectorView sigma_t(const MaterialID id) const {
+    return table.sigma_t(table.MaterialIndex(id)); }
 
-  //! \f$1/\sigma_\mathrm{t}\f$ of all groups for all materials.
-  const std::unordered_map<MaterialID, std::vector<double>> inverse_sigma_t;
+  //! \f$1/\sigma_\mathrm{t}\f$ of all groups for a material.
+  VectorView inverse_sigma_t(const MaterialID id) const {
+    return table.inverse_sigma_t(table.MaterialIndex(id)); }
 
-  //! Scattering matrices for all materials (i.e. \f$\sigma_\mathrm{s,g'\to g}\f$).
-  const std::unordered_map<MaterialID, dealii::FullMatrix<double>> sigma_s;
+  //! Scattering matrix for a material (i.e. \f$\sigma_\mathrm{s,g'\to g}\f$).
+  MatrixView sigma_s(const MaterialID id) const {
+    return table.sigma_s(table.MaterialIndex(id)); }
 
   //! \f$\sigma_\mathrm{s,g'\to g}/(4\pi)\f$
-  const std::unordered_map<MaterialID, dealii::FullMatrix<double>> sigma_s_per_ster;
+  MatrixView sigma_s_per_ster(const MaterialID id) const {
+    return table.sigma_s_per_ster(table.MaterialIndex(id)); }
 
-  //! \f$Q\f$ values of all groups for all materials.
-  const std::unordered_map<MaterialID, std::vector<double>> q;
+  //! \f$(2\ell + 1)\sigma_{\mathrm{s},\ell,g'\to g}/(4\pi)\f$ for Legendre moment \f$\ell\f$
+  MatrixView scattering_moment_per_ster(const MaterialID id,
+                                        const int l) const {
+    return table.scattering_moment_per_ster(table.MaterialIndex(id), l); }
 
-  //! \f$Q/(4\pi)\f$ values of all groups for all materials.
-  const std::unordered_map<MaterialID, std::vector<double>> q_per_ster;
+  //! \f$Q\f$ values of all groups for a material.
+  VectorView q(const MaterialID id) const {
+    return table.q(table.MaterialIndex(id)); }
 
-  const std::unordered_map<MaterialID, bool> is_material_fissile;
+  //! \f$Q/(4\pi)\f$ values of all groups for a material.
+  VectorView q_per_ster(const MaterialID id) const {
+    return table.q_per_ster(table.MaterialIndex(id)); }
 
-  //! \f$\nu\sigma_\mathrm{f}\f$ of all groups for all fissile materials.
-  const std::unordered_map<MaterialID, std::vector<double>> nu_sigma_f;
+  bool is_material_fissile(const MaterialID id) const {
+    return table.is_material_fissile(table.MaterialIndex(id)); }
 
-  //! \f$\chi\nu\sigma_\mathrm{f}\f$ of all incident and outgoing groups for fissile materials.
-  const std::unordered_map<MaterialID, dealii::FullMatrix<double>> fiss_transfer;
+  //! \f$\nu\sigma_\mathrm{f}\f$ of all groups, zero for non-fissile materials.
+  VectorView nu_sigma_f(const MaterialID id) const {
+    return table.nu_sigma_f(table.MaterialIndex(id)); }
+
+  //! \f$\chi\nu\sigma_\mathrm{f}\f$ of all incident and outgoing groups, zero for non-fissile materials.
+  MatrixView fiss_transfer(const MaterialID id) const {
+    return table.fiss_transfer(table.MaterialIndex(id)); }
+
+  //! \f$\chi\nu\sigma_\mathrm{f}/(4\pi)\f$, zero for non-fissile materials.
+  MatrixView fiss_transfer_per_ster(const MaterialID id) const {
+    return table.fiss_transfer_per_ster(table.MaterialIndex(id)); }
+
+  //! Dense storage of all cross-sections, for lookups in assembly loops.
+  const CrossSectionTable table;
 
-  //! \f$\chi\nu\sigma_\mathrm{f}/(4\pi)\f$ for fissile materials.
-  const std::unordered_map<MaterialID, dealii::FullMatrix<double>> fiss_transfer_per_ster;
-  
 }; 
   
 } // namespace data
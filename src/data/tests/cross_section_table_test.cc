@@ -0,0 +1,212 @@
+#include "data/cross_section_table.h"
+
+#include <cmath>
+#include <unordered_map>
+#include <vector>
+
+#include <deal.II/base/exceptions.h>
+#include <deal.II/lac/full_matrix.h>
+
+#include "data/cross_sections.h"
+#include "material/tests/mock_material.h"
+#include "test_helpers/gmock_wrapper.h"
+#include "test_helpers/test_helper_functions.h"
+
+namespace {
+
+using namespace bart;
+using ::testing::Return, ::testing::DoubleEq;
+
+class CrossSectionTableTest : public ::testing::Test {
+ protected:
+  using IdVectorMap = std::unordered_map<int, std::vector<double>>;
+  using IdMatrixMap = std::unordered_map<int, dealii::FullMatrix<double>>;
+
+  void SetUp() override;
+
+  ::testing::NiceMock<btest::MockMaterial> mock_material_;
+
+  // Material 1 is fissile, material 4 is not and has no fission data
+  IdVectorMap sigma_t_map_{{1, {1.0, 2.0}}, {4, {3.0, 4.0}}};
+  IdVectorMap nu_sigma_f_map_{{1, {0.5, 0.25}}};
+  IdMatrixMap sigma_s_map_{
+      {1, test_helpers::RandomMatrix(2, 2)},
+      {4, test_helpers::RandomMatrix(2, 2)}};
+  IdMatrixMap fiss_transfer_map_{{1, test_helpers::RandomMatrix(2, 2)}};
+  std::unordered_map<int, bool> fissile_id_map_{{1, true}, {4, false}};
+};
+
+void CrossSectionTableTest::SetUp() {
+  ON_CALL(mock_material_, GetSigT()).WillByDefault(Return(sigma_t_map_));
+  ON_CALL(mock_material_, GetNuSigF()).WillByDefault(Return(nu_sigma_f_map_));
+  ON_CALL(mock_material_, GetSigS()).WillByDefault(Return(sigma_s_map_));
+  ON_CALL(mock_material_, GetChiNuSigF())
+      .WillByDefault(Return(fiss_transfer_map_));
+  ON_CALL(mock_material_, GetFissileIDMap())
+      .WillByDefault(Return(fissile_id_map_));
+}
+
+TEST_F(CrossSectionTableTest, DenseIndexing) {
+  data::CrossSections cross_sections(mock_material_);
+  const auto& table = cross_sections.table;
+
+  EXPECT_EQ(table.n_materials(), 2);
+  EXPECT_EQ(table.n_groups(), 2);
+  EXPECT_EQ(table.material_ids(), std::vector<int>({1, 4}));
+  EXPECT_EQ(table.MaterialIndex(1), 0);
+  EXPECT_EQ(table.MaterialIndex(4), 1);
+}
+
+TEST_F(CrossSectionTableTest, ValuesMatchCrossSections) {
+  data::CrossSections cross_sections(mock_material_);
+  const auto& table = cross_sections.table;
+
+  for (const int material_id : {1, 4}) {
+    const int material = table.MaterialIndex(material_id);
+    EXPECT_EQ(table.is_material_fissile(material),
+              fissile_id_map_.at(material_id));
+    for (int i = 0; i < 2; ++i) {
+      EXPECT_THAT(table.sigma_t(material)[i],
+                  DoubleEq(sigma_t_map_.at(material_id).at(i)));
+      for (int j = 0; j < 2; ++j) {
+        EXPECT_THAT(table.sigma_s(material)(i, j),
+                    DoubleEq(sigma_s_map_.at(material_id)(i, j)));
+        EXPECT_THAT(table.sigma_s(material).row(i)[j],
+                    DoubleEq(sigma_s_map_.at(material_id)(i, j)));
+      }
+    }
+  }
+
+  const int fissile_material = table.MaterialIndex(1);
+  for (int i = 0; i < 2; ++i) {
+    EXPECT_THAT(table.nu_sigma_f(fissile_material)[i],
+                DoubleEq(nu_sigma_f_map_.at(1).at(i)));
+    for (int j = 0; j < 2; ++j) {
+      EXPECT_THAT(table.fiss_transfer(fissile_material)(i, j),
+                  DoubleEq(fiss_transfer_map_.at(1)(i, j)));
+    }
+  }
+}
+
+TEST_F(CrossSectionTableTest, MissingDataIsZero) {
+  data::CrossSections cross_sections(mock_material_);
+  const auto& table = cross_sections.table;
+  const int non_fissile_material = table.MaterialIndex(4);
+
+  for (int i = 0; i < 2; ++i) {
+    EXPECT_EQ(table.nu_sigma_f(non_fissile_material)[i], 0);
+    EXPECT_EQ(table.q(non_fissile_material)[i], 0);
+    for (int j = 0; j < 2; ++j)
+      EXPECT_EQ(table.fiss_transfer(non_fissile_material)(i, j), 0);
+  }
+}
+
+TEST_F(CrossSectionTableTest, ScatteringMoments) {
+  // Material 1 has P_1 and P_2 moments, material 4 scatters isotropically
+  const std::vector<dealii::FullMatrix<double>> legendre_moments{
+      test_helpers::RandomMatrix(2, 2, -1, 1),
+      test_helpers::RandomMatrix(2, 2, -1, 1)};
+  ON_CALL(mock_material_, GetSigSPerSter()).WillByDefault(Return(
+      IdMatrixMap{{1, test_helpers::RandomMatrix(2, 2)},
+                  {4, test_helpers::RandomMatrix(2, 2)}}));
+  ON_CALL(mock_material_, GetSigSLegendre()).WillByDefault(Return(
+      std::unordered_map<int, std::vector<dealii::FullMatrix<double>>>{
+          {1, legendre_moments}}));
+
+  data::CrossSections cross_sections(mock_material_);
+  const auto& table = cross_sections.table;
+  EXPECT_EQ(table.max_scattering_order(), 2);
+
+  for (const int material_id : {1, 4}) {
+    const int material = table.MaterialIndex(material_id);
+    for (int i = 0; i < 2; ++i) {
+      for (int j = 0; j < 2; ++j) {
+        EXPECT_EQ(table.scattering_moment_per_ster(material, 0)(i, j),
+                  table.sigma_s_per_ster(material)(i, j));
+        for (int l = 1; l <= 2; ++l) {
+          const double expected = material_id == 1 ?
+              (2 * l + 1) * legendre_moments.at(l - 1)(i, j) / (4 * M_PI) : 0;
+          EXPECT_THAT(table.scattering_moment_per_ster(material, l)(i, j),
+                      DoubleEq(expected));
+        }
+      }
+    }
+  }
+  EXPECT_ANY_THROW({
+    [[maybe_unused]] auto moment = table.scattering_moment_per_ster(0, 3);
+  });
+}
+
+TEST_F(CrossSectionTableTest, SourceGroups) {
+  // Down-scatter only sigma_s and a fission spectrum only into group 0
+  dealii::FullMatrix<double> down_scatter(3, 3), fiss_transfer(3, 3);
+  down_scatter(0, 0) = 1.0;
+  down_scatter(1, 0) = 0.5;
+  down_scatter(1, 1) = 1.0;
+  down_scatter(2, 1) = 0.5;
+  down_scatter(2, 2) = 1.0;
+  fiss_transfer(1, 0) = 2.0;
+  fiss_transfer(2, 0) = 3.0;
+  ON_CALL(mock_material_, GetSigS())
+      .WillByDefault(Return(IdMatrixMap{{1, down_scatter}}));
+  ON_CALL(mock_material_, GetChiNuSigF())
+      .WillByDefault(Return(IdMatrixMap{{1, fiss_transfer}}));
+  ON_CALL(mock_material_, GetSigT())
+      .WillByDefault(Return(IdVectorMap{{1, {1.0, 1.0, 1.0}}}));
+  ON_CALL(mock_material_, GetNuSigF()).WillByDefault(Return(IdVectorMap{}));
+  ON_CALL(mock_material_, GetFissileIDMap())
+      .WillByDefault(Return(std::unordered_map<int, bool>{{1, true}}));
+
+  data::CrossSections cross_sections(mock_material_);
+  const auto& table = cross_sections.table;
+  const int material = table.MaterialIndex(1);
+  auto to_vector = [](const data::CrossSectionTable::GroupList groups) {
+    return std::vector<int>(groups.begin(), groups.end()); };
+
+  const std::vector<std::vector<int>> expected_scattering{{0}, {0, 1}, {1, 2}};
+  const std::vector<std::vector<int>> expected_fission{{1, 2}, {}, {}};
+  for (int group = 0; group < 3; ++group) {
+    EXPECT_EQ(to_vector(table.scattering_source_groups(material, group)),
+              expected_scattering.at(group));
+    EXPECT_EQ(to_vector(table.fission_source_groups(material, group)),
+              expected_fission.at(group));
+  }
+}
+
+TEST_F(CrossSectionTableTest, NodeSharedMatchesLocalMPI) {
+  data::CrossSections local_cross_sections(mock_material_);
+  data::CrossSections shared_cross_sections(mock_material_, true);
+  const auto& local_table = local_cross_sections.table;
+  const auto& shared_table = shared_cross_sections.table;
+
+  EXPECT_FALSE(local_table.is_node_shared());
+  EXPECT_TRUE(shared_table.is_node_shared());
+  ASSERT_EQ(shared_table.material_ids(), local_table.material_ids());
+  for (int material = 0; material < local_table.n_materials(); ++material) {
+    for (int i = 0; i < local_table.n_groups(); ++i) {
+      EXPECT_EQ(shared_table.sigma_t(material)[i],
+                local_table.sigma_t(material)[i]);
+      EXPECT_EQ(shared_table.nu_sigma_f(material)[i],
+                local_table.nu_sigma_f(material)[i]);
+      for (int j = 0; j < local_table.n_groups(); ++j) {
+        EXPECT_EQ(shared_table.sigma_s(material)(i, j),
+                  local_table.sigma_s(material)(i, j));
+        EXPECT_EQ(shared_table.fiss_transfer(material)(i, j),
+                  local_table.fiss_transfer(material)(i, j));
+      }
+    }
+  }
+}
+
+TEST_F(CrossSectionTableTest, UnknownMaterialThrows) {
+  data::CrossSections cross_sections(mock_material_);
+  const auto& table = cross_sections.table;
+
+  for (const int material_id : {-1, 0, 2, 5, 100}) {
+    EXPECT_ANY_THROW({
+      [[maybe_unused]] auto index = table.MaterialIndex(material_id);
+    });
+  }
+}
+
+} // namespace
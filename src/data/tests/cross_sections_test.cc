@@ -66,18 +66,51 @@ void CrossSectionsTestConstructor::SetUp() {
 
 TEST_F(CrossSectionsTestConstructor, CrossSectionsConstructor) {
   bart::data::CrossSections test_xsections(mock_material_properties);
-  EXPECT_EQ(test_xsections.diffusion_coef, diffusion_coef_map);
-  EXPECT_EQ(test_xsections.sigma_t, sigma_t_map);
-  EXPECT_EQ(test_xsections.inverse_sigma_t, sigma_t_inv_map);
-  EXPECT_EQ(test_xsections.q, q_map);
-  EXPECT_EQ(test_xsections.q_per_ster, q_per_ster_map);
-  EXPECT_EQ(test_xsections.nu_sigma_f, nu_sigf_map);
-  EXPECT_EQ(test_xsections.sigma_s, sig_s_map);
-  EXPECT_EQ(test_xsections.sigma_s_per_ster, sig_s_per_ster_map);
-  EXPECT_EQ(test_xsections.fiss_transfer, chi_nu_sig_f_map);
-  EXPECT_EQ(test_xsections.fiss_transfer_per_ster, chi_nu_sig_f_per_ster_map);
-  EXPECT_EQ(test_xsections.is_material_fissile, fissile_id_map);
+  using VectorView = bart::data::CrossSections::VectorView;
+  using MatrixView = bart::data::CrossSections::MatrixView;
 
+  auto expect_vectors = [](const id_vector_map& expected,
+                           auto accessor) {
+    for (const auto& [id, values] : expected) {
+      // Groups missing from a material are zero
+      const VectorView view = accessor(id);
+      ASSERT_GE(view.size(), values.size());
+      for (unsigned int i = 0; i < view.size(); ++i)
+        EXPECT_EQ(view[i], i < values.size() ? values[i] : 0);
+    }
+  };
+  auto expect_matrices = [](const id_matrix_map& expected,
+                            auto accessor) {
+    for (const auto& [id, matrix] : expected) {
+      const MatrixView view = accessor(id);
+      for (unsigned int i = 0; i < matrix.m(); ++i) {
+        for (unsigned int j = 0; j < matrix.n(); ++j)
+          EXPECT_EQ(view(i, j), matrix(i, j));
+      }
+    }
+  };
+
+  expect_vectors(diffusion_coef_map,
+                 [&](int id) { return test_xsections.diffusion_coef(id); });
+  expect_vectors(sigma_t_map,
+                 [&](int id) { return test_xsections.sigma_t(id); });
+  expect_vectors(sigma_t_inv_map,
+                 [&](int id) { return test_xsections.inverse_sigma_t(id); });
+  expect_vectors(q_map, [&](int id) { return test_xsections.q(id); });
+  expect_vectors(q_per_ster_map,
+                 [&](int id) { return test_xsections.q_per_ster(id); });
+  expect_vectors(nu_sigf_map,
+                 [&](int id) { return test_xsections.nu_sigma_f(id); });
+  expect_matrices(sig_s_map,
+                  [&](int id) { return test_xsections.sigma_s(id); });
+  expect_matrices(sig_s_per_ster_map,
+                  [&](int id) { return test_xsections.sigma_s_per_ster(id); });
+  expect_matrices(chi_nu_sig_f_map,
+                  [&](int id) { return test_xsections.fiss_transfer(id); });
+  expect_matrices(chi_nu_sig_f_per_ster_map, [&](int id) {
+    return test_xsections.fiss_transfer_per_ster(id); });
+  for (const auto& [id, is_fissile] : fissile_id_map)
+    EXPECT_EQ(test_xsections.is_material_fissile(id), is_fissile);
 }
 
 } // namespace
\ No newline at end of file
@@ -0,0 +1,28 @@
+#include "domain/cell_costs.h"
+
+#include <utility>
+
+namespace bart {
+
+namespace domain {
+
+template <int dim>
+typename DefinitionI<dim>::CellCostFunction MaterialCellCosts(
+    std::unordered_map<int, double> material_costs) {
+  return [material_costs = std::move(material_costs)](
+      const typename dealii::Triangulation<dim>::cell_iterator& cell) {
+    const auto cost_it = material_costs.find(cell->material_id());
+    return cost_it == material_costs.cend() ? 1.0 : cost_it->second;
+  };
+}
+
+template DefinitionI<1>::CellCostFunction MaterialCellCosts<1>(
+    std::unordered_map<int, double>);
+template DefinitionI<2>::CellCostFunction MaterialCellCosts<2>(
+    std::unordered_map<int, double>);
+template DefinitionI<3>::CellCostFunction MaterialCellCosts<3>(
+    std::unordered_map<int, double>);
+
+} // namespace domain
+
+} // namespace bart
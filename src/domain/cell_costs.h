@@ -0,0 +1,28 @@
+#ifndef BART_SRC_DOMAIN_CELL_COSTS_H_
+#define BART_SRC_DOMAIN_CELL_COSTS_H_
+
+#include <unordered_map>
+
+#include "domain/definition_i.h"
+
+namespace bart {
+
+namespace domain {
+
+/*! \brief Returns a cell cost function based on the material of each cell.
+ *
+ * Intended for DefinitionI::SetCellCosts, for example to weight fissile cells
+ * that also carry the fission source work more heavily than reflector cells.
+ *
+ * \param material_costs relative cost of the cells of each material ID, cells
+ * of materials not in the map have the default cost of 1.
+ */
+template <int dim>
+typename DefinitionI<dim>::CellCostFunction MaterialCellCosts(
+    std::unordered_map<int, double> material_costs);
+
+} // namespace domain
+
+} // namespace bart
+
+#endif // BART_SRC_DOMAIN_CELL_COSTS_H_
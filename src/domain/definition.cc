@@ -1,19 +1,39 @@
 #include "definition.h"
 
+#include <deal.II/distributed/grid_refinement.h>
+#include <deal.II/distributed/solution_transfer.h>
 #include <deal.II/dofs/dof_tools.h>
 #include <deal.II/lac/sparsity_tools.h>
 #include <deal.II/grid/grid_tools.h>
 #include <deal.II/dofs/dof_renumbering.h>
+#include <deal.II/base/utilities.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+#include "system/shared_structure_sparse_matrix.h"
 
 namespace bart {
 
 namespace domain {
 
+namespace  {
+
+/* Partitioning weight of the cheapest cell, costs are scaled relative to it.
+ * p4est adds this weight to every cell itself, so the cell weight signal
+ * returns only the weight in excess of it. */
+constexpr unsigned int kCellWeightUnit = 1000;
+
+} // namespace
+
 template <int dim>
 Definition<dim>::Definition(
     std::unique_ptr<domain::mesh::MeshI<dim>> mesh,
     std::shared_ptr<domain::finite_element::FiniteElementI<dim>> finite_element,
-    problem::DiscretizationType discretization)
+    problem::DiscretizationType discretization,
+    problem::DoFRenumberingType renumbering)
     : mesh_(std::move(mesh)),                     
       finite_element_(finite_element),
       triangulation_(MPI_COMM_WORLD,
@@ -21,7 +41,8 @@ Definition<dim>::Definition(
                          dealii::Triangulation<dim>::smoothing_on_refinement |
                          dealii::Triangulation<dim>::smoothing_on_coarsening)),
       dof_handler_(triangulation_),
-      discretization_type_(discretization) {
+      discretization_type_(discretization),
+      dof_renumbering_type_(renumbering) {
   std::string description{"Domain, " + std::to_string(dim) + "D"};
   if (discretization == problem::DiscretizationType::kContinuousFEM) {
     description += ", Continuous";
@@ -35,14 +56,16 @@ template <>
 Definition<1>::Definition(
     std::unique_ptr<domain::mesh::MeshI<1>> mesh,
     std::shared_ptr<domain::finite_element::FiniteElementI<1>> finite_element,
-    problem::DiscretizationType discretization)
+    problem::DiscretizationType discretization,
+    problem::DoFRenumberingType renumbering)
     : mesh_(std::move(mesh)),
       finite_element_(finite_element),
       triangulation_(typename dealii::Triangulation<1>::MeshSmoothing(
                          dealii::Triangulation<1>::smoothing_on_refinement |
                              dealii::Triangulation<1>::smoothing_on_coarsening)),
       dof_handler_(triangulation_),
-      discretization_type_(discretization) {
+      discretization_type_(discretization),
+      dof_renumbering_type_(renumbering) {
   std::string description{"Domain, 1D"};
   if (discretization == problem::DiscretizationType::kContinuousFEM) {
     description += ", Continuous";
@@ -58,15 +81,146 @@ Definition<dim>& Definition<dim>::SetUpMesh() {
   AssertThrow(mesh_->has_material_mapping(),
                     dealii::ExcMessage("Mesh object must have initialized material mapping"));
   mesh_->FillTriangulation(triangulation_);
+  // IDs are set on all cells, not only those owned by this process, so they
+  // are kept by cells that move between processes in later repartitions
   mesh_->FillBoundaryID(triangulation_);
   mesh_->FillMaterialID(triangulation_);
   return *this;
 }
 
+template <int dim>
+Definition<dim>& Definition<dim>::SetCellCosts(CellCostFunction cell_cost) {
+  AssertThrow(cell_cost != nullptr,
+              dealii::ExcMessage("Error in Definition::SetCellCosts, cell cost "
+                                 "function must not be empty"));
+  const bool is_connected = (cell_cost_ != nullptr);
+  cell_cost_ = std::move(cell_cost);
+  UpdateMinimumCellCost();
+  if (!is_connected) {
+    triangulation_.signals.cell_weight.connect(
+        [this](const typename dealii::Triangulation<dim>::cell_iterator& cell,
+               const typename TriangulationType<dim>::type::CellStatus) {
+          const unsigned int weight = CellWeight(cell);
+          return weight - std::min(weight, kCellWeightUnit);
+        });
+  }
+  triangulation_.repartition();
+  return *this;
+}
+
+template <>
+Definition<1>& Definition<1>::SetCellCosts(CellCostFunction cell_cost) {
+  AssertThrow(cell_cost != nullptr,
+              dealii::ExcMessage("Error in Definition::SetCellCosts, cell cost "
+                                 "function must not be empty"));
+  cell_cost_ = std::move(cell_cost);
+  UpdateMinimumCellCost();
+  return *this;
+}
+
+template <int dim>
+void Definition<dim>::RefineAndCoarsen(
+    const dealii::Vector<float>& cell_errors,
+    const double refine_fraction,
+    const double coarsen_fraction,
+    const std::vector<system::MPIVector*>& to_transfer) {
+  AssertThrow(cell_errors.size() == triangulation_.n_active_cells(),
+              dealii::ExcMessage("Error in Definition::RefineAndCoarsen, "
+                                 "number of cell errors does not match the "
+                                 "number of active cells"));
+  dealii::parallel::distributed::GridRefinement::
+      refine_and_coarsen_fixed_number(triangulation_, cell_errors,
+                                      refine_fraction, coarsen_fraction);
+
+  // The transfer requires ghosted vectors on the current degrees of freedom
+  const auto n_vectors = to_transfer.size();
+  std::vector<system::MPIVector> ghosted_vectors(n_vectors);
+  std::vector<const system::MPIVector*> ghosted_vector_ptrs;
+  for (std::size_t i = 0; i < n_vectors; ++i) {
+    ghosted_vectors[i].reinit(locally_owned_dofs_, locally_relevant_dofs_,
+                              MPI_COMM_WORLD);
+    ghosted_vectors[i] = *to_transfer[i];
+    ghosted_vector_ptrs.push_back(&ghosted_vectors[i]);
+  }
+
+  dealii::parallel::distributed::SolutionTransfer<dim, system::MPIVector>
+      solution_transfer(dof_handler_);
+  triangulation_.prepare_coarsening_and_refinement();
+  solution_transfer.prepare_for_coarsening_and_refinement(ghosted_vector_ptrs);
+  triangulation_.execute_coarsening_and_refinement();
+  if (cell_cost_ != nullptr)
+    UpdateMinimumCellCost();
+  SetUpDOF();
+
+  std::vector<system::MPIVector> transferred_vectors(n_vectors);
+  std::vector<system::MPIVector*> transferred_vector_ptrs;
+  for (auto& transferred_vector : transferred_vectors) {
+    transferred_vector.reinit(locally_owned_dofs_, MPI_COMM_WORLD);
+    transferred_vector_ptrs.push_back(&transferred_vector);
+  }
+  solution_transfer.interpolate(transferred_vector_ptrs);
+
+  for (std::size_t i = 0; i < n_vectors; ++i) {
+    constraint_matrix_.distribute(transferred_vectors[i]);
+    auto& vector = *to_transfer[i];
+    if (vector.has_ghost_elements()) {
+      vector.reinit(locally_owned_dofs_, locally_relevant_dofs_,
+                    MPI_COMM_WORLD);
+    } else {
+      vector.reinit(locally_owned_dofs_, MPI_COMM_WORLD);
+    }
+    vector = transferred_vectors[i];
+  }
+}
+
+template <>
+void Definition<1>::RefineAndCoarsen(const dealii::Vector<float>&,
+                                     const double, const double,
+                                     const std::vector<system::MPIVector*>&) {
+  AssertThrow(false,
+              dealii::ExcMessage("Error in Definition::RefineAndCoarsen, "
+                                 "adaptive refinement requires a distributed "
+                                 "triangulation and is not available in 1D"));
+}
+
+template <int dim>
+void Definition<dim>::UpdateMinimumCellCost() {
+  double minimum_cost = std::numeric_limits<double>::max();
+  for (const auto& cell : triangulation_.active_cell_iterators()) {
+    if (cell->is_locally_owned())
+      minimum_cost = std::min(minimum_cost, ValidCellCost(cell));
+  }
+  minimum_cell_cost_ = dealii::Utilities::MPI::min(minimum_cost,
+                                                   MPI_COMM_WORLD);
+}
+
+template <int dim>
+double Definition<dim>::ValidCellCost(
+    const typename dealii::Triangulation<dim>::cell_iterator& cell) const {
+  const double cost = cell_cost_(cell);
+  AssertThrow(cost > 0,
+              dealii::ExcMessage("Error in Definition, cell costs must be "
+                                 "> 0"));
+  return cost;
+}
+
+template <int dim>
+unsigned int Definition<dim>::CellWeight(
+    const typename dealii::Triangulation<dim>::cell_iterator& cell) const {
+  // The cheapest cell has the unit weight, so costs below 1 are kept relative
+  // to each other instead of being raised to the default weight
+  return std::max(1u, static_cast<unsigned int>(std::round(
+      ValidCellCost(cell) / minimum_cell_cost_ * kCellWeightUnit)));
+}
+
 template <int dim>
 Definition<dim>& Definition<dim>::SetUpDOF() {
   // Setup dof Handler
+  prototype_matrix_ptr_.reset();
+  local_cells_.clear();
+  total_degrees_of_freedom_ = 0;
   dof_handler_.distribute_dofs(*(finite_element_->finite_element()));
+  RenumberDoFs();
   // Populate dof IndexSets
   locally_owned_dofs_ = dof_handler_.locally_owned_dofs();
   dealii::DoFTools::extract_locally_relevant_dofs(dof_handler_,
@@ -83,6 +237,7 @@ Definition<dim>& Definition<dim>::SetUpDOF() {
     if (cell->is_locally_owned())
       local_cells_.push_back(cell);
   }
+  SortLocalCells();
 
   // Set up dynamic sparsity pattern
   dynamic_sparsity_pattern_.reinit(locally_relevant_dofs_.size(),
@@ -114,46 +269,167 @@ Definition<1>& Definition<1>::SetUpDOF() {
   auto n_mpi_processes = dealii::Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD);
   auto this_process = dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
 
-  dealii::GridTools::partition_triangulation(n_mpi_processes, triangulation_);
+  prototype_matrix_ptr_.reset();
+  local_cells_.clear();
+  total_degrees_of_freedom_ = 0;
+  if (cell_cost_ != nullptr) {
+    std::vector<unsigned int> cell_weights;
+    cell_weights.reserve(triangulation_.n_active_cells());
+    for (const auto& cell : triangulation_.active_cell_iterators())
+      cell_weights.push_back(CellWeight(cell));
+    dealii::GridTools::partition_triangulation(n_mpi_processes, cell_weights,
+                                               triangulation_);
+  } else {
+    dealii::GridTools::partition_triangulation(n_mpi_processes, triangulation_);
+  }
   dof_handler_.distribute_dofs(*(finite_element_)->finite_element());
+  // subdomain_wise keeps the relative order within each subdomain
+  RenumberDoFs();
   dealii::DoFRenumbering::subdomain_wise(dof_handler_);
 
+  // The serial triangulation reports every cell as locally owned, ownership
+  // is given by the subdomain
   for (auto cell = dof_handler_.begin_active();
        cell != dof_handler_.end(); ++cell) {
-    if (cell->is_locally_owned())
+    if (cell->subdomain_id() == this_process)
       local_cells_.push_back(cell);
   }
+  SortLocalCells();
 
-  auto locally_owned_dofs_vector =
+  const auto locally_owned_dofs_vector =
       dealii::DoFTools::locally_owned_dofs_per_subdomain(dof_handler_);
   locally_owned_dofs_ = locally_owned_dofs_vector.at(this_process);
 
+  // Locally relevant dofs are those of the owned cells and their neighbors,
+  // the equivalent of the ghost layer of the distributed triangulation
+  locally_relevant_dofs_ = locally_owned_dofs_;
+  std::vector<dealii::types::global_dof_index> cell_dofs(
+      dof_handler_.get_fe().dofs_per_cell);
+  for (const auto& cell : local_cells_) {
+    cell->get_dof_indices(cell_dofs);
+    locally_relevant_dofs_.add_indices(cell_dofs.cbegin(), cell_dofs.cend());
+    for (unsigned int face = 0; face < dealii::GeometryInfo<1>::faces_per_cell;
+         ++face) {
+      if (cell->at_boundary(face))
+        continue;
+      auto neighbor = cell->neighbor(face);
+      while (neighbor->has_children())
+        neighbor = neighbor->child(1 - face);
+      neighbor->get_dof_indices(cell_dofs);
+      locally_relevant_dofs_.add_indices(cell_dofs.cbegin(), cell_dofs.cend());
+    }
+  }
+  locally_relevant_dofs_.compress();
+
   constraint_matrix_.clear();
+  constraint_matrix_.reinit(locally_relevant_dofs_);
   dealii::DoFTools::make_hanging_node_constraints(dof_handler_,
                                                   constraint_matrix_);
   constraint_matrix_.close();
 
-  dynamic_sparsity_pattern_.reinit(dof_handler_.n_dofs(), dof_handler_.n_dofs());
+  // Only rows of the locally relevant dofs are stored, entries are only added
+  // from the cells of this subdomain
+  dynamic_sparsity_pattern_.reinit(dof_handler_.n_dofs(), dof_handler_.n_dofs(),
+                                   locally_relevant_dofs_);
 
   if (discretization_type_ ==  problem::DiscretizationType::kDiscontinuousFEM) {
     dealii::DoFTools::make_flux_sparsity_pattern(dof_handler_, dynamic_sparsity_pattern_,
-                                                 constraint_matrix_, false);
+                                                 constraint_matrix_, false,
+                                                 this_process);
   } else {
     dealii::DoFTools::make_sparsity_pattern(dof_handler_, dynamic_sparsity_pattern_,
-                                            constraint_matrix_, false);
+                                            constraint_matrix_, false,
+                                            this_process);
   }
 
+  std::vector<dealii::types::global_dof_index> n_locally_owned_dofs_per_processor;
+  for (const auto& owned_dofs : locally_owned_dofs_vector)
+    n_locally_owned_dofs_per_processor.push_back(owned_dofs.n_elements());
+  dealii::SparsityTools::distribute_sparsity_pattern(
+      dynamic_sparsity_pattern_, n_locally_owned_dofs_per_processor,
+      MPI_COMM_WORLD, locally_relevant_dofs_);
+
+  constraint_matrix_.condense(dynamic_sparsity_pattern_);
+
   return *this;
 }
 
+template <int dim>
+void Definition<dim>::RenumberDoFs() {
+  switch (dof_renumbering_type_) {
+    case problem::DoFRenumberingType::kCuthillMcKee: {
+      dealii::DoFRenumbering::Cuthill_McKee(dof_handler_);
+      break;
+    }
+    case problem::DoFRenumberingType::kHilbert: {
+      std::vector<typename dealii::DoFHandler<dim>::active_cell_iterator> cells;
+      std::vector<dealii::Point<dim>> cell_centers;
+      for (const auto& cell : dof_handler_.active_cell_iterators()) {
+        if (cell->is_locally_owned()) {
+          cells.push_back(cell);
+          cell_centers.push_back(cell->center());
+        }
+      }
+      const auto hilbert_indices =
+          dealii::Utilities::inverse_Hilbert_space_filling_curve(cell_centers);
+      std::vector<int> order(cells.size());
+      std::iota(order.begin(), order.end(), 0);
+      std::sort(order.begin(), order.end(), [&](const int lhs, const int rhs) {
+        return hilbert_indices[lhs] < hilbert_indices[rhs]; });
+
+      std::vector<typename dealii::DoFHandler<dim>::active_cell_iterator>
+          cell_order;
+      cell_order.reserve(cells.size());
+      for (const int index : order)
+        cell_order.push_back(cells[index]);
+      dealii::DoFRenumbering::cell_wise(dof_handler_, cell_order);
+      break;
+    }
+    case problem::DoFRenumberingType::kDownstream: {
+      dealii::Tensor<1, dim> direction;
+      for (int i = 0; i < dim; ++i)
+        direction[i] = 1.0 / std::sqrt(static_cast<double>(dim));
+      dealii::DoFRenumbering::downstream(dof_handler_, direction);
+      break;
+    }
+    default:
+      break;
+  }
+}
+
+template <int dim>
+void Definition<dim>::SortLocalCells() {
+  if (dof_renumbering_type_ == problem::DoFRenumberingType::kNone)
+    return;
+  std::vector<dealii::types::global_dof_index> cell_dofs(
+      dof_handler_.get_fe().dofs_per_cell);
+  std::vector<std::pair<dealii::types::global_dof_index,
+                        typename CellRange::value_type>> keyed_cells;
+  keyed_cells.reserve(local_cells_.size());
+  for (const auto& cell : local_cells_) {
+    cell->get_dof_indices(cell_dofs);
+    keyed_cells.emplace_back(
+        *std::min_element(cell_dofs.cbegin(), cell_dofs.cend()), cell);
+  }
+  std::stable_sort(keyed_cells.begin(), keyed_cells.end(),
+                   [](const auto& lhs, const auto& rhs) {
+                     return lhs.first < rhs.first; });
+  for (std::size_t i = 0; i < keyed_cells.size(); ++i)
+    local_cells_[i] = keyed_cells[i].second;
+}
+
 template<int dim>
 std::shared_ptr<system::MPISparseMatrix> Definition<dim>::MakeSystemMatrix() const {
-  auto system_matrix_ptr = std::make_shared<system::MPISparseMatrix>();
-  system_matrix_ptr->reinit(locally_owned_dofs_,
-      locally_owned_dofs_,
-      dynamic_sparsity_pattern_,
-      MPI_COMM_WORLD);
-  return system_matrix_ptr;
+  if (prototype_matrix_ptr_ == nullptr) {
+    prototype_matrix_ptr_ = std::make_shared<system::MPISparseMatrix>();
+    prototype_matrix_ptr_->reinit(locally_owned_dofs_,
+                                  locally_owned_dofs_,
+                                  dynamic_sparsity_pattern_,
+                                  MPI_COMM_WORLD);
+  }
+
+  return std::make_shared<system::SharedStructureSparseMatrix>(
+      *prototype_matrix_ptr_);
 }
 
 template<int dim>
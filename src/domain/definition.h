@@ -62,18 +62,55 @@ template <int dim>
 class Definition : public DefinitionI<dim> {
  public:
   typedef std::vector<typename dealii::DoFHandler<dim>::active_cell_iterator> CellRange;
+  using typename DefinitionI<dim>::CellCostFunction;
   
   /*! \brief Constructor.
    * Takes ownership of injected dependencies (MeshI and FiniteElementI) and
-   * sets the type of discretization (default: continuous FEM).
+   * sets the type of discretization (default: continuous FEM) and the
+   * renumbering of degrees of freedom (default: none).
+   *
+   * Renumbering is applied to the locally owned degrees of freedom in
+   * SetUpDOF, and the local cells are then ordered by their lowest degree of
+   * freedom so that assembly traverses the system matrices and vectors in
+   * order. Options are
+   * - Cuthill-McKee: reduces the bandwidth of the system matrices,
+   * - Hilbert: orders cells along a Hilbert space-filling curve through the
+   *   cell centers,
+   * - downstream: orders cells downstream along the diagonal direction
+   *   \f$(1, \ldots, 1)/\sqrt{d}\f$, which benefits upwind discontinuous
+   *   discretizations.
    */
   Definition(std::unique_ptr<domain::mesh::MeshI<dim>> mesh,
              std::shared_ptr<domain::finite_element::FiniteElementI<dim>> finite_element,
-             problem::DiscretizationType discretization = problem::DiscretizationType::kContinuousFEM);
+             problem::DiscretizationType discretization = problem::DiscretizationType::kContinuousFEM,
+             problem::DoFRenumberingType renumbering = problem::DoFRenumberingType::kNone);
   ~Definition() = default;
 
   Definition<dim>& SetUpDOF() override;
   Definition<dim>& SetUpMesh() override;
+  /*! \brief Partitions cells weighted by their relative cost.
+   *
+   * In 2D and 3D the costs are passed to p4est through the cell weight signal
+   * of the distributed triangulation, which is then repartitioned, p4est calls
+   * the signal again on every later repartition or refinement. In 1D the costs
+   * are used as vertex weights when the triangulation is partitioned in
+   * SetUpDOF.
+   */
+  Definition<dim>& SetCellCosts(CellCostFunction cell_cost) override;
+  /*! \brief Refines and coarsens the distributed triangulation.
+   *
+   * Cells are marked with the fixed number strategy of the distributed grid
+   * refinement, and the vectors are transferred with a distributed
+   * SolutionTransfer and made conforming with the hanging node constraints.
+   * Cell costs set with SetCellCosts are re-applied when p4est repartitions
+   * the refined mesh. Not available in 1D, where the triangulation is not
+   * distributed.
+   */
+  void RefineAndCoarsen(
+      const dealii::Vector<float>& cell_errors,
+      double refine_fraction,
+      double coarsen_fraction,
+      const std::vector<system::MPIVector*>& to_transfer) override;
 
   dealii::FullMatrix<double> GetCellMatrix() const override {
     int cell_dofs = finite_element_->dofs_per_cell();
@@ -87,6 +124,14 @@ class Definition : public DefinitionI<dim> {
     return vector;
   }
 
+  /*! \brief Get an MPI matrix suitable for the system.
+   *
+   * The first call builds a prototype matrix from the sparsity pattern, every
+   * returned matrix is a system::SharedStructureSparseMatrix, a values-only
+   * duplicate of the prototype that shares its nonzero structure (row pointers
+   * and column indices), so the structure is stored once for all
+   * (group, angle) system matrices.
+   */
   std::shared_ptr<system::MPISparseMatrix> MakeSystemMatrix() const override;
 
   std::shared_ptr<system::MPIVector> MakeSystemVector() const override;
@@ -96,16 +141,37 @@ class Definition : public DefinitionI<dim> {
   problem::DiscretizationType discretization_type() const override {
     return discretization_type_; }
 
+  problem::DoFRenumberingType dof_renumbering_type() const {
+    return dof_renumbering_type_; }
+
   int total_degrees_of_freedom() const override ;
 
   dealii::IndexSet locally_owned_dofs() const override {
     return locally_owned_dofs_; }
 
+  dealii::IndexSet locally_relevant_dofs() const override {
+    return locally_relevant_dofs_; }
+
 
   const dealii::DoFHandler<dim>& dof_handler() const override {
     return dof_handler_; }
+
+  const dealii::AffineConstraints<double>& constraints() const override {
+    return constraint_matrix_; }
   
  private:
+  //! Applies the DoF renumbering to the distributed degrees of freedom.
+  void RenumberDoFs();
+  //! Orders the local cells by their lowest degree of freedom.
+  void SortLocalCells();
+  //! Integer partitioning weight of a cell from its relative cost.
+  unsigned int CellWeight(
+      const typename dealii::Triangulation<dim>::cell_iterator& cell) const;
+  //! Cost of a cell, throws if it is not positive.
+  double ValidCellCost(
+      const typename dealii::Triangulation<dim>::cell_iterator& cell) const;
+  //! Sets the minimum cost over all active cells of all processes.
+  void UpdateMinimumCellCost();
 
   //! Internal owned mesh object.
   std::unique_ptr<domain::mesh::MeshI<dim>> mesh_;
@@ -137,11 +203,26 @@ class Definition : public DefinitionI<dim> {
   /*! Dynamic sparsity pattern for MPI matrices */
   dealii::DynamicSparsityPattern dynamic_sparsity_pattern_;
 
+  /*! Prototype system matrix holding the shared nonzero structure, built on
+   * the first call to MakeSystemMatrix and reset by SetUpDOF */
+  mutable std::shared_ptr<system::MPISparseMatrix> prototype_matrix_ptr_;
+
   /*! local cells */
   CellRange local_cells_;
 
+  /*! Relative cost of each cell used for partitioning, empty if cells are
+   * partitioned by count */
+  CellCostFunction cell_cost_;
+
+  /*! Minimum cell cost, weights are relative to it so that costs below 1 are
+   * distinguished */
+  double minimum_cell_cost_ = 1.0;
+
   /*! Discretization type */
   const problem::DiscretizationType discretization_type_;
+
+  /*! DoF renumbering type */
+  const problem::DoFRenumberingType dof_renumbering_type_;
 };
 
 } // namespace domain
@@ -1,10 +1,13 @@
 #ifndef BART_SRC_DOMAIN_DEFINITION_I_H_
 #define BART_SRC_DOMAIN_DEFINITION_I_H_
 
+#include <functional>
 #include <vector>
 
 #include <deal.II/dofs/dof_handler.h>
 #include <deal.II/dofs/dof_accessor.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/lac/affine_constraints.h>
 #include <deal.II/lac/full_matrix.h>
 #include <deal.II/lac/vector.h>
 
@@ -41,6 +44,10 @@ template <int dim>
 class DefinitionI : public utility::HasDescription {
  public:
   using CellRange = std::vector<domain::CellPtr<dim>>;
+  /*! Relative computational cost of a cell, a cell with cost 1 is the
+   * default */
+  using CellCostFunction = std::function<double(
+      const typename dealii::Triangulation<dim>::cell_iterator&)>;
 
   virtual ~DefinitionI() = default;
 
@@ -53,6 +60,30 @@ class DefinitionI : public utility::HasDescription {
    */
   virtual DefinitionI<dim>& SetUpMesh() = 0;
 
+  /*! Partitions the cells between processors weighted by their relative
+   * computational cost instead of by cell count. Must be called after
+   * SetUpMesh() and before SetUpDOF(). The costs are re-applied each time the
+   * triangulation is repartitioned, including after refinement.
+   */
+  virtual DefinitionI<dim>& SetCellCosts(CellCostFunction cell_cost) = 0;
+
+  /*! Refines and coarsens the mesh based on an error indicator per active
+   * cell, the degrees of freedom are then set up again and the provided
+   * vectors are interpolated onto the new mesh.
+   *
+   * \param cell_errors error indicator of each active cell.
+   * \param refine_fraction fraction of cells with the largest errors to refine.
+   * \param coarsen_fraction fraction of cells with the smallest errors to
+   * coarsen.
+   * \param to_transfer vectors to interpolate, they are reinitialized with the
+   * new degrees of freedom, ghosted vectors remain ghosted.
+   */
+  virtual void RefineAndCoarsen(
+      const dealii::Vector<float>& cell_errors,
+      double refine_fraction,
+      double coarsen_fraction,
+      const std::vector<system::MPIVector*>& to_transfer) = 0;
+
   /*! Get a matrix suitible for a cell matrix.
    *
    * \return a dealii FullMatrix<double> of appropriate size.
@@ -79,9 +110,18 @@ class DefinitionI : public utility::HasDescription {
   /*! Get locally owned degrees of freedom */
   virtual dealii::IndexSet locally_owned_dofs() const = 0;
 
+  /*! Get locally relevant degrees of freedom, including ghost dofs */
+  virtual dealii::IndexSet locally_relevant_dofs() const = 0;
+
   /*! Get internal DOF object */
   virtual const dealii::DoFHandler<dim>& dof_handler() const = 0;
 
+  /*! Get the hanging node constraints of the degrees of freedom. Cell
+   * contributions are added to system matrices and vectors through these
+   * constraints, and solutions are made conforming with them after each solve.
+   */
+  virtual const dealii::AffineConstraints<double>& constraints() const = 0;
+
   /*! Get total degrees of freedom */
   virtual int total_degrees_of_freedom() const = 0;
 };
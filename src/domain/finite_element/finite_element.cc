@@ -45,7 +45,7 @@ bool FiniteElement<dim>::SetFace(const domain::CellPtr<dim> &to_set,
 }
 template<int dim>
 std::vector<double> FiniteElement<dim>::ValueAtQuadrature(
-    const system::moments::MomentVector moment) const {
+    const system::moments::MomentVector& moment) const {
 
   std::vector<double> return_vector(finite_element_->dofs_per_cell, 0);
 
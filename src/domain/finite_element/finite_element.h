@@ -72,7 +72,7 @@ class FiniteElement : public FiniteElementI<dim> {
     return face_values_->normal_vector(0);
   };
 
-  std::vector<double> ValueAtQuadrature(const system::moments::MomentVector moment) const override;
+  std::vector<double> ValueAtQuadrature(const system::moments::MomentVector& moment) const override;
 
  protected:
   std::shared_ptr<dealii::FiniteElement<dim, dim>> finite_element_;
@@ -135,7 +135,7 @@ class FiniteElementI {
    * \return a vector holding the value of the moment at each quadrature point.
    */
   virtual std::vector<double> ValueAtQuadrature(
-      const system::moments::MomentVector moment) const = 0;
+      const system::moments::MomentVector& moment) const = 0;
 
   // DealII Finite element object access. These methods access the underlying
   // finite element objects.
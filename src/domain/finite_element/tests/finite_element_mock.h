@@ -43,7 +43,7 @@ class FiniteElementMock : public FiniteElementI<dim> {
 
   MOCK_METHOD((dealii::Tensor<1, dim>), FaceNormal, (), (const, override));
 
-  MOCK_METHOD(std::vector<double>, ValueAtQuadrature, (const system::moments::MomentVector moment), (const, override));
+  MOCK_METHOD(std::vector<double>, ValueAtQuadrature, (const system::moments::MomentVector& moment), (const, override));
 
   MOCK_METHOD((dealii::FiniteElement<dim, dim>*), finite_element, (), (override));
 
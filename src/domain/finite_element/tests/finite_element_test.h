@@ -4,6 +4,7 @@
 #include "domain/finite_element/finite_element.h"
 
 #include "test_helpers/test_assertions.h"
+#include "test_helpers/test_helper_functions.h"
 #include "test_helpers/gmock_wrapper.h"
 
 namespace bart {
@@ -103,7 +104,7 @@ void FiniteElementBaseClassTest<dim>::TestValueAtQuadrature(
   int n_dofs = dof_handler_.n_dofs();
 
   std::vector<double> moment_values(n_dofs, 0.5);
-  system::moments::MomentVector test_moment(moment_values.begin(), moment_values.end());
+  auto test_moment = test_helpers::MakeMPIVector(moment_values);
 
   std::vector<double> expected_vector(test_fe->dofs_per_cell(), 0.5);
 
@@ -1,7 +1,13 @@
 #include "domain/mesh/mesh_cartesian.h"
 
 #include <algorithm>
+#include <cctype>
+#include <charconv>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <string_view>
 #include <vector>
 
 #include <deal.II/base/point.h>
@@ -17,11 +23,19 @@ namespace domain {
 
 namespace mesh {
 
+namespace  {
+
+constexpr std::string_view kBinaryMapHeader = "BARTMAP1";
+
+} // namespace
+
 template <int dim>
 MeshCartesian<dim>::MeshCartesian(const std::vector<double> spatial_max,
                                   const std::vector<int> n_cells,
-                                  const std::string material_mapping)
+                                  const std::string material_mapping,
+                                  const bool use_node_shared_memory)
     : MeshCartesian(spatial_max, n_cells) {
+  use_node_shared_memory_ = use_node_shared_memory;
   ParseMaterialMap(material_mapping);
 }
 
@@ -74,44 +88,185 @@ void MeshCartesian<dim>::FillTriangulation(dealii::Triangulation<dim> &to_fill)
 
 template <int dim>
 void MeshCartesian<dim>::ParseMaterialMap(std::string material_mapping) {
-  using dealii::Utilities::split_string_list;
-  using dealii::Utilities::string_to_int;
-  using StringVector = std::vector<std::string>;
-
-  StringVector z_blocks = split_string_list(material_mapping, "\n\n");
-
-  std::reverse(z_blocks.begin(), z_blocks.end());
-
-  for (unsigned k = 0; k < z_blocks.size(); ++k) {
-    StringVector y_line = split_string_list(z_blocks.at(k), "\n");
-    std::reverse(y_line.begin(), y_line.end());
-    for (unsigned j = 0; j < y_line.size(); ++j) {
-      StringVector x_positions = split_string_list(y_line.at(j), " ");
-      for (unsigned i = 0; i < x_positions.size(); ++i) {
-        std::array<unsigned, 3> index{i, j, k};
-        std::array<int, dim> location;
-        for (int dir = 0; dir < dim; ++dir)
-          location.at(dir) = index.at(dir);
-        material_mapping_[location] = string_to_int(x_positions.at(i));
+  if (material_mapping.compare(0, kBinaryMapHeader.size(),
+                               kBinaryMapHeader) == 0) {
+    ParseBinaryMaterialMap(material_mapping);
+    return;
+  }
+
+  // Material IDs in text order, top line of the first block first
+  std::vector<int> text_ids;
+  std::array<int, 3> n_map{0, 0, 0};
+  int n_lines_in_block = 0;
+  auto end_block = [&]() {
+    if (n_map[1] == 0)
+      n_map[1] = n_lines_in_block;
+    AssertThrow(n_lines_in_block == n_map[1],
+                dealii::ExcMessage("MeshCartesian material map error, all "
+                                   "z-blocks must have the same number of "
+                                   "lines"));
+    ++n_map[2];
+    n_lines_in_block = 0;
+  };
+
+  const char* position = material_mapping.data();
+  const char* const end = position + material_mapping.size();
+  while (position < end) {
+    const char* const line_end = std::find(position, end, '\n');
+    int n_in_line = 0;
+    while (position < line_end) {
+      if (std::isspace(static_cast<unsigned char>(*position))) {
+        ++position;
+        continue;
       }
-      n_material_cells_.at(0) = x_positions.size();
+      int material_id;
+      const auto [next, error] = std::from_chars(position, line_end,
+                                                 material_id);
+      AssertThrow(error == std::errc(),
+                  dealii::ExcMessage("MeshCartesian material map error, bad "
+                                     "material ID"));
+      text_ids.push_back(material_id);
+      ++n_in_line;
+      position = next;
+    }
+
+    if (n_in_line > 0) {
+      if (n_map[0] == 0)
+        n_map[0] = n_in_line;
+      AssertThrow(n_in_line == n_map[0],
+                  dealii::ExcMessage("MeshCartesian material map error, all "
+                                     "lines must have the same number of "
+                                     "material IDs"));
+      ++n_lines_in_block;
+    } else if (n_lines_in_block > 0) {
+      // A blank line ends a z-block
+      end_block();
     }
-    if (dim > 1)
-      n_material_cells_.at(1) = y_line.size();
+    position = line_end + 1;
   }
+  if (n_lines_in_block > 0)
+    end_block();
 
-  if (dim > 2)
-    n_material_cells_.at(2) = z_blocks.size();
+  if (text_ids.empty()) {
+    SetMaterialGrid(n_map, {});
+    return;
+  }
+  for (int dir = dim; dir < 3; ++dir) {
+    AssertThrow(n_map[dir] == 1,
+                dealii::ExcMessage("MeshCartesian material map error, map has "
+                                   "more dimensions than the mesh"));
+  }
+
+  // Lines and blocks are stored from the top down, the grid from the bottom up
+  const auto [n_x, n_y, n_z] = n_map;
+  std::vector<int> grid(text_ids.size());
+  for (int block = 0; block < n_z; ++block) {
+    for (int line = 0; line < n_y; ++line) {
+      std::copy_n(text_ids.cbegin() + (block * n_y + line) * n_x, n_x,
+                  grid.begin() +
+                      ((n_z - 1 - block) * n_y + n_y - 1 - line) * n_x);
+    }
+  }
+  SetMaterialGrid(n_map, std::move(grid));
+}
+
+template <int dim>
+void MeshCartesian<dim>::ParseBinaryMaterialMap(
+    const std::string& material_mapping) {
+  static_assert(sizeof(int) == sizeof(std::int32_t));
+  std::array<std::int32_t, 3> n_map;
+  const std::size_t header_size = kBinaryMapHeader.size() + sizeof(n_map);
+  AssertThrow(material_mapping.size() >= header_size,
+              dealii::ExcMessage("MeshCartesian material map error, binary "
+                                 "map is truncated"));
+  std::memcpy(n_map.data(), material_mapping.data() + kBinaryMapHeader.size(),
+              sizeof(n_map));
+
+  const std::size_t n_ids = static_cast<std::size_t>(n_map[0]) * n_map[1] *
+      n_map[2];
+  AssertThrow(n_map[0] > 0 && n_map[1] > 0 && n_map[2] > 0 &&
+              material_mapping.size() == header_size + n_ids * sizeof(int),
+              dealii::ExcMessage("MeshCartesian material map error, binary "
+                                 "map size does not match its header"));
+  for (int dir = dim; dir < 3; ++dir) {
+    AssertThrow(n_map[dir] == 1,
+                dealii::ExcMessage("MeshCartesian material map error, map has "
+                                   "more dimensions than the mesh"));
+  }
+
+  std::vector<int> grid(n_ids);
+  std::memcpy(grid.data(), material_mapping.data() + header_size,
+              n_ids * sizeof(int));
+  SetMaterialGrid(n_map, std::move(grid));
+}
+
+template <int dim>
+void MeshCartesian<dim>::SetMaterialGrid(const std::array<int, 3> n_map,
+                                         std::vector<int>&& grid) {
+  n_material_blocks_ = grid.size();
+  if (n_material_blocks_ > 0) {
+    for (int dir = 0; dir < dim; ++dir) {
+      n_material_cells_[dir] = n_map[dir];
+      material_cell_size_[dir] = spatial_max_[dir] / n_material_cells_[dir];
+    }
+  }
+
+  shared_material_grid_ = nullptr;
+  if (use_node_shared_memory_) {
+    // Collective, every rank parsed the same map but only one copy per node
+    // is kept
+    shared_material_grid_ = std::make_shared<utility::NodeSharedArray<int>>(
+        grid.size(), [&grid](int* const to_fill) {
+          std::copy(grid.cbegin(), grid.cend(), to_fill); });
+    local_material_grid_ = std::vector<int>();
+  } else {
+    local_material_grid_ = std::move(grid);
+  }
+}
+
+template <int dim>
+void MeshCartesian<dim>::WriteBinaryMaterialMap(std::ostream& to_write) const {
+  AssertThrow(has_material_mapping(),
+              dealii::ExcMessage("MeshCartesian error, no material map to "
+                                 "write"));
+  std::array<std::int32_t, 3> n_map{1, 1, 1};
+  std::copy(n_material_cells_.cbegin(), n_material_cells_.cend(),
+            n_map.begin());
+  to_write.write(kBinaryMapHeader.data(), kBinaryMapHeader.size());
+  to_write.write(reinterpret_cast<const char*>(n_map.data()), sizeof(n_map));
+  to_write.write(reinterpret_cast<const char*>(material_grid()),
+                 n_material_blocks_ * sizeof(int));
 }
 
 template <int dim>  
 void MeshCartesian<dim>::FillMaterialID(dealii::Triangulation<dim> &to_fill) {
+  AssertThrow(has_material_mapping(),
+              dealii::ExcMessage("MeshCartesian error, no material map"));
+  /* Gather the cell centers so the grid indices are computed in flat loops.
+   * Cells owned by other processes are also filled, cells that move to this
+   * process when the mesh is repartitioned keep their IDs. */
+  std::vector<typename dealii::Triangulation<dim>::active_cell_iterator> cells;
+  std::array<std::vector<double>, dim> centers;
   for (auto cell = to_fill.begin_active(); cell != to_fill.end(); ++cell) {
-    if (cell->is_locally_owned()) {
-      int material_id = GetMaterialID(cell->center());
-      cell->set_material_id(material_id);
-    }
+    cells.push_back(cell);
+    const auto center = cell->center();
+    for (int dir = 0; dir < dim; ++dir)
+      centers[dir].push_back(center[dir]);
   }
+
+  const std::size_t n_local_cells = cells.size();
+  std::vector<int> grid_indices(n_local_cells, 0);
+  for (int dir = dim - 1; dir >= 0; --dir) {
+    const int n_material_cells = n_material_cells_[dir];
+    const double* const coordinates = centers[dir].data();
+    int* const indices = grid_indices.data();
+    for (std::size_t i = 0; i < n_local_cells; ++i)
+      indices[i] = indices[i] * n_material_cells +
+          MaterialCellIndex(dir, coordinates[i]);
+  }
+
+  for (std::size_t i = 0; i < n_local_cells; ++i)
+    cells[i]->set_material_id(material_grid()[grid_indices[i]]);
 }
 
 template <int dim>
@@ -119,9 +274,11 @@ void MeshCartesian<dim>::FillBoundaryID(dealii::Triangulation<dim> &to_fill) {
   using Boundary = bart::problem::Boundary;
   int faces_per_cell = dealii::GeometryInfo<dim>::faces_per_cell;
   double zero_tol = 1.0e-14;
-  
+
+  // Faces of cells owned by other processes are also filled, for cells that
+  // move to this process when the mesh is repartitioned
   for (auto cell = to_fill.begin_active(); cell != to_fill.end(); ++cell) {
-    if (cell->is_locally_owned() && cell->at_boundary()) {
+    if (cell->at_boundary()) {
       for (int face_id = 0; face_id < faces_per_cell; ++face_id) {
         auto face = cell->face(face_id);
         if (face->at_boundary()) {
@@ -180,21 +337,13 @@ int MeshCartesian<dim>::GetMaterialID(dealii::Point<dim> location) {
   
 template <int dim>
 int MeshCartesian<dim>::GetMaterialID(std::array<double, dim> location) {
-  std::array<int, dim> relative_location;
-
-  for (int i = 0; i < dim; ++i) {
-    double cell_size = spatial_max_.at(i)/n_material_cells_.at(i);
-    double cell_location = location.at(i) / cell_size;
-    int cell_index = std::floor(cell_location);
-
-    if (static_cast<double>(cell_index) == cell_location && cell_index != 0) {
-      relative_location.at(i) = cell_index - 1;
-    } else {
-      relative_location.at(i) = cell_index;
-    }
-  }
-  
-  return material_mapping_[relative_location];
+  AssertThrow(has_material_mapping(),
+              dealii::ExcMessage("MeshCartesian error, no material map"));
+  int grid_index = 0;
+  for (int dir = dim - 1; dir >= 0; --dir)
+    grid_index = grid_index * n_material_cells_[dir] +
+        MaterialCellIndex(dir, location[dir]);
+  return material_grid()[grid_index];
 }
 
 template class MeshCartesian<1>;
@@ -1,15 +1,19 @@
 #ifndef BART_SRC_DOMAIN_MESH_CARTESIAN_H_
 #define BART_SRC_DOMAIN_MESH_CARTESIAN_H_
 
+#include <algorithm>
 #include <array>
+#include <cmath>
+#include <memory>
+#include <ostream>
 #include <string>
-#include <map>
 #include <vector>
 
 #include <deal.II/base/point.h>
 #include <deal.II/grid/tria.h>
 
 #include "domain/mesh/mesh_i.h"
+#include "utility/node_shared_array.h"
 
 namespace bart {
 
@@ -17,6 +21,22 @@ namespace domain {
 
 namespace mesh {
 
+/*! \brief Cartesian mesh of a hyper rectangle with a material map.
+ *
+ * The material map divides the mesh into a grid of equally sized material
+ * blocks, stored densely with the x index fastest. The text format has one
+ * line of material IDs per row of blocks, the top line being the largest y,
+ * and one block of lines per z-layer separated by blank lines, the first block
+ * being the largest z. The binary format starts with the eight byte header
+ * "BARTMAP1" followed by the number of blocks in x, y and z and the material
+ * IDs in grid order, all as 32-bit integers in native byte order. Binary maps
+ * are recognized by their header and can be written from a parsed map with
+ * WriteBinaryMaterialMap.
+ *
+ * If constructed with node-shared storage, the parsed grid is stored once per
+ * compute node (see utility::NodeSharedArray) and parsing a map is collective
+ * over MPI_COMM_WORLD.
+ */
 template <int dim>
 class MeshCartesian : public MeshI<dim> {
  public:
@@ -24,13 +44,16 @@ class MeshCartesian : public MeshI<dim> {
                 const std::vector<int> n_cells);
   MeshCartesian(const std::vector<double> spatial_max,
                 const std::vector<int> n_cells,
-                const std::string material_mapping);
+                const std::string material_mapping,
+                const bool use_node_shared_memory = false);
   ~MeshCartesian() = default;
 
   void FillTriangulation(dealii::Triangulation<dim> &to_fill) override;
   /*! \brief Parses a material mapping string that indicates relative locations
-   * of materials */
+   * of materials, in text or binary format */
   void ParseMaterialMap(std::string material_mapping);
+  /*! \brief Writes the parsed material map in binary format */
+  void WriteBinaryMaterialMap(std::ostream& to_write) const;
   void FillMaterialID(dealii::Triangulation<dim> &to_fill) override;
   void FillBoundaryID(dealii::Triangulation<dim> &to_fill) override;
 
@@ -39,18 +62,48 @@ class MeshCartesian : public MeshI<dim> {
     /*! \brief Get the material ID for a given location (dealii Point)*/
   int GetMaterialID(dealii::Point<dim> location);
   bool has_material_mapping() const override {
-    return !material_mapping_.empty(); };
+    return n_material_blocks_ > 0; };
+  /*! \brief Returns true if the material grid is stored in node-shared
+   * memory. */
+  bool is_material_grid_node_shared() const {
+    return shared_material_grid_ != nullptr; }
   /*! \brief Get spatial maximum in each direction */
   std::array<double, dim> spatial_max() const override { return spatial_max_; };
   /*! \brief Get number of cells in each direction */
   std::array<int, dim> n_cells() const override { return n_cells_; };
   std::string description() const override { return description_; }
  private:
+  //! Parses a material map in binary format
+  void ParseBinaryMaterialMap(const std::string& material_mapping);
+  /*! \brief Sets the number and size of material blocks from the map size and
+   * stores the parsed grid */
+  void SetMaterialGrid(std::array<int, 3> n_map,
+                       std::vector<int>&& grid);
+  /*! \brief Index of the material block that contains a coordinate, locations
+   * on the boundary between two blocks are in the lower block */
+  int MaterialCellIndex(const int dir, const double coordinate) const {
+    const double cell_location = coordinate / material_cell_size_[dir];
+    int cell_index = std::floor(cell_location);
+    if (static_cast<double>(cell_index) == cell_location && cell_index != 0)
+      --cell_index;
+    return std::clamp(cell_index, 0, n_material_cells_[dir] - 1); }
+  //! Material ID of each material block, x index fastest
+  const int* material_grid() const {
+    return shared_material_grid_ ? shared_material_grid_->data()
+                                 : local_material_grid_.data(); }
+
   std::string description_ = "";
   std::array<double, dim> spatial_max_;
   std::array<int, dim>    n_material_cells_;
+  std::array<double, dim> material_cell_size_;
   std::array<int, dim>    n_cells_;
-  std::map<std::array<int, dim>, int> material_mapping_;
+  bool use_node_shared_memory_ = false;
+  std::size_t n_material_blocks_ = 0;
+  //! Material grid if stored per rank
+  std::vector<int> local_material_grid_;
+  //! Material grid if stored per node
+  std::shared_ptr<utility::NodeSharedArray<int>> shared_material_grid_ =
+      nullptr;
 };
 
 } // namespace mesh
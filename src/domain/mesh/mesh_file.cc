@@ -0,0 +1,195 @@
+#include "domain/mesh/mesh_file.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <string>
+
+#include <deal.II/grid/grid_in.h>
+
+namespace bart {
+
+namespace domain {
+
+namespace mesh {
+
+namespace  {
+
+/* Broadcasts a vector from the root process, resizing it on the other
+ * processes. */
+template <typename T>
+void Broadcast(std::vector<T>& to_broadcast, MPI_Datatype type,
+               MPI_Comm mpi_communicator) {
+  std::uint64_t size = to_broadcast.size();
+  MPI_Bcast(&size, 1, MPI_UINT64_T, 0, mpi_communicator);
+  to_broadcast.resize(size);
+  if (size > 0)
+    MPI_Bcast(to_broadcast.data(), static_cast<int>(size), type, 0,
+              mpi_communicator);
+}
+
+} // namespace
+
+template <int dim>
+MeshFile<dim>::MeshFile(const std::string& filename,
+                        MPI_Comm mpi_communicator) {
+  int rank;
+  MPI_Comm_rank(mpi_communicator, &rank);
+
+  int is_read = 1;
+  std::string error_message;
+  if (rank == 0) {
+    try {
+      packed_mesh_ = ReadMesh(filename);
+    } catch (const std::exception& exception) {
+      is_read = 0;
+      error_message = exception.what();
+    }
+  }
+
+  // A failure on the root process is reported on all processes
+  MPI_Bcast(&is_read, 1, MPI_INT, 0, mpi_communicator);
+  if (!is_read) {
+    std::vector<char> error_characters(error_message.cbegin(),
+                                       error_message.cend());
+    Broadcast(error_characters, MPI_CHAR, mpi_communicator);
+    AssertThrow(false,
+                dealii::ExcMessage("Error in MeshFile, failed to read mesh "
+                                   "file " + filename + ": " +
+                                   std::string(error_characters.cbegin(),
+                                               error_characters.cend())));
+  }
+
+  Broadcast(packed_mesh_.vertex_coordinates, MPI_DOUBLE, mpi_communicator);
+  Broadcast(packed_mesh_.cells, MPI_UNSIGNED, mpi_communicator);
+  Broadcast(packed_mesh_.boundary_faces, MPI_UNSIGNED, mpi_communicator);
+
+  spatial_max_.fill(std::numeric_limits<double>::lowest());
+  const auto& coordinates = packed_mesh_.vertex_coordinates;
+  for (std::size_t i = 0; i < coordinates.size(); ++i)
+    spatial_max_[i % dim] = std::max(spatial_max_[i % dim], coordinates[i]);
+
+  const int n_coarse_cells = packed_mesh_.cells.size() /
+      (dealii::GeometryInfo<dim>::vertices_per_cell + 1);
+  n_cells_.fill(1);
+  n_cells_[0] = n_coarse_cells;
+
+  description_ = "Mesh from file " + filename + ", " + std::to_string(dim) +
+      "D, N_cells: " + std::to_string(n_coarse_cells);
+}
+
+template <int dim>
+auto MeshFile<dim>::ReadMesh(const std::string& filename) -> PackedMesh {
+  using Format = typename dealii::GridIn<dim>::Format;
+  const std::map<std::string, Format> formats{
+      {"msh", Format::msh}, {"inp", Format::ucd}, {"ucd", Format::ucd},
+      {"vtk", Format::vtk}};
+
+  const auto extension = filename.substr(filename.find_last_of('.') + 1);
+  const auto format_it = formats.find(extension);
+  AssertThrow(format_it != formats.cend(),
+              dealii::ExcMessage("unsupported mesh file extension"));
+
+  std::ifstream mesh_stream(filename);
+  AssertThrow(mesh_stream.good(),
+              dealii::ExcMessage("cannot open mesh file"));
+
+  dealii::Triangulation<dim> coarse_mesh;
+  dealii::GridIn<dim> grid_in;
+  grid_in.attach_triangulation(coarse_mesh);
+  grid_in.read(mesh_stream, format_it->second);
+
+  PackedMesh packed_mesh;
+  for (const auto& vertex : coarse_mesh.get_vertices()) {
+    for (int i = 0; i < dim; ++i)
+      packed_mesh.vertex_coordinates.push_back(vertex[i]);
+  }
+
+  for (const auto& cell : coarse_mesh.active_cell_iterators()) {
+    for (unsigned int v = 0; v < dealii::GeometryInfo<dim>::vertices_per_cell;
+         ++v)
+      packed_mesh.cells.push_back(cell->vertex_index(v));
+    packed_mesh.cells.push_back(cell->material_id());
+
+    // In 1D the boundary vertices are labeled when the mesh is created
+    if constexpr (dim > 1) {
+      for (unsigned int f = 0; f < dealii::GeometryInfo<dim>::faces_per_cell;
+           ++f) {
+        const auto face = cell->face(f);
+        if (!face->at_boundary())
+          continue;
+        // File IDs are shifted by one, ID 0 is left to unlabeled faces
+        const unsigned int file_id = face->boundary_id();
+        AssertThrow(file_id <= 2 * dim,
+                    dealii::ExcMessage("boundary ID " +
+                                       std::to_string(file_id) + " is not a "
+                                       "boundary of a " + std::to_string(dim) +
+                                       "D mesh, IDs must be in [0, " +
+                                       std::to_string(2 * dim) + "]"));
+        for (unsigned int v = 0;
+             v < dealii::GeometryInfo<dim>::vertices_per_face; ++v)
+          packed_mesh.boundary_faces.push_back(face->vertex_index(v));
+        packed_mesh.boundary_faces.push_back(
+            file_id == 0 ? kUnlabeledBoundaryId : file_id - 1);
+      }
+    }
+  }
+  return packed_mesh;
+}
+
+template <int dim>
+void MeshFile<dim>::FillTriangulation(dealii::Triangulation<dim> &to_fill) {
+  const auto& coordinates = packed_mesh_.vertex_coordinates;
+  AssertThrow(!coordinates.empty(),
+              dealii::ExcMessage("Error in MeshFile::FillTriangulation, mesh "
+                                 "description is empty, the triangulation can "
+                                 "only be filled once"));
+
+  std::vector<dealii::Point<dim>> vertices(coordinates.size() / dim);
+  for (std::size_t i = 0; i < coordinates.size(); ++i)
+    vertices[i / dim][i % dim] = coordinates[i];
+
+  const unsigned int vertices_per_cell =
+      dealii::GeometryInfo<dim>::vertices_per_cell;
+  std::vector<dealii::CellData<dim>> cells(
+      packed_mesh_.cells.size() / (vertices_per_cell + 1));
+  auto packed_cell = packed_mesh_.cells.cbegin();
+  for (auto& cell : cells) {
+    for (unsigned int v = 0; v < vertices_per_cell; ++v)
+      cell.vertices[v] = *packed_cell++;
+    cell.material_id = *packed_cell++;
+  }
+
+  dealii::SubCellData subcell_data;
+  if constexpr (dim > 1) {
+    const unsigned int vertices_per_face =
+        dealii::GeometryInfo<dim>::vertices_per_face;
+    const auto& faces = packed_mesh_.boundary_faces;
+    for (std::size_t i = 0; i < faces.size(); i += vertices_per_face + 1) {
+      dealii::CellData<dim - 1> face;
+      for (unsigned int v = 0; v < vertices_per_face; ++v)
+        face.vertices[v] = faces[i + v];
+      face.boundary_id = faces[i + vertices_per_face];
+      if constexpr (dim == 2) {
+        subcell_data.boundary_lines.push_back(face);
+      } else {
+        subcell_data.boundary_quads.push_back(face);
+      }
+    }
+  }
+
+  to_fill.create_triangulation(vertices, cells, subcell_data);
+  packed_mesh_ = PackedMesh();
+}
+
+template class MeshFile<1>;
+template class MeshFile<2>;
+template class MeshFile<3>;
+
+} // namespace mesh
+
+} // namespace domain
+
+} // namespace bart
@@ -0,0 +1,100 @@
+#ifndef BART_SRC_DOMAIN_MESH_MESH_FILE_H_
+#define BART_SRC_DOMAIN_MESH_MESH_FILE_H_
+
+#include <array>
+#include <string>
+#include <vector>
+
+#include <mpi.h>
+
+#include <deal.II/base/point.h>
+#include <deal.II/base/types.h>
+#include <deal.II/grid/tria.h>
+
+#include "domain/mesh/mesh_i.h"
+
+namespace bart {
+
+namespace domain {
+
+namespace mesh {
+
+/*! \brief Mesh read from a Gmsh, UCD or VTK file.
+ *
+ * The file format is given by the extension of the file name (.msh, .inp or
+ * .ucd, and .vtk). Only the root process parses the file, the coarse mesh
+ * description (vertices, cells and labeled boundary faces) is then broadcast
+ * to all processes, which create the triangulation from it without touching
+ * the file. A distributed triangulation then partitions the cells between
+ * processes.
+ *
+ * Material IDs of the cells are read from the file (Gmsh physical tags, UCD
+ * material numbers) and set when the triangulation is filled. Boundary IDs of
+ * boundary faces are also read from the file, file ID \f$n > 0\f$ is the
+ * boundary problem::Boundary with value \f$n - 1\f$ (1 is kXMin, 2 is kXMax,
+ * ...). File ID 0 is the ID of unlabeled faces, they are given the reserved
+ * ID kUnlabeledBoundaryId which is not a problem::Boundary, so they are never
+ * mistaken for kXMin. File IDs beyond the boundaries of the dimension throw.
+ * In 1D the left and right boundaries are problem::Boundary::kXMin and
+ * kXMax.
+ *
+ * Exodus II files are not supported, they require a deal.II built with SEACAS.
+ */
+template <int dim>
+class MeshFile : public MeshI<dim> {
+ public:
+  //! Boundary ID of unlabeled boundary faces, not a problem::Boundary.
+  static constexpr dealii::types::boundary_id kUnlabeledBoundaryId =
+      dealii::numbers::internal_face_boundary_id - 1;
+  /*! \brief Constructor, reads the mesh file on the root process.
+   *
+   * \param filename mesh file name, the format is deduced from the extension.
+   * \param mpi_communicator processes that will share the mesh.
+   */
+  explicit MeshFile(const std::string& filename,
+                    MPI_Comm mpi_communicator = MPI_COMM_WORLD);
+  ~MeshFile() = default;
+
+  /*! \brief Creates the coarse mesh with material and boundary IDs, the mesh
+   * description is released afterwards so this can only be called once. */
+  void FillTriangulation(dealii::Triangulation<dim> &to_fill) override;
+  /*! \brief Material IDs are set by FillTriangulation. */
+  void FillMaterialID(dealii::Triangulation<dim> &) override {};
+  /*! \brief Boundary IDs are set by FillTriangulation. */
+  void FillBoundaryID(dealii::Triangulation<dim> &) override {};
+
+  bool has_material_mapping() const override { return true; };
+  /*! \brief Get the maximum vertex coordinate in each direction */
+  std::array<double, dim> spatial_max() const override { return spatial_max_; };
+  /*! \brief Get the number of coarse cells, unstructured meshes have no cell
+   * count per direction so it is stored in the first entry, all other entries
+   * are 1 */
+  std::array<int, dim> n_cells() const override { return n_cells_; };
+  std::string description() const override { return description_; }
+
+ private:
+  //! Coarse mesh description as flat arrays, for broadcasting
+  struct PackedMesh {
+    std::vector<double> vertex_coordinates;
+    //! Vertex indices followed by the material ID of each cell
+    std::vector<unsigned int> cells;
+    //! Vertex indices followed by the boundary ID of each boundary face
+    std::vector<unsigned int> boundary_faces;
+  };
+
+  //! Reads and packs the mesh, on the root process only.
+  static PackedMesh ReadMesh(const std::string& filename);
+
+  std::string description_ = "";
+  std::array<double, dim> spatial_max_;
+  std::array<int, dim> n_cells_;
+  PackedMesh packed_mesh_;
+};
+
+} // namespace mesh
+
+} // namespace domain
+
+} // namespace bart
+
+#endif // BART_SRC_DOMAIN_MESH_MESH_FILE_H_
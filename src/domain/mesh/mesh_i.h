@@ -20,9 +20,11 @@ class MeshI {
 
   /* \brief Generates the mesh in the triangulation object */
   virtual void FillTriangulation(dealii::Triangulation<dim> &to_fill) = 0;
-  /* \brief Add material IDs to each cell in the triangulation */
+  /* \brief Add material IDs to each cell in the triangulation, including cells
+   * owned by other processes */
   virtual void FillMaterialID(dealii::Triangulation<dim> &to_fill) = 0;
-  /* \brief Add boundary IDs to each boundary face */
+  /* \brief Add boundary IDs to each boundary face, including faces of cells
+   * owned by other processes */
   virtual void FillBoundaryID(dealii::Triangulation<dim> &to_fill) = 0;
 
   /* \brief Gets if the triangulation has a material mapping */
@@ -0,0 +1,310 @@
+#include "domain/mesh/mesh_pin_lattice.h"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_reordering.h>
+#include <deal.II/grid/manifold.h>
+#include <deal.II/grid/tria_accessor.h>
+#include <deal.II/grid/tria_iterator.h>
+
+namespace bart {
+
+namespace domain {
+
+namespace mesh {
+
+namespace  {
+
+constexpr dealii::types::manifold_id kPinManifoldID = 1;
+//! Radius of the inner ring of composite pins, relative to the pin radius
+constexpr double kCompositeInnerRadius = 0.6;
+//! Half side of the square at the pin center, relative to the innermost radius
+constexpr double kPinCenterHalfSide = 0.4;
+constexpr double kRelativeTolerance = 1e-8;
+
+/* Manifold of the pin surfaces of a lattice, new points are placed on the
+ * cylinder through the surrounding points around the axis of their pin cell. */
+template <int dim>
+class PinLatticeManifold : public dealii::Manifold<dim> {
+ public:
+  PinLatticeManifold(const std::array<double, 2> pitch,
+                     const std::array<int, 2> n_pins)
+      : pitch_(pitch), n_pins_(n_pins) {}
+
+  std::unique_ptr<dealii::Manifold<dim>> clone() const override {
+    return std::make_unique<PinLatticeManifold<dim>>(pitch_, n_pins_); }
+
+  dealii::Point<dim> get_new_point(
+      const dealii::ArrayView<const dealii::Point<dim>>& surrounding_points,
+      const dealii::ArrayView<const double>& weights) const override {
+    dealii::Point<dim> average;
+    for (unsigned int i = 0; i < surrounding_points.size(); ++i)
+      average += weights[i] * surrounding_points[i];
+
+    std::array<double, 2> center;
+    for (int dir = 0; dir < 2; ++dir) {
+      const int index = std::clamp(static_cast<int>(average[dir] / pitch_[dir]),
+                                   0, n_pins_[dir] - 1);
+      center[dir] = (index + 0.5) * pitch_[dir];
+    }
+
+    double radius = 0;
+    for (unsigned int i = 0; i < surrounding_points.size(); ++i)
+      radius += weights[i] * std::hypot(surrounding_points[i][0] - center[0],
+                                        surrounding_points[i][1] - center[1]);
+    const double distance = std::hypot(average[0] - center[0],
+                                       average[1] - center[1]);
+    if (distance == 0)
+      return average;
+
+    dealii::Point<dim> new_point = average;
+    for (int dir = 0; dir < 2; ++dir)
+      new_point[dir] = center[dir] +
+          (average[dir] - center[dir]) * radius / distance;
+    return new_point;
+  }
+
+ private:
+  const std::array<double, 2> pitch_;
+  const std::array<int, 2> n_pins_;
+};
+
+} // namespace
+
+template <int dim>
+MeshPinLattice<dim>::MeshPinLattice(
+    const std::vector<double>& spatial_max,
+    const std::vector<int>& n_cells,
+    const std::string& material_mapping,
+    const std::string& fuel_pin_mapping,
+    const double fuel_pin_radius,
+    const problem::FuelPinTriangulationType fuel_pin_type)
+    : material_mesh_(spatial_max, n_cells, material_mapping),
+      fuel_pin_mesh_(spatial_max, n_cells, fuel_pin_mapping),
+      fuel_pin_radius_(fuel_pin_radius),
+      fuel_pin_type_(fuel_pin_type) {
+  AssertThrow(dim > 1,
+              dealii::ExcMessage("MeshPinLattice error, pin-resolved meshes "
+                                 "are only available in 2D and 3D"));
+  AssertThrow(material_mesh_.has_material_mapping() &&
+              fuel_pin_mesh_.has_material_mapping(),
+              dealii::ExcMessage("MeshPinLattice error, material and fuel pin "
+                                 "maps must not be empty"));
+  AssertThrow(fuel_pin_type_ != problem::FuelPinTriangulationType::kNone,
+              dealii::ExcMessage("MeshPinLattice error, fuel pin triangulation "
+                                 "type must be specified"));
+
+  for (int dir = 0; dir < 2; ++dir)
+    pitch_[dir] = spatial_max.at(dir) / n_cells.at(dir);
+  AssertThrow(fuel_pin_radius_ > 0 &&
+              fuel_pin_radius_ < 0.5 * std::min(pitch_[0], pitch_[1]),
+              dealii::ExcMessage("MeshPinLattice error, fuel pin radius must "
+                                 "be positive and less than half the pitch"));
+
+  // A pin cell has a pin if any of its z-layers has fuel
+  const int n_layers = dim > 2 ? n_cells.at(dim - 1) : 1;
+  has_fuel_.resize(n_cells.at(0) * n_cells.at(1), false);
+  int n_fuel_pins = 0;
+  for (int j = 0; j < n_cells.at(1); ++j) {
+    for (int i = 0; i < n_cells.at(0); ++i) {
+      dealii::Point<dim> location;
+      location[0] = (i + 0.5) * pitch_[0];
+      location[1] = (j + 0.5) * pitch_[1];
+      for (int k = 0; k < n_layers; ++k) {
+        if (dim > 2)
+          location[dim - 1] = (k + 0.5) * spatial_max.at(dim - 1) / n_layers;
+        if (fuel_pin_mesh_.GetMaterialID(location) >= 0) {
+          has_fuel_[j * n_cells.at(0) + i] = true;
+          ++n_fuel_pins;
+          break;
+        }
+      }
+    }
+  }
+
+  description_ = "Pin-resolved lattice mesh, " + std::to_string(dim) +
+      "D, Pitch: {" + std::to_string(pitch_[0]) + ", " +
+      std::to_string(pitch_[1]) + "}, N_cells: {" +
+      std::to_string(n_cells.at(0));
+  for (int dir = 1; dir < dim; ++dir)
+    description_ += ", " + std::to_string(n_cells.at(dir));
+  description_ += "}, Fuel pins: " + std::to_string(n_fuel_pins);
+}
+
+template <int dim>
+void MeshPinLattice<dim>::FillTriangulation(
+    dealii::Triangulation<dim> &to_fill) {
+  if constexpr (dim == 2) {
+    FillLattice(to_fill);
+  } else if constexpr (dim == 3) {
+    dealii::Triangulation<2> lattice;
+    FillLattice(lattice);
+    dealii::GridGenerator::extrude_triangulation(
+        lattice, n_cells().at(2) + 1, spatial_max().at(2), to_fill);
+  }
+
+  if constexpr (dim > 1) {
+    // Attach the pin surfaces, all faces with vertices on a cylinder
+    const std::array<double, 2> radii{
+        fuel_pin_radius_, kCompositeInnerRadius * fuel_pin_radius_};
+    const int n_radii =
+        fuel_pin_type_ == problem::FuelPinTriangulationType::kComposite ? 2 : 1;
+    for (auto cell = to_fill.begin(0); cell != to_fill.end(0); ++cell) {
+      for (unsigned int f = 0; f < dealii::GeometryInfo<dim>::faces_per_cell;
+           ++f) {
+        const auto face = cell->face(f);
+        const auto center = PinCenter(face->center());
+        for (int r = 0; r < n_radii; ++r) {
+          bool on_cylinder = true;
+          for (unsigned int v = 0;
+               v < dealii::GeometryInfo<dim>::vertices_per_face; ++v) {
+            const auto vertex = face->vertex(v);
+            on_cylinder &= std::abs(
+                std::hypot(vertex[0] - center[0], vertex[1] - center[1]) -
+                    radii[r]) < kRelativeTolerance * fuel_pin_radius_;
+          }
+          if (on_cylinder)
+            face->set_all_manifold_ids(kPinManifoldID);
+        }
+      }
+    }
+    to_fill.set_manifold(kPinManifoldID, PinLatticeManifold<dim>(
+        pitch_, {n_cells().at(0), n_cells().at(1)}));
+  }
+}
+
+template <int dim>
+void MeshPinLattice<dim>::FillMaterialID(dealii::Triangulation<dim> &to_fill) {
+  const double pin_radius = (1 + kRelativeTolerance) * fuel_pin_radius_;
+  // Cells owned by other processes are also filled, cells that move to this
+  // process when the mesh is repartitioned keep their IDs
+  for (auto cell = to_fill.begin_active(); cell != to_fill.end(); ++cell) {
+    const int fuel_id = fuel_pin_mesh_.GetMaterialID(cell->center());
+    // Cells inside the pin have all of their vertices inside it
+    bool in_pin = fuel_id >= 0;
+    const auto center = PinCenter(cell->center());
+    for (unsigned int v = 0; in_pin &&
+        v < dealii::GeometryInfo<dim>::vertices_per_cell; ++v) {
+      const auto vertex = cell->vertex(v);
+      in_pin = std::hypot(vertex[0] - center[0], vertex[1] - center[1]) <=
+          pin_radius;
+    }
+    cell->set_material_id(in_pin ? fuel_id
+                                 : material_mesh_.GetMaterialID(cell->center()));
+  }
+}
+
+template <int dim>
+void MeshPinLattice<dim>::FillBoundaryID(dealii::Triangulation<dim> &to_fill) {
+  // The lattice boundary is the same as the Cartesian mesh boundary
+  material_mesh_.FillBoundaryID(to_fill);
+}
+
+template <int dim>
+auto MeshPinLattice<dim>::GetPinTemplate(const bool has_fuel)
+-> const PinTemplate& {
+  if (auto cached = pin_templates_.find(has_fuel);
+      cached != pin_templates_.end())
+    return cached->second;
+
+  PinTemplate pin_template;
+  const double half_x = 0.5 * pitch_[0], half_y = 0.5 * pitch_[1];
+
+  // Rings of four vertices from the pin cell corners inwards, the vertices of
+  // each ring are in lexicographic order
+  std::vector<std::array<double, 2>> ring_half_sides{{half_x, half_y}};
+  if (has_fuel) {
+    std::vector<double> radii{fuel_pin_radius_};
+    if (fuel_pin_type_ == problem::FuelPinTriangulationType::kComposite)
+      radii.push_back(kCompositeInnerRadius * fuel_pin_radius_);
+    for (const double radius : radii)
+      ring_half_sides.push_back({radius / std::sqrt(2.0),
+                                 radius / std::sqrt(2.0)});
+    const double center_half_side = kPinCenterHalfSide * radii.back();
+    ring_half_sides.push_back({center_half_side, center_half_side});
+  }
+  for (const auto& [half_side_x, half_side_y] : ring_half_sides) {
+    for (const double y : {-half_side_y, half_side_y}) {
+      for (const double x : {-half_side_x, half_side_x})
+        pin_template.vertices.emplace_back(x, y);
+    }
+  }
+
+  // Four cells between each pair of rings, and one cell inside the last ring
+  for (unsigned int ring = 0; ring + 1 < ring_half_sides.size(); ++ring) {
+    const unsigned int o = 4 * ring, i = 4 * (ring + 1);
+    pin_template.cells.push_back({o, o + 1, i, i + 1});
+    pin_template.cells.push_back({i + 1, o + 1, i + 3, o + 3});
+    pin_template.cells.push_back({i + 2, i + 3, o + 2, o + 3});
+    pin_template.cells.push_back({o, i, o + 2, i + 2});
+  }
+  const unsigned int last = 4 * (ring_half_sides.size() - 1);
+  pin_template.cells.push_back({last, last + 1, last + 2, last + 3});
+
+  return pin_templates_[has_fuel] = std::move(pin_template);
+}
+
+template <int dim>
+void MeshPinLattice<dim>::FillLattice(dealii::Triangulation<2> &to_fill) {
+  const int n_x = n_cells().at(0), n_y = n_cells().at(1);
+
+  // Pin cell corners are shared by neighboring pins, they are numbered first
+  std::vector<dealii::Point<2>> vertices;
+  for (int j = 0; j <= n_y; ++j) {
+    for (int i = 0; i <= n_x; ++i)
+      vertices.emplace_back(i * pitch_[0], j * pitch_[1]);
+  }
+
+  std::vector<dealii::CellData<2>> cells;
+  for (int j = 0; j < n_y; ++j) {
+    for (int i = 0; i < n_x; ++i) {
+      const auto& pin_template = GetPinTemplate(has_fuel_[j * n_x + i]);
+      const dealii::Point<2> pin_center((i + 0.5) * pitch_[0],
+                                        (j + 0.5) * pitch_[1]);
+
+      std::vector<unsigned int> vertex_indices(pin_template.vertices.size());
+      for (unsigned int v = 0; v < 4; ++v)
+        vertex_indices[v] = (j + v / 2) * (n_x + 1) + i + v % 2;
+      for (unsigned int v = 4; v < pin_template.vertices.size(); ++v) {
+        vertex_indices[v] = vertices.size();
+        vertices.push_back(pin_center + pin_template.vertices[v]);
+      }
+
+      for (const auto& template_cell : pin_template.cells) {
+        dealii::CellData<2> cell;
+        for (unsigned int v = 0; v < 4; ++v)
+          cell.vertices[v] = vertex_indices[template_cell[v]];
+        cells.push_back(cell);
+      }
+    }
+  }
+
+  dealii::GridReordering<2>::reorder_cells(cells, true);
+  to_fill.create_triangulation(vertices, cells, dealii::SubCellData());
+}
+
+template <int dim>
+dealii::Point<2> MeshPinLattice<dim>::PinCenter(
+    const dealii::Point<dim>& location) const {
+  dealii::Point<2> center;
+  const auto n_pins = n_cells();
+  for (int dir = 0; dir < 2; ++dir) {
+    const int index = std::clamp(static_cast<int>(location[dir] / pitch_[dir]),
+                                 0, n_pins[dir] - 1);
+    center[dir] = (index + 0.5) * pitch_[dir];
+  }
+  return center;
+}
+
+template class MeshPinLattice<1>;
+template class MeshPinLattice<2>;
+template class MeshPinLattice<3>;
+
+} // namespace mesh
+
+} // namespace domain
+
+} // namespace bart
@@ -0,0 +1,115 @@
+#ifndef BART_SRC_DOMAIN_MESH_MESH_PIN_LATTICE_H_
+#define BART_SRC_DOMAIN_MESH_MESH_PIN_LATTICE_H_
+
+#include <array>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <deal.II/base/point.h>
+#include <deal.II/grid/tria.h>
+
+#include "domain/mesh/mesh_cartesian.h"
+#include "domain/mesh/mesh_i.h"
+#include "problem/parameter_types.h"
+
+namespace bart {
+
+namespace domain {
+
+namespace mesh {
+
+/*! \brief Pin-resolved mesh of a rectangular lattice of pin cells.
+ *
+ * The x-y plane is divided into a lattice of pin cells, each either a fuel pin
+ * (a cylindrical pin surrounded by moderator) or a moderator-only pin cell.
+ * The coarse cells of each pin type are generated once, in local coordinates,
+ * as a template. The lattice is built by copying the template of each pin
+ * shifted to its position. Lattice corner vertices are numbered directly, so
+ * no search for duplicate vertices is needed and building the lattice is linear
+ * in the number of pins. In 3D the lattice is extruded in z.
+ *
+ * A fuel pin template is a square inside the pin, surrounded by a ring of four
+ * cells out to the pin radius and a ring of four moderator cells out to the
+ * pin cell boundary. A composite pin adds a second ring of fuel cells, with the
+ * inner ring at 0.6 times the pin radius. Faces on the pin surfaces are
+ * attached to a manifold that keeps refined vertices on the cylinders.
+ *
+ * Material IDs are given by two maps in the format of MeshCartesian, with one
+ * entry per pin cell (and per z-layer in 3D). The material map gives the
+ * moderator material of each pin cell. The fuel pin map gives the material
+ * inside the pin, negative entries are moderator-only pin cells. A pin cell
+ * has a pin if it has fuel in any z-layer.
+ *
+ * Pin-resolved meshes are not available in 1D.
+ */
+template <int dim>
+class MeshPinLattice : public MeshI<dim> {
+ public:
+  /*! \brief Constructor.
+   *
+   * \param spatial_max size of the lattice in each direction.
+   * \param n_cells number of pin cells in x and y, and of layers in z.
+   * \param material_mapping moderator material of each pin cell.
+   * \param fuel_pin_mapping fuel material of each pin cell, negative if there
+   * is no pin.
+   * \param fuel_pin_radius radius of the fuel pins, less than half the pitch.
+   * \param fuel_pin_type triangulation of the fuel pins.
+   */
+  MeshPinLattice(const std::vector<double>& spatial_max,
+                 const std::vector<int>& n_cells,
+                 const std::string& material_mapping,
+                 const std::string& fuel_pin_mapping,
+                 double fuel_pin_radius,
+                 problem::FuelPinTriangulationType fuel_pin_type);
+  ~MeshPinLattice() = default;
+
+  void FillTriangulation(dealii::Triangulation<dim> &to_fill) override;
+  void FillMaterialID(dealii::Triangulation<dim> &to_fill) override;
+  void FillBoundaryID(dealii::Triangulation<dim> &to_fill) override;
+
+  bool has_material_mapping() const override {
+    return material_mesh_.has_material_mapping(); };
+  std::array<double, dim> spatial_max() const override {
+    return material_mesh_.spatial_max(); };
+  /*! \brief Get number of pin cells in x and y, and of layers in z */
+  std::array<int, dim> n_cells() const override {
+    return material_mesh_.n_cells(); };
+  std::string description() const override { return description_; }
+
+  /*! \brief Get the number of distinct pin templates that have been built */
+  int n_pin_templates() const { return pin_templates_.size(); }
+
+ private:
+  //! Coarse cells of one pin cell centered at the origin
+  struct PinTemplate {
+    //! The first four vertices are the pin cell corners, in lexicographic order
+    std::vector<dealii::Point<2>> vertices;
+    std::vector<std::array<unsigned int, 4>> cells;
+  };
+
+  //! Returns the template for a pin type, building it on first use
+  const PinTemplate& GetPinTemplate(bool has_fuel);
+  //! Fills a 2D triangulation with the lattice, in the x-y plane
+  void FillLattice(dealii::Triangulation<2> &to_fill);
+  //! Returns the center of the pin cell that contains a location
+  dealii::Point<2> PinCenter(const dealii::Point<dim>& location) const;
+
+  std::string description_ = "";
+  MeshCartesian<dim> material_mesh_;
+  MeshCartesian<dim> fuel_pin_mesh_;
+  const double fuel_pin_radius_;
+  const problem::FuelPinTriangulationType fuel_pin_type_;
+  std::array<double, 2> pitch_;
+  //! If each pin cell has a pin, x index fastest
+  std::vector<bool> has_fuel_;
+  std::map<bool, PinTemplate> pin_templates_;
+};
+
+} // namespace mesh
+
+} // namespace domain
+
+} // namespace bart
+
+#endif // BART_SRC_DOMAIN_MESH_MESH_PIN_LATTICE_H_
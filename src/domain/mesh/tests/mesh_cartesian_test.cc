@@ -400,4 +400,65 @@ TEST_F(DomainMeshCartesianMappingTest, MultipleMaterialMapping3D) {
 }
 
 
+TEST_F(DomainMeshCartesianMappingTest, BinaryMaterialMapping3D) {
+  const std::vector<double> spatial_max{4, 4, 4};
+  const std::vector<int> n_cells{4, 4, 4};
+  domain::mesh::MeshCartesian<3> text_mesh(spatial_max, n_cells,
+                                           "1 2\n3 4\n\n5 6\n7 8\n");
+
+  std::ostringstream binary_map;
+  text_mesh.WriteBinaryMaterialMap(binary_map);
+  domain::mesh::MeshCartesian<3> binary_mesh(spatial_max, n_cells,
+                                             binary_map.str());
+  EXPECT_TRUE(binary_mesh.has_material_mapping());
+
+  for (const double x : {0.5, 3.5}) {
+    for (const double y : {0.5, 3.5}) {
+      for (const double z : {0.5, 3.5}) {
+        std::array<double, 3> location{x, y, z};
+        EXPECT_EQ(binary_mesh.GetMaterialID(location),
+                  text_mesh.GetMaterialID(location));
+      }
+    }
+  }
+  EXPECT_EQ(binary_mesh.GetMaterialID(std::array<double, 3>{0.5, 0.5, 0.5}), 7);
+
+  std::string truncated_map = binary_map.str();
+  truncated_map.pop_back();
+  EXPECT_ANY_THROW(binary_mesh.ParseMaterialMap(truncated_map));
+}
+
+TEST_F(DomainMeshCartesianMappingTest, NodeSharedMaterialMappingMPI) {
+  const std::vector<double> spatial_max{4, 4, 4};
+  const std::vector<int> n_cells{4, 4, 4};
+  const std::string material_mapping{"1 2\n3 4\n\n5 6\n7 8\n"};
+  domain::mesh::MeshCartesian<3> local_mesh(spatial_max, n_cells,
+                                            material_mapping);
+  domain::mesh::MeshCartesian<3> shared_mesh(spatial_max, n_cells,
+                                             material_mapping, true);
+
+  EXPECT_FALSE(local_mesh.is_material_grid_node_shared());
+  EXPECT_TRUE(shared_mesh.is_material_grid_node_shared());
+  EXPECT_TRUE(shared_mesh.has_material_mapping());
+  for (const double x : {0.5, 3.5}) {
+    for (const double y : {0.5, 3.5}) {
+      for (const double z : {0.5, 3.5}) {
+        std::array<double, 3> location{x, y, z};
+        EXPECT_EQ(shared_mesh.GetMaterialID(location),
+                  local_mesh.GetMaterialID(location));
+      }
+    }
+  }
+}
+
+TEST_F(DomainMeshCartesianMappingTest, BadMaterialMappingThrows) {
+  domain::mesh::MeshCartesian<2> test_mesh({4, 4}, {4, 4});
+  // Ragged lines
+  EXPECT_ANY_THROW(test_mesh.ParseMaterialMap("1 2\n3"));
+  // Not a number
+  EXPECT_ANY_THROW(test_mesh.ParseMaterialMap("1 a\n3 4"));
+  // z-blocks in a 2D mesh
+  EXPECT_ANY_THROW(test_mesh.ParseMaterialMap("1 2\n3 4\n\n5 6\n7 8"));
+}
+
 } // namespace
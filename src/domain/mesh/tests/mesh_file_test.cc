@@ -0,0 +1,100 @@
+#include "domain/mesh/mesh_file.h"
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include <deal.II/base/mpi.h>
+#include <deal.II/distributed/tria.h>
+
+#include "problem/parameter_types.h"
+#include "test_helpers/gmock_wrapper.h"
+
+namespace  {
+
+using namespace bart;
+
+class DomainMeshFileTest : public ::testing::Test {
+ protected:
+  void SetUp() override;
+  void TearDown() override;
+
+  // Two quads with materials 1 and 2, the boundary at x = 2 has file ID 2
+  // (kXMax), the other boundary faces are unlabeled
+  const std::string filename_ = "mesh_file_test_mesh.inp";
+  const std::string bad_id_filename_ = "mesh_file_test_bad_id_mesh.inp";
+  const int rank_ = dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+};
+
+void DomainMeshFileTest::SetUp() {
+  if (rank_ == 0) {
+    std::ofstream mesh_file(filename_);
+    mesh_file << "6 3 0 0 0\n"
+              << "1 0 0 0\n2 1 0 0\n3 2 0 0\n"
+              << "4 0 1 0\n5 1 1 0\n6 2 1 0\n"
+              << "1 1 quad 1 2 5 4\n"
+              << "2 2 quad 2 3 6 5\n"
+              << "3 2 line 3 6\n";
+    // File ID 5 is kZMin, not a boundary of a 2D mesh
+    std::ofstream bad_id_mesh_file(bad_id_filename_);
+    bad_id_mesh_file << "4 2 0 0 0\n"
+                     << "1 0 0 0\n2 1 0 0\n3 0 1 0\n4 1 1 0\n"
+                     << "1 1 quad 1 2 4 3\n"
+                     << "2 5 line 2 4\n";
+  }
+  MPI_Barrier(MPI_COMM_WORLD);
+}
+
+void DomainMeshFileTest::TearDown() {
+  MPI_Barrier(MPI_COMM_WORLD);
+  if (rank_ == 0) {
+    std::remove(filename_.c_str());
+    std::remove(bad_id_filename_.c_str());
+  }
+}
+
+TEST_F(DomainMeshFileTest, FillTriangulationMPI) {
+  domain::mesh::MeshFile<2> test_mesh(filename_);
+
+  EXPECT_TRUE(test_mesh.has_material_mapping());
+  EXPECT_EQ(test_mesh.spatial_max()[0], 2.0);
+  EXPECT_EQ(test_mesh.spatial_max()[1], 1.0);
+  EXPECT_EQ(test_mesh.n_cells()[0], 2);
+  EXPECT_EQ(test_mesh.description(),
+            "Mesh from file " + filename_ + ", 2D, N_cells: 2");
+
+  dealii::parallel::distributed::Triangulation<2> triangulation(MPI_COMM_WORLD);
+  test_mesh.FillTriangulation(triangulation);
+  test_mesh.FillMaterialID(triangulation);
+  test_mesh.FillBoundaryID(triangulation);
+
+  EXPECT_EQ(triangulation.n_global_active_cells(), 2);
+  for (const auto& cell : triangulation.active_cell_iterators()) {
+    if (!cell->is_locally_owned())
+      continue;
+    EXPECT_EQ(cell->material_id(), cell->center()[0] < 1 ? 1 : 2);
+    for (unsigned int f = 0; f < dealii::GeometryInfo<2>::faces_per_cell; ++f) {
+      const auto face = cell->face(f);
+      if (!face->at_boundary())
+        continue;
+      // Unlabeled faces must not be mistaken for kXMin
+      EXPECT_EQ(face->boundary_id(), face->center()[0] > 1.5
+                ? static_cast<dealii::types::boundary_id>(
+                    problem::Boundary::kXMax)
+                : domain::mesh::MeshFile<2>::kUnlabeledBoundaryId);
+    }
+  }
+
+  // The mesh description is released after filling
+  dealii::parallel::distributed::Triangulation<2> second_triangulation(
+      MPI_COMM_WORLD);
+  EXPECT_ANY_THROW(test_mesh.FillTriangulation(second_triangulation));
+}
+
+TEST_F(DomainMeshFileTest, BadFileThrowsMPI) {
+  EXPECT_ANY_THROW(domain::mesh::MeshFile<2> test_mesh("missing_mesh.msh"));
+  EXPECT_ANY_THROW(domain::mesh::MeshFile<2> test_mesh("mesh_file.unknown"));
+  EXPECT_ANY_THROW(domain::mesh::MeshFile<2> test_mesh(bad_id_filename_));
+}
+
+} // namespace
@@ -0,0 +1,138 @@
+#include "domain/mesh/mesh_pin_lattice.h"
+
+#include <cmath>
+
+#include <deal.II/base/numbers.h>
+#include <deal.II/grid/tria.h>
+
+#include "problem/parameter_types.h"
+#include "test_helpers/gmock_wrapper.h"
+
+namespace  {
+
+using namespace bart;
+using ::testing::HasSubstr;
+
+class DomainMeshPinLatticeTest : public ::testing::Test {
+ protected:
+  using PinType = problem::FuelPinTriangulationType;
+
+  const std::vector<double> spatial_max_2D_{2, 2};
+  const std::vector<double> spatial_max_3D_{2, 2, 4};
+  const std::vector<int> n_cells_2D_{2, 2};
+  const std::vector<int> n_cells_3D_{2, 2, 2};
+  const double radius_ = 0.3;
+  const std::string material_mapping_2D_ = "1 1\n1 1";
+  // Fuel pins with material 2 at the lower right and upper left
+  const std::string fuel_pin_mapping_2D_ = "2 -1\n-1 2";
+};
+
+TEST_F(DomainMeshPinLatticeTest, SimplePins) {
+  domain::mesh::MeshPinLattice<2> test_mesh(spatial_max_2D_, n_cells_2D_,
+                                            material_mapping_2D_,
+                                            fuel_pin_mapping_2D_, radius_,
+                                            PinType::kSimple);
+  EXPECT_THAT(test_mesh.description(), HasSubstr("Fuel pins: 2"));
+  EXPECT_EQ(test_mesh.n_cells().at(0), 2);
+
+  dealii::Triangulation<2> test_triangulation;
+  test_mesh.FillTriangulation(test_triangulation);
+  // Nine cells per fuel pin, one per moderator pin cell
+  EXPECT_EQ(test_triangulation.n_active_cells(), 2 * 9 + 2 * 1);
+  // Lattice corners are shared, eight vertices inside each fuel pin
+  EXPECT_EQ(test_triangulation.n_vertices(), 9 + 2 * 8);
+  // One template per pin type, reused for the repeated pins
+  EXPECT_EQ(test_mesh.n_pin_templates(), 2);
+}
+
+TEST_F(DomainMeshPinLatticeTest, CompositePins) {
+  domain::mesh::MeshPinLattice<2> test_mesh(spatial_max_2D_, n_cells_2D_,
+                                            material_mapping_2D_,
+                                            fuel_pin_mapping_2D_, radius_,
+                                            PinType::kComposite);
+  dealii::Triangulation<2> test_triangulation;
+  test_mesh.FillTriangulation(test_triangulation);
+  EXPECT_EQ(test_triangulation.n_active_cells(), 2 * 13 + 2 * 1);
+  EXPECT_EQ(test_triangulation.n_vertices(), 9 + 2 * 12);
+}
+
+TEST_F(DomainMeshPinLatticeTest, FuelAreaConvergesToCircles) {
+  domain::mesh::MeshPinLattice<2> test_mesh(spatial_max_2D_, n_cells_2D_,
+                                            material_mapping_2D_,
+                                            fuel_pin_mapping_2D_, radius_,
+                                            PinType::kSimple);
+  dealii::Triangulation<2> test_triangulation;
+  test_mesh.FillTriangulation(test_triangulation);
+  test_mesh.FillBoundaryID(test_triangulation);
+  test_mesh.FillMaterialID(test_triangulation);
+  test_triangulation.refine_global(3);
+
+  double fuel_area = 0, total_area = 0;
+  for (const auto& cell : test_triangulation.active_cell_iterators()) {
+    total_area += cell->measure();
+    if (cell->material_id() == 2) {
+      fuel_area += cell->measure();
+      // Fuel pins are at the lower right and upper left
+      EXPECT_EQ(cell->center()[0] > 1, cell->center()[1] < 1);
+    } else {
+      EXPECT_EQ(cell->material_id(), 1);
+    }
+    for (unsigned int f = 0; f < dealii::GeometryInfo<2>::faces_per_cell; ++f) {
+      if (cell->face(f)->at_boundary() && cell->face(f)->center()[0] < 1e-12) {
+        EXPECT_EQ(cell->face(f)->boundary_id(),
+                  static_cast<int>(problem::Boundary::kXMin));
+      }
+    }
+  }
+
+  // Refined pin surfaces stay on the cylinders
+  const double expected_fuel_area = 2 * dealii::numbers::PI * radius_ * radius_;
+  EXPECT_NEAR(fuel_area, expected_fuel_area, 0.01 * expected_fuel_area);
+  EXPECT_NEAR(total_area, 4.0, 1e-12);
+}
+
+TEST_F(DomainMeshPinLatticeTest, ExtrudedLattice) {
+  // Fuel only in the upper layer, the lower layer pins are filled with the
+  // moderator
+  const std::string fuel_pin_mapping = fuel_pin_mapping_2D_ + "\n\n-1 -1\n-1 -1";
+  const std::string material_mapping = material_mapping_2D_ + "\n\n" +
+      material_mapping_2D_;
+  domain::mesh::MeshPinLattice<3> test_mesh(spatial_max_3D_, n_cells_3D_,
+                                            material_mapping, fuel_pin_mapping,
+                                            radius_, PinType::kSimple);
+  dealii::Triangulation<3> test_triangulation;
+  test_mesh.FillTriangulation(test_triangulation);
+  test_mesh.FillMaterialID(test_triangulation);
+  EXPECT_EQ(test_triangulation.n_active_cells(), 2 * (2 * 9 + 2 * 1));
+
+  int n_fuel_cells = 0;
+  for (const auto& cell : test_triangulation.active_cell_iterators()) {
+    if (cell->material_id() == 2) {
+      ++n_fuel_cells;
+      EXPECT_GT(cell->center()[2], 2);
+    }
+  }
+  // Five cells inside each of the two pins
+  EXPECT_EQ(n_fuel_cells, 2 * 5);
+}
+
+TEST_F(DomainMeshPinLatticeTest, BadParametersThrow) {
+  EXPECT_ANY_THROW({
+    domain::mesh::MeshPinLattice<2> test_mesh(spatial_max_2D_, n_cells_2D_,
+                                              material_mapping_2D_,
+                                              fuel_pin_mapping_2D_, 0.6,
+                                              PinType::kSimple);
+  });
+  EXPECT_ANY_THROW({
+    domain::mesh::MeshPinLattice<2> test_mesh(spatial_max_2D_, n_cells_2D_,
+                                              material_mapping_2D_,
+                                              fuel_pin_mapping_2D_, radius_,
+                                              PinType::kNone);
+  });
+  EXPECT_ANY_THROW({
+    domain::mesh::MeshPinLattice<1> test_mesh({2}, {2}, "1 1", "2 -1", radius_,
+                                              PinType::kSimple);
+  });
+}
+
+} // namespace
@@ -0,0 +1,45 @@
+#include "domain/cell_costs.h"
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include "test_helpers/gmock_wrapper.h"
+
+namespace {
+
+using namespace bart;
+
+template <typename DimensionWrapper>
+class DomainCellCostsTest : public ::testing::Test {
+ protected:
+  static constexpr int dim = DimensionWrapper::value;
+};
+
+TYPED_TEST_CASE(DomainCellCostsTest, bart::testing::AllDimensions);
+
+TYPED_TEST(DomainCellCostsTest, CostByMaterial) {
+  constexpr int dim = TypeParam::value;
+  dealii::Triangulation<dim> triangulation;
+  dealii::GridGenerator::hyper_cube(triangulation, 0, 1);
+  triangulation.refine_global(1);
+  int material_id = 0;
+  for (auto& cell : triangulation.active_cell_iterators())
+    cell->set_material_id(material_id++ % 3);
+
+  auto cell_cost = domain::MaterialCellCosts<dim>({{1, 4.0}, {2, 0.5}});
+
+  for (const auto& cell : triangulation.active_cell_iterators()) {
+    switch (cell->material_id()) {
+      case 1:
+        EXPECT_EQ(cell_cost(cell), 4.0);
+        break;
+      case 2:
+        EXPECT_EQ(cell_cost(cell), 0.5);
+        break;
+      default:
+        EXPECT_EQ(cell_cost(cell), 1.0);
+    }
+  }
+}
+
+} // namespace
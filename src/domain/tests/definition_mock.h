@@ -3,6 +3,7 @@
 
 #include <deal.II/dofs/dof_handler.h>
 #include <deal.II/dofs/dof_accessor.h>
+#include <deal.II/lac/affine_constraints.h>
 #include <deal.II/lac/full_matrix.h>
 #include <deal.II/lac/vector.h>
 
@@ -22,6 +23,10 @@ class DefinitionMock : public DefinitionI<dim> {
 
   MOCK_METHOD(DefinitionMock<dim>&, SetUpMesh, (), (override));
   MOCK_METHOD(DefinitionMock<dim>&, SetUpDOF, (), (override));
+  MOCK_METHOD(DefinitionMock<dim>&, SetCellCosts,
+              (typename DefinitionI<dim>::CellCostFunction), (override));
+  MOCK_METHOD(void, RefineAndCoarsen, (const dealii::Vector<float>&, double,
+      double, const std::vector<system::MPIVector*>&), (override));
   MOCK_METHOD(dealii::FullMatrix<double>, GetCellMatrix, (), (override, const));
   MOCK_METHOD(dealii::Vector<double>, GetCellVector, (), (override, const));
   MOCK_METHOD(std::shared_ptr<bart::system::MPISparseMatrix>, MakeSystemMatrix,
@@ -32,7 +37,10 @@ class DefinitionMock : public DefinitionI<dim> {
   MOCK_METHOD(problem::DiscretizationType, discretization_type, (), (override, const));
   MOCK_METHOD(int, total_degrees_of_freedom, (), (override, const));
   MOCK_METHOD(const dealii::DoFHandler<dim>&, dof_handler, (), (override, const));
+  MOCK_METHOD(const dealii::AffineConstraints<double>&, constraints, (),
+              (override, const));
   MOCK_METHOD(dealii::IndexSet, locally_owned_dofs, (), (override, const));
+  MOCK_METHOD(dealii::IndexSet, locally_relevant_dofs, (), (override, const));
 
   };
 
@@ -1,19 +1,30 @@
 #include "domain/definition.h"
 
+#include <algorithm>
 #include <cmath>
 #include <functional>
 #include <memory>
 
 #include <gtest/gtest.h>
 
+#include <deal.II/base/geometry_info.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/quadrature_lib.h>
 #include <deal.II/grid/tria.h>
 #include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_values.h>
 #include <deal.II/grid/grid_generator.h>
+#include <deal.II/lac/petsc_precondition.h>
+
+#include <petscmat.h>
 
 #include "test_helpers/gmock_wrapper.h"
+#include "domain/mesh/mesh_cartesian.h"
 #include "domain/mesh/tests/mesh_mock.h"
 #include "domain/finite_element/tests/finite_element_mock.h"
+#include "formulation/stamper.h"
 #include "problem/parameter_types.h"
+#include "solver/gmres.h"
 
 namespace {
 
@@ -22,6 +33,26 @@ using namespace bart;
 using ::testing::_;
 using ::testing::NiceMock;
 
+/* Returns the column index array of the locally owned diagonal block of a
+ * PETSc AIJ matrix, matrices sharing a nonzero structure share this array. */
+const PetscInt* LocalColumnIndices(const Mat matrix) {
+  PetscBool is_mpi = PETSC_FALSE;
+  PetscObjectTypeCompare(reinterpret_cast<PetscObject>(matrix), MATMPIAIJ,
+                         &is_mpi);
+  Mat local_block = matrix, off_diagonal_block;
+  const PetscInt* column_map;
+  if (is_mpi)
+    MatMPIAIJGetSeqAIJ(matrix, &local_block, &off_diagonal_block, &column_map);
+  PetscInt n_rows;
+  const PetscInt *row_offsets = nullptr, *columns = nullptr;
+  PetscBool done;
+  MatGetRowIJ(local_block, 0, PETSC_FALSE, PETSC_FALSE, &n_rows, &row_offsets,
+              &columns, &done);
+  MatRestoreRowIJ(local_block, 0, PETSC_FALSE, PETSC_FALSE, &n_rows,
+                  &row_offsets, &columns, &done);
+  return columns;
+}
+
 template <typename DimensionWrapper>
 class DomainDefinitionTest : public ::testing::Test {
  protected:
@@ -124,10 +155,12 @@ TYPED_TEST(DomainDefinitionDOFTest, SetUpDOFTestMPI) {
   EXPECT_EQ(test_domain.total_degrees_of_freedom(),
             test_domain.dof_handler().n_dofs());
 
+  const auto this_process =
+      dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
   int total_cells = 0;
   for (auto cell = test_domain.dof_handler().begin_active();
        cell != test_domain.dof_handler().end(); ++cell) {
-    if (cell->is_locally_owned())
+    if (cell->subdomain_id() == this_process)
       ++total_cells;
   }
 
@@ -145,6 +178,341 @@ TYPED_TEST(DomainDefinitionDOFTest, SetUpDOFTestMPI) {
   EXPECT_EQ(vector.size(), 4);
 }
 
+TYPED_TEST(DomainDefinitionDOFTest, SetUpDOFHilbertRenumberingMPI) {
+  EXPECT_CALL(*this->nice_mesh_ptr, has_material_mapping()).
+      WillOnce(::testing::Return(true));
+  EXPECT_CALL(*this->nice_mesh_ptr, FillTriangulation(_))
+      .WillOnce(::testing::Invoke(this->SetTriangulation));
+  EXPECT_CALL(*this->fe_ptr, finite_element())
+      .WillOnce(::testing::Return(&this->fe));
+
+  bart::domain::Definition<this->dim> test_domain(
+      std::move(this->nice_mesh_ptr), this->fe_ptr,
+      bart::problem::DiscretizationType::kContinuousFEM,
+      bart::problem::DoFRenumberingType::kHilbert);
+  test_domain.SetUpMesh();
+  test_domain.SetUpDOF();
+
+  EXPECT_EQ(test_domain.dof_renumbering_type(),
+            bart::problem::DoFRenumberingType::kHilbert);
+  EXPECT_EQ(test_domain.total_degrees_of_freedom(),
+            test_domain.dof_handler().n_dofs());
+
+  // Local cells are ordered by their lowest degree of freedom
+  std::vector<dealii::types::global_dof_index> cell_dofs(
+      this->fe.dofs_per_cell);
+  dealii::types::global_dof_index last_min_dof = 0;
+  for (const auto& cell : test_domain.Cells()) {
+    cell->get_dof_indices(cell_dofs);
+    const auto min_dof = *std::min_element(cell_dofs.cbegin(),
+                                           cell_dofs.cend());
+    EXPECT_GE(min_dof, last_min_dof);
+    last_min_dof = min_dof;
+  }
+}
+
+TYPED_TEST(DomainDefinitionDOFTest, SetUpDOFDistributedRowsMPI) {
+  EXPECT_CALL(*this->nice_mesh_ptr, has_material_mapping()).
+      WillOnce(::testing::Return(true));
+  EXPECT_CALL(*this->nice_mesh_ptr, FillTriangulation(_))
+      .WillOnce(::testing::Invoke(this->SetTriangulation));
+  EXPECT_CALL(*this->fe_ptr, finite_element())
+      .WillOnce(::testing::Return(&this->fe));
+
+  bart::domain::Definition<this->dim> test_domain(std::move(this->nice_mesh_ptr),
+                                                  this->fe_ptr);
+  test_domain.SetUpMesh();
+  test_domain.SetUpDOF();
+
+  const auto owned_dofs = test_domain.locally_owned_dofs();
+  const auto relevant_dofs = test_domain.locally_relevant_dofs();
+  const int n_dofs = test_domain.total_degrees_of_freedom();
+
+  // Each dof is owned by exactly one process
+  EXPECT_EQ(dealii::Utilities::MPI::sum(owned_dofs.n_elements(),
+                                        MPI_COMM_WORLD), n_dofs);
+  for (const auto dof : owned_dofs)
+    EXPECT_TRUE(relevant_dofs.is_element(dof));
+
+  // Relevant dofs cover the local cells and their neighbors
+  std::vector<dealii::types::global_dof_index> cell_dofs(
+      this->fe.dofs_per_cell);
+  for (const auto& cell : test_domain.Cells()) {
+    cell->get_dof_indices(cell_dofs);
+    for (const auto dof : cell_dofs)
+      EXPECT_TRUE(relevant_dofs.is_element(dof));
+  }
+  // In 1D no process neighbors the whole domain with three or more processes
+  if (this->dim == 1 &&
+      dealii::Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD) > 2)
+    EXPECT_LT(relevant_dofs.n_elements(), n_dofs);
+}
+
+TYPED_TEST(DomainDefinitionDOFTest, SetCellCostsMPI) {
+  constexpr int dim = this->dim;
+  EXPECT_CALL(*this->nice_mesh_ptr, has_material_mapping()).
+      WillOnce(::testing::Return(true));
+  EXPECT_CALL(*this->nice_mesh_ptr, FillTriangulation(_))
+      .WillOnce(::testing::Invoke(this->SetTriangulation));
+  EXPECT_CALL(*this->fe_ptr, finite_element())
+      .WillOnce(::testing::Return(&this->fe));
+
+  bart::domain::Definition<dim> test_domain(std::move(this->nice_mesh_ptr),
+                                            this->fe_ptr);
+  /* Cells in the lower half of the last direction are a quarter of the cost,
+   * an equal cell count partition gives these cells to the first processes
+   * and is unbalanced. Costs below 1 must be distinguished from the default. */
+  auto cell_cost =
+      [](const typename dealii::Triangulation<dim>::cell_iterator& cell) {
+        return cell->center()[dim - 1] < 0 ? 0.25 : 1.0; };
+  test_domain.SetUpMesh();
+  test_domain.SetCellCosts(cell_cost);
+  test_domain.SetUpDOF();
+
+  const auto this_process =
+      dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+  int n_local_cells = 0;
+  double local_cost = 0;
+  for (const auto& cell : test_domain.dof_handler().active_cell_iterators()) {
+    if (cell->subdomain_id() == this_process) {
+      ++n_local_cells;
+      local_cost += cell_cost(cell);
+    }
+  }
+  EXPECT_EQ(dealii::Utilities::MPI::sum(n_local_cells, MPI_COMM_WORLD),
+            test_domain.dof_handler().get_triangulation().n_global_active_cells());
+
+  if (dealii::Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD) > 1) {
+    // Processes with cheap cells own more of them
+    EXPECT_GT(dealii::Utilities::MPI::max(n_local_cells, MPI_COMM_WORLD),
+              dealii::Utilities::MPI::min(n_local_cells, MPI_COMM_WORLD));
+    // p4est balances costs to within one cell
+    if (dim > 1) {
+      EXPECT_LE(dealii::Utilities::MPI::max(local_cost, MPI_COMM_WORLD) -
+                    dealii::Utilities::MPI::min(local_cost, MPI_COMM_WORLD),
+                1.0 + 1e-12);
+    }
+  }
+
+  EXPECT_ANY_THROW(test_domain.SetCellCosts(nullptr));
+  // Costs must be positive
+  EXPECT_ANY_THROW(test_domain.SetCellCosts(
+      [](const typename dealii::Triangulation<dim>::cell_iterator&) {
+        return 0.0; }));
+}
+
+/* Material and boundary IDs are set before the mesh is partitioned by cell
+ * cost, cells that move between processes when the mesh is repartitioned
+ * should keep them. */
+TYPED_TEST(DomainDefinitionDOFTest, SetCellCostsMaterialIDsMPI) {
+  constexpr int dim = this->dim;
+  const double length = 2.0;
+  std::string material_mapping{"1 2"};
+  if (dim == 2) {
+    material_mapping = "1 2\n3 4";
+  } else if (dim == 3) {
+    material_mapping = "1 2\n3 4\n\n5 6\n7 8";
+  }
+  auto mesh_ptr = std::make_unique<domain::mesh::MeshCartesian<dim>>(
+      std::vector<double>(dim, length), std::vector<int>(dim, 4),
+      material_mapping);
+  auto mesh_observer_ptr = mesh_ptr.get();
+  EXPECT_CALL(*this->fe_ptr, finite_element())
+      .WillOnce(::testing::Return(&this->fe));
+
+  bart::domain::Definition<dim> test_domain(std::move(mesh_ptr), this->fe_ptr);
+  test_domain.SetUpMesh();
+  test_domain.SetCellCosts(
+      [](const typename dealii::Triangulation<dim>::cell_iterator& cell) {
+        return cell->material_id() == 1 ? 4.0 : 1.0; });
+  test_domain.SetUpDOF();
+
+  for (const auto& cell : test_domain.Cells()) {
+    EXPECT_EQ(cell->material_id(),
+              mesh_observer_ptr->GetMaterialID(cell->center()));
+    for (unsigned int f = 0; f < dealii::GeometryInfo<dim>::faces_per_cell;
+         ++f) {
+      const auto face = cell->face(f);
+      if (!face->at_boundary())
+        continue;
+      // Boundary IDs are 2 * direction for the minimum, + 1 for the maximum
+      const auto face_center = face->center();
+      int expected_boundary_id = -1;
+      for (int dir = dim - 1; dir >= 0 && expected_boundary_id < 0; --dir) {
+        if (std::abs(face_center[dir]) < 1e-14) {
+          expected_boundary_id = 2 * dir;
+        } else if (std::abs(face_center[dir] - length) < 1e-14) {
+          expected_boundary_id = 2 * dir + 1;
+        }
+      }
+      EXPECT_EQ(static_cast<int>(face->boundary_id()), expected_boundary_id);
+    }
+  }
+}
+
+TYPED_TEST(DomainDefinitionDOFTest, RefineAndCoarsenMPI) {
+  EXPECT_CALL(*this->nice_mesh_ptr, has_material_mapping()).
+      WillOnce(::testing::Return(true));
+  EXPECT_CALL(*this->nice_mesh_ptr, FillTriangulation(_))
+      .WillOnce(::testing::Invoke(this->SetTriangulation));
+  EXPECT_CALL(*this->fe_ptr, finite_element())
+      .WillRepeatedly(::testing::Return(&this->fe));
+
+  bart::domain::Definition<this->dim> test_domain(std::move(this->nice_mesh_ptr),
+                                                  this->fe_ptr);
+  test_domain.SetUpMesh();
+  test_domain.SetUpDOF();
+
+  const auto& triangulation = test_domain.dof_handler().get_triangulation();
+  const auto n_cells = triangulation.n_global_active_cells();
+  dealii::Vector<float> cell_errors(triangulation.n_active_cells());
+  int cell_index = 0;
+  for (const auto& cell : triangulation.active_cell_iterators())
+    cell_errors[cell_index++] = cell->center()[0] < 0 ? 1.0 : 0.0;
+
+  system::MPIVector owned_vector, ghosted_vector;
+  owned_vector.reinit(test_domain.locally_owned_dofs(), MPI_COMM_WORLD);
+  owned_vector = 2.0;
+  ghosted_vector.reinit(test_domain.locally_owned_dofs(),
+                        test_domain.locally_relevant_dofs(), MPI_COMM_WORLD);
+  ghosted_vector = owned_vector;
+
+  if (this->dim == 1) {
+    EXPECT_ANY_THROW(test_domain.RefineAndCoarsen(
+        cell_errors, 0.25, 0, {&owned_vector, &ghosted_vector}));
+    return;
+  }
+  test_domain.RefineAndCoarsen(cell_errors, 0.25, 0,
+                               {&owned_vector, &ghosted_vector});
+
+  EXPECT_GT(triangulation.n_global_active_cells(), n_cells);
+  const int n_dofs = test_domain.total_degrees_of_freedom();
+  EXPECT_EQ(n_dofs, test_domain.dof_handler().n_dofs());
+  int total_cells = 0;
+  for (const auto& cell : test_domain.dof_handler().active_cell_iterators()) {
+    if (cell->is_locally_owned())
+      ++total_cells;
+  }
+  EXPECT_EQ(test_domain.Cells().size(), total_cells);
+
+  // Constants are interpolated exactly, ghosted vectors stay ghosted
+  EXPECT_EQ(owned_vector.size(), n_dofs);
+  EXPECT_FALSE(owned_vector.has_ghost_elements());
+  EXPECT_TRUE(ghosted_vector.has_ghost_elements());
+  for (const auto dof : test_domain.locally_owned_dofs()) {
+    EXPECT_NEAR(owned_vector(dof), 2.0, 1e-12);
+    EXPECT_NEAR(ghosted_vector(dof), 2.0, 1e-12);
+  }
+}
+
+/* Refining a single cell leaves hanging nodes on its faces. Projecting a
+ * smooth function with the system assembled through the domain constraints
+ * and distributing the solution should give a conforming solution, the value
+ * at each hanging node is fixed by the values at the nodes of its parent
+ * face. */
+TYPED_TEST(DomainDefinitionDOFTest, HangingNodeContinuityMPI) {
+  constexpr int dim = this->dim;
+  EXPECT_CALL(*this->nice_mesh_ptr, has_material_mapping()).
+      WillOnce(::testing::Return(true));
+  EXPECT_CALL(*this->nice_mesh_ptr, FillTriangulation(_))
+      .WillOnce(::testing::Invoke(this->SetTriangulation));
+  EXPECT_CALL(*this->fe_ptr, finite_element())
+      .WillRepeatedly(::testing::Return(&this->fe));
+
+  auto test_domain_ptr = std::make_shared<bart::domain::Definition<dim>>(
+      std::move(this->nice_mesh_ptr), this->fe_ptr);
+  auto& test_domain = *test_domain_ptr;
+  test_domain.SetUpMesh();
+  test_domain.SetUpDOF();
+  if (dim == 1)
+    return;
+
+  // Refine only the corner cell
+  const auto& triangulation = test_domain.dof_handler().get_triangulation();
+  const auto n_cells = triangulation.n_global_active_cells();
+  dealii::Vector<float> cell_errors(triangulation.n_active_cells());
+  int cell_index = 0;
+  for (const auto& cell : triangulation.active_cell_iterators()) {
+    bool is_corner = true;
+    for (int i = 0; i < dim; ++i)
+      is_corner = is_corner && cell->center()[i] < -0.5;
+    cell_errors[cell_index++] = is_corner ? 1.0 : 0.0;
+  }
+  test_domain.RefineAndCoarsen(cell_errors, 1.0/n_cells, 0, {});
+  ASSERT_EQ(triangulation.n_global_active_cells(),
+            n_cells + dealii::GeometryInfo<dim>::max_children_per_cell - 1);
+
+  const auto& constraints = test_domain.constraints();
+  int n_local_constrained = 0;
+  for (const auto dof : test_domain.locally_owned_dofs()) {
+    if (constraints.is_constrained(dof))
+      ++n_local_constrained;
+  }
+  EXPECT_GT(dealii::Utilities::MPI::sum(n_local_constrained, MPI_COMM_WORLD),
+            0);
+
+  // Assemble the projection of f onto the finite element space
+  auto f = [](const dealii::Point<dim>& point) {
+    double value = 1;
+    for (int i = 0; i < dim; ++i)
+      value *= std::exp(point[i]) + point[i]*point[i];
+    return value;
+  };
+  dealii::FEValues<dim> fe_values(this->fe, dealii::QGauss<dim>(3),
+                                  dealii::update_values |
+                                  dealii::update_quadrature_points |
+                                  dealii::update_JxW_values);
+  formulation::Stamper<dim> stamper(test_domain_ptr);
+  auto mass_matrix_ptr = test_domain.MakeSystemMatrix();
+  auto right_hand_side_ptr = test_domain.MakeSystemVector();
+  stamper.StampMatrix(*mass_matrix_ptr, [&](formulation::FullMatrix& to_stamp,
+                                            const domain::CellPtr<dim>& cell) {
+    fe_values.reinit(cell);
+    for (unsigned int q = 0; q < fe_values.n_quadrature_points; ++q) {
+      for (unsigned int i = 0; i < this->fe.dofs_per_cell; ++i) {
+        for (unsigned int j = 0; j < this->fe.dofs_per_cell; ++j) {
+          to_stamp(i, j) += fe_values.shape_value(i, q)
+              * fe_values.shape_value(j, q) * fe_values.JxW(q);
+        }
+      }
+    }
+  });
+  stamper.StampVector(*right_hand_side_ptr, [&](formulation::Vector& to_stamp,
+                                                const domain::CellPtr<dim>& cell) {
+    fe_values.reinit(cell);
+    for (unsigned int q = 0; q < fe_values.n_quadrature_points; ++q) {
+      for (unsigned int i = 0; i < this->fe.dofs_per_cell; ++i) {
+        to_stamp(i) += fe_values.shape_value(i, q)
+            * f(fe_values.quadrature_point(q)) * fe_values.JxW(q);
+      }
+    }
+  });
+
+  system::MPIVector solution;
+  solution.reinit(test_domain.locally_owned_dofs(), MPI_COMM_WORLD);
+  solver::GMRES gmres(1000, 1e-12);
+  dealii::PETScWrappers::PreconditionNone no_preconditioner(*mass_matrix_ptr);
+  gmres.Solve(mass_matrix_ptr.get(), &solution, right_hand_side_ptr.get(),
+              &no_preconditioner);
+  constraints.distribute(solution);
+
+  system::MPIVector ghosted_solution;
+  ghosted_solution.reinit(test_domain.locally_owned_dofs(),
+                          test_domain.locally_relevant_dofs(), MPI_COMM_WORLD);
+  ghosted_solution = solution;
+
+  for (const auto dof : test_domain.locally_owned_dofs()) {
+    if (!constraints.is_constrained(dof))
+      continue;
+    double parent_value = 0;
+    for (const auto& [parent_dof, weight] :
+        *constraints.get_constraint_entries(dof))
+      parent_value += weight * ghosted_solution(parent_dof);
+    EXPECT_NE(ghosted_solution(dof), 0);
+    EXPECT_NEAR(ghosted_solution(dof), parent_value, 1e-12);
+  }
+}
+
 TYPED_TEST(DomainDefinitionDOFTest, SystemMatrixMPI) {
   EXPECT_CALL(*this->nice_mesh_ptr, has_material_mapping()).
       WillOnce(::testing::Return(true));
@@ -165,6 +533,64 @@ TYPED_TEST(DomainDefinitionDOFTest, SystemMatrixMPI) {
   EXPECT_EQ(system_matrix_ptr->m(), test_domain.locally_owned_dofs().size());
 }
 
+TYPED_TEST(DomainDefinitionDOFTest, SystemMatricesShareSparsityMPI) {
+  EXPECT_CALL(*this->nice_mesh_ptr, has_material_mapping()).
+      WillOnce(::testing::Return(true));
+  EXPECT_CALL(*this->nice_mesh_ptr, FillTriangulation(_))
+      .WillOnce(::testing::Invoke(this->SetTriangulation));
+  EXPECT_CALL(*this->fe_ptr, finite_element())
+      .WillOnce(::testing::Return(&this->fe));
+
+  bart::domain::Definition<this->dim> test_domain(std::move(this->nice_mesh_ptr),
+                                                  this->fe_ptr);
+  test_domain.SetUpMesh();
+  test_domain.SetUpDOF();
+
+  auto first_matrix_ptr = test_domain.MakeSystemMatrix();
+  auto second_matrix_ptr = test_domain.MakeSystemMatrix();
+
+  ASSERT_NE(first_matrix_ptr, nullptr);
+  ASSERT_NE(second_matrix_ptr, nullptr);
+  EXPECT_NE(first_matrix_ptr, second_matrix_ptr);
+  EXPECT_EQ(second_matrix_ptr->m(), first_matrix_ptr->m());
+  EXPECT_EQ(second_matrix_ptr->n(), first_matrix_ptr->n());
+  EXPECT_EQ(second_matrix_ptr->n_nonzero_elements(),
+            first_matrix_ptr->n_nonzero_elements());
+  // Duplicates report the communicator of the domain, not the one of the
+  // empty matrix they replaced
+  for (const auto& matrix_ptr : {first_matrix_ptr, second_matrix_ptr}) {
+    int world_comparison, self_comparison;
+    MPI_Comm_compare(matrix_ptr->get_mpi_communicator(), MPI_COMM_WORLD,
+                     &world_comparison);
+    MPI_Comm_compare(matrix_ptr->get_mpi_communicator(), MPI_COMM_SELF,
+                     &self_comparison);
+    EXPECT_NE(world_comparison, MPI_UNEQUAL);
+    EXPECT_NE(self_comparison, MPI_IDENT);
+  }
+
+  // The nonzero structure is the same array, not a copy
+  const PetscInt* first_columns =
+      LocalColumnIndices(first_matrix_ptr->petsc_matrix());
+  const PetscInt* second_columns =
+      LocalColumnIndices(second_matrix_ptr->petsc_matrix());
+  if (!test_domain.locally_owned_dofs().is_empty()) {
+    EXPECT_NE(first_columns, nullptr);
+    EXPECT_EQ(first_columns, second_columns);
+  }
+
+  // Values are independent
+  const auto owned_dofs = test_domain.locally_owned_dofs();
+  if (!owned_dofs.is_empty())
+    first_matrix_ptr->set(*owned_dofs.begin(), *owned_dofs.begin(), 2.0);
+  first_matrix_ptr->compress(dealii::VectorOperation::insert);
+  second_matrix_ptr->compress(dealii::VectorOperation::insert);
+  if (!owned_dofs.is_empty()) {
+    const auto row = *owned_dofs.begin();
+    EXPECT_EQ((*first_matrix_ptr)(row, row), 2.0);
+    EXPECT_EQ((*second_matrix_ptr)(row, row), 0.0);
+  }
+}
+
 TYPED_TEST(DomainDefinitionDOFTest, SystemVectorMPI) {
   EXPECT_CALL(*this->nice_mesh_ptr, has_material_mapping()).
       WillOnce(::testing::Return(true));
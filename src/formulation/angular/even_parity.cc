@@ -0,0 +1,254 @@
+#include "formulation/angular/even_parity.h"
+
+#include <cmath>
+#include <sstream>
+
+namespace bart {
+
+namespace formulation {
+
+namespace angular {
+
+template <int dim>
+EvenParity<dim>::EvenParity(
+    std::shared_ptr<domain::finite_element::FiniteElementI<dim>> finite_element_ptr,
+    std::shared_ptr<data::CrossSections> cross_sections_ptr)
+    : finite_element_ptr_(finite_element_ptr),
+      cross_sections_ptr_(cross_sections_ptr),
+      cell_degrees_of_freedom_(finite_element_ptr->dofs_per_cell()),
+      cell_quadrature_points_(finite_element_ptr->n_cell_quad_pts()),
+      face_quadrature_points_(finite_element_ptr->n_face_quad_pts()) {}
+
+template <int dim>
+void EvenParity<dim>::FillBoundaryBilinearTerm(
+    FullMatrix& to_fill,
+    const domain::CellPtr<dim>& cell_ptr,
+    const domain::FaceIndex face_number,
+    const std::shared_ptr<quadrature::QuadraturePointI<dim>> quadrature_point) {
+  ValidateMatrixSize(to_fill, __FUNCTION__);
+  AssertThrow(cell_ptr.state() == dealii::IteratorState::valid,
+              dealii::ExcMessage("Bad cell given to FillBoundaryBilinearTerm"))
+  finite_element_ptr_->SetFace(cell_ptr, face_number);
+
+  const double abs_normal_dot_omega = std::abs(
+      finite_element_ptr_->FaceNormal() *
+      quadrature_point->cartesian_position_tensor());
+
+  for (int f_q = 0; f_q < face_quadrature_points_; ++f_q) {
+    const double jacobian = finite_element_ptr_->FaceJacobian(f_q);
+    for (int i = 0; i < cell_degrees_of_freedom_; ++i) {
+      for (int j = 0; j < cell_degrees_of_freedom_; ++j) {
+        to_fill(i, j) += abs_normal_dot_omega
+            * finite_element_ptr_->FaceShapeValue(i, f_q)
+            * finite_element_ptr_->FaceShapeValue(j, f_q)
+            * jacobian;
+      }
+    }
+  }
+}
+
+template <int dim>
+void EvenParity<dim>::FillCellCollisionTerm(
+    FullMatrix& to_fill,
+    const domain::CellPtr<dim>& cell_ptr,
+    const system::EnergyGroup group_number) {
+  ValidateMatrixSize(to_fill, __FUNCTION__);
+  ValidateAndSetCell(cell_ptr, __FUNCTION__);
+
+  const auto& table = cross_sections_ptr_->table;
+  const double sigma_t = table.sigma_t(
+      table.MaterialIndex(cell_ptr->material_id()))[group_number.get()];
+
+  for (int q = 0; q < cell_quadrature_points_; ++q) {
+    const double jacobian = finite_element_ptr_->Jacobian(q);
+    for (int i = 0; i < cell_degrees_of_freedom_; ++i) {
+      for (int j = 0; j < cell_degrees_of_freedom_; ++j) {
+        to_fill(i, j) += sigma_t * finite_element_ptr_->ShapeValue(i, q) *
+            finite_element_ptr_->ShapeValue(j, q) * jacobian;
+      }
+    }
+  }
+}
+
+template <int dim>
+void EvenParity<dim>::FillCellFissionSourceTerm(
+    Vector& to_fill,
+    const domain::CellPtr<dim>& cell_ptr,
+    const system::EnergyGroup group_number,
+    const double k_eff,
+    const system::moments::MomentVector& in_group_moment,
+    const system::moments::MomentStore& group_moments) {
+  ValidateVectorSize(to_fill, __FUNCTION__);
+  ValidateAndSetCell(cell_ptr, __FUNCTION__);
+
+  const auto& table = cross_sections_ptr_->table;
+  const int material = table.MaterialIndex(cell_ptr->material_id());
+  const auto fiss_transfer_per_ster = table.fiss_transfer_per_ster(material);
+  const int group = group_number.get();
+
+  std::vector<double> fission_source(cell_quadrature_points_);
+
+  for (const int group_in : table.fission_source_groups(material, group)) {
+    std::vector<double> scalar_flux(cell_quadrature_points_);
+
+    if (group_in == group) {
+      scalar_flux = finite_element_ptr_->ValueAtQuadrature(in_group_moment);
+    } else {
+      scalar_flux = finite_element_ptr_->ValueAtQuadrature(
+          group_moments.scalar_moment(group_in));
+    }
+
+    const double fission_xfer_per_ster =
+        fiss_transfer_per_ster(group_in, group);
+
+    for (int q = 0; q < cell_quadrature_points_; ++q)
+      fission_source.at(q) += fission_xfer_per_ster * scalar_flux.at(q) / k_eff;
+  }
+
+  FillCellSourceTerm(to_fill, fission_source);
+}
+
+template <int dim>
+void EvenParity<dim>::FillCellFixedSourceTerm(
+    Vector& to_fill,
+    const domain::CellPtr<dim>& cell_ptr,
+    const system::EnergyGroup group_number) {
+  ValidateVectorSize(to_fill, __FUNCTION__);
+  ValidateAndSetCell(cell_ptr, __FUNCTION__);
+
+  const auto& table = cross_sections_ptr_->table;
+  const int material = table.MaterialIndex(cell_ptr->material_id());
+  const double q_per_ster = table.q_per_ster(material)[group_number.get()];
+
+  FillCellSourceTerm(to_fill,
+                     std::vector<double>(cell_quadrature_points_, q_per_ster));
+}
+
+template <int dim>
+void EvenParity<dim>::FillCellScatteringSourceTerm(
+    Vector& to_fill,
+    const domain::CellPtr<dim>& cell_ptr,
+    const system::EnergyGroup group_number,
+    const system::moments::MomentVector& in_group_moment,
+    const system::moments::MomentStore& group_moments) {
+  ValidateVectorSize(to_fill, __FUNCTION__);
+  ValidateAndSetCell(cell_ptr, __FUNCTION__);
+
+  const auto& table = cross_sections_ptr_->table;
+  const int material = table.MaterialIndex(cell_ptr->material_id());
+  const auto sigma_s_per_ster = table.sigma_s_per_ster(material);
+  const int group = group_number.get();
+
+  std::vector<double> scattering_source(cell_quadrature_points_);
+
+  for (const int group_in : table.scattering_source_groups(material, group)) {
+    std::vector<double> scalar_flux(cell_quadrature_points_);
+
+    if (group_in == group) {
+      scalar_flux = finite_element_ptr_->ValueAtQuadrature(in_group_moment);
+    } else {
+      scalar_flux = finite_element_ptr_->ValueAtQuadrature(
+          group_moments.scalar_moment(group_in));
+    }
+
+    const double sigma_s_in_per_ster = sigma_s_per_ster(group, group_in);
+
+    for (int q = 0; q < cell_quadrature_points_; ++q)
+      scattering_source.at(q) += sigma_s_in_per_ster * scalar_flux.at(q);
+  }
+
+  FillCellSourceTerm(to_fill, scattering_source);
+}
+
+template <int dim>
+void EvenParity<dim>::FillCellStreamingTerm(
+    FullMatrix& to_fill,
+    const domain::CellPtr<dim>& cell_ptr,
+    const std::shared_ptr<quadrature::QuadraturePointI<dim>> quadrature_point,
+    const system::EnergyGroup group_number) {
+  ValidateMatrixSize(to_fill, __FUNCTION__);
+  ValidateAndSetCell(cell_ptr, __FUNCTION__);
+
+  const auto& table = cross_sections_ptr_->table;
+  const double inverse_sigma_t = table.inverse_sigma_t(
+      table.MaterialIndex(cell_ptr->material_id()))[group_number.get()];
+  const auto omega = quadrature_point->cartesian_position_tensor();
+
+  Vector omega_dot_gradient(cell_degrees_of_freedom_);
+  for (int q = 0; q < cell_quadrature_points_; ++q) {
+    const double jacobian = finite_element_ptr_->Jacobian(q);
+    for (int i = 0; i < cell_degrees_of_freedom_; ++i)
+      omega_dot_gradient[i] = omega * finite_element_ptr_->ShapeGradient(i, q);
+    for (int i = 0; i < cell_degrees_of_freedom_; ++i) {
+      for (int j = 0; j < cell_degrees_of_freedom_; ++j) {
+        to_fill(i, j) += inverse_sigma_t * omega_dot_gradient[i] *
+            omega_dot_gradient[j] * jacobian;
+      }
+    }
+  }
+}
+
+// PRIVATE FUNCTIONS ===========================================================
+template <int dim>
+void EvenParity<dim>::FillCellSourceTerm(Vector& to_fill,
+                                         const std::vector<double>& source) {
+  for (int q = 0; q < cell_quadrature_points_; ++q) {
+    const double jacobian = finite_element_ptr_->Jacobian(q);
+    for (int i = 0; i < cell_degrees_of_freedom_; ++i) {
+      to_fill(i) += jacobian * source.at(q) *
+          finite_element_ptr_->ShapeValue(i, q);
+    }
+  }
+}
+
+template <int dim>
+void EvenParity<dim>::ValidateAndSetCell(
+    const domain::CellPtr<dim>& cell_ptr,
+    std::string called_function_name) {
+  std::string error{"Error in EvenParity function " + called_function_name +
+      ": passed cell pointer is invalid"};
+  AssertThrow(cell_ptr.state() == dealii::IteratorState::valid,
+              dealii::ExcMessage(error))
+  finite_element_ptr_->SetCell(cell_ptr);
+}
+
+template <int dim>
+void EvenParity<dim>::ValidateMatrixSize(const FullMatrix& to_validate,
+                                         std::string called_function_name) {
+  auto [rows, cols] = std::pair{to_validate.n_rows(), to_validate.n_cols()};
+
+  std::ostringstream error_string;
+  error_string << "Error in EvenParity function " << called_function_name
+               << ": passed matrix size is invalid, expected size ("
+               << cell_degrees_of_freedom_ << ", " << cell_degrees_of_freedom_
+               << "), actual size: (" << rows << ", " << cols << ")";
+
+  AssertThrow((static_cast<int>(rows) == cell_degrees_of_freedom_) &&
+              (static_cast<int>(cols) == cell_degrees_of_freedom_),
+              dealii::ExcMessage(error_string.str()))
+}
+
+template <int dim>
+void EvenParity<dim>::ValidateVectorSize(const Vector& to_validate,
+                                         std::string called_function_name) {
+  const int rows = to_validate.size();
+
+  std::ostringstream error_string;
+  error_string << "Error in EvenParity function " << called_function_name
+               << ": passed vector size is invalid, expected size ("
+               << cell_degrees_of_freedom_ << ", 1), actual size: (" << rows
+               << ", 1)";
+
+  AssertThrow(rows == cell_degrees_of_freedom_,
+              dealii::ExcMessage(error_string.str()))
+}
+
+template class EvenParity<1>;
+template class EvenParity<2>;
+template class EvenParity<3>;
+
+} // namespace angular
+
+} // namespace formulation
+
+} // namespace bart
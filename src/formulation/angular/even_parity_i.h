@@ -0,0 +1,179 @@
+#ifndef BART_SRC_FORMULATION_ANGULAR_EVEN_PARITY_I_H_
+#define BART_SRC_FORMULATION_ANGULAR_EVEN_PARITY_I_H_
+
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/dofs/dof_accessor.h>
+
+#include "domain/domain_types.h"
+#include "formulation/formulation_types.h"
+#include "quadrature/quadrature_point_i.h"
+#include "system/system_types.h"
+#include "system/moments/moment_store.h"
+#include "system/moments/spherical_harmonic_types.h"
+
+namespace bart {
+
+namespace formulation {
+
+namespace angular {
+
+/*! \brief Interface for the even-parity transport formulation.
+ *
+ * The even-parity angular flux is the average of the angular flux in a
+ * direction and its reflection across the origin,
+ * \f[
+ * \psi^+(\vec{\Omega}) = \frac{\psi(\vec{\Omega}) + \psi(-\vec{\Omega})}{2},
+ * \f]
+ * and, for isotropic sources, is the solution of the second-order equation
+ * \f[
+ * -\vec{\Omega}\cdot\nabla\frac{1}{\sigma_t}\vec{\Omega}\cdot\nabla\psi^+ +
+ * \sigma_t\psi^+ = \frac{q}{4\pi}.
+ * \f]
+ * The equation is the same for \f$\vec{\Omega}\f$ and \f$-\vec{\Omega}\f$, it
+ * is therefore only solved over half of the quadrature set and the scalar flux
+ * is \f$\phi = 2\sum_{n \in \text{half}} w_n\psi^+_n\f$.
+ *
+ * @tparam dim spatial dimension
+ */
+template <int dim>
+class EvenParityI {
+ public:
+  virtual ~EvenParityI() = default;
+
+  /*! \brief Integrates the bilinear vacuum boundary term and fills a given
+   * matrix.
+   *
+   * For a given boundary face of the triangulation, \f$\partial K \in
+   * \partial T_K\f$, with basis functions \f$\varphi\f$, this function
+   * integrates the vacuum boundary term and adds it to the local cell matrix.
+   * The term does not depend on the sign of \f$(\hat{n}\cdot\vec{\Omega})\f$,
+   * both the direction and its reflection are represented by \f$\psi^+\f$:
+   * \f[
+   * \mathbf{A}(i,j)_{K,g}' = \mathbf{A}(i,j)_{K,g} +
+   * \int_{\partial K}
+   * |\hat{n}\cdot\vec{\Omega}|\varphi_i(\vec{r})
+   * \varphi_j(\vec{r})
+   * dS
+   * \f]
+   *
+   * @param to_fill cell matrix to fill
+   * @param cell_ptr pointer to the cell
+   * @param face_number boundary face of the cell
+   * @param quadrature_point quadrature point to provide \f$\Omega\f$
+   * \return No values returned, modifies input parameter \f$\mathbf{A}\to \mathbf{A}'\f$.
+   */
+  virtual void FillBoundaryBilinearTerm(
+      FullMatrix& to_fill,
+      const domain::CellPtr<dim>& cell_ptr,
+      const domain::FaceIndex face_number,
+      const std::shared_ptr<quadrature::QuadraturePointI<dim>> quadrature_point) = 0;
+
+  /*! \brief Integrates the bilinear collision term and fills a given matrix.
+   *
+   * \f[
+   * \mathbf{A}(i,j)_{K,g}' = \mathbf{A}(i,j)_{K,g} +
+   * \int_{K}\sigma_{t,g}(\vec{r})\varphi_i(\vec{r})
+   * \varphi_j(\vec{r}) dV
+   * \f]
+   *
+   * @param to_fill cell matrix to fill
+   * @param cell_ptr pointer to the cell
+   * @param group_number energy group to fill
+   * \return No values returned, modifies input parameter \f$\mathbf{A}\to \mathbf{A}'\f$.
+   */
+  virtual void FillCellCollisionTerm(
+      FullMatrix& to_fill,
+      const domain::CellPtr<dim>& cell_ptr,
+      const system::EnergyGroup group_number) = 0;
+
+  /*! \brief Integrates the linear fission term and fills a given vector.
+   *
+   * \f[
+   * \vec{b}(i)_{K,g}' = \vec{b}(i)_{K,g} +
+   * \int_{K}\frac{q_g(\vec{r})}{4\pi}\varphi_i(\vec{r})dV
+   * \f]
+   *
+   * where \f$q_g(\vec{r})\f$ is the fission source. Isotropic sources have no
+   * odd-parity part, so unlike SAAF there is no streaming source term.
+   *
+   * @param to_fill cell vector to fill
+   * @param cell_ptr pointer to the cell
+   * @param group_number energy group number
+   * @param k_eff k effective
+   * @param in_group_moment in-group flux moments
+   * @param group_moments full set of group moments
+   */
+  virtual void FillCellFissionSourceTerm(
+      Vector& to_fill,
+      const domain::CellPtr<dim>& cell_ptr,
+      const system::EnergyGroup group_number,
+      const double k_eff,
+      const system::moments::MomentVector& in_group_moment,
+      const system::moments::MomentStore& group_moments) = 0;
+
+  /*! \brief Integrates the linear fixed source term and fills a given vector.
+   *
+   * \f[
+   * \vec{b}(i)_{K,g}' = \vec{b}(i)_{K,g} +
+   * \int_{K}\frac{q_g(\vec{r})}{4\pi}\varphi_i(\vec{r})dV
+   * \f]
+   *
+   * @param to_fill cell vector to fill
+   * @param cell_ptr pointer to the cell
+   * @param group_number energy group number
+   */
+  virtual void FillCellFixedSourceTerm(
+      Vector& to_fill,
+      const domain::CellPtr<dim>& cell_ptr,
+      const system::EnergyGroup group_number) = 0;
+
+  /*! \brief Integrates the linear scattering source and fills a given vector.
+   *
+   * \f[
+   * \vec{b}(i)_{K,g}' = \vec{b}(i)_{K,g} + \sum_{g'}
+   * \int_{K}\frac{\sigma_{s,g'\to g}(\vec{r})}{4\pi}\phi_{g'}(\vec{r})
+   * \varphi_i(\vec{r}) dV
+   * \f]
+   *
+   * @param to_fill cell vector to fill
+   * @param cell_ptr pointer to the cell
+   * @param group_number energy group number
+   * @param in_group_moment in-group scalar flux moment
+   * @param group_moments out-group scalar flux moments
+   */
+  virtual void FillCellScatteringSourceTerm(
+      Vector& to_fill,
+      const domain::CellPtr<dim>& cell_ptr,
+      const system::EnergyGroup group_number,
+      const system::moments::MomentVector& in_group_moment,
+      const system::moments::MomentStore& group_moments) = 0;
+
+  /*! \brief Integrates the bilinear streaming term and fills a given matrix.
+   *
+   * \f[
+   * \mathbf{A}(i,j)_{K,g}' = \mathbf{A}(i,j)_{K,g} +
+   * \int_{K}\left(\vec{\Omega}\cdot\nabla\varphi_i(\vec{r})\right)
+   * \frac{1}{\sigma_{t,g}(\vec{r})}\left(\vec{\Omega}\cdot\nabla\varphi_j
+   * (\vec{r})\right) dV
+   * \f]
+   *
+   * @param to_fill cell matrix to fill
+   * @param cell_ptr pointer to the cell
+   * @param quadrature_point quadrature point to provide \f$\Omega\f$
+   * @param group_number energy group to fill
+   * \return No values returned, modifies input parameter \f$\mathbf{A}\to \mathbf{A}'\f$.
+   */
+  virtual void FillCellStreamingTerm(
+      FullMatrix& to_fill,
+      const domain::CellPtr<dim>& cell_ptr,
+      const std::shared_ptr<quadrature::QuadraturePointI<dim>> quadrature_point,
+      const system::EnergyGroup group_number) = 0;
+};
+
+} // namespace angular
+
+} // namespace formulation
+
+} // namespace bart
+
+#endif //BART_SRC_FORMULATION_ANGULAR_EVEN_PARITY_I_H_
@@ -3,6 +3,8 @@
 #include <algorithm>
 #include <sstream>
 
+#include "quadrature/utility/quadrature_utilities.h"
+
 namespace bart {
 
 namespace formulation {
@@ -28,11 +30,14 @@ void SelfAdjointAngularFlux<dim>::Initialize(const domain::CellPtr<dim> &cell_pt
                                  "cell pointer is invalid."))
 
   finite_element_ptr_->SetCell(cell_ptr);
+  quadrature_set_view_ptr_ =
+      std::make_unique<quadrature::QuadratureSetView<dim>>(*quadrature_set_ptr_);
   shape_squared_ = {};
-  omega_dot_gradient_ = {};
 
-  /* Precalculated values are held in maps that are indexed by the cell
-   * quadrature point where they are valid */
+  /* Precalculated shape squared values are held in a map indexed by the cell
+   * quadrature point where they are valid. Shape gradients depend on the size
+   * and shape of each cell so omega dot gradient values are calculated by the
+   * fill functions on the cell being filled. */
   for (int cell_quad_index = 0; cell_quad_index < cell_quadrature_points_;
        ++cell_quad_index) {
     formulation::FullMatrix shape_squared(cell_degrees_of_freedom_,
@@ -45,31 +50,6 @@ void SelfAdjointAngularFlux<dim>::Initialize(const domain::CellPtr<dim> &cell_pt
       }
     }
     shape_squared_.insert_or_assign(cell_quad_index, shape_squared);
-
-    /* Each cell quadrature point has a further mapping based on the angular
-     * quadrature point. */
-    for (int angle_index : quadrature_set_ptr_->quadrature_point_indices()) {
-      auto quadrature_point_ptr = quadrature_set_ptr_->GetQuadraturePoint(
-          quadrature::QuadraturePointIndex(angle_index));
-
-      dealii::Vector<double> omega_dot_gradient_vector(cell_degrees_of_freedom_);
-      for (int i = 0; i < cell_degrees_of_freedom_; ++i) {
-        omega_dot_gradient_vector[i] =
-            quadrature_point_ptr->cartesian_position_tensor() *
-            finite_element_ptr_->ShapeGradient(i, cell_quad_index);
-      }
-
-      omega_dot_gradient_.insert_or_assign({cell_quad_index, angle_index},
-                                           omega_dot_gradient_vector);
-
-      FullMatrix omega_dot_gradient_squared(cell_degrees_of_freedom_,
-                                            cell_degrees_of_freedom_);
-      omega_dot_gradient_squared.outer_product(omega_dot_gradient_vector,
-                                               omega_dot_gradient_vector);
-      omega_dot_gradient_squared_.insert_or_assign(
-          {cell_quad_index, angle_index},
-          omega_dot_gradient_squared);
-    }
   }
   is_initialized_ = true;
 }
@@ -115,9 +95,9 @@ void SelfAdjointAngularFlux<dim>::FillCellCollisionTerm(
   VerifyInitialized(__FUNCTION__);
   ValidateMatrixSizeAndSetCell(cell_ptr, to_fill, __FUNCTION__);
 
-  const int material_id = cell_ptr->material_id();
-  const double sigma_t =
-      cross_sections_ptr_->sigma_t.at(material_id).at(group_number.get());
+  const auto& table = cross_sections_ptr_->table;
+  const double sigma_t = table.sigma_t(
+      table.MaterialIndex(cell_ptr->material_id()))[group_number.get()];
 
   for (int q = 0; q < cell_quadrature_points_; ++q) {
     const double jacobian = finite_element_ptr_->Jacobian(q);
@@ -134,15 +114,17 @@ template<int dim>
 void SelfAdjointAngularFlux<dim>::FillCellFissionSourceTerm(
     Vector &to_fill,
     const domain::CellPtr<dim> & cell_ptr,
-    const std::shared_ptr<quadrature::QuadraturePointI<dim>> quadrature_point,
+    const quadrature::QuadraturePointIndex quadrature_point_index,
     const system::EnergyGroup group_number,
     const double k_eff,
     const system::moments::MomentVector & in_group_moment,
-    const system::moments::MomentsMap & group_moments) {
+    const system::moments::MomentStore & group_moments) {
   VerifyInitialized(__FUNCTION__);
   ValidateVectorSizeAndSetCell(cell_ptr, to_fill, __FUNCTION__);
 
-  const int material_id = cell_ptr->material_id();
+  const auto& table = cross_sections_ptr_->table;
+  const int material = table.MaterialIndex(cell_ptr->material_id());
+  const auto fiss_transfer_per_ster = table.fiss_transfer_per_ster(material);
   const int group = group_number.get();
 
   /* The scattering source is determined as the common values in both of the
@@ -151,31 +133,26 @@ void SelfAdjointAngularFlux<dim>::FillCellFissionSourceTerm(
 
   std::vector<double> fission_source(cell_quadrature_points_);
 
-  // Get the contribution from each group
-  for (const auto& moment_pair : group_moments) {
-    auto &[index, moment] = moment_pair;
-    const auto &[group_in, harmonic_l, harmonic_m] = index;
+  // Get the contribution from each contributing group
+  for (const int group_in : table.fission_source_groups(material, group)) {
+    std::vector<double> scalar_flux(cell_quadrature_points_);
 
-    if ((harmonic_l == 0) && (harmonic_m == 0)) {
-      std::vector<double> scalar_flux(cell_quadrature_points_);
-
-      if (group_in == group) {
-        scalar_flux = finite_element_ptr_->ValueAtQuadrature(in_group_moment);
-      } else {
-        scalar_flux = finite_element_ptr_->ValueAtQuadrature(moment);
-      }
+    if (group_in == group) {
+      scalar_flux = finite_element_ptr_->ValueAtQuadrature(in_group_moment);
+    } else {
+      scalar_flux = finite_element_ptr_->ValueAtQuadrature(
+          group_moments.scalar_moment(group_in));
+    }
 
-      const auto fission_xfer_per_ster =
-          cross_sections_ptr_->fiss_transfer_per_ster.at(material_id)(group_in,
-                                                                      group);
+    const double fission_xfer_per_ster =
+        fiss_transfer_per_ster(group_in, group);
 
-      for (int q = 0; q < cell_quadrature_points_; ++q){
-        fission_source.at(q) += fission_xfer_per_ster * scalar_flux.at(q) / k_eff;
-      }
+    for (int q = 0; q < cell_quadrature_points_; ++q){
+      fission_source.at(q) += fission_xfer_per_ster * scalar_flux.at(q) / k_eff;
     }
   }
 
-  FillCellSourceTerm(to_fill, material_id, quadrature_point, group_number,
+  FillCellSourceTerm(to_fill, material, quadrature_point_index, group_number,
                      fission_source);
 }
 
@@ -183,19 +160,19 @@ template<int dim>
 void SelfAdjointAngularFlux<dim>::FillCellFixedSourceTerm(
     Vector &to_fill,
     const domain::CellPtr<dim> &cell_ptr,
-    const std::shared_ptr<quadrature::QuadraturePointI<dim>> quadrature_point,
+    const quadrature::QuadraturePointIndex quadrature_point_index,
     const system::EnergyGroup group_number) {
   VerifyInitialized(__FUNCTION__);
   ValidateVectorSizeAndSetCell(cell_ptr, to_fill, __FUNCTION__);
 
-  const int material_id = cell_ptr->material_id();
-  const double q_per_ster =
-      cross_sections_ptr_->q_per_ster.at(material_id).at(group_number.get());
+  const auto& table = cross_sections_ptr_->table;
+  const int material = table.MaterialIndex(cell_ptr->material_id());
+  const double q_per_ster = table.q_per_ster(material)[group_number.get()];
 
   std::vector<double> fixed_source(cell_degrees_of_freedom_);
   std::fill(fixed_source.begin(), fixed_source.end(), q_per_ster);
 
-  FillCellSourceTerm(to_fill, material_id, quadrature_point, group_number,
+  FillCellSourceTerm(to_fill, material, quadrature_point_index, group_number,
                      fixed_source);
 }
 
@@ -203,14 +180,16 @@ template<int dim>
 void SelfAdjointAngularFlux<dim>::FillCellScatteringSourceTerm(
     Vector &to_fill,
     const domain::CellPtr<dim> &cell_ptr,
-    const std::shared_ptr<quadrature::QuadraturePointI<dim>> quadrature_point,
+    const quadrature::QuadraturePointIndex quadrature_point_index,
     const system::EnergyGroup group_number,
     const system::moments::MomentVector &in_group_moment,
-    const system::moments::MomentsMap &group_moments) {
+    const system::moments::MomentStore &group_moments) {
   VerifyInitialized(__FUNCTION__);
   ValidateVectorSizeAndSetCell(cell_ptr, to_fill, __FUNCTION__);
 
-  const int material_id = cell_ptr->material_id();
+  const auto& table = cross_sections_ptr_->table;
+  const int material = table.MaterialIndex(cell_ptr->material_id());
+  const auto sigma_s_per_ster = table.sigma_s_per_ster(material);
   const int group = group_number.get();
 
   /* The scattering source is determined as the common values in both of the
@@ -219,30 +198,59 @@ void SelfAdjointAngularFlux<dim>::FillCellScatteringSourceTerm(
 
   std::vector<double> scattering_source(cell_quadrature_points_);
 
-  // Get the contribution from each group
-  for (const auto& moment_pair : group_moments) {
-    auto &[index, moment] = moment_pair;
-    const auto &[group_in, harmonic_l, harmonic_m] = index;
+  // Get the contribution from each contributing group
+  for (const int group_in : table.scattering_source_groups(material, group)) {
+    std::vector<double> scalar_flux(cell_quadrature_points_);
 
-    if ((harmonic_l == 0) && (harmonic_m == 0)) {
-      std::vector<double> scalar_flux(cell_quadrature_points_);
+    if (group_in == group) {
+      scalar_flux = finite_element_ptr_->ValueAtQuadrature(in_group_moment);
+    } else {
+      scalar_flux = finite_element_ptr_->ValueAtQuadrature(
+          group_moments.scalar_moment(group_in));
+    }
 
-      if (group_in == group) {
-        scalar_flux = finite_element_ptr_->ValueAtQuadrature(in_group_moment);
-      } else {
-        scalar_flux = finite_element_ptr_->ValueAtQuadrature(moment);
-      }
+    const double sigma_s_in_per_ster = sigma_s_per_ster(group, group_in);
 
-      const auto sigma_s_per_ster =
-          cross_sections_ptr_->sigma_s_per_ster.at(material_id)(group, group_in);
+    for (int q = 0; q < cell_quadrature_points_; ++q){
+      scattering_source.at(q) += sigma_s_in_per_ster * scalar_flux.at(q);
+    }
+  }
 
-      for (int q = 0; q < cell_quadrature_points_; ++q){
-        scattering_source.at(q) += sigma_s_per_ster * scalar_flux.at(q);
+  /* Anisotropic scattering, the Legendre moments of the scattering
+   * cross-section couple to the angular moments of the same degree through the
+   * real spherical harmonics in the direction of this quadrature point. */
+  const int scattering_order = std::min(table.max_scattering_order(),
+                                        group_moments.max_harmonic_l());
+  const auto position = quadrature_set_view_ptr_->cartesian_position(
+      quadrature_point_index.get());
+  for (int l = 1; l <= scattering_order; ++l) {
+    const auto sigma_s_l_per_ster = table.scattering_moment_per_ster(material,
+                                                                     l);
+    for (int m = -l; m <= l; ++m) {
+      // Harmonics that vanish by symmetry, in 1D all m != 0 and in 2D those
+      // odd across the xy-plane
+      if ((dim == 1 && m != 0) || (dim == 2 && (l + m) % 2 != 0))
+        continue;
+      const double harmonic =
+          quadrature::utility::RealSphericalHarmonic<dim>(l, m, position);
+
+      for (const int group_in : table.scattering_source_groups(material,
+                                                               group)) {
+        const double sigma_s_l_in_per_ster = sigma_s_l_per_ster(group,
+                                                                group_in);
+        if (sigma_s_l_in_per_ster == 0)
+          continue;
+        const auto moment = finite_element_ptr_->ValueAtQuadrature(
+            group_moments.at({group_in, l, m}));
+        for (int q = 0; q < cell_quadrature_points_; ++q) {
+          scattering_source.at(q) +=
+              sigma_s_l_in_per_ster * harmonic * moment.at(q);
+        }
       }
     }
   }
 
-  FillCellSourceTerm(to_fill, material_id, quadrature_point, group_number,
+  FillCellSourceTerm(to_fill, material, quadrature_point_index, group_number,
                      scattering_source);
 }
 
@@ -250,47 +258,68 @@ template<int dim>
 void SelfAdjointAngularFlux<dim>::FillCellStreamingTerm(
     FullMatrix &to_fill,
     const domain::CellPtr<dim> &cell_ptr,
-    const std::shared_ptr<quadrature::QuadraturePointI<dim>> quadrature_point,
+    const quadrature::QuadraturePointIndex quadrature_point_index,
     const system::EnergyGroup group_number) {
   VerifyInitialized(__FUNCTION__);
   ValidateMatrixSizeAndSetCell(cell_ptr, to_fill, __FUNCTION__);
 
-  const int material_id = cell_ptr->material_id();
-  const double inverse_sigma_t =
-      cross_sections_ptr_->inverse_sigma_t.at(material_id).at(group_number.get());
-  const int angle_index = quadrature_set_ptr_->GetQuadraturePointIndex(
-      quadrature_point);
+  const auto& table = cross_sections_ptr_->table;
+  const double inverse_sigma_t = table.inverse_sigma_t(
+      table.MaterialIndex(cell_ptr->material_id()))[group_number.get()];
+  const auto omega = quadrature_set_view_ptr_->omega_tensor(
+      quadrature_point_index.get());
 
+  Vector omega_dot_gradient(cell_degrees_of_freedom_);
   for (int q = 0; q < cell_quadrature_points_; ++q) {
     const double jacobian = finite_element_ptr_->Jacobian(q);
-    const FullMatrix omega_dot_gradient_squared = OmegaDotGradientSquared(
-        q, quadrature::QuadraturePointIndex(angle_index));
+    FillOmegaDotGradient(omega_dot_gradient, omega, q);
     for (int i = 0; i < cell_degrees_of_freedom_; ++i) {
       for (int j = 0; j < cell_degrees_of_freedom_; ++j) {
-        to_fill(i, j) +=
-            inverse_sigma_t * omega_dot_gradient_squared(i,j) * jacobian;
+        to_fill(i, j) += inverse_sigma_t * omega_dot_gradient[i] *
+            omega_dot_gradient[j] * jacobian;
       }
     }
   }
 }
 
-template <int dim>
-std::vector<double> SelfAdjointAngularFlux<dim>::OmegaDotGradient(
-    int cell_quadrature_point,
-    quadrature::QuadraturePointIndex angular_index) const {
-  std::vector<double> return_vector(cell_degrees_of_freedom_);
-  std::pair<int, int> index{cell_quadrature_point, angular_index.get()};
-  for (int i = 0; i < cell_degrees_of_freedom_; ++i)
-    return_vector.at(i) = omega_dot_gradient_.at(index)[i];
-  return return_vector;
-}
+template<int dim>
+void SelfAdjointAngularFlux<dim>::FillReflectiveBoundaryLinearTerm(
+    Vector &to_fill,
+    const domain::CellPtr<dim> &cell_ptr,
+    const domain::FaceIndex face_number,
+    const std::shared_ptr<quadrature::QuadraturePointI<dim>> quadrature_point,
+    const system::MPIVector &reflected_angular_flux) {
+  VerifyInitialized(__FUNCTION__);
+  ValidateVectorSize(to_fill, __FUNCTION__);
+  AssertThrow(cell_ptr.state() == dealii::IteratorState::valid,
+              dealii::ExcMessage("Bad cell given to "
+                                 "FillReflectiveBoundaryLinearTerm"))
+  finite_element_ptr_->SetFace(cell_ptr, face_number);
 
-template <int dim>
-FullMatrix SelfAdjointAngularFlux<dim>::OmegaDotGradientSquared(
-    int cell_quadrature_point,
-    quadrature::QuadraturePointIndex angular_index) const {
-  return omega_dot_gradient_squared_.at(
-      {cell_quadrature_point, angular_index.get()});
+  const double normal_dot_omega = finite_element_ptr_->FaceNormal() *
+      quadrature_point->cartesian_position_tensor();
+
+  if (normal_dot_omega < 0) {
+    // Face degrees of freedom may be owned by another process, they are read
+    // from the ghost entries
+    dealii::Vector<double> cell_reflected_flux(cell_ptr->get_fe().dofs_per_cell);
+    cell_ptr->get_dof_values(reflected_angular_flux, cell_reflected_flux);
+
+    for (int f_q = 0; f_q < face_quadrature_points_; ++f_q) {
+      double incoming_flux = 0;
+      for (int j = 0; j < cell_degrees_of_freedom_; ++j) {
+        incoming_flux += cell_reflected_flux[j]
+            * finite_element_ptr_->FaceShapeValue(j, f_q);
+      }
+      const double jacobian = finite_element_ptr_->FaceJacobian(f_q);
+      for (int i = 0; i < cell_degrees_of_freedom_; ++i) {
+        to_fill(i) -= normal_dot_omega
+            * finite_element_ptr_->FaceShapeValue(i, f_q)
+            * incoming_flux
+            * jacobian;
+      }
+    }
+  }
 }
 
 // PRIVATE FUNCTIONS ===========================================================
@@ -346,29 +375,40 @@ void SelfAdjointAngularFlux<dim>::ValidateVectorSize(
 template <int dim>
 void SelfAdjointAngularFlux<dim>::FillCellSourceTerm(
     bart::formulation::Vector &to_fill,
-    const int material_id,
-    const std::shared_ptr<bart::quadrature::QuadraturePointI<dim>> quadrature_point,
+    const int material_index,
+    const quadrature::QuadraturePointIndex quadrature_point_index,
     const bart::system::EnergyGroup group_number,
     std::vector<double> source) {
-  const double inverse_sigma_t =
-      cross_sections_ptr_->inverse_sigma_t.at(material_id).at(group_number.get());
-  const int angle_index = quadrature_set_ptr_->GetQuadraturePointIndex(
-      quadrature_point);
+  const double inverse_sigma_t = cross_sections_ptr_->table.inverse_sigma_t(
+      material_index)[group_number.get()];
+  const auto omega = quadrature_set_view_ptr_->omega_tensor(
+      quadrature_point_index.get());
 
+  Vector omega_dot_gradient(cell_degrees_of_freedom_);
   for (int q = 0; q < cell_quadrature_points_; ++q) {
     const double jacobian = finite_element_ptr_->Jacobian(q);
-    const auto omega_dot_gradient = OmegaDotGradient(
-        q, quadrature::QuadraturePointIndex(angle_index));
+    FillOmegaDotGradient(omega_dot_gradient, omega, q);
 
     for (int i = 0; i < cell_degrees_of_freedom_; ++i) {
       to_fill(i) += jacobian * source.at(q) * (
           finite_element_ptr_->ShapeValue(i, q) +
-              omega_dot_gradient.at(i) * inverse_sigma_t
+              omega_dot_gradient[i] * inverse_sigma_t
       );
     }
   }
 }
 
+template <int dim>
+void SelfAdjointAngularFlux<dim>::FillOmegaDotGradient(
+    Vector& to_fill,
+    const dealii::Tensor<1, dim>& omega,
+    const int cell_quadrature_point) const {
+  for (int i = 0; i < cell_degrees_of_freedom_; ++i) {
+    to_fill[i] =
+        omega * finite_element_ptr_->ShapeGradient(i, cell_quadrature_point);
+  }
+}
+
 template<int dim>
 void SelfAdjointAngularFlux<dim>::VerifyInitialized(
     std::string called_function_name) {
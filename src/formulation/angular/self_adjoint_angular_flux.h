@@ -5,8 +5,10 @@
 #include "domain/finite_element/finite_element_i.h"
 #include "formulation/angular/self_adjoint_angular_flux_i.h"
 #include "quadrature/quadrature_set_i.h"
+#include "quadrature/quadrature_set_view.h"
 
 #include <memory>
+#include <vector>
 
 namespace bart {
 
@@ -42,38 +44,39 @@ class SelfAdjointAngularFlux : public SelfAdjointAngularFluxI<dim> {
   void FillCellFissionSourceTerm(
       Vector &to_fill,
       const domain::CellPtr<dim> &cell_ptr,
-      const std::shared_ptr<quadrature::QuadraturePointI<dim>> quadrature_point,
+      const quadrature::QuadraturePointIndex quadrature_point_index,
       const system::EnergyGroup group_number,
       const double k_eff,
       const system::moments::MomentVector &in_group_moment,
-      const system::moments::MomentsMap &group_moments) override;
+      const system::moments::MomentStore &group_moments) override;
 
   void FillCellFixedSourceTerm(
       Vector &to_fill,
       const domain::CellPtr<dim> &cell_ptr,
-      const std::shared_ptr<quadrature::QuadraturePointI<dim>> quadrature_point,
+      const quadrature::QuadraturePointIndex quadrature_point_index,
       const system::EnergyGroup group_number) override;
 
   void FillCellScatteringSourceTerm(
       Vector &to_fill,
       const domain::CellPtr<dim> &cell_ptr,
-      const std::shared_ptr<quadrature::QuadraturePointI<dim>> quadrature_point,
+      const quadrature::QuadraturePointIndex quadrature_point_index,
       const system::EnergyGroup group_number,
       const system::moments::MomentVector &in_group_moment,
-      const system::moments::MomentsMap &group_moments) override;
+      const system::moments::MomentStore &group_moments) override;
 
   void FillCellStreamingTerm(
       FullMatrix &to_fill,
       const domain::CellPtr<dim> &cell_ptr,
-      const std::shared_ptr<quadrature::QuadraturePointI<dim>> quadrature_point,
+      const quadrature::QuadraturePointIndex quadrature_point_index,
       const system::EnergyGroup group_number) override;
 
+  void FillReflectiveBoundaryLinearTerm(
+      Vector &to_fill,
+      const domain::CellPtr<dim> &cell_ptr,
+      const domain::FaceIndex face_number,
+      const std::shared_ptr<quadrature::QuadraturePointI<dim>> quadrature_point,
+      const system::MPIVector &reflected_angular_flux) override;
 
-  // Getters for pre-calculated values
-  std::vector<double> OmegaDotGradient(int cell_quadrature_point,
-                                       quadrature::QuadraturePointIndex) const;
-  FullMatrix OmegaDotGradientSquared(int cell_quadrature_point,
-                                     quadrature::QuadraturePointIndex) const;
   // Dependency getters
   domain::finite_element::FiniteElementI<dim>* finite_element_ptr() const {
     return finite_element_ptr_.get(); }
@@ -107,11 +110,17 @@ class SelfAdjointAngularFlux : public SelfAdjointAngularFluxI<dim> {
   void ValidateVectorSize(const Vector&, std::string called_function_name);
   void VerifyInitialized(std::string called_function_name);
 
+  //! Fills \f$\vec{\Omega}\cdot\nabla\varphi_i\f$ at a quadrature point of the
+  //! current cell
+  void FillOmegaDotGradient(Vector& to_fill,
+                            const dealii::Tensor<1, dim>& omega,
+                            const int cell_quadrature_point) const;
+
   // Combined implementation functions
   void FillCellSourceTerm(
       Vector& to_fill,
-      const int material_id,
-      const std::shared_ptr<quadrature::QuadraturePointI<dim>> quadrature_point,
+      const int material_index,
+      const quadrature::QuadraturePointIndex quadrature_point_index,
       const system::EnergyGroup group_number,
       std::vector<double> source);
 
@@ -123,13 +132,10 @@ class SelfAdjointAngularFlux : public SelfAdjointAngularFluxI<dim> {
   const int cell_degrees_of_freedom_ = 0; //!< Degrees of freedom per cell
   const int cell_quadrature_points_ = 0; //!< Quadrature points per cell
   const int face_quadrature_points_ = 0; //!< Quadrature points per face
-  // Precalculated matrices and vectors
+  //! Flat view of the quadrature set, built by Initialize
+  std::unique_ptr<quadrature::QuadratureSetView<dim>> quadrature_set_view_ptr_;
+  // Precalculated matrices
   using CellQuadratureIndex = int;
-  using AngleIndex = int;
-  std::map<std::pair<CellQuadratureIndex, AngleIndex>,
-           dealii::Vector<double>> omega_dot_gradient_;
-  std::map<std::pair<CellQuadratureIndex, AngleIndex>,
-           FullMatrix> omega_dot_gradient_squared_;
   std::map<CellQuadratureIndex, FullMatrix> shape_squared_ = {};
   bool is_initialized_ = false;
 };
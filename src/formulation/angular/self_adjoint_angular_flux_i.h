@@ -7,7 +7,9 @@
 #include "domain/domain_types.h"
 #include "formulation/formulation_types.h"
 #include "quadrature/quadrature_point_i.h"
+#include "quadrature/quadrature_types.h"
 #include "system/system_types.h"
+#include "system/moments/moment_store.h"
 #include "system/moments/spherical_harmonic_types.h"
 
 namespace bart {
@@ -97,7 +99,7 @@ class SelfAdjointAngularFluxI {
    *
    * @param to_fill cell vector to fill
    * @param cell_ptr pointer to the cell
-   * @param quadrature_point quadrature point
+   * @param quadrature_point_index index of the quadrature point to provide \f$\Omega\f$
    * @param group_number energy group number
    * @param k_eff k effective
    * @param in_group_moment in-group flux moments
@@ -106,11 +108,11 @@ class SelfAdjointAngularFluxI {
   virtual void FillCellFissionSourceTerm(
       Vector& to_fill,
       const domain::CellPtr<dim>& cell_ptr,
-      const std::shared_ptr<quadrature::QuadraturePointI<dim>> quadrature_point,
+      const quadrature::QuadraturePointIndex quadrature_point_index,
       const system::EnergyGroup group_number,
       const double k_eff,
       const system::moments::MomentVector& in_group_moment,
-      const system::moments::MomentsMap& group_moments) = 0;
+      const system::moments::MomentStore& group_moments) = 0;
 
   /*!
  * \brief Integrates the linear fixed-source terms and fills a given vector.
@@ -132,7 +134,7 @@ class SelfAdjointAngularFluxI {
   virtual void FillCellFixedSourceTerm(
       Vector& to_fill,
       const domain::CellPtr<dim>& cell_ptr,
-      const std::shared_ptr<quadrature::QuadraturePointI<dim>> quadrature_point,
+      const quadrature::QuadraturePointIndex quadrature_point_index,
       const system::EnergyGroup group_number) = 0;
 
   /*! \brief Integrates the linear scattering source and fills a given vector.
@@ -152,20 +154,30 @@ class SelfAdjointAngularFluxI {
    * where \f$\phi\f$ is the scalar flux. Adds the result per cell DOFF to the
    * input-output vector cell_rhs.
    *
+   * If the cross-sections and group_moments both hold Legendre moments
+   * \f$\ell > 0\f$ of scattering, \f$\sigma_{s,g'\to g}\phi_{g'}/(4\pi)\f$
+   * in both terms is replaced by the anisotropic source
+   * \f[
+   * \sum_{\ell = 0}^{L}\frac{2\ell + 1}{4\pi}\sigma_{s,\ell,g'\to g}
+   * \sum_{m = -\ell}^{\ell}Y_{\ell}^{m}(\vec{\Omega})\phi_{\ell,g'}^{m}
+   * \f]
+   * where \f$L\f$ is the lower of the two highest moments and
+   * \f$\phi_{\ell,g'}^{m}\f$ are the angular moments of group \f$g'\f$.
    *
    * @param to_fill cell vector to fill
    * @param cell_ptr pointer to the cell
-   * @param quadrature_point quadrature point to provide \f$\Omega\f$
+   * @param quadrature_point_index index of the quadrature point to provide \f$\Omega\f$
    * @param in_group_moment in-group scalar flux moment
-   * @param group_moments out-group scalar flux moments
+   * @param group_moments out-group scalar flux moments, and all group moments
+   * \f$\ell > 0\f$ for anisotropic scattering
    */
   virtual void FillCellScatteringSourceTerm(
       Vector& to_fill,
       const domain::CellPtr<dim>& cell_ptr,
-      const std::shared_ptr<quadrature::QuadraturePointI<dim>> quadrature_point,
+      const quadrature::QuadraturePointIndex quadrature_point_index,
       const system::EnergyGroup group_number,
       const system::moments::MomentVector& in_group_moment,
-      const system::moments::MomentsMap& group_moments) = 0;
+      const system::moments::MomentStore& group_moments) = 0;
 
   /*! \brief Integrates the bilinear streaming term and fills a given matrix.
    *
@@ -184,16 +196,48 @@ class SelfAdjointAngularFluxI {
    *
    * @param to_fill cell matrix to fill.
    * @param cell_ptr pointer to the cell
-   * @param quadrature_point quadrature angle to provide \f$\Omega\f$
+   * @param quadrature_point_index index of the quadrature angle to provide \f$\Omega\f$
    * @param group_number energy group to fill
    * \return No values returned, modifies input parameter \f$\mathbf{A}\to \mathbf{A}'\f$.
    */
   virtual void FillCellStreamingTerm(
       FullMatrix& to_fill,
       const domain::CellPtr<dim>& cell_ptr,
-      const std::shared_ptr<quadrature::QuadraturePointI<dim>> quadrature_point,
+      const quadrature::QuadraturePointIndex quadrature_point_index,
       const system::EnergyGroup group_number) = 0;
 
+  /*! \brief Integrates the linear reflective boundary term and fills a given
+   * vector.
+   *
+   * For a given boundary face of the triangulation, \f$\partial K \in
+   * \partial T_K\f$, and a direction entering the domain,
+   * \f$(\hat{n}\cdot\vec{\Omega}) < 0\f$, the boundary condition is
+   * \f$\Psi_b(\vec{r},\vec{\Omega}) = \Psi(\vec{r},\vec{\Omega}_r)\f$ where
+   * \f$\vec{\Omega}_r\f$ is the specular reflection of the direction off the
+   * face. The incoming angular flux is added as a linear term:
+   * \f[
+   * \vec{b}(i)_{K,g}' = \vec{b}(i)_{K,g} -
+   * \int_{\partial K}
+   * (\hat{n}\cdot\vec{\Omega})\varphi_i(\vec{r})
+   * \Psi(\vec{r},\vec{\Omega}_r)
+   * dS
+   * \f]
+   *
+   * Nothing is added for directions leaving the domain.
+   *
+   * @param to_fill cell vector to fill.
+   * @param cell_ptr pointer to the cell
+   * @param face_number boundary face of the cell
+   * @param quadrature_point quadrature angle to provide \f$\Omega\f$
+   * @param reflected_angular_flux angular flux for \f$\vec{\Omega}_r\f$,
+   * with ghost entries for the locally relevant degrees of freedom.
+   */
+  virtual void FillReflectiveBoundaryLinearTerm(
+      Vector& to_fill,
+      const domain::CellPtr<dim>& cell_ptr,
+      const domain::FaceIndex face_number,
+      const std::shared_ptr<quadrature::QuadraturePointI<dim>> quadrature_point,
+      const system::MPIVector& reflected_angular_flux) = 0;
 
   /*! \brief Initialize the formulation.
    * In general, this will pre-calculate matrix terms. The cell pointer is only
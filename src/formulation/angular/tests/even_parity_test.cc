@@ -0,0 +1,221 @@
+#include "formulation/angular/even_parity.h"
+
+#include <deal.II/base/tensor.h>
+
+#include "data/cross_sections.h"
+#include "domain/finite_element/tests/finite_element_mock.h"
+#include "material/tests/mock_material.h"
+#include "quadrature/tests/quadrature_point_mock.h"
+#include "system/system_types.h"
+#include "test_helpers/gmock_wrapper.h"
+#include "test_helpers/dealii_test_domain.h"
+#include "test_helpers/test_helper_functions.h"
+
+namespace  {
+
+using namespace bart;
+
+using ::testing::NiceMock, ::testing::Return, ::testing::_;
+
+/* Tests for the even-parity formulation. The finite element is mocked with two
+ * degrees of freedom and two quadrature points, shape values (on cells and
+ * faces) are 10*(dof + 1) + quadrature point + 1, gradients have all
+ * components equal to the shape value, and the Jacobians are
+ * 3*(quadrature point + 1). The direction has all components equal to one.
+ */
+template <typename DimensionWrapper>
+class FormulationAngularEvenParityTest :
+    public ::testing::Test,
+    bart::testing::DealiiTestDomain<DimensionWrapper::value> {
+ public:
+  static constexpr int dim = DimensionWrapper::value;
+  using FiniteElementType = NiceMock<domain::finite_element::FiniteElementMock<dim>>;
+
+  domain::CellPtr<dim> cell_ptr_;
+  std::shared_ptr<FiniteElementType> mock_finite_element_ptr_;
+  std::shared_ptr<data::CrossSections> cross_section_ptr_;
+  std::shared_ptr<NiceMock<quadrature::QuadraturePointMock<dim>>>
+      quadrature_point_ptr_;
+  NiceMock<btest::MockMaterial> mock_material_;
+
+  const int material_id_ = 1;
+  const std::unordered_map<int, std::vector<double>> sigma_t_{
+      {material_id_, {1.0, 2.0}}};
+  const std::unordered_map<int, std::vector<double>> inverse_sigma_t_{
+      {material_id_, {1.0, 0.5}}};
+  const std::unordered_map<int, std::vector<double>> q_per_ster_{
+      {material_id_, {2.0, 3.0}}};
+  const std::unordered_map<int, formulation::FullMatrix> sigma_s_per_ster_{
+      {material_id_,
+       {2, 2, std::array<double, 4>{0.25, 0.5, 0.75, 1.0}.begin()}}};
+  system::moments::MomentVector group_0_moment_, group_1_moment_;
+  system::moments::MomentStore out_group_moments_{2, 0};
+  const std::vector<double> group_0_moment_values_{0.75, 0.75};
+  const std::vector<double> group_1_moment_values_{1.0, 1.0};
+
+  void SetUp() override;
+};
+
+template <typename DimensionWrapper>
+void FormulationAngularEvenParityTest<DimensionWrapper>::SetUp() {
+  this->SetUpDealii();
+  mock_finite_element_ptr_ = std::make_shared<FiniteElementType>();
+
+  ON_CALL(*mock_finite_element_ptr_, dofs_per_cell()).WillByDefault(Return(2));
+  ON_CALL(*mock_finite_element_ptr_, n_cell_quad_pts()).WillByDefault(Return(2));
+  ON_CALL(*mock_finite_element_ptr_, n_face_quad_pts()).WillByDefault(Return(2));
+  for (int q = 0; q < 2; ++q) {
+    ON_CALL(*mock_finite_element_ptr_, Jacobian(q))
+        .WillByDefault(Return(3 * (q + 1)));
+    ON_CALL(*mock_finite_element_ptr_, FaceJacobian(q))
+        .WillByDefault(Return(3 * (q + 1)));
+    for (int dof = 0; dof < 2; ++dof) {
+      const int entry = q + 1 + 10 * (dof + 1);
+      ON_CALL(*mock_finite_element_ptr_, ShapeValue(dof, q))
+          .WillByDefault(Return(entry));
+      ON_CALL(*mock_finite_element_ptr_, FaceShapeValue(dof, q))
+          .WillByDefault(Return(entry));
+      dealii::Tensor<1, dim> gradient;
+      for (int i = 0; i < dim; ++i)
+        gradient[i] = entry;
+      ON_CALL(*mock_finite_element_ptr_, ShapeGradient(dof, q))
+          .WillByDefault(Return(gradient));
+    }
+  }
+
+  quadrature_point_ptr_ =
+      std::make_shared<NiceMock<quadrature::QuadraturePointMock<dim>>>();
+  dealii::Tensor<1, dim> omega;
+  for (int i = 0; i < dim; ++i)
+    omega[i] = 1;
+  ON_CALL(*quadrature_point_ptr_, cartesian_position_tensor())
+      .WillByDefault(Return(omega));
+
+  ON_CALL(mock_material_, GetSigT()).WillByDefault(Return(sigma_t_));
+  ON_CALL(mock_material_, GetInvSigT()).WillByDefault(Return(inverse_sigma_t_));
+  ON_CALL(mock_material_, GetQPerSter()).WillByDefault(Return(q_per_ster_));
+  ON_CALL(mock_material_, GetSigSPerSter())
+      .WillByDefault(Return(sigma_s_per_ster_));
+  cross_section_ptr_ = std::make_shared<data::CrossSections>(mock_material_);
+
+  group_0_moment_ = test_helpers::MakeMPIVector(group_0_moment_values_);
+  group_1_moment_ = test_helpers::MakeMPIVector(group_1_moment_values_);
+  out_group_moments_[{0, 0, 0}] = group_0_moment_;
+  out_group_moments_[{1, 0, 0}] = group_1_moment_;
+  ON_CALL(*mock_finite_element_ptr_, ValueAtQuadrature(group_0_moment_))
+      .WillByDefault(Return(group_0_moment_values_));
+  ON_CALL(*mock_finite_element_ptr_, ValueAtQuadrature(group_1_moment_))
+      .WillByDefault(Return(group_1_moment_values_));
+
+  for (auto cell = this->dof_handler_.begin_active();
+       cell != this->dof_handler_.end(); ++cell) {
+    if (cell->is_locally_owned()) {
+      cell_ptr_ = cell;
+      cell_ptr_->set_material_id(material_id_);
+      break;
+    }
+  }
+}
+
+TYPED_TEST_CASE(FormulationAngularEvenParityTest, bart::testing::AllDimensions);
+
+TYPED_TEST(FormulationAngularEvenParityTest, FillCellCollisionTerm) {
+  constexpr int dim = this->dim;
+  formulation::angular::EvenParity<dim> test_formulation(
+      this->mock_finite_element_ptr_, this->cross_section_ptr_);
+  formulation::FullMatrix cell_matrix(2, 2);
+  formulation::FullMatrix expected_matrix(
+      2, 2, std::array<double, 4>{2454, 4554, 4554, 8454}.begin());
+
+  EXPECT_CALL(*this->mock_finite_element_ptr_, SetCell(this->cell_ptr_));
+  test_formulation.FillCellCollisionTerm(cell_matrix, this->cell_ptr_,
+                                         system::EnergyGroup(1));
+  EXPECT_EQ(cell_matrix, expected_matrix);
+
+  formulation::FullMatrix bad_matrix(3, 2);
+  EXPECT_ANY_THROW(test_formulation.FillCellCollisionTerm(
+      bad_matrix, this->cell_ptr_, system::EnergyGroup(1)));
+}
+
+TYPED_TEST(FormulationAngularEvenParityTest, FillCellStreamingTerm) {
+  constexpr int dim = this->dim;
+  formulation::angular::EvenParity<dim> test_formulation(
+      this->mock_finite_element_ptr_, this->cross_section_ptr_);
+  formulation::FullMatrix cell_matrix(2, 2);
+  // Omega dot gradient is dim times the shape value, 1/sigma_t is 0.5
+  const double factor = 0.5 * dim * dim;
+  formulation::FullMatrix expected_matrix(
+      2, 2, std::array<double, 4>{1227.0 * factor, 2277.0 * factor,
+                                  2277.0 * factor, 4227.0 * factor}.begin());
+
+  test_formulation.FillCellStreamingTerm(cell_matrix, this->cell_ptr_,
+                                         this->quadrature_point_ptr_,
+                                         system::EnergyGroup(1));
+  EXPECT_EQ(cell_matrix, expected_matrix);
+}
+
+TYPED_TEST(FormulationAngularEvenParityTest, FillBoundaryBilinearTerm) {
+  constexpr int dim = this->dim;
+  formulation::angular::EvenParity<dim> test_formulation(
+      this->mock_finite_element_ptr_, this->cross_section_ptr_);
+  formulation::FullMatrix cell_matrix(2, 2);
+  formulation::FullMatrix expected_matrix(
+      2, 2, std::array<double, 4>{1227.0 * dim, 2277.0 * dim,
+                                  2277.0 * dim, 4227.0 * dim}.begin());
+  dealii::Tensor<1, dim> outward_normal, inward_normal;
+  for (int i = 0; i < dim; ++i) {
+    outward_normal[i] = 1;
+    inward_normal[i] = -1;
+  }
+
+  EXPECT_CALL(*this->mock_finite_element_ptr_,
+              SetFace(this->cell_ptr_, domain::FaceIndex(0)))
+      .Times(2);
+  EXPECT_CALL(*this->mock_finite_element_ptr_, FaceNormal())
+      .WillOnce(Return(outward_normal))
+      .WillOnce(Return(inward_normal));
+
+  test_formulation.FillBoundaryBilinearTerm(cell_matrix, this->cell_ptr_,
+                                            domain::FaceIndex(0),
+                                            this->quadrature_point_ptr_);
+  EXPECT_EQ(cell_matrix, expected_matrix);
+  // The direction and its reflection contribute equally
+  test_formulation.FillBoundaryBilinearTerm(cell_matrix, this->cell_ptr_,
+                                            domain::FaceIndex(0),
+                                            this->quadrature_point_ptr_);
+  expected_matrix *= 2;
+  EXPECT_EQ(cell_matrix, expected_matrix);
+}
+
+TYPED_TEST(FormulationAngularEvenParityTest, FillCellFixedSourceTerm) {
+  constexpr int dim = this->dim;
+  formulation::angular::EvenParity<dim> test_formulation(
+      this->mock_finite_element_ptr_, this->cross_section_ptr_);
+  formulation::Vector cell_vector(2);
+
+  test_formulation.FillCellFixedSourceTerm(cell_vector, this->cell_ptr_,
+                                           system::EnergyGroup(0));
+  EXPECT_NEAR(cell_vector[0], 2.0 * 105, 1e-12);
+  EXPECT_NEAR(cell_vector[1], 2.0 * 195, 1e-12);
+}
+
+TYPED_TEST(FormulationAngularEvenParityTest, FillCellScatteringSourceTerm) {
+  constexpr int dim = this->dim;
+  formulation::angular::EvenParity<dim> test_formulation(
+      this->mock_finite_element_ptr_, this->cross_section_ptr_);
+  formulation::Vector cell_vector(2);
+  // Source is 0.25 * 0.75 + 0.5 * 1.0 at each quadrature point, there is no
+  // streaming source term
+  formulation::Vector expected_vector(2);
+  expected_vector[0] = 0.6875 * 105;
+  expected_vector[1] = 0.6875 * 195;
+
+  test_formulation.FillCellScatteringSourceTerm(cell_vector, this->cell_ptr_,
+                                                system::EnergyGroup(0),
+                                                this->group_0_moment_,
+                                                this->out_group_moments_);
+  for (int i = 0; i < 2; ++i)
+    EXPECT_NEAR(cell_vector[i], expected_vector[i], 1e-12);
+}
+
+} // namespace
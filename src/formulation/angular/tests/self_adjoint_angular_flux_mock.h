@@ -25,23 +25,28 @@ class SelfAdjointAngularFluxMock :
       const system::EnergyGroup), (override));
   MOCK_METHOD(void, FillCellFissionSourceTerm, (Vector&,
       const domain::CellPtr<dim>&,
-      const std::shared_ptr<quadrature::QuadraturePointI<dim>>,
+      const quadrature::QuadraturePointIndex,
       const system::EnergyGroup, const double,
       const system::moments::MomentVector&,
-      const system::moments::MomentsMap&), (override));
+      const system::moments::MomentStore&), (override));
   MOCK_METHOD(void, FillCellFixedSourceTerm, (Vector&,
       const domain::CellPtr<dim>&,
-      const std::shared_ptr<quadrature::QuadraturePointI<dim>>,
+      const quadrature::QuadraturePointIndex,
       const system::EnergyGroup), (override));
   MOCK_METHOD(void, FillCellScatteringSourceTerm, (Vector&,
       const domain::CellPtr<dim>&,
-      const std::shared_ptr<quadrature::QuadraturePointI<dim>>,
+      const quadrature::QuadraturePointIndex,
       const system::EnergyGroup, const system::moments::MomentVector&,
-      const system::moments::MomentsMap&), (override));
+      const system::moments::MomentStore&), (override));
   MOCK_METHOD(void, FillCellStreamingTerm, (FullMatrix&,
       const domain::CellPtr<dim>&,
-      const std::shared_ptr<quadrature::QuadraturePointI<dim>>,
+      const quadrature::QuadraturePointIndex,
       const system::EnergyGroup), (override));
+  MOCK_METHOD(void, FillReflectiveBoundaryLinearTerm, (Vector&,
+      const domain::CellPtr<dim>&,
+      const domain::FaceIndex,
+      const std::shared_ptr<quadrature::QuadraturePointI<dim>>,
+      const system::MPIVector&), (override));
   MOCK_METHOD(void, Initialize,
       (const domain::CellPtr<dim>&), (override));
 };
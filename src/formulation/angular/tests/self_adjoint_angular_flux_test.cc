@@ -1,8 +1,17 @@
 #include "formulation/angular/self_adjoint_angular_flux.h"
 
+#include <cmath>
+
 #include <deal.II/base/tensor.h>
+#include <deal.II/base/geometry_info.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/fe_values.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
 
 #include "data/cross_sections.h"
+#include "domain/finite_element/finite_element_gaussian.h"
 #include "domain/finite_element/tests/finite_element_mock.h"
 #include "material/tests/mock_material.h"
 #include "quadrature/tests/quadrature_set_mock.h"
@@ -12,6 +21,7 @@
 #include "test_helpers/gmock_wrapper.h"
 #include "test_helpers/dealii_test_domain.h"
 #include "test_helpers/test_assertions.h"
+#include "test_helpers/test_helper_functions.h"
 
 namespace  {
 
@@ -78,9 +88,11 @@ class FormulationAngularSelfAdjointAngularFluxTest :
                                    0.5*fission_test_factor_,
                                    fission_test_factor_}.begin()}}};
   system::moments::MomentVector group_0_moment_, group_1_moment_;
-  system::moments::MomentsMap out_group_moments_;
+  system::moments::MomentStore out_group_moments_{2, 0};
   const std::vector<double> group_0_moment_values_{0.75, 0.75};
   const std::vector<double> group_1_moment_values_{1.0, 1.0};
+  // Angular flux of the reflected direction, set on the test cell's DOFs
+  system::MPIVector reflected_angular_flux_;
 
   void SetUp() override;
 };
@@ -96,9 +108,6 @@ template <typename DimensionWrapper>
 void FormulationAngularSelfAdjointAngularFluxTest<DimensionWrapper>::SetUp() {
   this->SetUpDealii();
 
-  group_0_moment_.reinit(2);
-  group_1_moment_.reinit(2);
-
   // Make mocks and set up
   mock_finite_element_ptr_ = std::make_shared<NiceMock<FiniteElementType>>();
   mock_quadrature_set_ptr_ = std::make_shared<NiceMock<QuadratureSetType>>();
@@ -173,10 +182,8 @@ void FormulationAngularSelfAdjointAngularFluxTest<DimensionWrapper>::SetUp() {
       .WillByDefault(Return(fission_xfer_per_ster_));
 
   // Set up moment values
-  for (int i = 0; i < 2; ++i) {
-    group_0_moment_(i) = group_0_moment_values_.at(i);
-    group_1_moment_(i) = group_1_moment_values_.at(i);
-  }
+  group_0_moment_ = test_helpers::MakeMPIVector(group_0_moment_values_);
+  group_1_moment_ = test_helpers::MakeMPIVector(group_1_moment_values_);
 
   out_group_moments_[{0,0,0}] = group_0_moment_;
   out_group_moments_[{1,0,0}] = group_1_moment_;
@@ -201,6 +208,15 @@ void FormulationAngularSelfAdjointAngularFluxTest<DimensionWrapper>::SetUp() {
       break;
     }
   }
+
+  reflected_angular_flux_.reinit(this->locally_owned_dofs_, MPI_COMM_WORLD);
+  reflected_angular_flux_ = 100;
+  std::vector<dealii::types::global_dof_index> local_dof_indices(
+      cell_ptr_->get_fe().dofs_per_cell);
+  cell_ptr_->get_dof_indices(local_dof_indices);
+  reflected_angular_flux_(local_dof_indices.at(0)) = 1.0;
+  reflected_angular_flux_(local_dof_indices.at(1)) = 2.0;
+  reflected_angular_flux_.compress(dealii::VectorOperation::insert);
 }
 
 TYPED_TEST_CASE(FormulationAngularSelfAdjointAngularFluxTest,
@@ -304,9 +320,10 @@ TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest,
   EXPECT_TRUE(test_saaf.is_initialized());
 }
 
-// Initialize should calculate the correct matrices for Omega dot gradient vectors
+/* Initialize should build the flat view of the quadrature set. Shape gradients
+ * depend on the cell, so none should be precalculated. */
 TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest,
-    InitializeOmegaDotGradient) {
+    InitializeQuadratureSetView) {
   constexpr int dim = this->dim;
 
   formulation::angular::SelfAdjointAngularFlux<dim> test_saaf(
@@ -315,9 +332,8 @@ TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest,
       this->mock_quadrature_set_ptr_);
 
   /* Procedure should be: get all the quadrature point indices, retrieve each
-   * quadrature point using indices, get the position tensor and multiply by
-   * the gradient shape. This should be repeated for each degree of freedom
-   * (i.e. twice). */
+   * quadrature point once using its index to build the flat view of the
+   * quadrature set. */
   EXPECT_CALL(*this->mock_finite_element_ptr_, SetCell(this->cell_ptr_))
       .Times(1);
   EXPECT_CALL(*this->mock_quadrature_set_ptr_, quadrature_point_indices())
@@ -327,97 +343,20 @@ TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest,
   for (int index : this->quadrature_point_indices_) {
     EXPECT_CALL(*this->mock_quadrature_set_ptr_,
                 GetQuadraturePoint(quadrature::QuadraturePointIndex(index)))
-        .Times(2)
-        .WillRepeatedly(DoDefault());
+        .WillOnce(DoDefault());
   }
 
   for (auto quadrature_point_ptr : this->quadrature_set_) {
     auto mock_quadrature_point_ptr =
         dynamic_cast<quadrature::QuadraturePointMock<dim>*>(quadrature_point_ptr.get());
-    EXPECT_CALL(*mock_quadrature_point_ptr, cartesian_position_tensor())
-        .Times(4)
-        .WillRepeatedly(DoDefault());
-  }
-
-  for (int quad_pt_idx = 0; quad_pt_idx < 2; ++quad_pt_idx) {
-    for (int dof_idx = 0; dof_idx < 2; ++dof_idx) {
-      EXPECT_CALL(*this->mock_finite_element_ptr_,
-          ShapeGradient(quad_pt_idx, dof_idx))
-          .Times(2)
-          .WillRepeatedly(DoDefault());
-    }
+    EXPECT_CALL(*mock_quadrature_point_ptr, cartesian_position())
+        .WillOnce(DoDefault());
   }
 
-  /* Expected values: For each quadrature point (with a given omega) there should
-   * be two entries, a value for each degree of freedom. */
-
-  std::map<int, std::map<int, std::vector<double>>> omega_dot_gradient{
-      {0, {{0, {11*dim, 21*dim}}, {1, {22*dim, 42*dim}}}},
-      {1, {{0, {12*dim, 22*dim}}, {1, {24*dim, 44*dim}}}}
-  };
+  EXPECT_CALL(*this->mock_finite_element_ptr_, ShapeGradient(_, _))
+      .Times(0);
 
   EXPECT_NO_THROW(test_saaf.Initialize(this->cell_ptr_));
-
-  for (int cell_quad_point = 0; cell_quad_point < 2; ++cell_quad_point) {
-    for (int angle_index : this->quadrature_point_indices_) {
-      std::vector<double> result;
-      EXPECT_NO_THROW(result =
-          test_saaf.OmegaDotGradient(
-              cell_quad_point,
-              quadrature::QuadraturePointIndex(angle_index)));
-      EXPECT_THAT(result,
-                  ::testing::ContainerEq(
-                      omega_dot_gradient.at(cell_quad_point).at(angle_index)));
-    }
-  }
-  EXPECT_TRUE(test_saaf.is_initialized());
-}
-
-/* Initialize should generate the correct squares of the omega dot gradient
- * vectors. Returned as a matrix with entries corresponding to cell quadrature
- * points (i,j). No extra expectations are required, these are covered by
- * the above test. */
-TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest,
-    InitializeOmegaDotGradientSquared) {
-  constexpr int dim = this->dim;
-
-  double dim_sq = dim*dim;
-  formulation::FullMatrix odgs_00{
-      2,2, std::array<double, 4>{121, 231, 231, 441}.begin()};
-  odgs_00 *= dim_sq;
-  formulation::FullMatrix odgs_01{
-      2,2, std::array<double, 4>{484, 924, 924, 1764}.begin()};
-  odgs_01 *= dim_sq;
-  formulation::FullMatrix odgs_10{
-      2,2, std::array<double, 4>{144, 264, 264, 484}.begin()};
-  odgs_10 *= dim_sq;
-  formulation::FullMatrix odgs_11{
-      2,2, std::array<double, 4>{576, 1056, 1056, 1936}.begin()};
-  odgs_11 *= dim_sq;
-  std::map<int, std::map<int, formulation::FullMatrix>>
-      omega_dot_gradient_squared = {
-      {0, {{0, odgs_00}, {1, odgs_01}}},
-      {1, {{0, odgs_10}, {1, odgs_11}}}
-      };
-
-  formulation::angular::SelfAdjointAngularFlux<dim> test_saaf(
-      this->mock_finite_element_ptr_,
-      this->cross_section_ptr_,
-      this->mock_quadrature_set_ptr_);
-  test_saaf.Initialize(this->cell_ptr_);
-
-  for (int cell_quad_point = 0; cell_quad_point < 2; ++cell_quad_point) {
-    for (int angle_index : this->quadrature_point_indices_) {
-      formulation::FullMatrix result;
-      ASSERT_NO_THROW(result =
-                          test_saaf.OmegaDotGradientSquared(
-                              cell_quad_point,
-                              quadrature::QuadraturePointIndex(angle_index)));
-      EXPECT_TRUE(CompareMatrices(
-          omega_dot_gradient_squared.at(cell_quad_point).at(angle_index),
-          result));
-    }
-  }
   EXPECT_TRUE(test_saaf.is_initialized());
 }
 
@@ -490,6 +429,74 @@ TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest,
                    });
 }
 
+// FillReflectiveBoundaryLinearTerm
+TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest,
+           FillReflectiveBoundaryLinearTermBadVectorSize) {
+  constexpr int dim = this->dim;
+
+  formulation::angular::SelfAdjointAngularFlux<dim> test_saaf(
+      this->mock_finite_element_ptr_,
+      this->cross_section_ptr_,
+      this->mock_quadrature_set_ptr_);
+
+  formulation::Vector bad_cell_vector(3);
+  auto angle_ptr = *this->quadrature_set_.begin();
+
+  test_saaf.Initialize(this->cell_ptr_);
+  EXPECT_ANY_THROW({
+    test_saaf.FillReflectiveBoundaryLinearTerm(bad_cell_vector, this->cell_ptr_,
+                                               domain::FaceIndex(0), angle_ptr,
+                                               this->reflected_angular_flux_);
+  });
+}
+
+/* For incoming directions the reflected angular flux at the face quadrature
+ * points is {1*11 + 2*21, 1*12 + 2*22} = {53, 56}, and the term is
+ * -(n.Omega) * sum_q FaceShapeValue(i, q) * flux(q) * FaceJacobian(q). */
+TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest,
+           FillReflectiveBoundaryLinearTermTest) {
+  constexpr int dim = this->dim;
+
+  formulation::angular::SelfAdjointAngularFlux<dim> test_saaf(
+      this->mock_finite_element_ptr_,
+      this->cross_section_ptr_,
+      this->mock_quadrature_set_ptr_);
+
+  test_saaf.Initialize(this->cell_ptr_);
+  auto angle_ptr = *this->quadrature_set_.begin();
+  const int face_index = 0;
+
+  dealii::Tensor<1, dim> normal;
+  for (int i = 0; i < dim; ++i)
+    normal[i] = -1;
+  EXPECT_CALL(*this->mock_finite_element_ptr_,
+              SetFace(this->cell_ptr_, domain::FaceIndex(face_index)))
+      .Times(2);
+  EXPECT_CALL(*this->mock_finite_element_ptr_, FaceNormal())
+      .WillOnce(Return(normal))
+      .WillOnce(Return(-normal));
+
+  formulation::Vector cell_vector(2);
+  formulation::Vector expected_vector(2);
+  expected_vector[0] = dim * 5781;
+  expected_vector[1] = dim * 10731;
+
+  EXPECT_NO_THROW({
+    test_saaf.FillReflectiveBoundaryLinearTerm(
+        cell_vector, this->cell_ptr_, domain::FaceIndex(face_index), angle_ptr,
+        this->reflected_angular_flux_);
+  });
+  EXPECT_TRUE(test_helpers::CompareVector(expected_vector, cell_vector));
+
+  // Outgoing directions add nothing
+  EXPECT_NO_THROW({
+    test_saaf.FillReflectiveBoundaryLinearTerm(
+        cell_vector, this->cell_ptr_, domain::FaceIndex(face_index), angle_ptr,
+        this->reflected_angular_flux_);
+  });
+  EXPECT_TRUE(test_helpers::CompareVector(expected_vector, cell_vector));
+}
+
 TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest,
            FillCellBoundaryTermLessThanZeroTest) {
   constexpr int dim = this->dim;
@@ -597,14 +604,14 @@ TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest,
       this->mock_quadrature_set_ptr_);
 
   formulation::FullMatrix cell_matrix(2,2);
-  auto angle_ptr = *this->quadrature_set_.begin();
+  const quadrature::QuadraturePointIndex angle_index(0);
   domain::CellPtr<dim> invalid_cell_ptr;
 
 
   test_saaf.Initialize(this->cell_ptr_);
   EXPECT_ANY_THROW({
     test_saaf.FillCellStreamingTerm(cell_matrix, invalid_cell_ptr,
-                                    angle_ptr, system::EnergyGroup(0));
+                                    angle_index, system::EnergyGroup(0));
   });
 }
 
@@ -618,19 +625,19 @@ TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest,
       this->mock_quadrature_set_ptr_);
 
   formulation::FullMatrix bad_cell_matrix(3,2);
-  auto angle_ptr = *this->quadrature_set_.begin();
+  const quadrature::QuadraturePointIndex angle_index(0);
 
 
   test_saaf.Initialize(this->cell_ptr_);
   EXPECT_ANY_THROW({
     test_saaf.FillCellStreamingTerm(bad_cell_matrix, this->cell_ptr_,
-                                    angle_ptr, system::EnergyGroup(0));
+                                    angle_index, system::EnergyGroup(0));
                    });
 
   formulation::FullMatrix second_bad_cell_matrix(2,3);
   EXPECT_ANY_THROW({
     test_saaf.FillCellStreamingTerm(second_bad_cell_matrix, 
-                                    this->cell_ptr_, angle_ptr,
+                                    this->cell_ptr_, angle_index,
                                     system::EnergyGroup(0));
                    });
 }
@@ -667,22 +674,19 @@ TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest,
 
   for (int group = 0; group < 2; ++group) {
     for (int angle = 0; angle < 2; ++angle) {
-      auto angle_it = this->quadrature_set_.begin();
-      if (angle == 1)
-        ++angle_it;
-      auto angle_ptr = *angle_it;
+      const quadrature::QuadraturePointIndex angle_index(angle);
       EXPECT_CALL(*this->mock_finite_element_ptr_, SetCell(this->cell_ptr_));
       EXPECT_CALL(*this->mock_finite_element_ptr_, Jacobian(_))
           .Times(2)
           .WillRepeatedly(DoDefault());
       EXPECT_CALL(*this->mock_quadrature_set_ptr_, GetQuadraturePointIndex(_))
-          .WillOnce(DoDefault());
+          .Times(0);
 
       cell_matrix = 0;
 
       EXPECT_NO_THROW({
         test_saaf.FillCellStreamingTerm(cell_matrix, this->cell_ptr_,
-                                        angle_ptr, system::EnergyGroup(group));
+                                        angle_index, system::EnergyGroup(group));
                       });
       std::pair<int, int> result_index{group, angle};
       EXPECT_TRUE(CompareMatrices(expected_results.at(result_index),
@@ -692,6 +696,131 @@ TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest,
   }
 }
 
+/* Shape gradients scale with the inverse of the cell size, so on a cell half
+ * the size of another the streaming term is scaled by (1/2)^(dim - 2). Cells
+ * other than the one used to initialize should be filled with their own
+ * gradients. */
+TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest,
+           FillCellStreamingTermCellSize) {
+  constexpr int dim = this->dim;
+
+  auto finite_element_ptr = std::make_shared<
+      domain::finite_element::FiniteElementGaussian<dim>>(
+          problem::DiscretizationType::kContinuousFEM, 1);
+
+  // Cells of size 1/2 and 1/4
+  dealii::Triangulation<dim> triangulation;
+  dealii::GridGenerator::hyper_cube(triangulation, 0, 1);
+  triangulation.refine_global(1);
+  triangulation.begin_active()->set_refine_flag();
+  triangulation.execute_coarsening_and_refinement();
+  for (const auto& cell : triangulation.active_cell_iterators())
+    cell->set_material_id(this->material_id_);
+
+  dealii::DoFHandler<dim> dof_handler(triangulation);
+  dof_handler.distribute_dofs(*finite_element_ptr->finite_element());
+  domain::CellPtr<dim> large_cell, small_cell;
+  for (auto cell = dof_handler.begin_active(); cell != dof_handler.end();
+       ++cell) {
+    if (cell->level() == 1)
+      large_cell = cell;
+    else
+      small_cell = cell;
+  }
+
+  formulation::angular::SelfAdjointAngularFlux<dim> test_saaf(
+      finite_element_ptr, this->cross_section_ptr_,
+      this->mock_quadrature_set_ptr_);
+  formulation::angular::SelfAdjointAngularFlux<dim> small_cell_saaf(
+      finite_element_ptr, this->cross_section_ptr_,
+      this->mock_quadrature_set_ptr_);
+  test_saaf.Initialize(large_cell);
+  small_cell_saaf.Initialize(small_cell);
+
+  const int n_dofs = finite_element_ptr->dofs_per_cell();
+  formulation::FullMatrix large_cell_matrix(n_dofs, n_dofs),
+      small_cell_matrix(n_dofs, n_dofs),
+      expected_small_cell_matrix(n_dofs, n_dofs);
+  const quadrature::QuadraturePointIndex angle_index(0);
+
+  test_saaf.FillCellStreamingTerm(large_cell_matrix, large_cell, angle_index,
+                                  system::EnergyGroup(0));
+  test_saaf.FillCellStreamingTerm(small_cell_matrix, small_cell, angle_index,
+                                  system::EnergyGroup(0));
+  small_cell_saaf.FillCellStreamingTerm(expected_small_cell_matrix, small_cell,
+                                        angle_index, system::EnergyGroup(0));
+
+  EXPECT_TRUE(CompareMatrices(expected_small_cell_matrix, small_cell_matrix));
+  large_cell_matrix *= std::pow(0.5, dim - 2);
+  EXPECT_TRUE(CompareMatrices(large_cell_matrix, small_cell_matrix));
+}
+
+/* Imported and pin lattice meshes have cells that are not affine copies of
+ * each other. Moving the center vertex of a refined cube distorts every cell,
+ * the streaming term on each should match the term calculated directly from
+ * the shape gradients of that cell. */
+TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest,
+           FillCellStreamingTermDistortedCells) {
+  constexpr int dim = this->dim;
+
+  auto finite_element_ptr = std::make_shared<
+      domain::finite_element::FiniteElementGaussian<dim>>(
+          problem::DiscretizationType::kContinuousFEM, 1);
+
+  dealii::Triangulation<dim> triangulation;
+  dealii::GridGenerator::hyper_cube(triangulation, 0, 1);
+  triangulation.refine_global(1);
+  dealii::Point<dim> center, moved_center;
+  for (int i = 0; i < dim; ++i) {
+    center[i] = 0.5;
+    moved_center[i] = 0.6 - 0.05 * i;
+  }
+  for (const auto& cell : triangulation.active_cell_iterators()) {
+    cell->set_material_id(this->material_id_);
+    for (unsigned int v = 0; v < dealii::GeometryInfo<dim>::vertices_per_cell;
+         ++v) {
+      if (cell->vertex(v).distance(center) < 1e-12)
+        cell->vertex(v) = moved_center;
+    }
+  }
+
+  dealii::DoFHandler<dim> dof_handler(triangulation);
+  dof_handler.distribute_dofs(*finite_element_ptr->finite_element());
+  dealii::FEValues<dim> fe_values(*finite_element_ptr->finite_element(),
+                                  dealii::QGauss<dim>(2),
+                                  dealii::update_gradients |
+                                      dealii::update_JxW_values);
+
+  formulation::angular::SelfAdjointAngularFlux<dim> test_saaf(
+      finite_element_ptr, this->cross_section_ptr_,
+      this->mock_quadrature_set_ptr_);
+  test_saaf.Initialize(dof_handler.begin_active());
+
+  // First quadrature point is omega = (1, ..., 1), group 0 has sigma_t = 1
+  const int n_dofs = finite_element_ptr->dofs_per_cell();
+  auto angle_ptr = *this->quadrature_set_.begin();
+  const quadrature::QuadraturePointIndex angle_index(0);
+  const auto omega = angle_ptr->cartesian_position_tensor();
+
+  for (auto cell = dof_handler.begin_active(); cell != dof_handler.end();
+       ++cell) {
+    fe_values.reinit(cell);
+    formulation::FullMatrix cell_matrix(n_dofs, n_dofs),
+        expected_matrix(n_dofs, n_dofs);
+    for (unsigned int q = 0; q < fe_values.n_quadrature_points; ++q) {
+      for (int i = 0; i < n_dofs; ++i) {
+        for (int j = 0; j < n_dofs; ++j) {
+          expected_matrix(i, j) += (omega * fe_values.shape_grad(i, q)) *
+              (omega * fe_values.shape_grad(j, q)) * fe_values.JxW(q);
+        }
+      }
+    }
+    test_saaf.FillCellStreamingTerm(cell_matrix, cell, angle_index,
+                                    system::EnergyGroup(0));
+    EXPECT_TRUE(CompareMatrices(expected_matrix, cell_matrix));
+  }
+}
+
 TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest,
            FillCellStreamingTermTestNotInitialized) {
   constexpr int dim = this->dim;
@@ -703,10 +832,10 @@ TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest,
 
   formulation::FullMatrix cell_matrix(2,2);
 
-  auto angle_ptr = *this->quadrature_set_.begin();
+  const quadrature::QuadraturePointIndex angle_index(0);
   EXPECT_ANY_THROW({
     test_saaf.FillCellStreamingTerm(cell_matrix, this->cell_ptr_,
-                                    angle_ptr, system::EnergyGroup(0));
+                                    angle_index, system::EnergyGroup(0));
                    });
 }
 
@@ -803,12 +932,12 @@ TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest,
 
   formulation::Vector cell_vector(2);
   domain::CellPtr<dim> invalid_cell_ptr;
-  auto angle_ptr = *this->quadrature_set_.begin();
+  const quadrature::QuadraturePointIndex angle_index(0);
   test_saaf.Initialize(this->cell_ptr_);
 
   EXPECT_ANY_THROW({
     test_saaf.FillCellFixedSourceTerm(cell_vector, invalid_cell_ptr,
-                                    angle_ptr, system::EnergyGroup(0));
+                                    angle_index, system::EnergyGroup(0));
   });
 }
 
@@ -822,11 +951,11 @@ TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest,
       this->mock_quadrature_set_ptr_);
 
   formulation::Vector cell_vector(2);
-  auto angle_ptr = *this->quadrature_set_.begin();
+  const quadrature::QuadraturePointIndex angle_index(0);
 
   EXPECT_ANY_THROW({
     test_saaf.FillCellFixedSourceTerm(cell_vector, this->cell_ptr_,
-                                      angle_ptr, system::EnergyGroup(0));
+                                      angle_index, system::EnergyGroup(0));
                    });
 }
 
@@ -839,12 +968,12 @@ TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest,
       this->mock_quadrature_set_ptr_);
 
   formulation::Vector bad_cell_vector(3);
-  auto angle_ptr = *this->quadrature_set_.begin();
+  const quadrature::QuadraturePointIndex angle_index(0);
   test_saaf.Initialize(this->cell_ptr_);
 
   EXPECT_ANY_THROW({
     test_saaf.FillCellFixedSourceTerm(bad_cell_vector, this->cell_ptr_,
-                                      angle_ptr, system::EnergyGroup(0));
+                                      angle_index, system::EnergyGroup(0));
                    });
 }
 
@@ -882,10 +1011,7 @@ TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest,
 
   for (int group = 0; group < 2; ++group) {
     for (int angle = 0; angle < 2; ++angle) {
-      auto angle_it = this->quadrature_set_.begin();
-      if (angle == 1)
-        ++angle_it;
-      auto angle_ptr = *angle_it;
+      const quadrature::QuadraturePointIndex angle_index(angle);
       EXPECT_CALL(*this->mock_finite_element_ptr_, SetCell(this->cell_ptr_));
       EXPECT_CALL(*this->mock_finite_element_ptr_, Jacobian(_))
           .Times(2)
@@ -894,13 +1020,13 @@ TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest,
           .Times(4)
           .WillRepeatedly(DoDefault());
       EXPECT_CALL(*this->mock_quadrature_set_ptr_, GetQuadraturePointIndex(_))
-          .WillOnce(DoDefault());
+          .Times(0);
 
       cell_vector = 0;
 
       EXPECT_NO_THROW({
         test_saaf.FillCellFixedSourceTerm(cell_vector, this->cell_ptr_,
-                                          angle_ptr,
+                                          angle_index,
                                           system::EnergyGroup(group));
                       });
       std::pair<int, int> result_index{group, angle};
@@ -922,12 +1048,12 @@ TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest,
 
   formulation::Vector cell_vector(2);
   domain::CellPtr<dim> invalid_cell_ptr;
-  auto angle_ptr = *this->quadrature_set_.begin();
+  const quadrature::QuadraturePointIndex angle_index(0);
   test_saaf.Initialize(this->cell_ptr_);
 
   EXPECT_ANY_THROW({
     test_saaf.FillCellScatteringSourceTerm(cell_vector, invalid_cell_ptr,
-                                           angle_ptr, system::EnergyGroup(0),
+                                           angle_index, system::EnergyGroup(0),
                                            this->group_0_moment_,
                                            this->out_group_moments_);
                    });
@@ -943,11 +1069,11 @@ TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest,
       this->mock_quadrature_set_ptr_);
 
   formulation::Vector cell_vector(2);
-  auto angle_ptr = *this->quadrature_set_.begin();
+  const quadrature::QuadraturePointIndex angle_index(0);
 
   EXPECT_ANY_THROW({
     test_saaf.FillCellScatteringSourceTerm(cell_vector, this->cell_ptr_,
-                                           angle_ptr, system::EnergyGroup(0),
+                                           angle_index, system::EnergyGroup(0),
                                            this->group_0_moment_,
                                            this->out_group_moments_);
                    });
@@ -962,12 +1088,12 @@ TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest,
       this->mock_quadrature_set_ptr_);
 
   formulation::Vector bad_cell_vector(3);
-  auto angle_ptr = *this->quadrature_set_.begin();
+  const quadrature::QuadraturePointIndex angle_index(0);
   test_saaf.Initialize(this->cell_ptr_);
 
   EXPECT_ANY_THROW({
     test_saaf.FillCellScatteringSourceTerm(bad_cell_vector, this->cell_ptr_,
-                                           angle_ptr, system::EnergyGroup(0),
+                                           angle_index, system::EnergyGroup(0),
                                            this->group_0_moment_,
                                            this->out_group_moments_);
                    });
@@ -1006,10 +1132,7 @@ TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest,
 
   for (int group = 0; group < 2; ++group) {
     for (int angle = 0; angle < 2; ++angle) {
-      auto angle_it = this->quadrature_set_.begin();
-      if (angle == 1)
-        ++angle_it;
-      auto angle_ptr = *angle_it;
+      const quadrature::QuadraturePointIndex angle_index(angle);
       EXPECT_CALL(*this->mock_finite_element_ptr_, SetCell(this->cell_ptr_));
       EXPECT_CALL(*this->mock_finite_element_ptr_, Jacobian(_))
           .Times(2)
@@ -1018,7 +1141,7 @@ TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest,
           .Times(4)
           .WillRepeatedly(DoDefault());
       EXPECT_CALL(*this->mock_quadrature_set_ptr_, GetQuadraturePointIndex(_))
-          .WillOnce(DoDefault());
+          .Times(0);
 
       int out_group = !group;
       std::array<int, 3> out_index{out_group, 0, 0}, in_index{group, 0, 0};
@@ -1047,7 +1170,7 @@ TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest,
 
       EXPECT_NO_THROW({
         test_saaf.FillCellScatteringSourceTerm(cell_vector, this->cell_ptr_,
-                                               angle_ptr,
+                                               angle_index,
                                                system::EnergyGroup(group),
                                                in_group_moment,
                                                out_group_moments_map);
@@ -1060,6 +1183,100 @@ TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest,
   }
 }
 
+/* With Legendre moments of scattering and higher angular moments, the
+ * scattering source in direction x should add (3/4pi) sigma_s,1 times the
+ * moment Y_1^m(x) = 1 (m = 0 in 1D, m = 1 otherwise). All moments are constant
+ * over the cell, so the result is the isotropic result scaled by the ratio of
+ * the total to the isotropic source. */
+TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest,
+           FillCellScatteringSourceTermAnisotropic) {
+  constexpr int dim = this->dim;
+
+  const std::vector<formulation::FullMatrix> legendre_moments{
+      {2, 2, std::array<double, 4>{0.1, 0.2, 0.3, 0.4}.begin()}};
+  ON_CALL(this->mock_material_, GetSigSLegendre())
+      .WillByDefault(Return(
+          std::unordered_map<int, std::vector<formulation::FullMatrix>>{
+              {this->material_id_, legendre_moments}}));
+  auto cross_section_ptr =
+      std::make_shared<data::CrossSections>(this->mock_material_);
+
+  formulation::angular::SelfAdjointAngularFlux<dim> test_saaf(
+      this->mock_finite_element_ptr_,
+      cross_section_ptr,
+      this->mock_quadrature_set_ptr_);
+
+  // Direction of the first quadrature point of the set moved to the x axis,
+  // before the formulation copies the directions of the set
+  const quadrature::QuadraturePointIndex quadrature_point_index(0);
+  auto quadrature_point_ptr = *this->quadrature_set_.begin();
+  auto mock_quadrature_point_ptr =
+      dynamic_cast<quadrature::QuadraturePointMock<dim>*>(
+          quadrature_point_ptr.get());
+  ASSERT_NE(mock_quadrature_point_ptr, nullptr);
+  std::array<double, dim> position;
+  position.fill(0);
+  position.at(0) = 1;
+  ON_CALL(*mock_quadrature_point_ptr, cartesian_position())
+      .WillByDefault(Return(position));
+  test_saaf.Initialize(this->cell_ptr_);
+
+  // Distinct constant values for each first moment
+  system::moments::MomentStore isotropic_moments{2, 0}, anisotropic_moments{2, 1};
+  auto moment_value = [](const int group, const int m) {
+    return 0.1 * (group + 1) + 0.01 * (m + 2); };
+  for (int group = 0; group < 2; ++group) {
+    const auto& scalar_moment = group == 0 ? this->group_0_moment_
+                                           : this->group_1_moment_;
+    isotropic_moments[{group, 0, 0}] = scalar_moment;
+    anisotropic_moments[{group, 0, 0}] = scalar_moment;
+    for (int m = -1; m <= 1; ++m) {
+      const std::vector<double> values(2, moment_value(group, m));
+      anisotropic_moments[{group, 1, m}] = test_helpers::MakeMPIVector(values);
+      ON_CALL(*this->mock_finite_element_ptr_,
+              ValueAtQuadrature(anisotropic_moments[{group, 1, m}]))
+          .WillByDefault(Return(values));
+    }
+  }
+
+  const int m_x = dim == 1 ? 0 : 1;
+  const std::vector<double> scalar_flux{this->group_0_moment_values_.at(0),
+                                        this->group_1_moment_values_.at(0)};
+  const auto& sigma_s_per_ster = this->sigma_s_per_ster_.at(this->material_id_);
+
+  for (int group = 0; group < 2; ++group) {
+    const auto& in_group_moment = group == 0 ? this->group_0_moment_
+                                             : this->group_1_moment_;
+    double isotropic_source = 0, anisotropic_source = 0;
+    for (int group_in = 0; group_in < 2; ++group_in) {
+      isotropic_source += sigma_s_per_ster(group, group_in)
+          * scalar_flux.at(group_in);
+      anisotropic_source += 3.0 / (4.0 * M_PI)
+          * legendre_moments.at(0)(group, group_in)
+          * moment_value(group_in, m_x);
+    }
+
+    formulation::Vector isotropic_vector(2), anisotropic_vector(2);
+    test_saaf.FillCellScatteringSourceTerm(isotropic_vector, this->cell_ptr_,
+                                           quadrature_point_index,
+                                           system::EnergyGroup(group),
+                                           in_group_moment,
+                                           isotropic_moments);
+    test_saaf.FillCellScatteringSourceTerm(anisotropic_vector, this->cell_ptr_,
+                                           quadrature_point_index,
+                                           system::EnergyGroup(group),
+                                           in_group_moment,
+                                           anisotropic_moments);
+
+    const double ratio =
+        (isotropic_source + anisotropic_source) / isotropic_source;
+    for (int i = 0; i < 2; ++i) {
+      EXPECT_NEAR(anisotropic_vector(i), ratio * isotropic_vector(i), 1e-10)
+          << "Failed: group: " << group << " dof: " << i;
+    }
+  }
+}
+
 // FillCellFissionSourceTerm =====================================================
 
 TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest,
@@ -1072,12 +1289,12 @@ TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest,
 
   formulation::Vector cell_vector(2);
   domain::CellPtr<dim> invalid_cell_ptr;
-  auto angle_ptr = *this->quadrature_set_.begin();
+  const quadrature::QuadraturePointIndex angle_index(0);
   test_saaf.Initialize(this->cell_ptr_);
 
   EXPECT_ANY_THROW({
     test_saaf.FillCellFissionSourceTerm(cell_vector, invalid_cell_ptr,
-                                        angle_ptr, system::EnergyGroup(0),
+                                        angle_index, system::EnergyGroup(0),
                                         this->k_effective_,
                                         this->group_0_moment_,
                                         this->out_group_moments_);
@@ -1094,11 +1311,11 @@ TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest,
       this->mock_quadrature_set_ptr_);
 
   formulation::Vector cell_vector(2);
-  auto angle_ptr = *this->quadrature_set_.begin();
+  const quadrature::QuadraturePointIndex angle_index(0);
 
   EXPECT_ANY_THROW({
     test_saaf.FillCellFissionSourceTerm(cell_vector, this->cell_ptr_,
-                                        angle_ptr, system::EnergyGroup(0),
+                                        angle_index, system::EnergyGroup(0),
                                         this->k_effective_,
                                         this->group_0_moment_,
                                         this->out_group_moments_);
@@ -1114,12 +1331,12 @@ TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest,
       this->mock_quadrature_set_ptr_);
 
   formulation::Vector bad_cell_vector(3);
-  auto angle_ptr = *this->quadrature_set_.begin();
+  const quadrature::QuadraturePointIndex angle_index(0);
   test_saaf.Initialize(this->cell_ptr_);
 
   EXPECT_ANY_THROW({
     test_saaf.FillCellFissionSourceTerm(bad_cell_vector, this->cell_ptr_,
-                                        angle_ptr, system::EnergyGroup(0),
+                                        angle_index, system::EnergyGroup(0),
                                         this->k_effective_,
                                         this->group_0_moment_,
                                         this->out_group_moments_);
@@ -1160,10 +1377,7 @@ TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest,
 
   for (int group = 0; group < 2; ++group) {
     for (int angle = 0; angle < 2; ++angle) {
-      auto angle_it = this->quadrature_set_.begin();
-      if (angle == 1)
-        ++angle_it;
-      auto angle_ptr = *angle_it;
+      const quadrature::QuadraturePointIndex angle_index(angle);
       EXPECT_CALL(*this->mock_finite_element_ptr_, SetCell(this->cell_ptr_));
       EXPECT_CALL(*this->mock_finite_element_ptr_, Jacobian(_))
           .Times(2)
@@ -1172,7 +1386,7 @@ TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest,
           .Times(4)
           .WillRepeatedly(DoDefault());
       EXPECT_CALL(*this->mock_quadrature_set_ptr_, GetQuadraturePointIndex(_))
-          .WillOnce(DoDefault());
+          .Times(0);
 
       int out_group = !group;
       std::array<int, 3> out_index{out_group, 0, 0}, in_index{group, 0, 0};
@@ -1201,7 +1415,7 @@ TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest,
 
       EXPECT_NO_THROW({
         test_saaf.FillCellFissionSourceTerm(cell_vector, this->cell_ptr_,
-                                            angle_ptr,
+                                            angle_index,
                                             system::EnergyGroup(group),
                                             this->k_effective_,
                                             in_group_moment,
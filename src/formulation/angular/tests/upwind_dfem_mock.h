@@ -0,0 +1,49 @@
+#ifndef BART_SRC_FORMULATION_ANGULAR_TESTS_UPWIND_DFEM_MOCK_H_
+#define BART_SRC_FORMULATION_ANGULAR_TESTS_UPWIND_DFEM_MOCK_H_
+
+#include "formulation/angular/upwind_dfem_i.h"
+
+#include "test_helpers/gmock_wrapper.h"
+
+namespace bart {
+
+namespace formulation {
+
+namespace angular {
+
+template <int dim>
+class UpwindDFEMMock : public UpwindDFEMI<dim> {
+ public:
+  MOCK_METHOD(void, FillCellCollisionTerm, (FullMatrix&,
+      const domain::CellPtr<dim>&,
+      const system::EnergyGroup), (override));
+  MOCK_METHOD(void, FillCellStreamingTerm, (FullMatrix&,
+      const domain::CellPtr<dim>&,
+      const std::shared_ptr<quadrature::QuadraturePointI<dim>>), (override));
+  MOCK_METHOD(void, FillFaceOutflowTerm, (FullMatrix&,
+      const domain::CellPtr<dim>&,
+      const domain::FaceIndex,
+      const std::shared_ptr<quadrature::QuadraturePointI<dim>>), (override));
+  MOCK_METHOD(void, FillFaceInflowTerm, (Vector&,
+      const domain::CellPtr<dim>&,
+      const domain::FaceIndex,
+      const std::shared_ptr<quadrature::QuadraturePointI<dim>>,
+      const Vector&), (override));
+  MOCK_METHOD(void, FillCellScatteringSourceTerm, (Vector&,
+      const domain::CellPtr<dim>&,
+      const system::EnergyGroup, const system::moments::MomentVector&,
+      const system::moments::MomentStore&), (override));
+  MOCK_METHOD(void, FillCellFissionSourceTerm, (Vector&,
+      const domain::CellPtr<dim>&,
+      const system::EnergyGroup, const double,
+      const system::moments::MomentVector&,
+      const system::moments::MomentStore&), (override));
+};
+
+} // namespace angular
+
+} // namespace formulation
+
+} // namespace bart
+
+#endif //BART_SRC_FORMULATION_ANGULAR_TESTS_UPWIND_DFEM_MOCK_H_
@@ -0,0 +1,298 @@
+#include "formulation/angular/upwind_dfem.h"
+
+#include <sstream>
+
+namespace bart {
+
+namespace formulation {
+
+namespace angular {
+
+template <int dim>
+UpwindDFEM<dim>::UpwindDFEM(
+    std::shared_ptr<domain::finite_element::FiniteElementI<dim>> finite_element_ptr,
+    std::shared_ptr<data::CrossSections> cross_sections_ptr)
+    : finite_element_ptr_(finite_element_ptr),
+      cross_sections_ptr_(cross_sections_ptr),
+      cell_degrees_of_freedom_(finite_element_ptr->dofs_per_cell()),
+      cell_quadrature_points_(finite_element_ptr->n_cell_quad_pts()),
+      face_quadrature_points_(finite_element_ptr->n_face_quad_pts()) {}
+
+template <int dim>
+void UpwindDFEM<dim>::FillCellCollisionTerm(
+    FullMatrix& to_fill,
+    const domain::CellPtr<dim>& cell_ptr,
+    const system::EnergyGroup group_number) {
+  ValidateMatrixSize(to_fill, __FUNCTION__);
+  ValidateAndSetCell(cell_ptr, __FUNCTION__);
+
+  const auto& table = cross_sections_ptr_->table;
+  const double sigma_t = table.sigma_t(
+      table.MaterialIndex(cell_ptr->material_id()))[group_number.get()];
+
+  for (int q = 0; q < cell_quadrature_points_; ++q) {
+    const double jacobian = finite_element_ptr_->Jacobian(q);
+    for (int i = 0; i < cell_degrees_of_freedom_; ++i) {
+      for (int j = 0; j < cell_degrees_of_freedom_; ++j) {
+        to_fill(i, j) += sigma_t * finite_element_ptr_->ShapeValue(i, q) *
+            finite_element_ptr_->ShapeValue(j, q) * jacobian;
+      }
+    }
+  }
+}
+
+template <int dim>
+void UpwindDFEM<dim>::FillCellStreamingTerm(
+    FullMatrix& to_fill,
+    const domain::CellPtr<dim>& cell_ptr,
+    const std::shared_ptr<quadrature::QuadraturePointI<dim>> quadrature_point) {
+  ValidateMatrixSize(to_fill, __FUNCTION__);
+  ValidateAndSetCell(cell_ptr, __FUNCTION__);
+
+  const auto omega = quadrature_point->cartesian_position_tensor();
+
+  for (int q = 0; q < cell_quadrature_points_; ++q) {
+    const double jacobian = finite_element_ptr_->Jacobian(q);
+    for (int i = 0; i < cell_degrees_of_freedom_; ++i) {
+      const double omega_dot_gradient =
+          omega * finite_element_ptr_->ShapeGradient(i, q);
+      for (int j = 0; j < cell_degrees_of_freedom_; ++j) {
+        to_fill(i, j) -= omega_dot_gradient *
+            finite_element_ptr_->ShapeValue(j, q) * jacobian;
+      }
+    }
+  }
+}
+
+template <int dim>
+void UpwindDFEM<dim>::FillFaceOutflowTerm(
+    FullMatrix& to_fill,
+    const domain::CellPtr<dim>& cell_ptr,
+    const domain::FaceIndex face_number,
+    const std::shared_ptr<quadrature::QuadraturePointI<dim>> quadrature_point) {
+  ValidateMatrixSize(to_fill, __FUNCTION__);
+  AssertThrow(cell_ptr.state() == dealii::IteratorState::valid,
+              dealii::ExcMessage("Bad cell given to FillFaceOutflowTerm"))
+  finite_element_ptr_->SetFace(cell_ptr, face_number);
+
+  const double normal_dot_omega = finite_element_ptr_->FaceNormal() *
+      quadrature_point->cartesian_position_tensor();
+
+  if (normal_dot_omega > 0) {
+    for (int f_q = 0; f_q < face_quadrature_points_; ++f_q) {
+      const double jacobian = finite_element_ptr_->FaceJacobian(f_q);
+      for (int i = 0; i < cell_degrees_of_freedom_; ++i) {
+        for (int j = 0; j < cell_degrees_of_freedom_; ++j) {
+          to_fill(i, j) += normal_dot_omega
+              * finite_element_ptr_->FaceShapeValue(i, f_q)
+              * finite_element_ptr_->FaceShapeValue(j, f_q)
+              * jacobian;
+        }
+      }
+    }
+  }
+}
+
+template <int dim>
+void UpwindDFEM<dim>::FillFaceInflowTerm(
+    Vector& to_fill,
+    const domain::CellPtr<dim>& cell_ptr,
+    const domain::FaceIndex face_number,
+    const std::shared_ptr<quadrature::QuadraturePointI<dim>> quadrature_point,
+    const Vector& upwind_values) {
+  ValidateVectorSize(to_fill, __FUNCTION__);
+  ValidateVectorSize(upwind_values, __FUNCTION__);
+  AssertThrow(cell_ptr.state() == dealii::IteratorState::valid,
+              dealii::ExcMessage("Bad cell given to FillFaceInflowTerm"))
+  const int face = face_number.get();
+  AssertThrow(!cell_ptr->at_boundary(face),
+              dealii::ExcMessage("Error in UpwindDFEM function "
+                                 "FillFaceInflowTerm: face is on the boundary "
+                                 "and has no upwind neighbor"))
+  finite_element_ptr_->SetFace(cell_ptr, face_number);
+
+  const double normal_dot_omega = finite_element_ptr_->FaceNormal() *
+      quadrature_point->cartesian_position_tensor();
+  if (normal_dot_omega >= 0)
+    return;
+
+  const auto neighbor_ptr = cell_ptr->neighbor(face);
+  AssertThrow(!cell_ptr->neighbor_is_coarser(face) &&
+              !neighbor_ptr->has_children(),
+              dealii::ExcMessage("Error in UpwindDFEM function "
+                                 "FillFaceInflowTerm: neighbor does not match "
+                                 "the cell face, non-conforming meshes are not "
+                                 "supported"))
+  auto neighbor_face_values = finite_element_ptr_->neighbor_face_values();
+  AssertThrow(neighbor_face_values != nullptr,
+              dealii::ExcMessage("Error in UpwindDFEM function "
+                                 "FillFaceInflowTerm: finite element has no "
+                                 "neighbor face values, a discontinuous finite "
+                                 "element is required"))
+  neighbor_face_values->reinit(neighbor_ptr,
+                               cell_ptr->neighbor_of_neighbor(face));
+  const auto face_values = finite_element_ptr_->face_values();
+
+  for (int f_q = 0; f_q < face_quadrature_points_; ++f_q) {
+    // Face quadrature points of the neighbor may be ordered differently
+    const auto& point = face_values->quadrature_point(f_q);
+    int neighbor_f_q = 0;
+    for (int n_q = 1; n_q < face_quadrature_points_; ++n_q) {
+      if (point.distance(neighbor_face_values->quadrature_point(n_q)) <
+          point.distance(neighbor_face_values->quadrature_point(neighbor_f_q)))
+        neighbor_f_q = n_q;
+    }
+
+    double upwind_flux = 0;
+    for (int j = 0; j < cell_degrees_of_freedom_; ++j)
+      upwind_flux += upwind_values[j] *
+          neighbor_face_values->shape_value(j, neighbor_f_q);
+
+    const double jacobian = finite_element_ptr_->FaceJacobian(f_q);
+    for (int i = 0; i < cell_degrees_of_freedom_; ++i) {
+      to_fill(i) -= normal_dot_omega
+          * finite_element_ptr_->FaceShapeValue(i, f_q)
+          * upwind_flux
+          * jacobian;
+    }
+  }
+}
+
+template <int dim>
+void UpwindDFEM<dim>::FillCellScatteringSourceTerm(
+    Vector& to_fill,
+    const domain::CellPtr<dim>& cell_ptr,
+    const system::EnergyGroup group_number,
+    const system::moments::MomentVector& in_group_moment,
+    const system::moments::MomentStore& group_moments) {
+  ValidateVectorSize(to_fill, __FUNCTION__);
+  ValidateAndSetCell(cell_ptr, __FUNCTION__);
+
+  const auto& table = cross_sections_ptr_->table;
+  const int material = table.MaterialIndex(cell_ptr->material_id());
+  const auto sigma_s_per_ster = table.sigma_s_per_ster(material);
+  const int group = group_number.get();
+
+  std::vector<double> scattering_source(cell_quadrature_points_);
+
+  for (const int group_in : table.scattering_source_groups(material, group)) {
+    std::vector<double> scalar_flux(cell_quadrature_points_);
+
+    if (group_in == group) {
+      scalar_flux = finite_element_ptr_->ValueAtQuadrature(in_group_moment);
+    } else {
+      scalar_flux = finite_element_ptr_->ValueAtQuadrature(
+          group_moments.scalar_moment(group_in));
+    }
+
+    const double sigma_s_in_per_ster = sigma_s_per_ster(group, group_in);
+
+    for (int q = 0; q < cell_quadrature_points_; ++q)
+      scattering_source.at(q) += sigma_s_in_per_ster * scalar_flux.at(q);
+  }
+
+  FillCellSourceTerm(to_fill, scattering_source);
+}
+
+template <int dim>
+void UpwindDFEM<dim>::FillCellFissionSourceTerm(
+    Vector& to_fill,
+    const domain::CellPtr<dim>& cell_ptr,
+    const system::EnergyGroup group_number,
+    const double k_eff,
+    const system::moments::MomentVector& in_group_moment,
+    const system::moments::MomentStore& group_moments) {
+  ValidateVectorSize(to_fill, __FUNCTION__);
+  ValidateAndSetCell(cell_ptr, __FUNCTION__);
+
+  const auto& table = cross_sections_ptr_->table;
+  const int material = table.MaterialIndex(cell_ptr->material_id());
+  const auto fiss_transfer_per_ster = table.fiss_transfer_per_ster(material);
+  const int group = group_number.get();
+
+  std::vector<double> fission_source(cell_quadrature_points_);
+
+  for (const int group_in : table.fission_source_groups(material, group)) {
+    std::vector<double> scalar_flux(cell_quadrature_points_);
+
+    if (group_in == group) {
+      scalar_flux = finite_element_ptr_->ValueAtQuadrature(in_group_moment);
+    } else {
+      scalar_flux = finite_element_ptr_->ValueAtQuadrature(
+          group_moments.scalar_moment(group_in));
+    }
+
+    const double fission_xfer_per_ster =
+        fiss_transfer_per_ster(group_in, group);
+
+    for (int q = 0; q < cell_quadrature_points_; ++q)
+      fission_source.at(q) += fission_xfer_per_ster * scalar_flux.at(q) / k_eff;
+  }
+
+  FillCellSourceTerm(to_fill, fission_source);
+}
+
+// PRIVATE FUNCTIONS ===========================================================
+template <int dim>
+void UpwindDFEM<dim>::FillCellSourceTerm(Vector& to_fill,
+                                         const std::vector<double>& source) {
+  for (int q = 0; q < cell_quadrature_points_; ++q) {
+    const double jacobian = finite_element_ptr_->Jacobian(q);
+    for (int i = 0; i < cell_degrees_of_freedom_; ++i) {
+      to_fill(i) += jacobian * source.at(q) *
+          finite_element_ptr_->ShapeValue(i, q);
+    }
+  }
+}
+
+template <int dim>
+void UpwindDFEM<dim>::ValidateAndSetCell(
+    const domain::CellPtr<dim>& cell_ptr,
+    std::string called_function_name) {
+  std::string error{"Error in UpwindDFEM function " + called_function_name +
+      ": passed cell pointer is invalid"};
+  AssertThrow(cell_ptr.state() == dealii::IteratorState::valid,
+              dealii::ExcMessage(error))
+  finite_element_ptr_->SetCell(cell_ptr);
+}
+
+template <int dim>
+void UpwindDFEM<dim>::ValidateMatrixSize(const FullMatrix& to_validate,
+                                         std::string called_function_name) {
+  auto [rows, cols] = std::pair{to_validate.n_rows(), to_validate.n_cols()};
+
+  std::ostringstream error_string;
+  error_string << "Error in UpwindDFEM function " << called_function_name
+               << ": passed matrix size is invalid, expected size ("
+               << cell_degrees_of_freedom_ << ", " << cell_degrees_of_freedom_
+               << "), actual size: (" << rows << ", " << cols << ")";
+
+  AssertThrow((static_cast<int>(rows) == cell_degrees_of_freedom_) &&
+              (static_cast<int>(cols) == cell_degrees_of_freedom_),
+              dealii::ExcMessage(error_string.str()))
+}
+
+template <int dim>
+void UpwindDFEM<dim>::ValidateVectorSize(const Vector& to_validate,
+                                         std::string called_function_name) {
+  const int rows = to_validate.size();
+
+  std::ostringstream error_string;
+  error_string << "Error in UpwindDFEM function " << called_function_name
+               << ": passed vector size is invalid, expected size ("
+               << cell_degrees_of_freedom_ << ", 1), actual size: (" << rows
+               << ", 1)";
+
+  AssertThrow(rows == cell_degrees_of_freedom_,
+              dealii::ExcMessage(error_string.str()))
+}
+
+template class UpwindDFEM<1>;
+template class UpwindDFEM<2>;
+template class UpwindDFEM<3>;
+
+} // namespace angular
+
+} // namespace formulation
+
+} // namespace bart
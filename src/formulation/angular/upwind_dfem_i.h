@@ -0,0 +1,175 @@
+#ifndef BART_SRC_FORMULATION_ANGULAR_UPWIND_DFEM_I_H_
+#define BART_SRC_FORMULATION_ANGULAR_UPWIND_DFEM_I_H_
+
+#include <memory>
+
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/dofs/dof_accessor.h>
+
+#include "domain/domain_types.h"
+#include "formulation/formulation_types.h"
+#include "quadrature/quadrature_point_i.h"
+#include "system/system_types.h"
+#include "system/moments/moment_store.h"
+#include "system/moments/spherical_harmonic_types.h"
+
+namespace bart {
+
+namespace formulation {
+
+namespace angular {
+
+/*! \brief Interface for the first-order upwind discontinuous FEM formulation.
+ *
+ * The first-order transport equation is discretized cell by cell, with the
+ * angular flux entering each cell taken from the upwind neighbor (or boundary).
+ * For a given direction the cell matrix only depends on the cell itself, the
+ * upwind values enter the cell right-hand side. This allows the streaming
+ * operator to be inverted by sweeping through the cells in upwind order with
+ * local dense solves, no global matrix is required.
+ *
+ * Whether a face is an inflow or outflow face is determined by the sign of
+ * \f$\hat{n}\cdot\vec{\Omega}\f$ using the face normal at the first face
+ * quadrature point.
+ *
+ * @tparam dim spatial dimension
+ */
+template <int dim>
+class UpwindDFEMI {
+ public:
+  virtual ~UpwindDFEMI() = default;
+
+  /*! \brief Integrates the bilinear collision term and fills a given matrix.
+   *
+   * \f[
+   * \mathbf{A}(i,j)_{K,g}' = \mathbf{A}(i,j)_{K,g} +
+   * \int_{K}\sigma_{t,g}(\vec{r})\varphi_i(\vec{r})\varphi_j(\vec{r}) dV
+   * \f]
+   *
+   * @param to_fill cell matrix to fill.
+   * @param cell_ptr pointer to the cell
+   * @param group_number energy group to fill
+   */
+  virtual void FillCellCollisionTerm(
+      FullMatrix& to_fill,
+      const domain::CellPtr<dim>& cell_ptr,
+      const system::EnergyGroup group_number) = 0;
+
+  /*! \brief Integrates the bilinear streaming term and fills a given matrix.
+   *
+   * The streaming term is integrated by parts, the volumetric part is
+   * \f[
+   * \mathbf{A}(i,j)_{K,g}' = \mathbf{A}(i,j)_{K,g} -
+   * \int_{K}\left(\vec{\Omega}\cdot\nabla\varphi_i(\vec{r})\right)
+   * \varphi_j(\vec{r}) dV
+   * \f]
+   *
+   * @param to_fill cell matrix to fill.
+   * @param cell_ptr pointer to the cell
+   * @param quadrature_point quadrature point to provide \f$\vec{\Omega}\f$
+   */
+  virtual void FillCellStreamingTerm(
+      FullMatrix& to_fill,
+      const domain::CellPtr<dim>& cell_ptr,
+      const std::shared_ptr<quadrature::QuadraturePointI<dim>> quadrature_point) = 0;
+
+  /*! \brief Integrates the bilinear outflow term of a face.
+   *
+   * For faces with \f$(\hat{n}\cdot\vec{\Omega}) > 0\f$, interior or boundary,
+   * the surface part of the streaming term uses the angular flux of the cell
+   * itself:
+   * \f[
+   * \mathbf{A}(i,j)_{K,g}' = \mathbf{A}(i,j)_{K,g} +
+   * \int_{\partial K}(\hat{n}\cdot\vec{\Omega})\varphi_i(\vec{r})
+   * \varphi_j(\vec{r}) dS
+   * \f]
+   * Inflow faces are left unchanged.
+   *
+   * @param to_fill cell matrix to fill.
+   * @param cell_ptr pointer to the cell
+   * @param face_number face of the cell
+   * @param quadrature_point quadrature point to provide \f$\vec{\Omega}\f$
+   */
+  virtual void FillFaceOutflowTerm(
+      FullMatrix& to_fill,
+      const domain::CellPtr<dim>& cell_ptr,
+      const domain::FaceIndex face_number,
+      const std::shared_ptr<quadrature::QuadraturePointI<dim>> quadrature_point) = 0;
+
+  /*! \brief Integrates the linear inflow term of an interior face.
+   *
+   * For interior faces with \f$(\hat{n}\cdot\vec{\Omega}) < 0\f$ the surface
+   * part of the streaming term uses the angular flux of the upwind neighbor,
+   * \f$\psi^{-}\f$, and is moved to the right-hand side:
+   * \f[
+   * \vec{b}(i)_{K,g}' = \vec{b}(i)_{K,g} -
+   * \int_{\partial K}(\hat{n}\cdot\vec{\Omega})\varphi_i(\vec{r})
+   * \psi^{-}(\vec{r}) dS
+   * \f]
+   * Outflow faces are left unchanged. Neighbors must match the cell face,
+   * hanging nodes are not supported.
+   *
+   * @param to_fill cell vector to fill
+   * @param cell_ptr pointer to the cell
+   * @param face_number face of the cell
+   * @param quadrature_point quadrature point to provide \f$\vec{\Omega}\f$
+   * @param upwind_values angular flux degrees of freedom of the neighbor
+   *        across the face
+   */
+  virtual void FillFaceInflowTerm(
+      Vector& to_fill,
+      const domain::CellPtr<dim>& cell_ptr,
+      const domain::FaceIndex face_number,
+      const std::shared_ptr<quadrature::QuadraturePointI<dim>> quadrature_point,
+      const Vector& upwind_values) = 0;
+
+  /*! \brief Integrates the linear isotropic scattering source.
+   * \f[
+   * \vec{b}(i)_{K,g}' = \vec{b}(i)_{K,g} + \sum_{g'}
+   * \int_{K}\frac{\sigma_{s,g'\to g}(\vec{r})}{4\pi}\phi_{g'}(\vec{r})
+   * \varphi_i(\vec{r}) dV
+   * \f]
+   *
+   * @param to_fill cell vector to fill
+   * @param cell_ptr pointer to the cell
+   * @param group_number energy group number
+   * @param in_group_moment in-group scalar flux moment
+   * @param group_moments out-group scalar flux moments
+   */
+  virtual void FillCellScatteringSourceTerm(
+      Vector& to_fill,
+      const domain::CellPtr<dim>& cell_ptr,
+      const system::EnergyGroup group_number,
+      const system::moments::MomentVector& in_group_moment,
+      const system::moments::MomentStore& group_moments) = 0;
+
+  /*! \brief Integrates the linear isotropic fission source.
+   * \f[
+   * \vec{b}(i)_{K,g}' = \vec{b}(i)_{K,g} + \sum_{g'}
+   * \int_{K}\frac{\chi_g\nu_{g'}\sigma_{f,g'}(\vec{r})}{4\pi k_{\text{eff}}}
+   * \phi_{g'}(\vec{r})\varphi_i(\vec{r}) dV
+   * \f]
+   *
+   * @param to_fill cell vector to fill
+   * @param cell_ptr pointer to the cell
+   * @param group_number energy group number
+   * @param k_eff k effective
+   * @param in_group_moment in-group flux moments
+   * @param group_moments full set of group moments
+   */
+  virtual void FillCellFissionSourceTerm(
+      Vector& to_fill,
+      const domain::CellPtr<dim>& cell_ptr,
+      const system::EnergyGroup group_number,
+      const double k_eff,
+      const system::moments::MomentVector& in_group_moment,
+      const system::moments::MomentStore& group_moments) = 0;
+};
+
+} // namespace angular
+
+} // namespace formulation
+
+} // namespace bart
+
+#endif //BART_SRC_FORMULATION_ANGULAR_UPWIND_DFEM_I_H_
@@ -24,8 +24,6 @@ void Diffusion<dim>::Precalculate(const CellPtr& cell_ptr) {
   finite_element_->SetCell(cell_ptr);
 
   for (int q = 0; q < cell_quadrature_points_; ++q) {
-    Matrix gradient_squared(cell_degrees_of_freedom_,
-                            cell_degrees_of_freedom_);
     Matrix shape_squared(cell_degrees_of_freedom_,
                          cell_degrees_of_freedom_);
 
@@ -34,13 +32,9 @@ void Diffusion<dim>::Precalculate(const CellPtr& cell_ptr) {
         shape_squared(i, j) =
             finite_element_->ShapeValue(i, q) *
             finite_element_->ShapeValue(j, q);
-        gradient_squared(i, j) =
-            finite_element_->ShapeGradient(i, q) *
-            finite_element_->ShapeGradient(j, q);
       }
     }
     shape_squared_.push_back(shape_squared);
-    gradient_squared_.push_back(gradient_squared);
   }
   is_initialized_ = true;
 }
@@ -51,16 +45,20 @@ void Diffusion<dim>::FillCellStreamingTerm(Matrix& to_fill,
                                            const GroupNumber group) const {
   VerifyInitialized(__FUNCTION__);
   finite_element_->SetCell(cell_ptr);
-  int material_id = cell_ptr->material_id();
+  const auto& table = cross_sections_->table;
+  const int material = table.MaterialIndex(cell_ptr->material_id());
 
-  const double diffusion_coef =
-      cross_sections_->diffusion_coef.at(material_id)[group];
+  const double diffusion_coef = table.diffusion_coef(material)[group];
 
+  // Shape gradients depend on the size and shape of the cell, so they are
+  // retrieved for the cell being filled
   for (int q = 0; q < cell_quadrature_points_; ++q) {
     double jacobian = finite_element_->Jacobian(q);
     for (int i = 0; i < cell_degrees_of_freedom_; ++i) {
+      const auto gradient_i = finite_element_->ShapeGradient(i, q);
       for (int j = 0; j < cell_degrees_of_freedom_; ++j) {
-        to_fill(i, j) += diffusion_coef * gradient_squared_[q](i, j) *jacobian;
+        to_fill(i, j) += diffusion_coef * gradient_i *
+            finite_element_->ShapeGradient(j, q) * jacobian;
       }
     }
   }
@@ -73,10 +71,11 @@ void Diffusion<dim>::FillCellCollisionTerm(Matrix& to_fill,
                                            const GroupNumber group) const {
   VerifyInitialized(__FUNCTION__);
   finite_element_->SetCell(cell_ptr);
-  int material_id = cell_ptr->material_id();
+  const auto& table = cross_sections_->table;
+  const int material = table.MaterialIndex(cell_ptr->material_id());
 
-  const double sigma_t = cross_sections_->sigma_t.at(material_id)[group];
-  const double sigma_s = cross_sections_->sigma_s.at(material_id)(group, group);
+  const double sigma_t = table.sigma_t(material)[group];
+  const double sigma_s = table.sigma_s(material)(group, group);
   double sigma_r = sigma_t - sigma_s;
 
   for (int q = 0; q < cell_quadrature_points_; ++q) {
@@ -117,9 +116,10 @@ void Diffusion<dim>::FillCellFixedSource(Vector& to_fill,
                                          const GroupNumber group) const {
 
   finite_element_->SetCell(cell_ptr);
-  int material_id = cell_ptr->material_id();
+  const auto& table = cross_sections_->table;
+  const int material = table.MaterialIndex(cell_ptr->material_id());
 
-  const double q{cross_sections_->q.at(material_id)[group]};
+  const double q{table.q(material)[group]};
   std::vector<double> cell_fixed_source(cell_quadrature_points_, q);
 
   for (int q = 0; q < cell_quadrature_points_; ++q) {
@@ -137,37 +137,36 @@ void Diffusion<dim>::FillCellFissionSource(
     const GroupNumber group,
     const double k_effective,
     const system::moments::MomentVector& in_group_moment,
-    const system::moments::MomentsMap& group_moments) const {
+    const system::moments::MomentStore& group_moments) const {
 
-  int material_id = cell_ptr->material_id();
-  if (cross_sections_->is_material_fissile.at(material_id)) {
+  const auto& table = cross_sections_->table;
+  const int material = table.MaterialIndex(cell_ptr->material_id());
+  if (table.is_material_fissile(material)) {
     finite_element_->SetCell(cell_ptr);
 
 
     std::vector<double> fission_source_at_quad_points(cell_quadrature_points_);
 
-    // Get fission source contribution from each group at each quadrature point
-    for (const auto& moment_pair : group_moments) {
-      auto &[index, moment] = moment_pair;
-      int group_in = index[0];
-      if (index[1] == 0 && index[2] == 0) {
-        std::vector<double> scalar_flux_at_quad_points(cell_quadrature_points_);
-
-        if (group_in == group) {
-          scalar_flux_at_quad_points =
-              finite_element_->ValueAtQuadrature(in_group_moment);
-        } else {
-          scalar_flux_at_quad_points =
-              finite_element_->ValueAtQuadrature(moment);
-        }
-
-        auto fission_transfer =
-            cross_sections_->fiss_transfer.at(material_id)(group_in, group);
+    // Get fission source contribution from each contributing group at each
+    // quadrature point
+    for (const int group_in : table.fission_source_groups(material, group)) {
+      std::vector<double> scalar_flux_at_quad_points(cell_quadrature_points_);
 
-        for (int q = 0; q < cell_quadrature_points_; ++q)
-          fission_source_at_quad_points[q] +=
-              fission_transfer * scalar_flux_at_quad_points[q];
+      if (group_in == group) {
+        scalar_flux_at_quad_points =
+            finite_element_->ValueAtQuadrature(in_group_moment);
+      } else {
+        scalar_flux_at_quad_points =
+            finite_element_->ValueAtQuadrature(
+                group_moments.scalar_moment(group_in));
       }
+
+      const double fission_transfer =
+          table.fiss_transfer(material)(group_in, group);
+
+      for (int q = 0; q < cell_quadrature_points_; ++q)
+        fission_source_at_quad_points[q] +=
+            fission_transfer * scalar_flux_at_quad_points[q];
     }
 
     // Integrate for each degree of freedom
@@ -188,31 +187,31 @@ void Diffusion<dim>::FillCellScatteringSource(
       Vector& to_fill,
       const CellPtr& cell_ptr,
       const GroupNumber group,
-      const system::moments::MomentsMap& group_moments) const {
+      const system::moments::MomentStore& group_moments) const {
 
   finite_element_->SetCell(cell_ptr);
-  int material_id = cell_ptr->material_id();
+  const auto& table = cross_sections_->table;
+  const int material = table.MaterialIndex(cell_ptr->material_id());
+  const auto sigma_s = table.sigma_s(material);
 
   std::vector<double> scattering_source_at_quad_points(cell_quadrature_points_);
 
-  // Get fission source contribution from each group at each quadrature point
-  for (const auto& moment_pair : group_moments) {
-    auto &[index, moment] = moment_pair;
-    const auto &[group_in, harmonic_l, harmonic_m] = index;
-
-    // Check if scalar flux for an out-group
-    if ((group_in != group) && (harmonic_l == 0) && (harmonic_m == 0)) {
+  // Get scattering source contribution from each contributing group at each
+  // quadrature point
+  for (const int group_in : table.scattering_source_groups(material, group)) {
+    // Only out-group scalar fluxes contribute
+    if (group_in != group) {
       std::vector<double> scalar_flux_at_quad_points(cell_quadrature_points_);
 
       scalar_flux_at_quad_points =
-            finite_element_->ValueAtQuadrature(moment);
+            finite_element_->ValueAtQuadrature(
+                group_moments.scalar_moment(group_in));
 
-      const auto sigma_s =
-          cross_sections_->sigma_s.at(material_id)(group, group_in);
+      const double sigma_s_in = sigma_s(group, group_in);
 
       for (int q = 0; q < cell_quadrature_points_; ++q)
         scattering_source_at_quad_points[q] +=
-            sigma_s * scalar_flux_at_quad_points[q];
+            sigma_s_in * scalar_flux_at_quad_points[q];
     }
   }
 
@@ -32,6 +32,9 @@ class Diffusion : public DiffusionI<dim> {
             std::shared_ptr<data::CrossSections> cross_sections);
 
   /*! \brief Precalculate matrices.
+   *
+   * Only the squares of the shape functions are precalculated, shape function
+   * gradients depend on the size and shape of each cell.
    *
    * \param cell_ptr any cell, no Jacobian is used so this is arbitrary.
    */
@@ -59,12 +62,12 @@ class Diffusion : public DiffusionI<dim> {
                              const GroupNumber group,
                              const double k_effective,
                              const system::moments::MomentVector& in_group_moment,
-                             const system::moments::MomentsMap& group_moments) const override;
+                             const system::moments::MomentStore& group_moments) const override;
 
   void FillCellScatteringSource(Vector& to_fill,
                                 const CellPtr& cell_ptr,
                                 const GroupNumber group,
-                                const system::moments::MomentsMap& group_moments) const override;
+                                const system::moments::MomentStore& group_moments) const override;
 
   // Getters & Setters
   /*! \brief Get precalculated matrices for the square of the shape function.
@@ -75,15 +78,6 @@ class Diffusion : public DiffusionI<dim> {
     return shape_squared_;
   }
 
-  /*! \brief Get precalculated matrices for the square of the gradient
-   * of the shape function.
-   *
-   * \return Vector containing matrices corresponding to each quadrature point.
-   */
-  std::vector<Matrix> GetGradientSquared() const {
-    return gradient_squared_;
-  }
-
   bool is_initialized() const override { return is_initialized_; }
 
  protected:
@@ -94,7 +88,6 @@ class Diffusion : public DiffusionI<dim> {
 
   //Precalculated matrices
   std::vector<Matrix> shape_squared_;
-  std::vector<Matrix> gradient_squared_;
 
   int cell_degrees_of_freedom_ = 0; //!< Number of degrees of freedom per cell
   int cell_quadrature_points_ = 0; //!< Number of quadrature points per cell
@@ -2,8 +2,10 @@
 #define BART_SRC_FORMULATION_SCALAR_DIFFUSION_I_H_
 
 #include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/vector.h>
 #include <deal.II/dofs/dof_accessor.h>
 
+#include "system/moments/moment_store.h"
 #include "system/moments/spherical_harmonic_types.h"
 #include "utility/has_description.h"
 
@@ -55,12 +57,12 @@ class DiffusionI : public utility::HasDescription {
                              const GroupNumber group,
                              const double k_effective,
                              const system::moments::MomentVector& in_group_moment,
-                             const system::moments::MomentsMap& group_moments) const = 0;
+                             const system::moments::MomentStore& group_moments) const = 0;
 
   virtual void FillCellScatteringSource(Vector& to_fill,
                                 const CellPtr& cell_ptr,
                                 const GroupNumber group,
-                                const system::moments::MomentsMap& group_moments) const = 0;
+                                const system::moments::MomentStore& group_moments) const = 0;
 
   virtual bool is_initialized() const = 0;
 
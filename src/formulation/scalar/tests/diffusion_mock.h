@@ -44,11 +44,11 @@ class DiffusionMock : public DiffusionI<dim> {
   MOCK_METHOD(void, FillCellFissionSource,
               (Vector&, const CellPtr&, const GroupNumber,const double,
                   const system::moments::MomentVector&,
-                  const system::moments::MomentsMap&), (const, override));
+                  const system::moments::MomentStore&), (const, override));
 
   MOCK_METHOD(void, FillCellScatteringSource,
               (Vector&, const CellPtr&, const GroupNumber,
-                  const system::moments::MomentsMap&), (const, override));
+                  const system::moments::MomentStore&), (const, override));
 
   MOCK_METHOD(bool, is_initialized, (), (const, override));
 };
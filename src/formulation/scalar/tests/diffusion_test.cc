@@ -4,12 +4,15 @@
 #include <memory>
 #include <cstdlib>
 
+#include <deal.II/base/quadrature_lib.h>
 #include <deal.II/dofs/dof_handler.h>
 #include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_values.h>
 #include <deal.II/grid/grid_generator.h>
 #include <deal.II/grid/tria.h>
 
 #include "data/cross_sections.h"
+#include "domain/finite_element/finite_element_gaussian.h"
 #include "domain/finite_element/tests/finite_element_mock.h"
 #include "material/tests/mock_material.h"
 #include "test_helpers/gmock_wrapper.h"
@@ -189,25 +192,16 @@ TEST_F(FormulationCFEMDiffusionTest, ConstructorTest) {
 
 TEST_F(FormulationCFEMDiffusionTest, PrecalculateTest) {
   // Shape call, by default, returns (quadrature point index + degree of freedom)
-  // Gradient call will return a tensor of [i, q]
   // Expected results, we need to make arrays to put them into dealii matrices
   std::array<double, 4> shape_matrix_q_0_values = {0, 0,
                                                    0, 1};
   std::array<double, 4> shape_matrix_q_1_values = {1, 2,
                                                    2, 4};
-  std::array<double, 4> gradient_matrix_q_0_values = {0, 0,
-                                                      0, 1};
-  std::array<double, 4> gradient_matrix_q_1_values = {1, 1,
-                                                      1, 2};
 
   dealii::FullMatrix<double> shape_matrix_q_0{2,2,
                                               shape_matrix_q_0_values.begin()};
   dealii::FullMatrix<double> shape_matrix_q_1{2,2,
                                               shape_matrix_q_1_values.begin()};
-  dealii::FullMatrix<double> gradient_matrix_q_0{2,2,
-                                                 gradient_matrix_q_0_values.begin()};
-  dealii::FullMatrix<double> gradient_matrix_q_1{2,2,
-                                                 gradient_matrix_q_1_values.begin()};
 
   formulation::scalar::Diffusion<2> test_diffusion(fe_mock_ptr,
                                                    cross_sections_ptr);
@@ -218,18 +212,15 @@ TEST_F(FormulationCFEMDiffusionTest, PrecalculateTest) {
   EXPECT_CALL(*fe_mock_ptr, ShapeValue(_,_))
       .Times(16)
       .WillRepeatedly(DoDefault());
+  // Shape gradients depend on the cell and are not precalculated
   EXPECT_CALL(*fe_mock_ptr, ShapeGradient(_,_))
-      .Times(16)
-      .WillRepeatedly(DoDefault());
+      .Times(0);
 
   test_diffusion.Precalculate(cell_ptr_);
   auto shape_squared = test_diffusion.GetShapeSquared();
-  auto gradient_squared = test_diffusion.GetGradientSquared();
 
   EXPECT_TRUE(CompareMatrices(shape_matrix_q_0, shape_squared.at(0)));
   EXPECT_TRUE(CompareMatrices(shape_matrix_q_1, shape_squared.at(1)));
-  EXPECT_TRUE(CompareMatrices(gradient_matrix_q_0, gradient_squared.at(0)));
-  EXPECT_TRUE(CompareMatrices(gradient_matrix_q_1, gradient_squared.at(1)));
   EXPECT_TRUE(test_diffusion.is_initialized());
 }
 
@@ -260,6 +251,105 @@ TEST_F(FormulationCFEMDiffusionTest, FillCellStreamingTermTest) {
   EXPECT_TRUE(CompareMatrices(expected_matrix, test_matrix));
 }
 
+/* Shape gradients scale with the inverse of the cell size, in 2D the streaming
+ * term is the same on square cells of any size. Each cell should be filled
+ * with its own gradients, giving the bilinear stiffness matrix scaled by the
+ * diffusion coefficient. */
+TEST_F(FormulationCFEMDiffusionTest, FillCellStreamingTermCellSize) {
+  auto finite_element_ptr = std::make_shared<
+      domain::finite_element::FiniteElementGaussian<2>>(
+          problem::DiscretizationType::kContinuousFEM, 1);
+
+  // Cells of size 1/2 and 1/4
+  dealii::Triangulation<2> triangulation;
+  dealii::GridGenerator::hyper_cube(triangulation, 0, 1);
+  triangulation.refine_global(1);
+  triangulation.begin_active()->set_refine_flag();
+  triangulation.execute_coarsening_and_refinement();
+
+  dealii::DoFHandler<2> dof_handler(triangulation);
+  dof_handler.distribute_dofs(*finite_element_ptr->finite_element());
+  dealii::DoFHandler<2>::active_cell_iterator large_cell, small_cell;
+  for (auto cell = dof_handler.begin_active(); cell != dof_handler.end();
+       ++cell) {
+    cell->set_material_id(0);
+    if (cell->level() == 1)
+      large_cell = cell;
+    else
+      small_cell = cell;
+  }
+
+  std::array<double, 16> expected_values{
+      4, -1, -1, -2,
+      -1, 4, -2, -1,
+      -1, -2, 4, -1,
+      -2, -1, -1, 4};
+  dealii::FullMatrix<double> expected_matrix(4, 4, expected_values.begin());
+  expected_matrix /= 6.0;
+
+  formulation::scalar::Diffusion<2> test_diffusion(finite_element_ptr,
+                                                   cross_sections_ptr);
+  test_diffusion.Precalculate(large_cell);
+
+  for (const auto& cell : {large_cell, small_cell}) {
+    dealii::FullMatrix<double> test_matrix(4, 4);
+    test_diffusion.FillCellStreamingTerm(test_matrix, cell, 0);
+    EXPECT_TRUE(CompareMatrices(expected_matrix, test_matrix))
+        << "Failed on cell at level " << cell->level();
+  }
+}
+
+/* Imported and pin lattice meshes have cells that are not affine copies of
+ * each other. A square cell followed by a trapezoidal cell should each be
+ * filled with the stiffness matrix calculated directly from their own shape
+ * gradients. */
+TEST_F(FormulationCFEMDiffusionTest, FillCellStreamingTermTrapezoid) {
+  auto finite_element_ptr = std::make_shared<
+      domain::finite_element::FiniteElementGaussian<2>>(
+          problem::DiscretizationType::kContinuousFEM, 1);
+
+  const std::vector<dealii::Point<2>> vertices{
+      {0, 0}, {1, 0}, {0, 1}, {1, 1}, {2, 0.25}, {2, 0.75}};
+  const std::array<std::array<unsigned int, 4>, 2> cell_vertices{
+      {{0, 1, 2, 3}, {1, 4, 3, 5}}};
+  std::vector<dealii::CellData<2>> cells(2);
+  for (int cell = 0; cell < 2; ++cell) {
+    for (int v = 0; v < 4; ++v)
+      cells[cell].vertices[v] = cell_vertices[cell][v];
+    cells[cell].material_id = 0;
+  }
+  dealii::Triangulation<2> triangulation;
+  triangulation.create_triangulation(vertices, cells, dealii::SubCellData());
+
+  dealii::DoFHandler<2> dof_handler(triangulation);
+  dof_handler.distribute_dofs(*finite_element_ptr->finite_element());
+  dealii::FEValues<2> fe_values(*finite_element_ptr->finite_element(),
+                                dealii::QGauss<2>(2),
+                                dealii::update_gradients |
+                                    dealii::update_JxW_values);
+
+  formulation::scalar::Diffusion<2> test_diffusion(finite_element_ptr,
+                                                   cross_sections_ptr);
+  test_diffusion.Precalculate(dof_handler.begin_active());
+
+  // Group 0 has a diffusion coefficient of 1
+  for (auto cell = dof_handler.begin_active(); cell != dof_handler.end();
+       ++cell) {
+    fe_values.reinit(cell);
+    dealii::FullMatrix<double> test_matrix(4, 4), expected_matrix(4, 4);
+    for (unsigned int q = 0; q < fe_values.n_quadrature_points; ++q) {
+      for (int i = 0; i < 4; ++i) {
+        for (int j = 0; j < 4; ++j) {
+          expected_matrix(i, j) += fe_values.shape_grad(i, q) *
+              fe_values.shape_grad(j, q) * fe_values.JxW(q);
+        }
+      }
+    }
+    test_diffusion.FillCellStreamingTerm(test_matrix, cell, 0);
+    EXPECT_TRUE(CompareMatrices(expected_matrix, test_matrix));
+  }
+}
+
 TEST_F(FormulationCFEMDiffusionTest, FillCellCollisionTermTest) {
   dealii::FullMatrix<double> test_matrix(2,2);
 
@@ -368,16 +458,13 @@ TEST_F(FormulationCFEMDiffusionTest, FillFissionSourceTest) {
   double k_effective = 1.05;
   // Make in-group moment
   std::vector<double> in_group_moment_values{0.5, 0.5};
-  system::moments::MomentVector in_group_moment(in_group_moment_values.begin(),
-                                     in_group_moment_values.end());
+  auto in_group_moment = test_helpers::MakeMPIVector(in_group_moment_values);
 
-  /* Make out-group moments (specifically in-group values in this are different
-   * This is a somewhat tortured process due to the way dealii::Vectors are
-   * defined (system::moments::MomentVector is an alias) */
+  // Make out-group moments (specifically in-group values in this are different)
   std::vector<double> group_1_moment_values{1.0, 1.0};
-  system::moments::MomentVector group_0_moment{0.75, 0.75};
-  system::moments::MomentVector group_1_moment{1.0, 1.0};
-  system::moments::MomentsMap out_group_moments;
+  auto group_0_moment = test_helpers::MakeMPIVector({0.75, 0.75});
+  auto group_1_moment = test_helpers::MakeMPIVector({1.0, 1.0});
+  system::moments::MomentStore out_group_moments(2, 0);
   out_group_moments[{0,0,0}] = group_0_moment;
   out_group_moments[{1,0,0}] = group_1_moment;
 
@@ -407,19 +494,14 @@ TEST_F(FormulationCFEMDiffusionTest, FillScatteringSourceTest) {
   dealii::Vector<double> test_vector(2);
   // Make in-group moment
   std::vector<double> in_group_moment_values{0.5, 0.5};
-  system::moments::MomentVector in_group_moment(in_group_moment_values.begin(),
-                                     in_group_moment_values.end());
+  auto in_group_moment = test_helpers::MakeMPIVector(in_group_moment_values);
 
-  /* Make out-group moments (specifically in-group values in this are different
-   * This is a somewhat tortured process due to the way dealii::Vectors are
-   * defined (system::moments::MomentVector is an alias) */
+  // Make out-group moments (specifically in-group values in this are different)
   std::vector<double> group_0_moment_values{0.75, 0.75};
   std::vector<double> group_1_moment_values{1.0, 1.0};
-  system::moments::MomentVector group_0_moment(group_0_moment_values.begin(),
-                                               group_0_moment_values.end());
-  system::moments::MomentVector group_1_moment(group_1_moment_values.begin(),
-                                               group_1_moment_values.end());
-  system::moments::MomentsMap out_group_moments;
+  auto group_0_moment = test_helpers::MakeMPIVector(group_0_moment_values);
+  auto group_1_moment = test_helpers::MakeMPIVector(group_1_moment_values);
+  system::moments::MomentStore out_group_moments(2, 0);
   out_group_moments[{0,0,0}] = group_0_moment;
   out_group_moments[{1,0,0}] = group_1_moment;
 
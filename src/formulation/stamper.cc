@@ -21,6 +21,7 @@ void Stamper<dim>::StampMatrix(
                        const domain::CellPtr<dim> &)> stamp_function) {
   auto cell_matrix = domain_ptr_->GetCellMatrix();
   auto cells = domain_ptr_->Cells();
+  const auto& constraints = domain_ptr_->constraints();
   std::vector<dealii::types::global_dof_index> local_dof_indices(
       cell_matrix.n_cols());
 
@@ -28,7 +29,8 @@ void Stamper<dim>::StampMatrix(
     cell_matrix = 0;
     cell->get_dof_indices(local_dof_indices);
     stamp_function(cell_matrix, cell);
-    to_stamp.add(local_dof_indices, local_dof_indices, cell_matrix);
+    constraints.distribute_local_to_global(cell_matrix, local_dof_indices,
+                                           to_stamp);
   }
   to_stamp.compress(dealii::VectorOperation::add);
 }
@@ -39,6 +41,7 @@ void Stamper<dim>::StampVector(
                        const domain::CellPtr<dim>&)> stamp_function) {
   auto cell_vector = domain_ptr_->GetCellVector();
   auto cells = domain_ptr_->Cells();
+  const auto& constraints = domain_ptr_->constraints();
   std::vector<dealii::types::global_dof_index> local_dof_indices(
       cell_vector.size());
 
@@ -46,7 +49,8 @@ void Stamper<dim>::StampVector(
     cell_vector = 0;
     cell->get_dof_indices(local_dof_indices);
     stamp_function(cell_vector, cell);
-    to_stamp.add(local_dof_indices, cell_vector);
+    constraints.distribute_local_to_global(cell_vector, local_dof_indices,
+                                           to_stamp);
   }
   to_stamp.compress(dealii::VectorOperation::add);
 }
@@ -59,6 +63,7 @@ void Stamper<dim>::StampBoundaryMatrix(
                        const domain::CellPtr<dim> &)> stamp_function) {
   auto cell_matrix = domain_ptr_->GetCellMatrix();
   auto cells = domain_ptr_->Cells();
+  const auto& constraints = domain_ptr_->constraints();
   std::vector<dealii::types::global_dof_index> local_dof_indices(
       cell_matrix.n_cols());
 
@@ -70,7 +75,8 @@ void Stamper<dim>::StampBoundaryMatrix(
           cell_matrix = 0;
           cell->get_dof_indices(local_dof_indices);
           stamp_function(cell_matrix, domain::FaceIndex(face), cell);
-          to_stamp.add(local_dof_indices, local_dof_indices, cell_matrix);
+          constraints.distribute_local_to_global(cell_matrix,
+                                                 local_dof_indices, to_stamp);
         }
       }
     }
@@ -86,6 +92,9 @@ void Stamper<dim>::StampBoundaryVector(
                        const domain::CellPtr<dim> &)> stamp_function) {
   auto cell_vector = domain_ptr_->GetCellVector();
   auto cells = domain_ptr_->Cells();
+  const auto& constraints = domain_ptr_->constraints();
+  std::vector<dealii::types::global_dof_index> local_dof_indices(
+      cell_vector.size());
 
   for (const auto& cell : cells) {
     if (cell->at_boundary()) {
@@ -93,11 +102,10 @@ void Stamper<dim>::StampBoundaryVector(
       for (int face = 0; face < faces_per_cell; ++face) {
         if (cell->face(face)->at_boundary()) {
           cell_vector = 0;
-          std::vector<dealii::types::global_dof_index> local_dof_indices(
-              cell_vector.size());
           cell->get_dof_indices(local_dof_indices);
           stamp_function(cell_vector, domain::FaceIndex(face), cell);
-          to_stamp.add(local_dof_indices, cell_vector);
+          constraints.distribute_local_to_global(cell_vector,
+                                                 local_dof_indices, to_stamp);
         }
       }
     }
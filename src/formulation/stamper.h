@@ -27,7 +27,8 @@ class Stamper : public StamperI<dim> {
   /*! \brief Constructor.
    * Takes a domain definition dependency that provides the domain of cells to
    * iterate over. The matrices and vectors passed in this classes functions
-   * should be seperately initialized using this domain.
+   * should be seperately initialized using this domain. Cell contributions are
+   * added through the hanging node constraints of the domain.
    */
   explicit Stamper(std::shared_ptr<domain::DefinitionI<dim>>);
   virtual ~Stamper() = default;
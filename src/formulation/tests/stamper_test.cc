@@ -165,6 +165,8 @@ void FormulationStamperTestDealiiDomain<DimensionWrapper>::SetUp() {
       .WillByDefault(Return(dealii::FullMatrix<double>(cell_dofs, cell_dofs)));
   ON_CALL(*domain_ptr_, GetCellVector())
       .WillByDefault(Return(dealii::Vector<double>(cell_dofs)));
+  ON_CALL(*domain_ptr_, constraints())
+      .WillByDefault(ReturnRef(this->constraint_matrix_));
 }
 
 TYPED_TEST_SUITE(FormulationStamperTestDealiiDomain,
@@ -173,6 +175,7 @@ TYPED_TEST_SUITE(FormulationStamperTestDealiiDomain,
 TYPED_TEST(FormulationStamperTestDealiiDomain, StampMatrixMPI) {
   EXPECT_CALL(*this->domain_ptr_, GetCellMatrix()).WillOnce(DoDefault());
   EXPECT_CALL(*this->domain_ptr_, Cells()).WillOnce(DoDefault());
+  EXPECT_CALL(*this->domain_ptr_, constraints()).WillOnce(DoDefault());
   EXPECT_NO_THROW({
     this->test_stamper_ptr_->StampMatrix(this->system_matrix,
                                          this->matrix_stamp_function);
@@ -184,6 +187,7 @@ TYPED_TEST(FormulationStamperTestDealiiDomain, StampMatrixMPI) {
 TYPED_TEST(FormulationStamperTestDealiiDomain, StampVectorMPI) {
   EXPECT_CALL(*this->domain_ptr_, GetCellVector()).WillOnce(DoDefault());
   EXPECT_CALL(*this->domain_ptr_, Cells()).WillOnce(DoDefault());
+  EXPECT_CALL(*this->domain_ptr_, constraints()).WillOnce(DoDefault());
   EXPECT_NO_THROW({
     this->test_stamper_ptr_->StampVector(this->system_vector,
                                          this->vector_stamp_function);
@@ -195,6 +199,7 @@ TYPED_TEST(FormulationStamperTestDealiiDomain, StampVectorMPI) {
 TYPED_TEST(FormulationStamperTestDealiiDomain, StampMatrixBoundaryMPI) {
   EXPECT_CALL(*this->domain_ptr_, GetCellMatrix()).WillOnce(DoDefault());
   EXPECT_CALL(*this->domain_ptr_, Cells()).WillOnce(DoDefault());
+  EXPECT_CALL(*this->domain_ptr_, constraints()).WillOnce(DoDefault());
   EXPECT_NO_THROW({
     this->test_stamper_ptr_->StampBoundaryMatrix(this->system_matrix,
                                                  this->matrix_boundary_stamp_function);
@@ -206,6 +211,7 @@ TYPED_TEST(FormulationStamperTestDealiiDomain, StampMatrixBoundaryMPI) {
 TYPED_TEST(FormulationStamperTestDealiiDomain, StampVectorBoundaryMPI) {
   EXPECT_CALL(*this->domain_ptr_, GetCellVector()).WillOnce(DoDefault());
   EXPECT_CALL(*this->domain_ptr_, Cells()).WillOnce(DoDefault());
+  EXPECT_CALL(*this->domain_ptr_, constraints()).WillOnce(DoDefault());
   EXPECT_NO_THROW({
     this->test_stamper_ptr_->StampBoundaryVector(this->system_vector,
                                                  this->vector_boundary_stamp_function);
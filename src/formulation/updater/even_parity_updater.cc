@@ -0,0 +1,119 @@
+#include "formulation/updater/even_parity_updater.h"
+
+namespace bart {
+
+namespace formulation {
+
+namespace updater {
+
+template<int dim>
+EvenParityUpdater<dim>::EvenParityUpdater(
+    std::unique_ptr<EvenParityFormulationType> formulation_ptr,
+    std::unique_ptr<StamperType> stamper_ptr,
+    const std::shared_ptr<QuadratureSetType>& quadrature_set_ptr)
+    : formulation_ptr_(std::move(formulation_ptr)),
+      stamper_ptr_(std::move(stamper_ptr)),
+      quadrature_set_ptr_(quadrature_set_ptr) {
+  AssertThrow(formulation_ptr_ != nullptr,
+              dealii::ExcMessage("Error in constructor of EvenParityUpdater, "
+                                 "formulation pointer passed is null"))
+  AssertThrow(stamper_ptr_ != nullptr,
+              dealii::ExcMessage("Error in constructor of EvenParityUpdater, "
+                                 "stamper pointer passed is null"))
+  AssertThrow(quadrature_set_ptr_ != nullptr,
+              dealii::ExcMessage("Error in constructor of EvenParityUpdater, "
+                                 "quadrature set pointer passed is null"))
+}
+
+template<int dim>
+void EvenParityUpdater<dim>::UpdateFixedTerms(
+    system::System &to_update,
+    system::EnergyGroup group,
+    quadrature::QuadraturePointIndex index) {
+  auto fixed_matrix_ptr =
+      to_update.left_hand_side_ptr_->GetFixedTermPtr({group.get(), index.get()});
+  auto quadrature_point_ptr = quadrature_set_ptr_->GetQuadraturePoint(index);
+  auto streaming_term_function =
+      [&](formulation::FullMatrix& cell_matrix,
+          const domain::CellPtr<dim>& cell_ptr) -> void {
+        formulation_ptr_->FillCellStreamingTerm(cell_matrix, cell_ptr,
+                                                quadrature_point_ptr, group);
+      };
+  auto collision_term_function =
+      [&](formulation::FullMatrix& cell_matrix,
+          const domain::CellPtr<dim>& cell_ptr) -> void {
+        formulation_ptr_->FillCellCollisionTerm(cell_matrix, cell_ptr, group);
+      };
+  auto boundary_bilinear_term_function =
+      [&](formulation::FullMatrix& cell_matrix,
+          const domain::FaceIndex face_index,
+          const domain::CellPtr<dim>& cell_ptr) -> void {
+        formulation_ptr_->FillBoundaryBilinearTerm(cell_matrix, cell_ptr,
+                                                   face_index,
+                                                   quadrature_point_ptr);
+      };
+  *fixed_matrix_ptr = 0;
+  stamper_ptr_->StampMatrix(*fixed_matrix_ptr, streaming_term_function);
+  stamper_ptr_->StampMatrix(*fixed_matrix_ptr, collision_term_function);
+  stamper_ptr_->StampBoundaryMatrix(*fixed_matrix_ptr,
+                                    boundary_bilinear_term_function);
+}
+
+template<int dim>
+void EvenParityUpdater<dim>::UpdateFissionSource(
+    system::System &to_update,
+    system::EnergyGroup group,
+    quadrature::QuadraturePointIndex index) {
+  auto fission_source_ptr =
+      to_update.right_hand_side_ptr_->GetVariableTermPtr(
+          {group.get(), index.get()},
+          system::terms::VariableLinearTerms::kFissionSource);
+  const auto& current_moments = to_update.current_moments->moments();
+  const auto& in_group_moment = current_moments.at({group.get(), 0, 0});
+  auto fission_source_function =
+      [&](formulation::Vector& cell_vector,
+          const domain::CellPtr<dim> &cell_ptr) -> void {
+        formulation_ptr_->FillCellFissionSourceTerm(cell_vector,
+                                                    cell_ptr,
+                                                    group,
+                                                    to_update.k_effective.value(),
+                                                    in_group_moment,
+                                                    current_moments);
+      };
+  *fission_source_ptr = 0;
+  stamper_ptr_->StampVector(*fission_source_ptr, fission_source_function);
+}
+
+template<int dim>
+void EvenParityUpdater<dim>::UpdateScatteringSource(
+    system::System &to_update,
+    system::EnergyGroup group,
+    quadrature::QuadraturePointIndex index) {
+  auto scattering_source_ptr =
+      to_update.right_hand_side_ptr_->GetVariableTermPtr(
+          {group.get(), index.get()},
+          system::terms::VariableLinearTerms::kScatteringSource);
+  const auto& current_moments = to_update.current_moments->moments();
+  const auto& in_group_moment = current_moments.at({group.get(), 0, 0});
+  auto scattering_source_function =
+      [&](formulation::Vector& cell_vector,
+          const domain::CellPtr<dim> &cell_ptr) -> void {
+        formulation_ptr_->FillCellScatteringSourceTerm(cell_vector,
+                                                       cell_ptr,
+                                                       group,
+                                                       in_group_moment,
+                                                       current_moments);
+      };
+  *scattering_source_ptr = 0;
+  stamper_ptr_->StampVector(*scattering_source_ptr, scattering_source_function);
+}
+
+template class EvenParityUpdater<1>;
+template class EvenParityUpdater<2>;
+template class EvenParityUpdater<3>;
+
+} // namespace updater
+
+} // namespace formulation
+
+} // namespace bart
@@ -1,5 +1,9 @@
 #include "formulation/updater/saaf_updater.h"
 
+#include <map>
+
+#include "quadrature/utility/quadrature_utilities.h"
+
 namespace bart {
 
 namespace formulation {
@@ -24,6 +28,34 @@ SAAFUpdater<dim>::SAAFUpdater(
               dealii::ExcMessage("Error in constructor of SAAFUpdater, "
                                  "quadrature set pointer passed is null"))
 }
+
+template<int dim>
+SAAFUpdater<dim>::SAAFUpdater(
+    std::unique_ptr<SAAFFormulationType> formulation_ptr,
+    std::unique_ptr<StamperType> stamper_ptr,
+    const std::shared_ptr<QuadratureSetType>& quadrature_set_ptr,
+    const std::shared_ptr<GroupSolutionType>& group_solution_ptr,
+    const std::shared_ptr<DomainType>& domain_ptr,
+    const std::unordered_set<problem::Boundary>& reflective_boundaries)
+    : SAAFUpdater(std::move(formulation_ptr), std::move(stamper_ptr),
+                  quadrature_set_ptr) {
+  group_solution_ptr_ = group_solution_ptr;
+  domain_ptr_ = domain_ptr;
+  AssertThrow(group_solution_ptr_ != nullptr,
+              dealii::ExcMessage("Error in constructor of SAAFUpdater, "
+                                 "group solution pointer passed is null"))
+  AssertThrow(domain_ptr_ != nullptr,
+              dealii::ExcMessage("Error in constructor of SAAFUpdater, "
+                                 "domain pointer passed is null"))
+  for (const auto boundary : reflective_boundaries) {
+    // Boundaries are ordered {kXMin, kXMax, kYMin, ...}
+    const int axis = static_cast<int>(boundary) / 2;
+    reflection_indices_[boundary] =
+        quadrature::utility::ReflectionIndicesAcrossAxis(*quadrature_set_ptr_,
+                                                         axis);
+  }
+}
+
 template<int dim>
 void SAAFUpdater<dim>::UpdateFixedTerms(
     system::System &to_update,
@@ -35,8 +67,8 @@ void SAAFUpdater<dim>::UpdateFixedTerms(
   auto streaming_term_function =
       [&](formulation::FullMatrix& cell_matrix,
           const domain::CellPtr<dim>& cell_ptr) -> void {
-        formulation_ptr_->FillCellStreamingTerm(cell_matrix, cell_ptr,
-                                                quadrature_point_ptr, group);
+        formulation_ptr_->FillCellStreamingTerm(cell_matrix, cell_ptr, index,
+                                                group);
       };
   auto collision_term_function =
       [&](formulation::FullMatrix& cell_matrix,
@@ -63,7 +95,6 @@ void SAAFUpdater<dim>::UpdateFissionSource(system::System &to_update,
   auto fission_source_ptr =
       to_update.right_hand_side_ptr_->GetVariableTermPtr({group.get(), index.get()},
                                                          system::terms::VariableLinearTerms::kFissionSource);
-  auto quadrature_point_ptr = quadrature_set_ptr_->GetQuadraturePoint(index);
   const auto& current_moments = to_update.current_moments->moments();
   const auto& in_group_moment = current_moments.at({group.get(), 0, 0});
   auto fission_source_function =
@@ -71,7 +102,7 @@ void SAAFUpdater<dim>::UpdateFissionSource(system::System &to_update,
           const domain::CellPtr<dim> &cell_ptr) -> void {
         formulation_ptr_->FillCellFissionSourceTerm(cell_vector,
                                                     cell_ptr,
-                                                    quadrature_point_ptr,
+                                                    index,
                                                     group,
                                                     to_update.k_effective.value(),
                                                     in_group_moment,
@@ -98,12 +129,48 @@ void SAAFUpdater<dim>::UpdateScatteringSource(
           const domain::CellPtr<dim> &cell_ptr) -> void {
     formulation_ptr_->FillCellScatteringSourceTerm(cell_vector,
                                                    cell_ptr,
-                                                   quadrature_point_ptr,
+                                                   index,
                                                    group,
                                                    in_group_moment,
                                                    current_moments);
   };
   stamper_ptr_->StampVector(*scattering_source_ptr, scattering_source_function);
+
+  if (!reflection_indices_.empty()) {
+    /* Faces of locally owned cells can have degrees of freedom owned by other
+     * processes, each reflected angle is copied to a ghosted vector. The copy
+     * is collective, it is made on all processes for every reflective
+     * boundary in the same order. */
+    std::map<int, system::MPIVector> reflected_angular_fluxes;
+    for (const auto& [boundary, reflection_indices] : reflection_indices_) {
+      const int reflection_index = reflection_indices.at(index.get());
+      auto [flux_it, inserted] =
+          reflected_angular_fluxes.try_emplace(reflection_index);
+      if (inserted) {
+        flux_it->second.reinit(domain_ptr_->locally_owned_dofs(),
+                               domain_ptr_->locally_relevant_dofs(),
+                               MPI_COMM_WORLD);
+        flux_it->second = group_solution_ptr_->GetSolution(reflection_index);
+      }
+    }
+
+    auto reflective_boundary_function =
+        [&](formulation::Vector& cell_vector,
+            const domain::FaceIndex face_index,
+            const domain::CellPtr<dim>& cell_ptr) -> void {
+      const auto boundary = static_cast<problem::Boundary>(
+          cell_ptr->face(face_index.get())->boundary_id());
+      const auto reflection_it = reflection_indices_.find(boundary);
+      if (reflection_it != reflection_indices_.end()) {
+        const int reflection_index = reflection_it->second.at(index.get());
+        formulation_ptr_->FillReflectiveBoundaryLinearTerm(
+            cell_vector, cell_ptr, face_index, quadrature_point_ptr,
+            reflected_angular_fluxes.at(reflection_index));
+      }
+    };
+    stamper_ptr_->StampBoundaryVector(*scattering_source_ptr,
+                                      reflective_boundary_function);
+  }
 }
 
 template class SAAFUpdater<1>;
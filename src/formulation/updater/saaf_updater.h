@@ -1,14 +1,19 @@
 #ifndef BART_SRC_FORMULATION_UPDATER_TESTS_SAAF_UPDATER_H_
 #define BART_SRC_FORMULATION_UPDATER_TESTS_SAAF_UPDATER_H_
 
+#include <map>
 #include <memory>
+#include <unordered_set>
 
+#include "domain/definition_i.h"
 #include "formulation/angular/self_adjoint_angular_flux_i.h"
 #include "formulation/stamper_i.h"
 #include "formulation/updater/fixed_updater_i.h"
 #include "formulation/updater/scattering_source_updater_i.h"
 #include "formulation/updater/fission_source_updater_i.h"
+#include "problem/parameter_types.h"
 #include "quadrature/quadrature_set_i.h"
+#include "system/solution/mpi_group_angular_solution_i.h"
 
 namespace bart {
 
@@ -16,6 +21,18 @@ namespace formulation {
 
 namespace updater {
 
+/*! \brief Updates the system terms for the SAAF formulation.
+ *
+ * Boundaries are vacuum unless given as reflective. On a reflective boundary
+ * the incoming angular flux is the current group solution for the direction
+ * specularly reflected off the boundary. It is lagged and added to the
+ * scattering source, so it converges with the group source iteration. The
+ * reflected solution is copied to a vector with the ghost entries of the
+ * domain before it is used, faces of locally owned cells may have degrees of
+ * freedom owned by other processes.
+ *
+ * @tparam dim spatial dimension
+ */
 template <int dim>
 class SAAFUpdater :
     public FixedUpdaterI,
@@ -25,9 +42,17 @@ class SAAFUpdater :
   using SAAFFormulationType = formulation::angular::SelfAdjointAngularFluxI<dim>;
   using StamperType = formulation::StamperI<dim>;
   using QuadratureSetType = quadrature::QuadratureSetI<dim>;
+  using GroupSolutionType = system::solution::MPIGroupAngularSolutionI;
+  using DomainType = domain::DefinitionI<dim>;
   SAAFUpdater(std::unique_ptr<SAAFFormulationType>,
               std::unique_ptr<StamperType>,
               const std::shared_ptr<QuadratureSetType>&);
+  SAAFUpdater(std::unique_ptr<SAAFFormulationType>,
+              std::unique_ptr<StamperType>,
+              const std::shared_ptr<QuadratureSetType>&,
+              const std::shared_ptr<GroupSolutionType>&,
+              const std::shared_ptr<DomainType>&,
+              const std::unordered_set<problem::Boundary>& reflective_boundaries);
 
   void UpdateFixedTerms(system::System &to_update,
                         system::EnergyGroup group,
@@ -43,10 +68,20 @@ class SAAFUpdater :
   StamperType* stamper_ptr() const {return stamper_ptr_.get();};
   QuadratureSetType* quadrature_set_ptr() const {
     return quadrature_set_ptr_.get();};
+  GroupSolutionType* group_solution_ptr() const {
+    return group_solution_ptr_.get();};
+  DomainType* domain_ptr() const { return domain_ptr_.get(); };
+  /*! \brief Returns, for each reflective boundary, the index of the reflection
+   * of each quadrature point off that boundary. */
+  const std::map<problem::Boundary, std::map<int, int>>& reflection_indices()
+  const { return reflection_indices_; };
  private:
   std::unique_ptr<SAAFFormulationType> formulation_ptr_;
   std::unique_ptr<StamperType> stamper_ptr_;
   std::shared_ptr<QuadratureSetType> quadrature_set_ptr_;
+  std::shared_ptr<GroupSolutionType> group_solution_ptr_ = nullptr;
+  std::shared_ptr<DomainType> domain_ptr_ = nullptr;
+  std::map<problem::Boundary, std::map<int, int>> reflection_indices_;
 };
 
 } // namespace updater
@@ -1,6 +1,10 @@
 #include "formulation/updater/saaf_updater.h"
 
+#include "domain/tests/definition_mock.h"
+#include "quadrature/factory/quadrature_factories.h"
 #include "quadrature/tests/quadrature_set_mock.h"
+#include "quadrature/utility/quadrature_utilities.h"
+#include "system/solution/tests/mpi_group_angular_solution_mock.h"
 #include "formulation/angular/tests/self_adjoint_angular_flux_mock.h"
 #include "formulation/tests/stamper_mock.h"
 #include "formulation/updater/tests/updater_tests.h"
@@ -12,7 +16,24 @@ namespace {
 using namespace bart;
 
 using ::testing::Return, ::testing::Ref, ::testing::Invoke, ::testing::_,
-::testing::A, ::testing::WithArg, ::testing::DoDefault, ::testing::ReturnRef;
+::testing::A, ::testing::WithArg, ::testing::WithArgs, ::testing::DoDefault,
+::testing::ReturnRef, ::testing::AtLeast, ::testing::NiceMock;
+
+/* Returns a quadrature set with one point in each quadrant or octant, so that
+ * the reflection of each point across each axis is in the set. */
+template <int dim>
+std::shared_ptr<quadrature::QuadratureSetI<dim>> MakeSymmetricQuadratureSet() {
+  std::array<double, dim> position;
+  for (int i = 0; i < dim; ++i)
+    position.at(i) = 0.25 * (i + 1);
+  auto quadrature_set_ptr = quadrature::factory::MakeQuadratureSetPtr<dim>();
+  quadrature::factory::FillQuadratureSet<dim>(
+      quadrature_set_ptr.get(),
+      quadrature::utility::GenerateAllPositiveX<dim>(
+          {{quadrature::CartesianPosition<dim>(position),
+            quadrature::Weight(1.0)}}));
+  return quadrature_set_ptr;
+}
 
 template <typename DimensionWrapper>
 class FormulationUpdaterSAAFTest :
@@ -108,6 +129,61 @@ TYPED_TEST(FormulationUpdaterSAAFTest, ConstructorBadDepdendencies) {
 
 // ===== Update Fixed Terms Tests ==============================================
 
+TYPED_TEST(FormulationUpdaterSAAFTest, ConstructorReflective) {
+  constexpr int dim = this->dim;
+  using FormulationType = formulation::angular::SelfAdjointAngularFluxMock<dim>;
+  using StamperType = formulation::StamperMock<dim>;
+  using UpdaterType = formulation::updater::SAAFUpdater<dim>;
+  using GroupSolutionType = system::solution::MPIGroupAngularSolutionMock;
+  using DomainType = domain::DefinitionMock<dim>;
+
+  auto quadrature_set_ptr = MakeSymmetricQuadratureSet<dim>();
+  auto group_solution_ptr = std::make_shared<GroupSolutionType>();
+  auto domain_ptr = std::make_shared<DomainType>();
+  std::unordered_set<problem::Boundary> reflective_boundaries{
+      problem::Boundary::kXMin, problem::Boundary::kXMax};
+
+  std::unique_ptr<UpdaterType> test_updater_ptr;
+  EXPECT_NO_THROW({
+    test_updater_ptr = std::make_unique<UpdaterType>(
+        std::make_unique<FormulationType>(), std::make_unique<StamperType>(),
+        quadrature_set_ptr, group_solution_ptr, domain_ptr,
+        reflective_boundaries);
+  });
+  EXPECT_EQ(test_updater_ptr->group_solution_ptr(), group_solution_ptr.get());
+  EXPECT_EQ(test_updater_ptr->domain_ptr(), domain_ptr.get());
+
+  const auto& reflection_indices = test_updater_ptr->reflection_indices();
+  ASSERT_EQ(reflection_indices.size(), 2);
+  for (const auto boundary : reflective_boundaries) {
+    EXPECT_EQ(reflection_indices.at(boundary),
+              quadrature::utility::ReflectionIndicesAcrossAxis(
+                  *quadrature_set_ptr, 0));
+  }
+
+  EXPECT_ANY_THROW({
+    UpdaterType test_updater(std::make_unique<FormulationType>(),
+                             std::make_unique<StamperType>(),
+                             quadrature_set_ptr, nullptr, domain_ptr,
+                             reflective_boundaries);
+  });
+  EXPECT_ANY_THROW({
+    UpdaterType test_updater(std::make_unique<FormulationType>(),
+                             std::make_unique<StamperType>(),
+                             quadrature_set_ptr, group_solution_ptr, nullptr,
+                             reflective_boundaries);
+  });
+  // Boundaries must exist in the spatial dimension
+  std::unordered_set<problem::Boundary> bad_boundaries{
+      static_cast<problem::Boundary>(2 * dim)};
+  EXPECT_ANY_THROW({
+    UpdaterType test_updater(std::make_unique<FormulationType>(),
+                             std::make_unique<StamperType>(),
+                             quadrature_set_ptr, group_solution_ptr,
+                             domain_ptr, bad_boundaries);
+  });
+}
+
 TYPED_TEST(FormulationUpdaterSAAFTest, UpdateFixedTermsTest) {
   constexpr int dim = this->dim;
   using QuadraturePointType = quadrature::QuadraturePointI<dim>;
@@ -123,10 +199,7 @@ TYPED_TEST(FormulationUpdaterSAAFTest, UpdateFixedTermsTest) {
 
   for (auto& cell : this->cells_) {
     EXPECT_CALL(*this->formulation_obs_ptr_,
-                FillCellStreamingTerm(_,
-                                      cell,
-                                      quadrature_point_ptr_,
-                                      group_number));
+                FillCellStreamingTerm(_, cell, quad_index, group_number));
     EXPECT_CALL(*this->formulation_obs_ptr_,
                 FillCellCollisionTerm(_, cell, group_number));
     int faces_per_cell = dealii::GeometryInfo<dim>::faces_per_cell;
@@ -177,7 +250,7 @@ TYPED_TEST(FormulationUpdaterSAAFTest, UpdateScatteringSourceTest) {
       .WillOnce(DoDefault());
   for (auto& cell : this->cells_) {
     EXPECT_CALL(*this->formulation_obs_ptr_, FillCellScatteringSourceTerm(
-        _, cell, quadrature_point_ptr_, group_number,
+        _, cell, quad_index, group_number,
         Ref(this->current_iteration_moments_.at({group_number.get(), 0, 0})),
         Ref(this->current_iteration_moments_)));
   }
@@ -188,13 +261,125 @@ TYPED_TEST(FormulationUpdaterSAAFTest, UpdateScatteringSourceTest) {
                                               *this->vector_to_stamp));
 }
 
-TYPED_TEST(FormulationUpdaterSAAFTest, UpdateFissionSourceTest) {
+/* The reflected angular flux is read on the faces of locally owned cells. In
+ * parallel, partition boundaries touch the reflective boundary and some face
+ * degrees of freedom are owned by another process, the formulation must be
+ * given a copy of the reflected solution with these ghost entries. */
+TYPED_TEST(FormulationUpdaterSAAFTest, UpdateScatteringSourceReflectiveMPI) {
   constexpr int dim = this->dim;
-  using QuadraturePointType = quadrature::QuadraturePointI<dim>;
+  using FormulationType = formulation::angular::SelfAdjointAngularFluxMock<dim>;
+  using UpdaterType = formulation::updater::SAAFUpdater<dim>;
+  using GroupSolutionType = system::solution::MPIGroupAngularSolutionMock;
+  using DomainType = NiceMock<domain::DefinitionMock<dim>>;
+
+  auto quadrature_set_ptr = MakeSymmetricQuadratureSet<dim>();
+  auto group_solution_ptr = std::make_shared<GroupSolutionType>();
+  auto domain_ptr = std::make_shared<DomainType>();
+  auto formulation_ptr = std::make_unique<FormulationType>();
+  auto formulation_obs_ptr = formulation_ptr.get();
+  auto stamper_ptr = this->MakeStamper();
+  auto stamper_obs_ptr = stamper_ptr.get();
+  const auto reflective_boundary = problem::Boundary::kXMin;
+
+  // Locally owned degrees of freedom and those of the locally owned cells
+  dealii::IndexSet relevant_dofs = this->locally_owned_dofs_;
+  for (const auto& cell : this->cells_) {
+    std::vector<dealii::types::global_dof_index> cell_dofs(
+        cell->get_fe().dofs_per_cell);
+    cell->get_dof_indices(cell_dofs);
+    relevant_dofs.add_indices(cell_dofs.cbegin(), cell_dofs.cend());
+  }
+  relevant_dofs.compress();
+  ON_CALL(*domain_ptr, locally_owned_dofs())
+      .WillByDefault(Return(this->locally_owned_dofs_));
+  ON_CALL(*domain_ptr, locally_relevant_dofs())
+      .WillByDefault(Return(relevant_dofs));
+
+  UpdaterType test_updater(std::move(formulation_ptr), std::move(stamper_ptr),
+                           quadrature_set_ptr, group_solution_ptr, domain_ptr,
+                           {reflective_boundary});
+
+  const int angle = *quadrature_set_ptr->quadrature_point_indices().begin();
+  quadrature::QuadraturePointIndex quad_index(angle);
+  system::EnergyGroup group_number(this->group_number);
+  auto quadrature_point_ptr = quadrature_set_ptr->GetQuadraturePoint(quad_index);
+  const int reflection_index =
+      test_updater.reflection_indices().at(reflective_boundary).at(angle);
+  EXPECT_NE(reflection_index, angle);
+
+  // Each entry of the reflected solution is its global index + 1
+  system::MPIVector reflected_angular_flux;
+  reflected_angular_flux.reinit(this->locally_owned_dofs_, MPI_COMM_WORLD);
+  for (const auto dof : this->locally_owned_dofs_)
+    reflected_angular_flux(dof) = dof + 1.0;
+  reflected_angular_flux.compress(dealii::VectorOperation::insert);
 
+  EXPECT_CALL(*this->mock_rhs_obs_ptr_, GetVariableTermPtr(
+      system::Index{this->group_number, angle},
+      system::terms::VariableLinearTerms::kScatteringSource))
+      .WillOnce(DoDefault());
+  EXPECT_CALL(*stamper_obs_ptr, StampVector(_,_))
+      .WillOnce(DoDefault());
+  EXPECT_CALL(*stamper_obs_ptr, StampBoundaryVector(_,_))
+      .WillOnce(DoDefault());
+  EXPECT_CALL(*this->current_moments_obs_ptr_, moments())
+      .WillOnce(DoDefault());
+  EXPECT_CALL(*group_solution_ptr, GetSolution(reflection_index))
+      .Times(AtLeast(1))
+      .WillRepeatedly(ReturnRef(reflected_angular_flux));
+
+  int n_ghost_face_reads = 0;
+  auto verify_reflected_flux = [&](const domain::CellPtr<dim>& cell_ptr,
+                                   const system::MPIVector& flux) {
+    EXPECT_NE(&flux, &reflected_angular_flux);
+    const int dofs_per_cell = cell_ptr->get_fe().dofs_per_cell;
+    dealii::Vector<double> cell_values(dofs_per_cell);
+    std::vector<dealii::types::global_dof_index> local_dof_indices(
+        dofs_per_cell);
+    cell_ptr->get_dof_values(flux, cell_values);
+    cell_ptr->get_dof_indices(local_dof_indices);
+    for (int i = 0; i < dofs_per_cell; ++i) {
+      EXPECT_EQ(cell_values[i], local_dof_indices[i] + 1.0);
+      if (!this->locally_owned_dofs_.is_element(local_dof_indices[i]))
+        ++n_ghost_face_reads;
+    }
+  };
+
+  const int faces_per_cell = dealii::GeometryInfo<dim>::faces_per_cell;
+  for (auto& cell : this->cells_) {
+    EXPECT_CALL(*formulation_obs_ptr, FillCellScatteringSourceTerm(
+        _, cell, quad_index, group_number,
+        Ref(this->current_iteration_moments_.at({group_number.get(), 0, 0})),
+        Ref(this->current_iteration_moments_)));
+    for (int face = 0; face < faces_per_cell; ++face) {
+      if (cell->face(face)->at_boundary() &&
+          static_cast<problem::Boundary>(cell->face(face)->boundary_id()) ==
+              reflective_boundary) {
+        EXPECT_CALL(*formulation_obs_ptr, FillReflectiveBoundaryLinearTerm(
+            _, cell, domain::FaceIndex(face), quadrature_point_ptr, _))
+            .WillOnce(WithArgs<1, 4>(Invoke(verify_reflected_flux)));
+      }
+    }
+  }
+
+  test_updater.UpdateScatteringSource(this->test_system_, group_number,
+                                      quad_index);
+  EXPECT_TRUE(test_helpers::CompareMPIVectors(this->expected_vector_result,
+                                              *this->vector_to_stamp));
+
+  // With more than one process some reflective faces are on a partition
+  // boundary
+  const int n_processes =
+      dealii::Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD);
+  if (dim > 1 && n_processes > 1) {
+    EXPECT_GT(dealii::Utilities::MPI::sum(n_ghost_face_reads, MPI_COMM_WORLD),
+              0);
+  }
+}
+
+TYPED_TEST(FormulationUpdaterSAAFTest, UpdateFissionSourceTest) {
   quadrature::QuadraturePointIndex quad_index(this->angle_index);
   system::EnergyGroup group_number(this->group_number);
-  std::shared_ptr<QuadraturePointType> quadrature_point_ptr_;
 
   const double k_effective = 1.045;
   this->test_system_.k_effective = k_effective;
@@ -203,15 +388,15 @@ TYPED_TEST(FormulationUpdaterSAAFTest, UpdateFissionSourceTest) {
       this->index,
       system::terms::VariableLinearTerms::kFissionSource))
       .WillOnce(DoDefault());
-  EXPECT_CALL(*this->quadrature_set_ptr_, GetQuadraturePoint(quad_index))
-      .WillOnce(Return(quadrature_point_ptr_));
+  // The formulation is given the index, no quadrature point is looked up
+  EXPECT_CALL(*this->quadrature_set_ptr_, GetQuadraturePoint(_)).Times(0);
   EXPECT_CALL(*this->stamper_obs_ptr_, StampVector(_,_))
       .WillOnce(DoDefault());
   EXPECT_CALL(*this->current_moments_obs_ptr_, moments())
       .WillOnce(DoDefault());
   for (auto& cell : this->cells_) {
     EXPECT_CALL(*this->formulation_obs_ptr_, FillCellFissionSourceTerm(
-        _, cell, quadrature_point_ptr_, group_number, k_effective,
+        _, cell, quad_index, group_number, k_effective,
         Ref(this->current_iteration_moments_.at({group_number.get(), 0, 0})),
         Ref(this->current_iteration_moments_)));
   }
@@ -48,7 +48,7 @@ class UpdaterTests : public ::testing::Test,
   MomentsType* current_moments_obs_ptr_;
 
   // Real system objects
-  bart::system::moments::MomentsMap current_iteration_moments_;
+  bart::system::moments::MomentStore current_iteration_moments_{total_groups, 0};
 
   // Vectors to "stamp", these will be filled with random values that should be
   // properly zero'd
@@ -112,10 +112,6 @@ void UpdaterTests<dim>::SetUpSystem() {
   auto current_moments_ptr = std::make_unique<system::moments::SphericalHarmonicMock>();
   current_moments_obs_ptr_ = current_moments_ptr.get();
 
-  for (int group = 0; group < this->total_groups; ++group) {
-    system::moments::MomentVector new_vector;
-    current_iteration_moments_.insert_or_assign({group, 0, 0}, new_vector);
-  }
 
   matrix_to_stamp = std::make_shared<system::MPISparseMatrix>();
   matrix_to_stamp->reinit(this->matrix_1);
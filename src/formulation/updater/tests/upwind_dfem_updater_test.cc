@@ -0,0 +1,129 @@
+#include "formulation/updater/upwind_dfem_updater.h"
+
+#include "formulation/angular/tests/upwind_dfem_mock.h"
+#include "formulation/tests/stamper_mock.h"
+#include "formulation/updater/tests/updater_tests.h"
+#include "test_helpers/gmock_wrapper.h"
+#include "test_helpers/test_assertions.h"
+
+namespace {
+
+using namespace bart;
+
+using ::testing::Ref, ::testing::_, ::testing::DoDefault;
+
+template <typename DimensionWrapper>
+class FormulationUpdaterUpwindDFEMTest :
+    public bart::formulation::updater::test_helpers::UpdaterTests<DimensionWrapper::value> {
+ public:
+  static constexpr int dim = DimensionWrapper::value;
+
+  using FormulationType = formulation::angular::UpwindDFEMMock<dim>;
+  using UpdaterType = formulation::updater::UpwindDFEMUpdater<dim>;
+
+  // Test object
+  std::unique_ptr<UpdaterType> test_updater_ptr;
+
+  // Pointers to mocks
+  std::shared_ptr<FormulationType> formulation_ptr_;
+  formulation::StamperMock<dim>* stamper_obs_ptr_;
+
+  void SetUp() override;
+};
+
+template <typename DimensionWrapper>
+void FormulationUpdaterUpwindDFEMTest<DimensionWrapper>::SetUp() {
+  bart::formulation::updater::test_helpers::UpdaterTests<dim>::SetUp();
+  formulation_ptr_ = std::make_shared<FormulationType>();
+  auto stamper_ptr = this->MakeStamper();
+  stamper_obs_ptr_ = stamper_ptr.get();
+  test_updater_ptr = std::make_unique<UpdaterType>(formulation_ptr_,
+                                                   std::move(stamper_ptr));
+}
+
+TYPED_TEST_SUITE(FormulationUpdaterUpwindDFEMTest, bart::testing::AllDimensions);
+
+TYPED_TEST(FormulationUpdaterUpwindDFEMTest, ConstructorBadDependencies) {
+  constexpr int dim = this->dim;
+  using UpdaterType = formulation::updater::UpwindDFEMUpdater<dim>;
+
+  EXPECT_NE(this->test_updater_ptr->formulation_ptr(), nullptr);
+  EXPECT_NE(this->test_updater_ptr->stamper_ptr(), nullptr);
+  EXPECT_ANY_THROW({
+    UpdaterType test_updater(nullptr,
+                             std::make_unique<formulation::StamperMock<dim>>());
+  });
+  EXPECT_ANY_THROW({
+    UpdaterType test_updater(this->formulation_ptr_, nullptr);
+  });
+}
+
+TYPED_TEST(FormulationUpdaterUpwindDFEMTest, UpdateFixedTermsTest) {
+  quadrature::QuadraturePointIndex quad_index(this->angle_index);
+  system::EnergyGroup group_number(this->group_number);
+
+  // No global matrices are used by the sweep
+  EXPECT_CALL(*this->mock_lhs_obs_ptr_, GetFixedTermPtr(_)).Times(0);
+  EXPECT_CALL(*this->mock_rhs_obs_ptr_, GetFixedTermPtr(this->index))
+      .WillOnce(DoDefault());
+
+  this->test_updater_ptr->UpdateFixedTerms(this->test_system_, group_number,
+                                           quad_index);
+  EXPECT_TRUE(test_helpers::CompareMPIVectors(this->expected_vector_result,
+                                              *this->vector_to_stamp));
+}
+
+TYPED_TEST(FormulationUpdaterUpwindDFEMTest, UpdateScatteringSourceTest) {
+  quadrature::QuadraturePointIndex quad_index(this->angle_index);
+  system::EnergyGroup group_number(this->group_number);
+
+  EXPECT_CALL(*this->mock_rhs_obs_ptr_, GetVariableTermPtr(
+      this->index,
+      system::terms::VariableLinearTerms::kScatteringSource))
+      .WillOnce(DoDefault());
+  EXPECT_CALL(*this->stamper_obs_ptr_, StampVector(_,_))
+      .WillOnce(DoDefault());
+  EXPECT_CALL(*this->current_moments_obs_ptr_, moments())
+      .WillOnce(DoDefault());
+  for (auto& cell : this->cells_) {
+    EXPECT_CALL(*this->formulation_ptr_, FillCellScatteringSourceTerm(
+        _, cell, group_number,
+        Ref(this->current_iteration_moments_.at({group_number.get(), 0, 0})),
+        Ref(this->current_iteration_moments_)));
+  }
+
+  this->test_updater_ptr->UpdateScatteringSource(this->test_system_,
+                                                 group_number, quad_index);
+  EXPECT_TRUE(test_helpers::CompareMPIVectors(this->expected_vector_result,
+                                              *this->vector_to_stamp));
+}
+
+TYPED_TEST(FormulationUpdaterUpwindDFEMTest, UpdateFissionSourceTest) {
+  quadrature::QuadraturePointIndex quad_index(this->angle_index);
+  system::EnergyGroup group_number(this->group_number);
+
+  const double k_effective = 1.045;
+  this->test_system_.k_effective = k_effective;
+
+  EXPECT_CALL(*this->mock_rhs_obs_ptr_, GetVariableTermPtr(
+      this->index,
+      system::terms::VariableLinearTerms::kFissionSource))
+      .WillOnce(DoDefault());
+  EXPECT_CALL(*this->stamper_obs_ptr_, StampVector(_,_))
+      .WillOnce(DoDefault());
+  EXPECT_CALL(*this->current_moments_obs_ptr_, moments())
+      .WillOnce(DoDefault());
+  for (auto& cell : this->cells_) {
+    EXPECT_CALL(*this->formulation_ptr_, FillCellFissionSourceTerm(
+        _, cell, group_number, k_effective,
+        Ref(this->current_iteration_moments_.at({group_number.get(), 0, 0})),
+        Ref(this->current_iteration_moments_)));
+  }
+
+  this->test_updater_ptr->UpdateFissionSource(this->test_system_,
+                                              group_number, quad_index);
+  EXPECT_TRUE(test_helpers::CompareMPIVectors(this->expected_vector_result,
+                                              *this->vector_to_stamp));
+}
+
+} // namespace
@@ -0,0 +1,90 @@
+#include "formulation/updater/upwind_dfem_updater.h"
+
+namespace bart {
+
+namespace formulation {
+
+namespace updater {
+
+template<int dim>
+UpwindDFEMUpdater<dim>::UpwindDFEMUpdater(
+    const std::shared_ptr<FormulationType>& formulation_ptr,
+    std::unique_ptr<StamperType> stamper_ptr)
+    : formulation_ptr_(formulation_ptr),
+      stamper_ptr_(std::move(stamper_ptr)) {
+  AssertThrow(formulation_ptr_ != nullptr,
+              dealii::ExcMessage("Error in constructor of UpwindDFEMUpdater, "
+                                 "formulation pointer passed is null"))
+  AssertThrow(stamper_ptr_ != nullptr,
+              dealii::ExcMessage("Error in constructor of UpwindDFEMUpdater, "
+                                 "stamper pointer passed is null"))
+}
+
+template<int dim>
+void UpwindDFEMUpdater<dim>::UpdateFixedTerms(
+    system::System &to_update,
+    system::EnergyGroup group,
+    quadrature::QuadraturePointIndex index) {
+  auto fixed_source_ptr =
+      to_update.right_hand_side_ptr_->GetFixedTermPtr({group.get(), index.get()});
+  *fixed_source_ptr = 0;
+}
+
+template<int dim>
+void UpwindDFEMUpdater<dim>::UpdateFissionSource(
+    system::System &to_update,
+    system::EnergyGroup group,
+    quadrature::QuadraturePointIndex index) {
+  auto fission_source_ptr =
+      to_update.right_hand_side_ptr_->GetVariableTermPtr(
+          {group.get(), index.get()},
+          system::terms::VariableLinearTerms::kFissionSource);
+  const auto& current_moments = to_update.current_moments->moments();
+  const auto& in_group_moment = current_moments.at({group.get(), 0, 0});
+  auto fission_source_function =
+      [&](formulation::Vector& cell_vector,
+          const domain::CellPtr<dim> &cell_ptr) -> void {
+        formulation_ptr_->FillCellFissionSourceTerm(cell_vector,
+                                                    cell_ptr,
+                                                    group,
+                                                    to_update.k_effective.value(),
+                                                    in_group_moment,
+                                                    current_moments);
+      };
+  *fission_source_ptr = 0;
+  stamper_ptr_->StampVector(*fission_source_ptr, fission_source_function);
+}
+
+template<int dim>
+void UpwindDFEMUpdater<dim>::UpdateScatteringSource(
+    system::System &to_update,
+    system::EnergyGroup group,
+    quadrature::QuadraturePointIndex index) {
+  auto scattering_source_ptr =
+      to_update.right_hand_side_ptr_->GetVariableTermPtr(
+          {group.get(), index.get()},
+          system::terms::VariableLinearTerms::kScatteringSource);
+  const auto& current_moments = to_update.current_moments->moments();
+  const auto& in_group_moment = current_moments.at({group.get(), 0, 0});
+  auto scattering_source_function =
+      [&](formulation::Vector& cell_vector,
+          const domain::CellPtr<dim> &cell_ptr) -> void {
+        formulation_ptr_->FillCellScatteringSourceTerm(cell_vector,
+                                                       cell_ptr,
+                                                       group,
+                                                       in_group_moment,
+                                                       current_moments);
+      };
+  *scattering_source_ptr = 0;
+  stamper_ptr_->StampVector(*scattering_source_ptr, scattering_source_function);
+}
+
+template class UpwindDFEMUpdater<1>;
+template class UpwindDFEMUpdater<2>;
+template class UpwindDFEMUpdater<3>;
+
+} // namespace updater
+
+} // namespace formulation
+
+} // namespace bart
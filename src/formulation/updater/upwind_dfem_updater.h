@@ -0,0 +1,62 @@
+#ifndef BART_SRC_FORMULATION_UPDATER_UPWIND_DFEM_UPDATER_H_
+#define BART_SRC_FORMULATION_UPDATER_UPWIND_DFEM_UPDATER_H_
+
+#include <memory>
+
+#include "formulation/angular/upwind_dfem_i.h"
+#include "formulation/stamper_i.h"
+#include "formulation/updater/fixed_updater_i.h"
+#include "formulation/updater/scattering_source_updater_i.h"
+#include "formulation/updater/fission_source_updater_i.h"
+
+namespace bart {
+
+namespace formulation {
+
+namespace updater {
+
+/*! \brief Updates the system terms for the upwind DFEM formulation.
+ *
+ * Only the right-hand side sources are stored in the system, the streaming and
+ * collision terms are integrated cell by cell during the transport sweep. The
+ * formulation is shared with the sweep solver.
+ *
+ * @tparam dim spatial dimension
+ */
+template <int dim>
+class UpwindDFEMUpdater :
+    public FixedUpdaterI,
+    public ScatteringSourceUpdaterI,
+    public FissionSourceUpdaterI {
+ public:
+  using FormulationType = formulation::angular::UpwindDFEMI<dim>;
+  using StamperType = formulation::StamperI<dim>;
+  UpwindDFEMUpdater(const std::shared_ptr<FormulationType>&,
+                    std::unique_ptr<StamperType>);
+
+  /*! \brief Zeroes the fixed right-hand side term, the formulation has no
+   * fixed global terms */
+  void UpdateFixedTerms(system::System &to_update,
+                        system::EnergyGroup group,
+                        quadrature::QuadraturePointIndex index) override;
+  void UpdateFissionSource(system::System &to_update,
+                           system::EnergyGroup group,
+                           quadrature::QuadraturePointIndex index) override;
+  void UpdateScatteringSource(system::System &to_update,
+                              system::EnergyGroup group,
+                              quadrature::QuadraturePointIndex index) override;
+
+  FormulationType* formulation_ptr() const { return formulation_ptr_.get(); };
+  StamperType* stamper_ptr() const { return stamper_ptr_.get(); };
+ private:
+  std::shared_ptr<FormulationType> formulation_ptr_;
+  std::unique_ptr<StamperType> stamper_ptr_;
+};
+
+} // namespace updater
+
+} // namespace formulation
+
+} // namespace bart
+
+#endif //BART_SRC_FORMULATION_UPDATER_UPWIND_DFEM_UPDATER_H_
@@ -9,21 +9,29 @@
 
 // Convergence classes
 #include "convergence/final_checker_or_n.h"
+#include "convergence/inner_tolerance_eisenstat_walker.h"
 #include "convergence/moments/single_moment_checker_l1_norm.h"
 #include "convergence/parameters/single_parameter_checker.h"
 #include "convergence/reporter/mpi.h"
 
 // Domain classes
+#include "domain/cell_costs.h"
 #include "domain/definition.h"
 #include "domain/finite_element/finite_element_gaussian.h"
 #include "domain/mesh/mesh_cartesian.h"
+#include "domain/mesh/mesh_file.h"
+#include "domain/mesh/mesh_pin_lattice.h"
 
 // Formulation classes
+#include "formulation/angular/even_parity.h"
 #include "formulation/angular/self_adjoint_angular_flux.h"
+#include "formulation/angular/upwind_dfem.h"
 #include "formulation/scalar/diffusion.h"
 #include "formulation/stamper.h"
 #include "formulation/updater/saaf_updater.h"
 #include "formulation/updater/diffusion_updater.h"
+#include "formulation/updater/even_parity_updater.h"
+#include "formulation/updater/upwind_dfem_updater.h"
 
 // Framework class
 #include "framework/framework.h"
@@ -34,11 +42,14 @@
 #include "eigenvalue/k_effective/updater_via_fission_source.h"
 
 // Material classes
+#include "material/material_binary_library.h"
 #include "material/material_protobuf.h"
 
 // Solver classes
 #include "solver/group/single_group_solver.h"
+#include "solver/group/sweep_group_solver.h"
 #include "solver/gmres.h"
+#include "solver/krylov_recycler.h"
 
 // Iteration classes
 #include "iteration/initializer/initialize_fixed_terms_once.h"
@@ -56,6 +67,7 @@
 // System classes
 #include "system/system.h"
 #include "system/solution/mpi_group_angular_solution.h"
+#include "system/solution/mpi_group_moment_accumulator.h"
 #include "system/system_functions.h"
 
 namespace bart {
@@ -78,14 +90,45 @@ auto FrameworkBuilder<dim>::BuildFramework(std::string name,
   auto finite_element_ptr = Shared(BuildFiniteElement(prm));
   auto cross_sections_ptr = Shared(BuildCrossSections(prm));
 
-  auto domain_ptr = Shared(BuildDomain(prm, finite_element_ptr,
-                                       ReadMappingFile(prm.MaterialMapFilename())));
+  // Meshes read from file carry their own material IDs
+  auto domain_ptr = Shared(BuildDomain(
+      prm, finite_element_ptr,
+      prm.IsMeshGenerated() ? ReadMappingFile(prm.MaterialMapFilename()) : ""));
   *reporter_ptr_ << "\tSetting up domain\n";
-  domain_ptr->SetUpMesh().SetUpDOF();
+  domain_ptr->SetUpMesh();
+  if (prm.FissileCellCost() != 1.0) {
+    // Only fissile cells carry the fission source work
+    std::unordered_map<int, double> material_costs;
+    const auto& table = cross_sections_ptr->table;
+    for (int material = 0; material < table.n_materials(); ++material) {
+      if (table.is_material_fissile(material))
+        material_costs[table.material_ids()[material]] = prm.FissileCellCost();
+    }
+    domain_ptr->SetCellCosts(
+        domain::MaterialCellCosts<dim>(std::move(material_costs)));
+  }
+  domain_ptr->SetUpDOF();
+
+  // Anisotropic scattering is assembled only by the SAAF formulation, from
+  // angular moments calculated from the stored angular fluxes
+  const int scattering_order = prm.ScatteringOrder();
+  if (scattering_order > 0) {
+    AssertThrow(prm.TransportModel() ==
+                    problem::EquationType::kSelfAdjointAngularFlux,
+                dealii::ExcMessage("Error in BuildFramework, anisotropic "
+                                   "scattering is only supported with the "
+                                   "saaf transport model"))
+    AssertThrow(prm.StoreAngularFlux(),
+                dealii::ExcMessage("Error in BuildFramework, anisotropic "
+                                   "scattering requires angular fluxes to be "
+                                   "stored"))
+  }
 
   std::shared_ptr<QuadratureSetType> quadrature_set_ptr = nullptr;
   UpdaterPointers updater_pointers;
   std::unique_ptr<MomentCalculatorType> moment_calculator_ptr = nullptr;
+  std::unique_ptr<SingleGroupSolverType> single_group_solver_ptr = nullptr;
+  std::shared_ptr<GroupSolutionType> group_solution_ptr = nullptr;
 
   if (prm.TransportModel() == problem::EquationType::kSelfAdjointAngularFlux) {
     quadrature_set_ptr = BuildQuadratureSet(prm);
@@ -95,9 +138,51 @@ auto FrameworkBuilder<dim>::BuildFramework(std::string name,
                                                      cross_sections_ptr,
                                                      quadrature_set_ptr);
     saaf_formulation_ptr->Initialize(domain_ptr->Cells().at(0));
+
+    std::unordered_set<problem::Boundary> reflective_boundaries;
+    if (prm.HaveReflectiveBC()) {
+      for (const auto [boundary, is_reflective] : prm.ReflectiveBoundary()) {
+        if (is_reflective)
+          reflective_boundaries.insert(boundary);
+      }
+    }
+
+    if (reflective_boundaries.empty()) {
+      updater_pointers = BuildUpdaterPointers(
+          std::move(saaf_formulation_ptr),
+          std::move(stamper_ptr),
+          quadrature_set_ptr);
+    } else {
+      // Incoming flux on reflective boundaries is taken from the group solution
+      group_solution_ptr = Shared(BuildGroupSolution(n_angles));
+      updater_pointers = BuildUpdaterPointers(
+          std::move(saaf_formulation_ptr),
+          std::move(stamper_ptr),
+          quadrature_set_ptr,
+          group_solution_ptr,
+          domain_ptr,
+          reflective_boundaries);
+    }
+    if (scattering_order > 0) {
+      moment_calculator_ptr = std::move(BuildMomentCalculator(
+          quadrature_set_ptr, MomentCalculatorImpl::kSphericalHarmonicPN,
+          scattering_order));
+    } else {
+      moment_calculator_ptr = std::move(BuildMomentCalculator(
+          quadrature_set_ptr));
+    }
+
+  } else if (prm.TransportModel() == problem::EquationType::kEvenParity) {
+    AssertThrow(!prm.HaveReflectiveBC(),
+                dealii::ExcMessage("Error in BuildFramework, reflective "
+                                   "boundaries are not supported with the "
+                                   "even parity transport model"))
+    // Only one direction of each reflection pair is solved for
+    quadrature_set_ptr = BuildQuadratureSet(prm);
+    n_angles = quadrature_set_ptr->size();
     updater_pointers = BuildUpdaterPointers(
-        std::move(saaf_formulation_ptr),
-        std::move(stamper_ptr),
+        BuildEvenParityFormulation(finite_element_ptr, cross_sections_ptr),
+        BuildStamper(domain_ptr),
         quadrature_set_ptr);
     moment_calculator_ptr = std::move(BuildMomentCalculator(quadrature_set_ptr));
 
@@ -111,21 +196,83 @@ auto FrameworkBuilder<dim>::BuildFramework(std::string name,
         std::move(diffusion_formulation_ptr),
         std::move(stamper_ptr));
     moment_calculator_ptr = std::move(BuildMomentCalculator());
+
+  } else if (prm.TransportModel() == problem::EquationType::kDiscreteOrdinates) {
+    AssertThrow(prm.AdaptiveRefinementCycles() == 0,
+                dealii::ExcMessage("Error in BuildFramework, adaptive "
+                                   "refinement is not supported with the "
+                                   "sn transport model"))
+    AssertThrow(!prm.HaveReflectiveBC(),
+                dealii::ExcMessage("Error in BuildFramework, reflective "
+                                   "boundaries are not supported with the "
+                                   "sn transport model"))
+    quadrature_set_ptr = BuildQuadratureSet(prm);
+    n_angles = quadrature_set_ptr->size();
+    auto upwind_dfem_formulation_ptr = Shared(BuildUpwindDFEMFormulation(
+        finite_element_ptr, cross_sections_ptr));
+    updater_pointers = BuildUpdaterPointers(upwind_dfem_formulation_ptr,
+                                            BuildStamper(domain_ptr));
+    moment_calculator_ptr = std::move(BuildMomentCalculator(quadrature_set_ptr));
+    single_group_solver_ptr = BuildSweepGroupSolver(upwind_dfem_formulation_ptr,
+                                                    finite_element_ptr,
+                                                    domain_ptr,
+                                                    quadrature_set_ptr);
+  }
+
+  if (!prm.StoreAngularFlux() && quadrature_set_ptr != nullptr) {
+    AssertThrow(group_solution_ptr == nullptr,
+                dealii::ExcMessage("Error in BuildFramework, reflective "
+                                   "boundaries require angular fluxes to be "
+                                   "stored"))
+    AssertThrow(prm.TransportModel() !=
+                    problem::EquationType::kDiscreteOrdinates,
+                dealii::ExcMessage("Error in BuildFramework, the sn transport "
+                                   "model requires angular fluxes to be "
+                                   "stored"))
+    // Only the scalar flux is kept, angular solutions share one vector
+    group_solution_ptr = Shared(BuildGroupSolution(quadrature_set_ptr));
+    moment_calculator_ptr = std::move(BuildMomentCalculator(
+        MomentCalculatorImpl::kAccumulatedZerothMoment));
   }
 
   auto initializer_ptr = BuildInitializer(
       updater_pointers.fixed_updater_ptr, n_groups, n_angles);
   auto convergence_reporter_ptr = Shared(BuildConvergenceReporter());
-  auto group_solution_ptr = Shared(BuildGroupSolution(n_angles));
+  if (group_solution_ptr == nullptr)
+    group_solution_ptr = Shared(BuildGroupSolution(n_angles));
   system::SetUpMPIAngularSolution(*group_solution_ptr, *domain_ptr);
 
+  std::shared_ptr<InnerToleranceType> inner_tolerance_ptr = nullptr;
+  if (prm.IsEigenvalueProblem() && prm.DoAdaptiveInnerTolerance())
+    inner_tolerance_ptr = Shared(BuildInnerTolerance(1e-10));
+
+  // Hanging node constraints of the domain, the aliasing pointer keeps the
+  // domain alive and stays valid when the domain is refined
+  const std::shared_ptr<const ConstraintsType> constraints_ptr(
+      domain_ptr, &domain_ptr->constraints());
+
+  // Sweeps solve each group directly, others use a Krylov solver
+  const bool is_swept = single_group_solver_ptr != nullptr;
+  solver::KrylovRecycler* krylov_recycler_ptr = nullptr;
+  if (!is_swept) {
+    single_group_solver_ptr = BuildSingleGroupSolver(
+        1000, 1e-10, inner_tolerance_ptr, prm.KrylovRecyclingVectors(),
+        prm.KrylovRecyclingTotalVectors(), constraints_ptr);
+    // Recycled spaces are owned by the group solver, kept to be cleared on
+    // refinement
+    krylov_recycler_ptr = dynamic_cast<solver::KrylovRecycler*>(
+        dynamic_cast<solver::group::SingleGroupSolver&>(
+            *single_group_solver_ptr).linear_solver_ptr());
+  }
+
   auto iterative_group_solver_ptr = BuildGroupSolveIteration(
-      BuildSingleGroupSolver(),
-      BuildMomentConvergenceChecker(1e-10, 100),
+      std::move(single_group_solver_ptr),
+      BuildMomentConvergenceChecker(1e-10, 100, inner_tolerance_ptr),
       std::move(moment_calculator_ptr),
       group_solution_ptr,
       updater_pointers.scattering_source_updater_ptr,
-      convergence_reporter_ptr);
+      convergence_reporter_ptr,
+      constraints_ptr);
 
   auto k_effective_updater = BuildKEffectiveUpdater(finite_element_ptr,
                                                     cross_sections_ptr,
@@ -136,21 +283,38 @@ auto FrameworkBuilder<dim>::BuildFramework(std::string name,
       BuildParameterConvergenceChecker(1e-6, 100),
       std::move(k_effective_updater),
       updater_pointers.fission_source_updater_ptr,
-      convergence_reporter_ptr);
+      convergence_reporter_ptr,
+      inner_tolerance_ptr);
 
-  auto system_ptr = BuildSystem(n_groups, n_angles, *domain_ptr,
-                                group_solution_ptr->solutions().at(0).size());
+  auto system_ptr = BuildSystem(n_groups, n_angles, *domain_ptr, true,
+                                !is_swept, scattering_order);
 
   auto results_output_ptr =
       std::make_unique<results::OutputDealiiVtu<dim>>(domain_ptr);
 
   Validate();
 
+  framework::Framework::SystemRefiner system_refiner = nullptr;
+  if (prm.AdaptiveRefinementCycles() > 0) {
+    system_refiner = [domain_ptr, group_solution_ptr, krylov_recycler_ptr,
+        refine_fraction = prm.RefineFraction(),
+        coarsen_fraction = prm.CoarsenFraction()](
+            system::System& system_to_refine) {
+      system::RefineSystem(system_to_refine, *group_solution_ptr, *domain_ptr,
+                           refine_fraction, coarsen_fraction);
+      // Recycled vectors are on the degrees of freedom of the previous mesh
+      if (krylov_recycler_ptr != nullptr)
+        krylov_recycler_ptr->ClearRecycledSpaces();
+    };
+  }
+
   return std::make_unique<framework::Framework>(
       std::move(system_ptr),
       std::move(initializer_ptr),
       std::move(outer_iteration_ptr),
-      std::move(results_output_ptr));
+      std::move(results_output_ptr),
+      std::move(system_refiner),
+      prm.AdaptiveRefinementCycles());
 }
 
 template<int dim>
@@ -173,15 +337,54 @@ auto FrameworkBuilder<dim>::BuildCrossSections(
     -> std::unique_ptr<CrossSectionType> {
   ReportBuildingComponant("Cross-sections");
   std::unique_ptr<CrossSectionType> return_ptr = nullptr;
+  const std::string library_filename =
+      problem_parameters.MaterialLibraryFilename();
+  const bool use_node_shared_memory =
+      problem_parameters.UseNodeSharedMaterialData();
+  const MaterialBinaryLibrary::Source library_source{
+      problem_parameters.MaterialFilenames(),
+      problem_parameters.NEnergyGroups(),
+      problem_parameters.NumberOfMaterials(),
+      problem_parameters.IsEigenvalueProblem()};
+
+  // Precompiled binary library, validated on rank 0 and broadcast
+  if (!library_filename.empty()) {
+    try {
+      MaterialBinaryLibrary materials(library_filename, library_source);
+      return_ptr = std::make_unique<CrossSectionType>(
+          materials, use_node_shared_memory);
+      ReportBuildSuccess("Cross-sections using binary library " +
+                         library_filename);
+      return return_ptr;
+    } catch (const dealii::ExceptionBase&) {
+      *reporter_ptr_ << "\tBinary library " + library_filename +
+          " missing, invalid or stale, reading material files\n";
+    }
+  }
+
   // Default implementation using protocol buffers
   try {
-    MaterialProtobuf materials(problem_parameters.MaterialFilenames(),
+    MaterialProtobuf materials(library_source.material_filenames,
                                problem_parameters.IsEigenvalueProblem(),
                                problem_parameters.DoNDA(),
-                               problem_parameters.NEnergyGroups(),
-                               problem_parameters.NumberOfMaterials());
-    return_ptr = std::move(std::make_unique<CrossSectionType>(materials));
+                               library_source.n_groups,
+                               library_source.n_materials);
+    return_ptr = std::make_unique<CrossSectionType>(materials,
+                                                  use_node_shared_memory);
     ReportBuildSuccess("(default) Cross-sections using protobuf");
+
+    // The library is only a cache, failing to write it does not stop the run
+    if (!library_filename.empty() &&
+        dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0) {
+      try {
+        MaterialBinaryLibrary::Write(materials, library_source,
+                                     library_filename);
+        *reporter_ptr_ << "\tWrote binary library " + library_filename + "\n";
+      } catch (const dealii::ExceptionBase&) {
+        *reporter_ptr_ << "\tFailed to write binary library " +
+            library_filename + ", continuing without it\n";
+      }
+    }
   } catch (...) {
     ReportBuildError("(default) Cross-sections using protobuf");
     throw;
@@ -217,20 +420,52 @@ auto FrameworkBuilder<dim>::BuildDomain(
   std::unique_ptr<DomainType> return_ptr = nullptr;
 
   ReportBuildingComponant("Mesh");
-  auto mesh_ptr = std::make_unique<domain::mesh::MeshCartesian<dim>>(
-      problem_parameters.SpatialMax(),
-      problem_parameters.NCells(),
-      material_mapping);
+  std::unique_ptr<domain::mesh::MeshI<dim>> mesh_ptr = nullptr;
+  try {
+    if (!problem_parameters.IsMeshGenerated()) {
+      mesh_ptr = std::make_unique<domain::mesh::MeshFile<dim>>(
+          problem_parameters.MeshFilename());
+    } else if (problem_parameters.IsMeshPinResolved()) {
+      mesh_ptr = std::make_unique<domain::mesh::MeshPinLattice<dim>>(
+          problem_parameters.SpatialMax(),
+          problem_parameters.NCells(),
+          material_mapping,
+          ReadMappingFile(problem_parameters.FuelPinMaterialMapFilename()),
+          problem_parameters.FuelPinRadius(),
+          problem_parameters.FuelPinTriangulation());
+    } else {
+      mesh_ptr = std::make_unique<domain::mesh::MeshCartesian<dim>>(
+          problem_parameters.SpatialMax(),
+          problem_parameters.NCells(),
+          material_mapping,
+          problem_parameters.UseNodeSharedMaterialData());
+    }
+  } catch (...) {
+    ReportBuildError();
+    throw;
+  }
   ReportBuildSuccess(mesh_ptr->description());
 
   ReportBuildingComponant("Domain");
   return_ptr = std::move(std::make_unique<domain::Definition<dim>>(
       std::move(mesh_ptr),
-      finite_element_ptr));
+      finite_element_ptr,
+      DiscretizationFor(problem_parameters),
+      problem_parameters.DoFRenumbering()));
   ReportBuildSuccess(return_ptr->description());
   return return_ptr;
 }
 
+template <int dim>
+auto FrameworkBuilder<dim>::BuildEvenParityFormulation(
+    const std::shared_ptr<FiniteElementType>& finite_element_ptr,
+    const std::shared_ptr<data::CrossSections>& cross_sections_ptr)
+-> std::unique_ptr<EvenParityFormulationType> {
+  reporter_ptr_->Report("\tBuilding Even-Parity Formulation\n");
+  using ReturnType = formulation::angular::EvenParity<dim>;
+  return std::make_unique<ReturnType>(finite_element_ptr, cross_sections_ptr);
+}
+
 template<int dim>
 auto FrameworkBuilder<dim>::BuildFiniteElement(ParametersType problem_parameters)
 -> std::unique_ptr<FiniteElementType>{
@@ -242,7 +477,7 @@ auto FrameworkBuilder<dim>::BuildFiniteElement(ParametersType problem_parameters
 
   try {
     return_ptr = std::move(std::make_unique<FiniteElementGaussianType>(
-        problem::DiscretizationType::kContinuousFEM,
+        DiscretizationFor(problem_parameters),
         problem_parameters.FEPolynomialDegree()));
 
     ReportBuildSuccess(return_ptr->description());
@@ -273,6 +508,27 @@ auto FrameworkBuilder<dim>::BuildUpdaterPointers(
   return return_struct;
 }
 
+template<int dim>
+auto FrameworkBuilder<dim>::BuildUpdaterPointers(
+    std::unique_ptr<EvenParityFormulationType> formulation_ptr,
+    std::unique_ptr<StamperType> stamper_ptr,
+    const std::shared_ptr<QuadratureSetType>& quadrature_set_ptr)
+-> UpdaterPointers {
+  ReportBuildingComponant("Building Even-Parity Formulation updater");
+  UpdaterPointers return_struct;
+
+  using ReturnType = formulation::updater::EvenParityUpdater<dim>;
+  auto even_parity_updater_ptr = std::make_shared<ReturnType>(
+      std::move(formulation_ptr),
+      std::move(stamper_ptr),
+      quadrature_set_ptr);
+  return_struct.fixed_updater_ptr = even_parity_updater_ptr;
+  return_struct.scattering_source_updater_ptr = even_parity_updater_ptr;
+  return_struct.fission_source_updater_ptr = even_parity_updater_ptr;
+
+  return return_struct;
+}
+
 template<int dim>
 auto FrameworkBuilder<dim>::BuildUpdaterPointers(
     std::unique_ptr<SAAFFormulationType> formulation_ptr,
@@ -294,6 +550,53 @@ auto FrameworkBuilder<dim>::BuildUpdaterPointers(
   return return_struct;
 }
 
+template<int dim>
+auto FrameworkBuilder<dim>::BuildUpdaterPointers(
+    std::unique_ptr<SAAFFormulationType> formulation_ptr,
+    std::unique_ptr<StamperType> stamper_ptr,
+    const std::shared_ptr<QuadratureSetType>& quadrature_set_ptr,
+    const std::shared_ptr<GroupSolutionType>& group_solution_ptr,
+    const std::shared_ptr<DomainType>& domain_ptr,
+    const std::unordered_set<problem::Boundary>& reflective_boundaries)
+-> UpdaterPointers {
+  ReportBuildingComponant("Building SAAF Formulation updater with reflective "
+                          "boundaries");
+  UpdaterPointers return_struct;
+
+  using ReturnType = formulation::updater::SAAFUpdater<dim>;
+  auto saaf_updater_ptr = std::make_shared<ReturnType>(
+      std::move(formulation_ptr),
+      std::move(stamper_ptr),
+      quadrature_set_ptr,
+      group_solution_ptr,
+      domain_ptr,
+      reflective_boundaries);
+  return_struct.fixed_updater_ptr = saaf_updater_ptr;
+  return_struct.scattering_source_updater_ptr = saaf_updater_ptr;
+  return_struct.fission_source_updater_ptr = saaf_updater_ptr;
+
+  return return_struct;
+}
+
+template<int dim>
+auto FrameworkBuilder<dim>::BuildUpdaterPointers(
+    const std::shared_ptr<UpwindDFEMFormulationType>& formulation_ptr,
+    std::unique_ptr<StamperType> stamper_ptr)
+-> UpdaterPointers {
+  ReportBuildingComponant("Building Upwind DFEM Formulation updater");
+  UpdaterPointers return_struct;
+
+  using ReturnType = formulation::updater::UpwindDFEMUpdater<dim>;
+  auto upwind_dfem_updater_ptr = std::make_shared<ReturnType>(
+      formulation_ptr,
+      std::move(stamper_ptr));
+  return_struct.fixed_updater_ptr = upwind_dfem_updater_ptr;
+  return_struct.scattering_source_updater_ptr = upwind_dfem_updater_ptr;
+  return_struct.fission_source_updater_ptr = upwind_dfem_updater_ptr;
+
+  return return_struct;
+}
+
 template <int dim>
 auto FrameworkBuilder<dim>::BuildGroupSolveIteration(
     std::unique_ptr<SingleGroupSolverType> single_group_solver_ptr,
@@ -301,7 +604,8 @@ auto FrameworkBuilder<dim>::BuildGroupSolveIteration(
     std::unique_ptr<MomentCalculatorType> moment_calculator_ptr,
     const std::shared_ptr<GroupSolutionType>& group_solution_ptr,
     const std::shared_ptr<ScatteringSourceUpdaterType>& scattering_source_updater_ptr,
-    const std::shared_ptr<ReporterType>& convergence_report_ptr)
+    const std::shared_ptr<ReporterType>& convergence_report_ptr,
+    const std::shared_ptr<const ConstraintsType>& constraints_ptr)
     -> std::unique_ptr<GroupSolveIterationType> {
   std::unique_ptr<GroupSolveIterationType> return_ptr = nullptr;
 
@@ -314,7 +618,8 @@ auto FrameworkBuilder<dim>::BuildGroupSolveIteration(
           std::move(moment_calculator_ptr),
           group_solution_ptr,
           scattering_source_updater_ptr,
-          convergence_report_ptr)
+          convergence_report_ptr,
+          constraints_ptr)
       );
   has_scattering_source_update_ = true;
   ReportBuildSuccess(return_ptr->description());
@@ -333,6 +638,41 @@ auto FrameworkBuilder<dim>::BuildGroupSolution(const int n_angles)
   return return_ptr;
 }
 
+template<int dim>
+auto FrameworkBuilder<dim>::BuildGroupSolution(
+    const std::shared_ptr<QuadratureSetType>& quadrature_set_ptr)
+-> std::unique_ptr<GroupSolutionType> {
+  std::unique_ptr<GroupSolutionType> return_ptr = nullptr;
+  ReportBuildingComponant("Group moment accumulator");
+
+  std::vector<double> angle_weights;
+  const int n_angles = quadrature_set_ptr->size();
+  for (int angle = 0; angle < n_angles; ++angle) {
+    angle_weights.push_back(quadrature_set_ptr->GetQuadraturePoint(
+        quadrature::QuadraturePointIndex(angle))->weight());
+  }
+
+  return_ptr = std::move(
+      std::make_unique<system::solution::MPIGroupMomentAccumulator>(
+          std::move(angle_weights)));
+  ReportBuildSuccess(return_ptr->description());
+  return return_ptr;
+}
+
+template<int dim>
+auto FrameworkBuilder<dim>::BuildInnerTolerance(const double min_tolerance)
+-> std::unique_ptr<InnerToleranceType> {
+  ReportBuildingComponant("Inner tolerance");
+  std::unique_ptr<InnerToleranceType> return_ptr = nullptr;
+
+  using ReturnType = convergence::InnerToleranceEisenstatWalker;
+
+  return_ptr = std::move(std::make_unique<ReturnType>(min_tolerance));
+  ReportBuildSuccess("Eisenstat-Walker adaptive inner tolerance: min = "
+                         + std::to_string(min_tolerance));
+  return return_ptr;
+}
+
 template<int dim>
 auto FrameworkBuilder<dim>::BuildInitializer(
     const std::shared_ptr<formulation::updater::FixedUpdaterI>& updater_ptr,
@@ -386,19 +726,26 @@ auto FrameworkBuilder<dim>::BuildMomentCalculator(
 template<int dim>
 auto FrameworkBuilder<dim>::BuildMomentCalculator(
     std::shared_ptr<QuadratureSetType> quadrature_set_ptr,
-    FrameworkBuilder::MomentCalculatorImpl implementation)
+    FrameworkBuilder::MomentCalculatorImpl implementation,
+    const int max_harmonic_l)
 -> std::unique_ptr<MomentCalculatorType> {
   ReportBuildingComponant("Moment calculator");
   std::unique_ptr<MomentCalculatorType> return_ptr = nullptr;
 
   try {
     return_ptr = std::move(quadrature::factory::MakeMomentCalculator<dim>(
-        implementation, quadrature_set_ptr));
+        implementation, quadrature_set_ptr, max_harmonic_l));
 
     if (implementation == MomentCalculatorImpl::kScalarMoment) {
       ReportBuildSuccess("(default) calculator for scalar solve");
     } else if (implementation == MomentCalculatorImpl::kZerothMomentOnly) {
       ReportBuildSuccess("(default) calculator for 0th moment only");
+    } else if (implementation ==
+        MomentCalculatorImpl::kAccumulatedZerothMoment) {
+      ReportBuildSuccess("calculator for accumulated 0th moment");
+    } else if (implementation == MomentCalculatorImpl::kSphericalHarmonicPN) {
+      ReportBuildSuccess("calculator for P_N moments up to l = "
+                         + std::to_string(max_harmonic_l));
     } else {
       AssertThrow(false,
                   dealii::ExcMessage("Unsupported implementation of moment "
@@ -417,7 +764,8 @@ auto FrameworkBuilder<dim>::BuildMomentCalculator(
 
 template<int dim>
 auto FrameworkBuilder<dim>::BuildMomentConvergenceChecker(
-    double max_delta, int max_iterations)
+    double max_delta, int max_iterations,
+    const std::shared_ptr<InnerToleranceType>& inner_tolerance_ptr)
 -> std::unique_ptr<MomentConvergenceCheckerType>{
   //TODO(Josh): Add option for using other than L1Norm
   ReportBuildingComponant("Moment convergence checker");
@@ -427,7 +775,8 @@ auto FrameworkBuilder<dim>::BuildMomentConvergenceChecker(
       system::moments::MomentVector,
       convergence::moments::SingleMomentCheckerI>;
 
-  auto single_checker_ptr = std::make_unique<CheckerType>(max_delta);
+  auto single_checker_ptr = std::make_unique<CheckerType>(max_delta,
+                                                         inner_tolerance_ptr);
   auto return_ptr = std::make_unique<FinalCheckerType>(
       std::move(single_checker_ptr));
   return_ptr->SetMaxIterations(max_iterations);
@@ -440,7 +789,8 @@ auto FrameworkBuilder<dim>::BuildOuterIteration(
     std::unique_ptr<ParameterConvergenceCheckerType> parameter_convergence_checker_ptr,
     std::unique_ptr<KEffectiveUpdaterType> k_effective_updater_ptr,
     const std::shared_ptr<FissionSourceUpdaterType>& fission_source_updater_ptr,
-    const std::shared_ptr<ReporterType>& convergence_reporter_ptr)
+    const std::shared_ptr<ReporterType>& convergence_reporter_ptr,
+    const std::shared_ptr<InnerToleranceType>& inner_tolerance_ptr)
 -> std::unique_ptr<OuterIterationType> {
   std::unique_ptr<OuterIterationType> return_ptr = nullptr;
   ReportBuildingComponant("Outer Iteration");
@@ -453,7 +803,8 @@ auto FrameworkBuilder<dim>::BuildOuterIteration(
           std::move(parameter_convergence_checker_ptr),
           std::move(k_effective_updater_ptr),
           fission_source_updater_ptr,
-          convergence_reporter_ptr));
+          convergence_reporter_ptr,
+          inner_tolerance_ptr));
 
   has_fission_source_update_ = true;
 
@@ -486,28 +837,39 @@ auto FrameworkBuilder<dim>::BuildQuadratureSet(ParametersType problem_parameters
   std::shared_ptr<QuadratureGeneratorType > quadrature_generator_ptr = nullptr;
 
   const int order_value = problem_parameters.AngularQuadOrder();
+  quadrature::AngularQuadratureSetType quadrature_type =
+      quadrature::AngularQuadratureSetType::kLevelSymmetricGaussian;
   switch (problem_parameters.AngularQuad()) {
-    default: {
-      if (dim == 3) {
-        quadrature_generator_ptr =
-            quadrature::factory::MakeAngularQuadratureGeneratorPtr<dim>(
-                quadrature::Order(order_value),
-                quadrature::AngularQuadratureSetType::kLevelSymmetricGaussian);
-      } else {
-        AssertThrow(false,
-                    dealii::ExcMessage("No supported quadratures for this dimension "
-                                       "and transport model"))
-      }
+    case problem::AngularQuadType::kProductGaussLegendreChebyshev: {
+      quadrature_type =
+          quadrature::AngularQuadratureSetType::kProductGaussLegendreChebyshev;
+      break;
     }
+    case problem::AngularQuadType::kGaussLegendre: {
+      quadrature_type = quadrature::AngularQuadratureSetType::kGaussLegendre;
+      break;
+    }
+    default:
+      break;
   }
 
+  quadrature_generator_ptr =
+      quadrature::factory::MakeAngularQuadratureGeneratorPtr<dim>(
+          quadrature::Order(order_value), quadrature_type,
+          quadrature::Order(problem_parameters.AngularQuadAzimuthalOrder()));
+
   return_ptr = quadrature::factory::MakeQuadratureSetPtr<dim>();
 
   auto quadrature_points = quadrature::utility::GenerateAllPositiveX<dim>(
       quadrature_generator_ptr->GenerateSet());
 
-  quadrature::factory::FillQuadratureSet<dim>(return_ptr.get(),
-                                              quadrature_points);
+  if (problem_parameters.TransportModel() == problem::EquationType::kEvenParity) {
+    quadrature::factory::FillHalfRangeQuadratureSet<dim>(return_ptr.get(),
+                                                         quadrature_points);
+  } else {
+    quadrature::factory::FillQuadratureSet<dim>(return_ptr.get(),
+                                                quadrature_points);
+  }
 
   return return_ptr;
 }
@@ -533,21 +895,65 @@ auto FrameworkBuilder<dim>::BuildSAAFFormulation(
   return return_ptr;
 }
 
+template <int dim>
+auto FrameworkBuilder<dim>::BuildUpwindDFEMFormulation(
+    const std::shared_ptr<FiniteElementType>& finite_element_ptr,
+    const std::shared_ptr<data::CrossSections>& cross_sections_ptr)
+-> std::unique_ptr<UpwindDFEMFormulationType> {
+  reporter_ptr_->Report("\tBuilding Upwind DFEM Formulation\n");
+  using ReturnType = formulation::angular::UpwindDFEM<dim>;
+  return std::make_unique<ReturnType>(finite_element_ptr, cross_sections_ptr);
+}
+
 template<int dim>
 auto FrameworkBuilder<dim>::BuildSingleGroupSolver(
     const int max_iterations,
-    const double convergence_tolerance)
+    const double convergence_tolerance,
+    const std::shared_ptr<InnerToleranceType>& inner_tolerance_ptr,
+    const int max_recycled_vectors,
+    const int max_total_recycled_vectors,
+    const std::shared_ptr<const ConstraintsType>& constraints_ptr)
 -> std::unique_ptr<SingleGroupSolverType> {
   ReportBuildingComponant("Single group solver");
   std::unique_ptr<SingleGroupSolverType> return_ptr = nullptr;
 
-  auto linear_solver_ptr = std::make_unique<solver::GMRES>(max_iterations,
-                                                           convergence_tolerance);
-  ReportBuildSuccess("GMRES: tol = " + std::to_string(convergence_tolerance)
-                            + "iter_max = " + std::to_string(max_iterations));
+  std::unique_ptr<solver::LinearI> linear_solver_ptr =
+      std::make_unique<solver::GMRES>(max_iterations,
+                                      convergence_tolerance,
+                                      inner_tolerance_ptr);
+  std::string description{"GMRES: tol = " + std::to_string(convergence_tolerance)
+                              + "iter_max = " + std::to_string(max_iterations)};
+
+  if (max_recycled_vectors > 0) {
+    linear_solver_ptr = std::make_unique<solver::KrylovRecycler>(
+        std::move(linear_solver_ptr), max_recycled_vectors,
+        max_total_recycled_vectors);
+    description += ", recycled vectors = "
+        + std::to_string(max_recycled_vectors) + " (total "
+        + std::to_string(max_total_recycled_vectors) + ")";
+  }
+  ReportBuildSuccess(description);
   return_ptr = std::move(std::make_unique<solver::group::SingleGroupSolver>(
-          std::move(linear_solver_ptr)));
+          std::move(linear_solver_ptr), constraints_ptr));
+
+  return return_ptr;
+}
 
+template<int dim>
+auto FrameworkBuilder<dim>::BuildSweepGroupSolver(
+    const std::shared_ptr<UpwindDFEMFormulationType>& formulation_ptr,
+    const std::shared_ptr<FiniteElementType>& finite_element_ptr,
+    const std::shared_ptr<DomainType>& domain_ptr,
+    const std::shared_ptr<QuadratureSetType>& quadrature_set_ptr)
+-> std::unique_ptr<SingleGroupSolverType> {
+  ReportBuildingComponant("Single group solver");
+  std::unique_ptr<SingleGroupSolverType> return_ptr = nullptr;
+
+  return_ptr = std::move(
+      std::make_unique<solver::group::SweepGroupSolver<dim>>(
+          formulation_ptr, finite_element_ptr, domain_ptr,
+          quadrature_set_ptr));
+  ReportBuildSuccess("transport sweep");
   return return_ptr;
 }
 
@@ -556,17 +962,19 @@ auto FrameworkBuilder<dim>::BuildSystem(
     const int total_groups,
     const int total_angles,
     const DomainType& domain,
-    const std::size_t solution_size,
-    bool is_eigenvalue_problem) -> std::unique_ptr<SystemType> {
+    bool is_eigenvalue_problem,
+    bool has_left_hand_side,
+    const int max_harmonic_l) -> std::unique_ptr<SystemType> {
   std::unique_ptr<SystemType> return_ptr;
 
   ReportBuildingComponant("system");
   try {
     return_ptr = std::move(std::make_unique<SystemType>());
     system::InitializeSystem(*return_ptr, total_groups, total_angles,
-                             is_eigenvalue_problem);
+                             is_eigenvalue_problem, has_left_hand_side,
+                             max_harmonic_l);
     system::SetUpSystemTerms(*return_ptr, domain);
-    system::SetUpSystemMoments(*return_ptr, solution_size);
+    system::SetUpSystemMoments(*return_ptr, domain);
   } catch (...) {
     ReportBuildError("system initialization error.");
     throw;
@@ -591,7 +999,7 @@ template<int dim>
 std::string FrameworkBuilder<dim>::ReadMappingFile(std::string filename) {
   reporter_ptr_->Report("\tReading mapping file: ");
 
-  std::ifstream mapping_file(filename);
+  std::ifstream mapping_file(filename, std::ios::binary);
   if (mapping_file.is_open()) {
     reporter_ptr_->Report(filename + '\n', Color::Green);
 
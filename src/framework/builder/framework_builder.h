@@ -3,6 +3,7 @@
 
 #include <fstream>
 #include <memory>
+#include <unordered_set>
 #include <data/cross_sections.h>
 #include <deal.II/base/conditional_ostream.h>
 
@@ -16,12 +17,15 @@
 // Interface classes built by this factory
 #include "convergence/reporter/mpi_i.h"
 #include "convergence/final_i.h"
+#include "convergence/inner_tolerance_i.h"
 #include "data/cross_sections.h"
 #include "domain/definition_i.h"
 #include "domain/finite_element/finite_element_i.h"
 #include "eigenvalue/k_effective/k_effective_updater_i.h"
 #include "formulation/stamper_i.h"
+#include "formulation/angular/even_parity_i.h"
 #include "formulation/angular/self_adjoint_angular_flux_i.h"
+#include "formulation/angular/upwind_dfem_i.h"
 #include "formulation/scalar/diffusion_i.h"
 #include "formulation/updater/fission_source_updater_i.h"
 #include "formulation/updater/fixed_updater_i.h"
@@ -55,9 +59,11 @@ class FrameworkBuilder {
   using Color = utility::reporter::Color;
   using MomentCalculatorImpl = quadrature::MomentCalculatorImpl;
 
+  using ConstraintsType = dealii::AffineConstraints<double>;
   using CrossSectionType = data::CrossSections;
   using DiffusionFormulationType = formulation::scalar::DiffusionI<dim>;
   using DomainType = domain::DefinitionI<dim>;
+  using EvenParityFormulationType = formulation::angular::EvenParityI<dim>;
   using FiniteElementType = domain::finite_element::FiniteElementI<dim>;
   using FissionSourceUpdaterType = formulation::updater::FissionSourceUpdaterI;
   using FixedUpdaterType = formulation::updater::FixedUpdaterI;
@@ -65,6 +71,7 @@ class FrameworkBuilder {
   using GroupSolutionType = system::solution::MPIGroupAngularSolutionI;
   using GroupSolveIterationType = iteration::group::GroupSolveIterationI;
   using InitializerType = iteration::initializer::InitializerI;
+  using InnerToleranceType = convergence::InnerToleranceI;
   using KEffectiveUpdaterType = eigenvalue::k_effective::K_EffectiveUpdaterI;
   using MomentCalculatorType = quadrature::calculators::SphericalHarmonicMomentsI;
   using MomentConvergenceCheckerType = convergence::FinalI<system::moments::MomentVector>;
@@ -77,6 +84,7 @@ class FrameworkBuilder {
   using SingleGroupSolverType = solver::group::SingleGroupSolverI;
   using StamperType = formulation::StamperI<dim>;
   using SystemType = system::System;
+  using UpwindDFEMFormulationType = formulation::angular::UpwindDFEMI<dim>;
 
   struct UpdaterPointers {
     std::shared_ptr<FissionSourceUpdaterType> fission_source_updater_ptr = nullptr;
@@ -99,25 +107,47 @@ class FrameworkBuilder {
   std::unique_ptr<DomainType> BuildDomain(
       ParametersType, const std::shared_ptr<FiniteElementType>&,
       std::string material_mapping);
+  std::unique_ptr<EvenParityFormulationType> BuildEvenParityFormulation(
+      const std::shared_ptr<FiniteElementType>&,
+      const std::shared_ptr<data::CrossSections>&);
   std::unique_ptr<FiniteElementType> BuildFiniteElement(ParametersType);
   UpdaterPointers BuildUpdaterPointers(
       std::unique_ptr<DiffusionFormulationType>,
       std::unique_ptr<StamperType>);
+  UpdaterPointers BuildUpdaterPointers(
+      std::unique_ptr<EvenParityFormulationType>,
+      std::unique_ptr<StamperType>,
+      const std::shared_ptr<QuadratureSetType>&);
   UpdaterPointers BuildUpdaterPointers(
       std::unique_ptr<SAAFFormulationType>,
       std::unique_ptr<StamperType>,
       const std::shared_ptr<QuadratureSetType>&);
+  UpdaterPointers BuildUpdaterPointers(
+      std::unique_ptr<SAAFFormulationType>,
+      std::unique_ptr<StamperType>,
+      const std::shared_ptr<QuadratureSetType>&,
+      const std::shared_ptr<GroupSolutionType>&,
+      const std::shared_ptr<DomainType>&,
+      const std::unordered_set<problem::Boundary>& reflective_boundaries);
+  UpdaterPointers BuildUpdaterPointers(
+      const std::shared_ptr<UpwindDFEMFormulationType>&,
+      std::unique_ptr<StamperType>);
   std::unique_ptr<GroupSolveIterationType> BuildGroupSolveIteration(
       std::unique_ptr<SingleGroupSolverType>,
       std::unique_ptr<MomentConvergenceCheckerType>,
       std::unique_ptr<MomentCalculatorType>,
       const std::shared_ptr<GroupSolutionType>&,
       const std::shared_ptr<ScatteringSourceUpdaterType>&,
-      const std::shared_ptr<ReporterType>&);
+      const std::shared_ptr<ReporterType>&,
+      const std::shared_ptr<const ConstraintsType>& constraints_ptr = nullptr);
   std::unique_ptr<InitializerType> BuildInitializer(
       const std::shared_ptr<formulation::updater::FixedUpdaterI>&,
       const int total_groups, const int total_angles);
   std::unique_ptr<GroupSolutionType> BuildGroupSolution(const int n_angles);
+  std::unique_ptr<GroupSolutionType> BuildGroupSolution(
+      const std::shared_ptr<QuadratureSetType>&);
+  std::unique_ptr<InnerToleranceType> BuildInnerTolerance(
+      const double min_tolerance);
   std::unique_ptr<KEffectiveUpdaterType> BuildKEffectiveUpdater(
       const std::shared_ptr<FiniteElementType>&,
       const std::shared_ptr<CrossSectionType>&,
@@ -126,15 +156,18 @@ class FrameworkBuilder {
       MomentCalculatorImpl implementation = MomentCalculatorImpl::kScalarMoment);
   std::unique_ptr<MomentCalculatorType> BuildMomentCalculator(
       std::shared_ptr<QuadratureSetType>,
-      MomentCalculatorImpl implementation = MomentCalculatorImpl::kZerothMomentOnly);
+      MomentCalculatorImpl implementation = MomentCalculatorImpl::kZerothMomentOnly,
+      const int max_harmonic_l = 0);
   std::unique_ptr<MomentConvergenceCheckerType> BuildMomentConvergenceChecker(
-      double max_delta, int max_iterations);
+      double max_delta, int max_iterations,
+      const std::shared_ptr<InnerToleranceType>& inner_tolerance_ptr = nullptr);
   std::unique_ptr<OuterIterationType> BuildOuterIteration(
       std::unique_ptr<GroupSolveIterationType>,
       std::unique_ptr<ParameterConvergenceCheckerType>,
       std::unique_ptr<KEffectiveUpdaterType>,
       const std::shared_ptr<FissionSourceUpdaterType>&,
-      const std::shared_ptr<ReporterType>&);
+      const std::shared_ptr<ReporterType>&,
+      const std::shared_ptr<InnerToleranceType>& inner_tolerance_ptr = nullptr);
   std::unique_ptr<ParameterConvergenceCheckerType> BuildParameterConvergenceChecker(
       double max_delta, int max_iterations);
   std::shared_ptr<QuadratureSetType> BuildQuadratureSet(ParametersType);
@@ -145,12 +178,25 @@ class FrameworkBuilder {
       const formulation::SAAFFormulationImpl implementation = formulation::SAAFFormulationImpl::kDefault);
   std::unique_ptr<SingleGroupSolverType> BuildSingleGroupSolver(
       const int max_iterations = 1000,
-      const double convergence_tolerance = 1e-10);
+      const double convergence_tolerance = 1e-10,
+      const std::shared_ptr<InnerToleranceType>& inner_tolerance_ptr = nullptr,
+      const int max_recycled_vectors = 0,
+      const int max_total_recycled_vectors = 200,
+      const std::shared_ptr<const ConstraintsType>& constraints_ptr = nullptr);
   std::unique_ptr<StamperType> BuildStamper(const std::shared_ptr<DomainType>&);
+  std::unique_ptr<SingleGroupSolverType> BuildSweepGroupSolver(
+      const std::shared_ptr<UpwindDFEMFormulationType>&,
+      const std::shared_ptr<FiniteElementType>&,
+      const std::shared_ptr<DomainType>&,
+      const std::shared_ptr<QuadratureSetType>&);
   std::unique_ptr<SystemType> BuildSystem(const int n_groups, const int n_angles,
                                           const DomainType& domain,
-                                          const std::size_t solution_size,
-                                          bool is_eigenvalue_problem = true);
+                                          bool is_eigenvalue_problem = true,
+                                          bool has_left_hand_side = true,
+                                          const int max_harmonic_l = 0);
+  std::unique_ptr<UpwindDFEMFormulationType> BuildUpwindDFEMFormulation(
+      const std::shared_ptr<FiniteElementType>&,
+      const std::shared_ptr<data::CrossSections>&);
 
   FrameworkReporterType* reporter_ptr() { return reporter_ptr_.get(); }
 
@@ -181,6 +227,13 @@ class FrameworkBuilder {
 
   void Validate() const;
 
+  //! Sweeps require a discontinuous basis, all other models are continuous
+  static problem::DiscretizationType DiscretizationFor(ParametersType prm) {
+    return prm.TransportModel() == problem::EquationType::kDiscreteOrdinates
+           ? problem::DiscretizationType::kDiscontinuousFEM
+           : problem::DiscretizationType::kContinuousFEM;
+  }
+
   std::shared_ptr<FrameworkReporterType> reporter_ptr_;
 
   template <typename T>
@@ -1,3 +1,8 @@
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+#include <deal.II/fe/fe_dgq.h>
 #include <deal.II/fe/fe_q.h>
 
 #include "framework/builder/framework_builder.h"
@@ -5,24 +10,37 @@
 // Instantiated concerete classes
 #include "convergence/reporter/mpi_noisy.h"
 #include "convergence/final_checker_or_n.h"
+#include "convergence/inner_tolerance_eisenstat_walker.h"
 #include "convergence/parameters/single_parameter_checker.h"
 #include "convergence/moments/single_moment_checker_i.h"
+#include "convergence/moments/single_moment_checker_l1_norm.h"
 #include "data/cross_sections.h"
 #include "domain/finite_element/finite_element_gaussian.h"
 #include "domain/definition.h"
 #include "eigenvalue/k_effective/updater_via_fission_source.h"
 #include "formulation/scalar/diffusion.h"
+#include "formulation/angular/even_parity.h"
 #include "formulation/angular/self_adjoint_angular_flux.h"
+#include "formulation/angular/upwind_dfem.h"
 #include "formulation/updater/saaf_updater.h"
 #include "formulation/updater/diffusion_updater.h"
+#include "formulation/updater/even_parity_updater.h"
+#include "formulation/updater/upwind_dfem_updater.h"
 #include "formulation/stamper.h"
 #include "iteration/outer/outer_power_iteration.h"
+#include "quadrature/calculators/accumulated_zeroth_moment.h"
 #include "quadrature/calculators/scalar_moment.h"
+#include "quadrature/calculators/spherical_harmonic_pn_moments.h"
 #include "quadrature/calculators/spherical_harmonic_zeroth_moment.h"
 #include "quadrature/quadrature_set.h"
+#include "quadrature/factory/quadrature_factories.h"
+#include "quadrature/utility/quadrature_utilities.h"
 #include "solver/gmres.h"
+#include "solver/krylov_recycler.h"
 #include "solver/group/single_group_solver.h"
+#include "solver/group/sweep_group_solver.h"
 #include "system/solution/mpi_group_angular_solution.h"
+#include "system/solution/mpi_group_moment_accumulator.h"
 #include "iteration/initializer/initialize_fixed_terms_once.h"
 #include "iteration/group/group_source_iteration.h"
 #include "system/system_types.h"
@@ -33,7 +51,9 @@
 #include "domain/tests/definition_mock.h"
 #include "domain/finite_element/tests/finite_element_mock.h"
 #include "eigenvalue/k_effective/tests/k_effective_updater_mock.h"
+#include "formulation/angular/tests/even_parity_mock.h"
 #include "formulation/angular/tests/self_adjoint_angular_flux_mock.h"
+#include "formulation/angular/tests/upwind_dfem_mock.h"
 #include "formulation/scalar/tests/diffusion_mock.h"
 #include "formulation/tests/stamper_mock.h"
 #include "formulation/updater/tests/scattering_source_updater_mock.h"
@@ -43,6 +63,7 @@
 #include "material/tests/mock_material.h"
 #include "problem/tests/parameters_mock.h"
 #include "formulation/updater/tests/fixed_updater_mock.h"
+#include "quadrature/tests/quadrature_point_mock.h"
 #include "quadrature/tests/quadrature_set_mock.h"
 #include "quadrature/calculators/tests/spherical_harmonic_moments_mock.h"
 #include "solver/group/tests/single_group_solver_mock.h"
@@ -182,6 +203,14 @@ void FrameworkBuilderIntegrationTest<DimensionWrapper>::SetUp() {
       .WillByDefault(Return(problem::EquationType::kDiffusion));
   ON_CALL(parameters, ReflectiveBoundary())
       .WillByDefault(Return(reflective_bcs));
+  ON_CALL(parameters, DoFRenumbering())
+      .WillByDefault(Return(problem::DoFRenumberingType::kNone));
+  ON_CALL(parameters, FissileCellCost())
+      .WillByDefault(Return(1.0));
+  ON_CALL(parameters, StoreAngularFlux())
+      .WillByDefault(Return(true));
+  ON_CALL(parameters, IsMeshGenerated())
+      .WillByDefault(Return(true));
   ON_CALL(*mock_reporter_ptr_, Instream(A<const std::string&>()))
       .WillByDefault(ReturnRef(*mock_reporter_ptr_));
   ON_CALL(*mock_reporter_ptr_, Instream(A<utility::reporter::Color>()))
@@ -204,6 +233,72 @@ TYPED_TEST(FrameworkBuilderIntegrationTest, BuildConvergenceReporterTest) {
               WhenDynamicCastTo<ExpectedType*>(NotNull()));
 }
 
+/* A binary material library is rebuilt from the material files when a source
+ * file changes after the library was written, instead of using stale data. */
+TYPED_TEST(FrameworkBuilderIntegrationTest, BuildCrossSectionsRebuildsLibrary) {
+  const std::string source_filename{"builder_test_reflector.material"};
+  const std::string library_filename{"builder_test_library.bin"};
+  std::stringstream reflector;
+  reflector << std::ifstream("./test_data/material/readable/reflector.material")
+      .rdbuf();
+  std::string source_contents = reflector.str();
+  std::ofstream(source_filename) << source_contents;
+
+  ON_CALL(this->parameters, NEnergyGroups()).WillByDefault(Return(7));
+  ON_CALL(this->parameters, NumberOfMaterials()).WillByDefault(Return(1));
+  ON_CALL(this->parameters, MaterialFilenames())
+      .WillByDefault(Return(std::unordered_map<int, std::string>{
+          {0, source_filename}}));
+  ON_CALL(this->parameters, MaterialLibraryFilename())
+      .WillByDefault(Return(library_filename));
+
+  auto cross_sections_ptr =
+      this->test_builder_ptr_->BuildCrossSections(this->parameters);
+  ASSERT_NE(cross_sections_ptr, nullptr);
+  EXPECT_DOUBLE_EQ(cross_sections_ptr->sigma_t(0)[0], 0.075384);
+  EXPECT_TRUE(std::ifstream(library_filename).good());
+
+  const std::string original_value{"value: 0.075384"};
+  source_contents.replace(source_contents.find(original_value),
+                          original_value.size(), "value: 0.08");
+  std::ofstream(source_filename, std::ios::trunc) << source_contents;
+
+  // Rebuilt from the changed source file, then loaded from the new library
+  for (int build = 0; build < 2; ++build) {
+    cross_sections_ptr =
+        this->test_builder_ptr_->BuildCrossSections(this->parameters);
+    ASSERT_NE(cross_sections_ptr, nullptr);
+    EXPECT_DOUBLE_EQ(cross_sections_ptr->sigma_t(0)[0], 0.08);
+  }
+
+  std::remove(source_filename.c_str());
+  std::remove(library_filename.c_str());
+}
+
+/* The binary material library is only a cache, a library that cannot be
+ * written should not stop cross-sections read from the material files from
+ * being built. */
+TYPED_TEST(FrameworkBuilderIntegrationTest,
+           BuildCrossSectionsUnwritableLibrary) {
+  const std::string library_filename{
+      "builder_test_missing_directory/builder_test_library.bin"};
+
+  ON_CALL(this->parameters, NEnergyGroups()).WillByDefault(Return(7));
+  ON_CALL(this->parameters, NumberOfMaterials()).WillByDefault(Return(1));
+  ON_CALL(this->parameters, MaterialFilenames())
+      .WillByDefault(Return(std::unordered_map<int, std::string>{
+          {0, "./test_data/material/readable/reflector.material"}}));
+  ON_CALL(this->parameters, MaterialLibraryFilename())
+      .WillByDefault(Return(library_filename));
+
+  std::unique_ptr<data::CrossSections> cross_sections_ptr;
+  EXPECT_NO_THROW(cross_sections_ptr =
+      this->test_builder_ptr_->BuildCrossSections(this->parameters));
+  ASSERT_NE(cross_sections_ptr, nullptr);
+  EXPECT_DOUBLE_EQ(cross_sections_ptr->sigma_t(0)[0], 0.075384);
+  EXPECT_FALSE(std::ifstream(library_filename).good());
+}
+
 TYPED_TEST(FrameworkBuilderIntegrationTest, BuildDiffusionFormulationTest) {
   constexpr int dim = this->dim;
 
@@ -238,6 +333,21 @@ TYPED_TEST(FrameworkBuilderIntegrationTest, BuildDiffusionUpdaterPointers) {
               WhenDynamicCastTo<ExpectedType*>(NotNull()));
 }
 
+TYPED_TEST(FrameworkBuilderIntegrationTest, BuildEvenParityUpdaterPointers) {
+  constexpr int dim = this->dim;
+  using ExpectedType = formulation::updater::EvenParityUpdater<dim>;
+  auto updater_struct = this->test_builder_ptr_->BuildUpdaterPointers(
+      std::make_unique<formulation::angular::EvenParityMock<dim>>(),
+      std::move(this->stamper_uptr_),
+      this->quadrature_set_sptr_);
+  EXPECT_THAT(updater_struct.fixed_updater_ptr.get(),
+              WhenDynamicCastTo<ExpectedType*>(NotNull()));
+  EXPECT_THAT(updater_struct.scattering_source_updater_ptr.get(),
+              WhenDynamicCastTo<ExpectedType*>(NotNull()));
+  EXPECT_THAT(updater_struct.fission_source_updater_ptr.get(),
+              WhenDynamicCastTo<ExpectedType*>(NotNull()));
+}
+
 TYPED_TEST(FrameworkBuilderIntegrationTest, BuildSAAFUpdaterPointers) {
   constexpr int dim = this->dim;
   using ExpectedType = formulation::updater::SAAFUpdater<dim>;
@@ -253,6 +363,61 @@ TYPED_TEST(FrameworkBuilderIntegrationTest, BuildSAAFUpdaterPointers) {
               WhenDynamicCastTo<ExpectedType*>(NotNull()));
 }
 
+TYPED_TEST(FrameworkBuilderIntegrationTest,
+           BuildSAAFUpdaterPointersReflective) {
+  constexpr int dim = this->dim;
+  using ExpectedType = formulation::updater::SAAFUpdater<dim>;
+
+  // Reflections across the x-axis must be in the quadrature set
+  std::array<double, dim> position;
+  position.fill(0.5);
+  auto quadrature_set_ptr = quadrature::factory::MakeQuadratureSetPtr<dim>();
+  quadrature::factory::FillQuadratureSet<dim>(
+      quadrature_set_ptr.get(),
+      quadrature::utility::GenerateAllPositiveX<dim>(
+          {{quadrature::CartesianPosition<dim>(position),
+            quadrature::Weight(1.0)}}));
+
+  auto updater_struct = this->test_builder_ptr_->BuildUpdaterPointers(
+      std::move(this->saaf_formulation_uptr_),
+      std::move(this->stamper_uptr_),
+      quadrature_set_ptr,
+      this->group_solution_sptr_,
+      this->domain_sptr_,
+      {problem::Boundary::kXMin});
+  EXPECT_THAT(updater_struct.fixed_updater_ptr.get(),
+              WhenDynamicCastTo<ExpectedType*>(NotNull()));
+  EXPECT_THAT(updater_struct.scattering_source_updater_ptr.get(),
+              WhenDynamicCastTo<ExpectedType*>(NotNull()));
+  EXPECT_THAT(updater_struct.fission_source_updater_ptr.get(),
+              WhenDynamicCastTo<ExpectedType*>(NotNull()));
+
+  auto saaf_updater_ptr = dynamic_cast<ExpectedType*>(
+      updater_struct.scattering_source_updater_ptr.get());
+  ASSERT_NE(saaf_updater_ptr, nullptr);
+  EXPECT_EQ(saaf_updater_ptr->group_solution_ptr(),
+            this->group_solution_sptr_.get());
+  EXPECT_EQ(saaf_updater_ptr->domain_ptr(), this->domain_sptr_.get());
+  EXPECT_EQ(saaf_updater_ptr->reflection_indices().count(
+      problem::Boundary::kXMin), 1);
+}
+
+TYPED_TEST(FrameworkBuilderIntegrationTest, BuildUpwindDFEMUpdaterPointers) {
+  constexpr int dim = this->dim;
+  using ExpectedType = formulation::updater::UpwindDFEMUpdater<dim>;
+  auto formulation_ptr =
+      std::make_shared<formulation::angular::UpwindDFEMMock<dim>>();
+  auto updater_struct = this->test_builder_ptr_->BuildUpdaterPointers(
+      formulation_ptr,
+      std::move(this->stamper_uptr_));
+  EXPECT_THAT(updater_struct.fixed_updater_ptr.get(),
+              WhenDynamicCastTo<ExpectedType*>(NotNull()));
+  EXPECT_THAT(updater_struct.scattering_source_updater_ptr.get(),
+              WhenDynamicCastTo<ExpectedType*>(NotNull()));
+  EXPECT_THAT(updater_struct.fission_source_updater_ptr.get(),
+              WhenDynamicCastTo<ExpectedType*>(NotNull()));
+}
+
 TYPED_TEST(FrameworkBuilderIntegrationTest, BuildDomainTest) {
   constexpr int dim = this->dim;
   auto finite_element_ptr =
@@ -262,14 +427,51 @@ TYPED_TEST(FrameworkBuilderIntegrationTest, BuildDomainTest) {
       .WillOnce(DoDefault());
   EXPECT_CALL(this->parameters, SpatialMax())
       .WillOnce(DoDefault());
+  EXPECT_CALL(this->parameters, DoFRenumbering())
+      .WillOnce(Return(problem::DoFRenumberingType::kCuthillMcKee));
 
   auto test_domain_ptr = this->test_builder_ptr_->BuildDomain(
       this->parameters, finite_element_ptr, "1 1 2 2");
 
   using ExpectedType = domain::Definition<this->dim>;
 
-  EXPECT_THAT(test_domain_ptr.get(),
+  ASSERT_THAT(test_domain_ptr.get(),
               WhenDynamicCastTo<ExpectedType*>(NotNull()));
+  EXPECT_EQ(dynamic_cast<ExpectedType*>(test_domain_ptr.get())
+                ->dof_renumbering_type(),
+            problem::DoFRenumberingType::kCuthillMcKee);
+}
+
+TYPED_TEST(FrameworkBuilderIntegrationTest, BuildDomainFromMissingFileTest) {
+  constexpr int dim = this->dim;
+  auto finite_element_ptr =
+      std::make_shared<NiceMock<domain::finite_element::FiniteElementMock<dim>>>();
+
+  EXPECT_CALL(this->parameters, IsMeshGenerated())
+      .WillOnce(Return(false));
+  EXPECT_CALL(this->parameters, MeshFilename())
+      .WillOnce(Return("missing_mesh_file.msh"));
+
+  EXPECT_ANY_THROW({
+    auto test_domain_ptr = this->test_builder_ptr_->BuildDomain(
+        this->parameters, finite_element_ptr, "");
+  });
+}
+
+TYPED_TEST(FrameworkBuilderIntegrationTest, BuildPinResolvedDomainMissingMapTest) {
+  constexpr int dim = this->dim;
+  auto finite_element_ptr =
+      std::make_shared<NiceMock<domain::finite_element::FiniteElementMock<dim>>>();
+
+  EXPECT_CALL(this->parameters, IsMeshPinResolved())
+      .WillOnce(Return(true));
+  EXPECT_CALL(this->parameters, FuelPinMaterialMapFilename())
+      .WillOnce(Return("missing_fuel_pin_map"));
+
+  EXPECT_ANY_THROW({
+    auto test_domain_ptr = this->test_builder_ptr_->BuildDomain(
+        this->parameters, finite_element_ptr, "1 1 2 2");
+  });
 }
 
 TYPED_TEST(FrameworkBuilderIntegrationTest, BuildGroupSourceIterationTest) {
@@ -296,6 +498,35 @@ TYPED_TEST(FrameworkBuilderIntegrationTest, BuildGroupSolution) {
   EXPECT_EQ(n_angles, group_solution_ptr->total_angles());
 }
 
+TYPED_TEST(FrameworkBuilderIntegrationTest, BuildGroupMomentAccumulator) {
+  constexpr int dim = this->dim;
+  using ExpectedType = system::solution::MPIGroupMomentAccumulator;
+  const std::vector<double> weights{0.25, 0.5, 0.75};
+
+  for (int i = 0; i < static_cast<int>(weights.size()); ++i) {
+    auto quadrature_point_ptr =
+        std::make_shared<quadrature::QuadraturePointMock<dim>>();
+    EXPECT_CALL(*quadrature_point_ptr, weight())
+        .WillOnce(Return(weights.at(i)));
+    EXPECT_CALL(*this->quadrature_set_sptr_,
+                GetQuadraturePoint(quadrature::QuadraturePointIndex(i)))
+        .WillOnce(Return(quadrature_point_ptr));
+  }
+  EXPECT_CALL(*this->quadrature_set_sptr_, size())
+      .WillOnce(Return(weights.size()));
+
+  auto group_solution_ptr = this->test_builder_ptr_->BuildGroupSolution(
+      this->quadrature_set_sptr_);
+
+  ASSERT_THAT(group_solution_ptr.get(),
+              WhenDynamicCastTo<ExpectedType*>(NotNull()));
+  EXPECT_EQ(group_solution_ptr->total_angles(),
+            static_cast<int>(weights.size()));
+  EXPECT_EQ(group_solution_ptr->stored_angles(), 1);
+  EXPECT_EQ(dynamic_cast<ExpectedType*>(group_solution_ptr.get())->angle_weights(),
+            weights);
+}
+
 TYPED_TEST(FrameworkBuilderIntegrationTest, BuildFiniteElementTest) {
   constexpr int dim = this->dim;
   EXPECT_CALL(this->parameters, FEPolynomialDegree())
@@ -313,6 +544,19 @@ TYPED_TEST(FrameworkBuilderIntegrationTest, BuildFiniteElementTest) {
   EXPECT_NE(dealii_finite_element_ptr, nullptr);
 }
 
+TYPED_TEST(FrameworkBuilderIntegrationTest, BuildFiniteElementDiscreteOrdinatesTest) {
+  constexpr int dim = this->dim;
+  ON_CALL(this->parameters, TransportModel())
+      .WillByDefault(Return(problem::EquationType::kDiscreteOrdinates));
+
+  auto finite_element_ptr = this->test_builder_ptr_->BuildFiniteElement(this->parameters);
+
+  // Sweeps require a discontinuous basis
+  auto dealii_finite_element_ptr = dynamic_cast<dealii::FE_DGQ<dim>*>(
+      finite_element_ptr->finite_element());
+  EXPECT_NE(dealii_finite_element_ptr, nullptr);
+}
+
 TYPED_TEST(FrameworkBuilderIntegrationTest, BuildKeffectiveUpdater) {
   using ExpectedType = eigenvalue::k_effective::UpdaterViaFissionSource;
   EXPECT_CALL(*this->finite_element_sptr_, n_cell_quad_pts())
@@ -352,6 +596,30 @@ TYPED_TEST(FrameworkBuilderIntegrationTest, BulidMomentCalculatorAngular) {
               WhenDynamicCastTo<ExpectedType*>(NotNull()));
 }
 
+TYPED_TEST(FrameworkBuilderIntegrationTest, BuildMomentCalculatorAccumulated) {
+  using ExpectedType = quadrature::calculators::AccumulatedZerothMoment;
+  using Implementation = quadrature::MomentCalculatorImpl;
+
+  auto moment_calculator_ptr = this->test_builder_ptr_->BuildMomentCalculator(
+      Implementation::kAccumulatedZerothMoment);
+  ASSERT_THAT(moment_calculator_ptr.get(),
+              WhenDynamicCastTo<ExpectedType*>(NotNull()));
+}
+
+TYPED_TEST(FrameworkBuilderIntegrationTest, BuildMomentCalculatorPN) {
+  constexpr int dim = this->dim;
+  using ExpectedType = quadrature::calculators::SphericalHarmonicPNMoments<dim>;
+  using Implementation = quadrature::MomentCalculatorImpl;
+
+  auto moment_calculator_ptr = this->test_builder_ptr_->BuildMomentCalculator(
+      quadrature::factory::MakeQuadratureSetPtr<dim>(),
+      Implementation::kSphericalHarmonicPN, 3);
+  auto pn_calculator_ptr =
+      dynamic_cast<ExpectedType*>(moment_calculator_ptr.get());
+  ASSERT_NE(pn_calculator_ptr, nullptr);
+  EXPECT_EQ(pn_calculator_ptr->max_harmonic_l(), 3);
+}
+
 TYPED_TEST(FrameworkBuilderIntegrationTest, BuildPowerIterationTest) {
   auto power_iteration_ptr = this->test_builder_ptr_->BuildOuterIteration(
       std::move(this->group_solve_iteration_uptr_),
@@ -372,12 +640,58 @@ TYPED_TEST(FrameworkBuilderIntegrationTest, BuildLSAngularQuadratureSet) {
   EXPECT_CALL(this->parameters, AngularQuadOrder())
       .WillOnce(Return(order));
 
-  if (dim == 3) {
-    using ExpectedType = quadrature::QuadratureSet<dim>;
+  // 2D sets fold the directions mirrored across the xy-plane into the weights,
+  // 1D sets are Gauss-Legendre in mu.
+  std::map<int, int> expected_size{{1, order},
+                                   {2, order * (order + 2) / 2},
+                                   {3, order * (order + 2)}};
+
+  using ExpectedType = quadrature::QuadratureSet<dim>;
+  auto quadrature_set = this->test_builder_ptr_->BuildQuadratureSet(this->parameters);
+  ASSERT_NE(nullptr, quadrature_set);
+  ASSERT_NE(nullptr, dynamic_cast<ExpectedType*>(quadrature_set.get()));
+  EXPECT_EQ(quadrature_set->size(), expected_size.at(dim));
+  double weight_sum = 0;
+  for (const auto& quadrature_point : *quadrature_set)
+    weight_sum += quadrature_point->weight();
+  EXPECT_NEAR(weight_sum, 4 * M_PI, 1e-10);
+}
+
+TYPED_TEST(FrameworkBuilderIntegrationTest, BuildProductGLCAngularQuadratureSet) {
+  constexpr int dim = this->dim;
+  const int polar_order = 4, azimuthal_order = 12;
+  EXPECT_CALL(this->parameters, AngularQuad())
+      .WillOnce(Return(problem::AngularQuadType::kProductGaussLegendreChebyshev));
+  EXPECT_CALL(this->parameters, AngularQuadOrder())
+      .WillOnce(Return(polar_order));
+  EXPECT_CALL(this->parameters, AngularQuadAzimuthalOrder())
+      .WillOnce(Return(azimuthal_order));
+
+  std::map<int, int> expected_size{{1, polar_order},
+                                   {2, polar_order * azimuthal_order / 2},
+                                   {3, polar_order * azimuthal_order}};
+
+  auto quadrature_set = this->test_builder_ptr_->BuildQuadratureSet(this->parameters);
+  ASSERT_NE(nullptr, quadrature_set);
+  EXPECT_EQ(quadrature_set->size(), expected_size.at(dim));
+  double weight_sum = 0;
+  for (const auto& quadrature_point : *quadrature_set)
+    weight_sum += quadrature_point->weight();
+  EXPECT_NEAR(weight_sum, 4 * M_PI, 1e-10);
+}
+
+TYPED_TEST(FrameworkBuilderIntegrationTest, BuildGaussLegendreAngularQuadratureSet) {
+  constexpr int dim = this->dim;
+  const int order = 8;
+  EXPECT_CALL(this->parameters, AngularQuad())
+      .WillOnce(Return(problem::AngularQuadType::kGaussLegendre));
+  EXPECT_CALL(this->parameters, AngularQuadOrder())
+      .WillOnce(Return(order));
+
+  if (dim == 1) {
     auto quadrature_set = this->test_builder_ptr_->BuildQuadratureSet(this->parameters);
     ASSERT_NE(nullptr, quadrature_set);
-    ASSERT_NE(nullptr, dynamic_cast<ExpectedType*>(quadrature_set.get()));
-    EXPECT_EQ(quadrature_set->size(), order * (order + 2));
+    EXPECT_EQ(quadrature_set->size(), order);
   } else {
     EXPECT_ANY_THROW({
       auto quadrature_set = this->test_builder_ptr_->BuildQuadratureSet(this->parameters);
@@ -385,6 +699,28 @@ TYPED_TEST(FrameworkBuilderIntegrationTest, BuildLSAngularQuadratureSet) {
   }
 }
 
+TYPED_TEST(FrameworkBuilderIntegrationTest, BuildEvenParityQuadratureSet) {
+  constexpr int dim = this->dim;
+  const int order = 4;
+  ON_CALL(this->parameters, TransportModel())
+      .WillByDefault(Return(problem::EquationType::kEvenParity));
+  EXPECT_CALL(this->parameters, AngularQuad())
+      .WillOnce(Return(problem::AngularQuadType::kLevelSymmetricGaussian));
+  EXPECT_CALL(this->parameters, AngularQuadOrder())
+      .WillOnce(Return(order));
+
+  std::map<int, int> expected_size{{1, order / 2},
+                                   {2, order * (order + 2) / 4},
+                                   {3, order * (order + 2) / 2}};
+
+  // Only one direction of each reflection pair is in the set
+  auto quadrature_set = this->test_builder_ptr_->BuildQuadratureSet(this->parameters);
+  ASSERT_NE(nullptr, quadrature_set);
+  EXPECT_EQ(quadrature_set->size(), expected_size.at(dim));
+  for (const auto& quadrature_point : *quadrature_set)
+    EXPECT_EQ(quadrature_set->GetReflection(quadrature_point), nullptr);
+}
+
 TYPED_TEST(FrameworkBuilderIntegrationTest, BuildSingleGroupSolver) {
   using ExpectedType = solver::group::SingleGroupSolver;
 
@@ -405,6 +741,72 @@ TYPED_TEST(FrameworkBuilderIntegrationTest, BuildSingleGroupSolver) {
   EXPECT_EQ(linear_solver_ptr->max_iterations(), 100);
 }
 
+TYPED_TEST(FrameworkBuilderIntegrationTest, BuildSingleGroupSolverRecycling) {
+  auto solver_ptr = this->test_builder_ptr_->BuildSingleGroupSolver(
+      100, 1e-12, nullptr, 5, 40);
+  auto dynamic_ptr =
+      dynamic_cast<solver::group::SingleGroupSolver*>(solver_ptr.get());
+  ASSERT_NE(nullptr, dynamic_ptr);
+
+  auto recycler_ptr = dynamic_cast<solver::KrylovRecycler*>(
+      dynamic_ptr->linear_solver_ptr());
+  ASSERT_NE(nullptr, recycler_ptr);
+  EXPECT_EQ(recycler_ptr->max_vectors(), 5);
+  EXPECT_EQ(recycler_ptr->max_total_vectors(), 40);
+
+  auto linear_solver_ptr = dynamic_cast<solver::GMRES*>(
+      recycler_ptr->linear_solver_ptr());
+  ASSERT_NE(nullptr, linear_solver_ptr);
+  EXPECT_EQ(linear_solver_ptr->convergence_tolerance(), 1e-12);
+  EXPECT_EQ(linear_solver_ptr->max_iterations(), 100);
+}
+
+TYPED_TEST(FrameworkBuilderIntegrationTest, BuildInnerTolerance) {
+  using ExpectedType = convergence::InnerToleranceEisenstatWalker;
+
+  auto inner_tolerance_ptr =
+      this->test_builder_ptr_->BuildInnerTolerance(1e-10);
+  ASSERT_THAT(inner_tolerance_ptr.get(),
+              WhenDynamicCastTo<ExpectedType*>(NotNull()));
+  EXPECT_EQ(dynamic_cast<ExpectedType*>(inner_tolerance_ptr.get())
+                ->min_tolerance(), 1e-10);
+}
+
+TYPED_TEST(FrameworkBuilderIntegrationTest, BuildSingleGroupSolverInnerTolerance) {
+  std::shared_ptr<convergence::InnerToleranceI> inner_tolerance_ptr =
+      this->test_builder_ptr_->BuildInnerTolerance(1e-10);
+
+  auto solver_ptr = this->test_builder_ptr_->BuildSingleGroupSolver(
+      100, 1e-12, inner_tolerance_ptr);
+  auto dynamic_ptr =
+      dynamic_cast<solver::group::SingleGroupSolver*>(solver_ptr.get());
+  ASSERT_NE(nullptr, dynamic_ptr);
+  auto linear_solver_ptr = dynamic_cast<solver::GMRES*>(
+      dynamic_ptr->linear_solver_ptr());
+  ASSERT_NE(nullptr, linear_solver_ptr);
+  EXPECT_EQ(linear_solver_ptr->inner_tolerance_ptr(), inner_tolerance_ptr.get());
+}
+
+TYPED_TEST(FrameworkBuilderIntegrationTest, BuildMomentConvergenceCheckerInnerTolerance) {
+  std::shared_ptr<convergence::InnerToleranceI> inner_tolerance_ptr =
+      this->test_builder_ptr_->BuildInnerTolerance(1e-10);
+
+  auto convergence_ptr =
+      this->test_builder_ptr_->BuildMomentConvergenceChecker(
+          1e-10, 100, inner_tolerance_ptr);
+
+  using FinalCheckerType =
+  convergence::FinalCheckerOrN<system::moments::MomentVector,
+                               convergence::moments::SingleMomentCheckerI>;
+  auto final_checker_ptr =
+      dynamic_cast<FinalCheckerType*>(convergence_ptr.get());
+  ASSERT_NE(nullptr, final_checker_ptr);
+  auto checker_ptr = dynamic_cast<convergence::moments::SingleMomentCheckerL1Norm*>(
+      final_checker_ptr->checker_ptr());
+  ASSERT_NE(nullptr, checker_ptr);
+  EXPECT_EQ(checker_ptr->inner_tolerance_ptr(), inner_tolerance_ptr.get());
+}
+
 TYPED_TEST(FrameworkBuilderIntegrationTest, BuildConvergenceChecker) {
   const double max_delta = 1e-4;
   const int max_iterations = 100;
@@ -466,6 +868,45 @@ TYPED_TEST(FrameworkBuilderIntegrationTest, BuildSAAFFormulationTest) {
               WhenDynamicCastTo<ExpectedType*>(NotNull()));
 }
 
+TYPED_TEST(FrameworkBuilderIntegrationTest, BuildEvenParityFormulationTest) {
+  constexpr int dim = this->dim;
+
+  auto even_parity_formulation_ptr =
+      this->test_builder_ptr_->BuildEvenParityFormulation(
+          this->finite_element_sptr_, this->cross_sections_sptr_);
+
+  using ExpectedType = formulation::angular::EvenParity<dim>;
+
+  EXPECT_THAT(even_parity_formulation_ptr.get(),
+              WhenDynamicCastTo<ExpectedType*>(NotNull()));
+}
+
+TYPED_TEST(FrameworkBuilderIntegrationTest, BuildUpwindDFEMFormulationTest) {
+  constexpr int dim = this->dim;
+
+  auto upwind_dfem_formulation_ptr =
+      this->test_builder_ptr_->BuildUpwindDFEMFormulation(
+          this->finite_element_sptr_, this->cross_sections_sptr_);
+
+  using ExpectedType = formulation::angular::UpwindDFEM<dim>;
+
+  EXPECT_THAT(upwind_dfem_formulation_ptr.get(),
+              WhenDynamicCastTo<ExpectedType*>(NotNull()));
+}
+
+TYPED_TEST(FrameworkBuilderIntegrationTest, BuildSweepGroupSolver) {
+  constexpr int dim = this->dim;
+  using ExpectedType = solver::group::SweepGroupSolver<dim>;
+
+  auto solver_ptr = this->test_builder_ptr_->BuildSweepGroupSolver(
+      std::make_shared<formulation::angular::UpwindDFEMMock<dim>>(),
+      this->finite_element_sptr_,
+      this->domain_sptr_,
+      this->quadrature_set_sptr_);
+
+  EXPECT_THAT(solver_ptr.get(), WhenDynamicCastTo<ExpectedType*>(NotNull()));
+}
+
 TYPED_TEST(FrameworkBuilderIntegrationTest, BuildStamper) {
   constexpr int dim = this->dim;
 
@@ -8,11 +8,15 @@ Framework::Framework(
     std::unique_ptr<system::System> system_ptr,
     std::unique_ptr<Initializer> initializer_ptr,
     std::unique_ptr<OuterIterator> outer_iterator_ptr,
-    std::unique_ptr<ResultsOutput> results_output_ptr)
+    std::unique_ptr<ResultsOutput> results_output_ptr,
+    SystemRefiner system_refiner,
+    const int refinement_cycles)
     : system_ptr_(std::move(system_ptr)),
       initializer_ptr_(std::move(initializer_ptr)),
       outer_iterator_ptr_(std::move(outer_iterator_ptr)),
-      results_output_ptr_(std::move(results_output_ptr)) {
+      results_output_ptr_(std::move(results_output_ptr)),
+      system_refiner_(std::move(system_refiner)),
+      refinement_cycles_(refinement_cycles) {
 
   AssertThrow(system_ptr_ != nullptr,
               dealii::ExcMessage("System pointer passed to "
@@ -23,12 +27,25 @@ Framework::Framework(
   AssertThrow(outer_iterator_ptr_ != nullptr,
               dealii::ExcMessage("Outer iterator pointer passed to "
                                  "Framework constructor is null"));
-
+  AssertThrow(refinement_cycles_ >= 0,
+              dealii::ExcMessage("Refinement cycles passed to "
+                                 "Framework constructor must be >= 0"));
+  AssertThrow(refinement_cycles_ == 0 || system_refiner_ != nullptr,
+              dealii::ExcMessage("System refiner passed to Framework "
+                                 "constructor is null but refinement cycles "
+                                 "are requested"));
 }
 
 void Framework::SolveSystem() {
   initializer_ptr_->Initialize(*system_ptr_);
   outer_iterator_ptr_->IterateToConvergence(*system_ptr_);
+
+  for (int cycle = 0; cycle < refinement_cycles_; ++cycle) {
+    system_refiner_(*system_ptr_);
+    // Fixed terms are rebuilt for the refined mesh
+    initializer_ptr_->Initialize(*system_ptr_);
+    outer_iterator_ptr_->IterateToConvergence(*system_ptr_);
+  }
 }
 
 void Framework::OutputResults(std::ostream &output_stream) {
@@ -1,6 +1,7 @@
 #ifndef BART_SRC_FRAMEWORK_FRAMEWORK_H_
 #define BART_SRC_FRAMEWORK_FRAMEWORK_H_
 
+#include <functional>
 #include <memory>
 #include <ostream>
 
@@ -19,12 +20,23 @@ class Framework : public FrameworkI {
   using Initializer = iteration::initializer::InitializerI;
   using OuterIterator = iteration::outer::OuterIterationI;
   using ResultsOutput = results::OutputI;
-
+  //! Refines the domain and carries the system over to the refined domain
+  using SystemRefiner = std::function<void(system::System&)>;
+
+  /*! \brief Constructor.
+   *
+   * If a system refiner and a number of refinement cycles are provided, the
+   * system is solved on the initial mesh and then refined and solved again
+   * for each cycle, each solve starting from the solution of the previous
+   * cycle.
+   */
   Framework(
       std::unique_ptr<system::System> system_ptr,
       std::unique_ptr<Initializer> initializer_ptr,
       std::unique_ptr<OuterIterator> outer_iterator_ptr,
-      std::unique_ptr<ResultsOutput> results_output_ptr = nullptr);
+      std::unique_ptr<ResultsOutput> results_output_ptr = nullptr,
+      SystemRefiner system_refiner = nullptr,
+      int refinement_cycles = 0);
   virtual ~Framework() = default;
 
   void SolveSystem() override;
@@ -51,11 +63,15 @@ class Framework : public FrameworkI {
     return results_output_ptr_.get();
   }
 
+  int refinement_cycles() const { return refinement_cycles_; }
+
  protected:
   std::unique_ptr<system::System> system_ptr_ = nullptr;
   std::unique_ptr<Initializer> initializer_ptr_ = nullptr;
   std::unique_ptr<OuterIterator> outer_iterator_ptr_ = nullptr;
   std::unique_ptr<ResultsOutput> results_output_ptr_ = nullptr;
+  SystemRefiner system_refiner_ = nullptr;
+  const int refinement_cycles_ = 0;
 };
 
 } // namespace framework
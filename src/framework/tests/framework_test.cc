@@ -86,6 +86,41 @@ TEST_F(FrameworkTest, SolveSystem) {
   test_framework_->SolveSystem();
 }
 
+TEST_F(FrameworkTest, SolveSystemWithRefinement) {
+  auto system_ptr = std::make_unique<system::System>();
+  auto& system = *system_ptr;
+  auto initializer_ptr = std::make_unique<Initializer>();
+  auto outer_iterator_ptr = std::make_unique<OuterIterator>();
+  const int refinement_cycles = 2;
+
+  EXPECT_CALL(*initializer_ptr, Initialize(Ref(system)))
+      .Times(refinement_cycles + 1);
+  EXPECT_CALL(*outer_iterator_ptr, IterateToConvergence(Ref(system)))
+      .Times(refinement_cycles + 1);
+
+  int times_refined = 0;
+  Framework test_framework(
+      std::move(system_ptr), std::move(initializer_ptr),
+      std::move(outer_iterator_ptr), nullptr,
+      [&](system::System& to_refine) {
+        EXPECT_EQ(&to_refine, &system);
+        ++times_refined; },
+      refinement_cycles);
+  EXPECT_EQ(test_framework.refinement_cycles(), refinement_cycles);
+
+  test_framework.SolveSystem();
+  EXPECT_EQ(times_refined, refinement_cycles);
+}
+
+TEST_F(FrameworkTest, RefinementWithoutRefinerThrows) {
+  EXPECT_ANY_THROW({
+    Framework test_framework(std::make_unique<system::System>(),
+                             std::make_unique<Initializer>(),
+                             std::make_unique<OuterIterator>(),
+                             nullptr, nullptr, 1);
+  });
+}
+
 TEST_F(FrameworkTest, OutputResultsNoOutputter) {
   auto system_ptr = std::make_unique<system::System>();
   auto initializer_ptr = std::make_unique<Initializer>();
@@ -12,12 +12,14 @@ GroupSolveIteration<dim>::GroupSolveIteration(
     std::unique_ptr<ConvergenceChecker> convergence_checker_ptr,
     std::unique_ptr<MomentCalculator> moment_calculator_ptr,
     const std::shared_ptr<GroupSolution> &group_solution_ptr,
-    const std::shared_ptr<Reporter> &reporter_ptr)
+    const std::shared_ptr<Reporter> &reporter_ptr,
+    const std::shared_ptr<const Constraints> &constraints_ptr)
     : group_solver_ptr_(std::move(group_solver_ptr)),
       convergence_checker_ptr_(std::move(convergence_checker_ptr)),
       moment_calculator_ptr_(std::move(moment_calculator_ptr)),
       group_solution_ptr_(group_solution_ptr),
-      reporter_ptr_(reporter_ptr) {
+      reporter_ptr_(reporter_ptr),
+      constraints_ptr_(constraints_ptr) {
 
   AssertThrow(group_solver_ptr_ != nullptr,
               dealii::ExcMessage("Group solver pointer passed to "
@@ -108,12 +110,16 @@ void GroupSolveIteration<dim>::UpdateCurrentMoments(system::System &system,
   auto& current_moments = *system.current_moments;
   const int max_harmonic_l = current_moments.max_harmonic_l();
 
+  // All moments are calculated together so that calculators can do it in a
+  // single pass over the angular solutions
+  auto moments = moment_calculator_ptr_->CalculateMoments(
+      group_solution_ptr_.get(), group, max_harmonic_l);
 
-  for (int l = 0; l <= max_harmonic_l; ++l) {
-    for (int m = -l; m <= l; ++m) {
-      current_moments[{group, l, m}] = moment_calculator_ptr_->CalculateMoment(
-          group_solution_ptr_.get(), group, l, m);
-    }
+  for (auto& [index, moment] : moments) {
+    if (constraints_ptr_ != nullptr)
+      constraints_ptr_->distribute(moment);
+    // Copy assigned so that ghost entries of the system moments are updated
+    current_moments[index] = moment;
   }
 }
 
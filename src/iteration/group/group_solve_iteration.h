@@ -9,6 +9,8 @@
 
 #include <memory>
 
+#include <deal.II/lac/affine_constraints.h>
+
 #include "solver/group/single_group_solver_i.h"
 
 namespace bart {
@@ -25,13 +27,20 @@ class GroupSolveIteration : public GroupSolveIterationI {
   using MomentCalculator = quadrature::calculators::SphericalHarmonicMomentsI;
   using GroupSolution = system::solution::MPIGroupAngularSolutionI;
   using Reporter = convergence::reporter::MpiI;
+  using Constraints = dealii::AffineConstraints<double>;
 
+  /*! \brief Constructor.
+   *
+   * If hanging node constraints are provided, the moments of each group are
+   * made conforming with them before they are stored in the system.
+   */
   GroupSolveIteration(
       std::unique_ptr<GroupSolver> group_solver_ptr,
       std::unique_ptr<ConvergenceChecker> convergence_checker_ptr,
       std::unique_ptr<MomentCalculator> moment_calculator_ptr,
       const std::shared_ptr<GroupSolution> &group_solution_ptr,
-      const std::shared_ptr<Reporter> &reporter_ptr = nullptr);
+      const std::shared_ptr<Reporter> &reporter_ptr = nullptr,
+      const std::shared_ptr<const Constraints> &constraints_ptr = nullptr);
   virtual ~GroupSolveIteration() = default;
 
   void Iterate(system::System &system) override;
@@ -56,6 +65,10 @@ class GroupSolveIteration : public GroupSolveIterationI {
     return reporter_ptr_.get();
   }
 
+  const Constraints* constraints_ptr() const {
+    return constraints_ptr_.get();
+  }
+
  protected:
 
   virtual void SolveGroup(const int group, system::System &system);
@@ -73,6 +86,7 @@ class GroupSolveIteration : public GroupSolveIterationI {
   std::unique_ptr<MomentCalculator> moment_calculator_ptr_ = nullptr;
   std::shared_ptr<GroupSolution> group_solution_ptr_ = nullptr;
   std::shared_ptr<Reporter> reporter_ptr_ = nullptr;
+  std::shared_ptr<const Constraints> constraints_ptr_ = nullptr;
 };
 
 } // namespace group
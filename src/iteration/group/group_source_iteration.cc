@@ -13,12 +13,14 @@ GroupSourceIteration<dim>::GroupSourceIteration(
     std::unique_ptr<MomentCalculator> moment_calculator_ptr,
     const std::shared_ptr<GroupSolution> &group_solution_ptr,
     const std::shared_ptr<SourceUpdater> &source_updater_ptr,
-    const std::shared_ptr<Reporter> &reporter_ptr)
+    const std::shared_ptr<Reporter> &reporter_ptr,
+    const std::shared_ptr<const Constraints> &constraints_ptr)
     : GroupSolveIteration<dim>(std::move(group_solver_ptr),
         std::move(convergence_checker_ptr),
         std::move(moment_calculator_ptr),
         group_solution_ptr,
-        reporter_ptr) {
+        reporter_ptr,
+        constraints_ptr) {
   source_updater_ptr_ = source_updater_ptr;
   AssertThrow(source_updater_ptr_ != nullptr,
               dealii::ExcMessage("Source updater pointer passed to "
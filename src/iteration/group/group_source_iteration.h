@@ -18,6 +18,7 @@ class GroupSourceIteration : public GroupSolveIteration<dim> {
   using typename GroupSolveIteration<dim>::MomentCalculator;
   using typename GroupSolveIteration<dim>::GroupSolution;
   using typename GroupSolveIteration<dim>::Reporter;
+  using typename GroupSolveIteration<dim>::Constraints;
 
   using SourceUpdater = formulation::updater::ScatteringSourceUpdaterI;
 
@@ -27,7 +28,8 @@ class GroupSourceIteration : public GroupSolveIteration<dim> {
       std::unique_ptr<MomentCalculator> moment_calculator_ptr,
       const std::shared_ptr<GroupSolution> &group_solution_ptr,
       const std::shared_ptr<SourceUpdater> &source_updater_ptr,
-      const std::shared_ptr<Reporter> &reporter_ptr = nullptr);
+      const std::shared_ptr<Reporter> &reporter_ptr = nullptr,
+      const std::shared_ptr<const Constraints> &constraints_ptr = nullptr);
   virtual ~GroupSourceIteration() = default;
 
   SourceUpdater* source_updater_ptr() const { return source_updater_ptr_.get(); };
@@ -154,7 +154,7 @@ class IterationGroupSourceSystemSolvingTest :
   virtual ~IterationGroupSourceSystemSolvingTest() = default;
   IterationGroupSourceSystemSolvingTest()
       : L_(4,4), U_(4,4), b_(MPI_COMM_WORLD, 4, 4),
-        true_scalar_flux_(4),
+        true_scalar_flux_(MPI_COMM_WORLD, 4, 4),
         solver_(solver_control_, MPI_COMM_WORLD)
         {}
   // Test parameters
@@ -211,6 +211,7 @@ void IterationGroupSourceSystemSolvingTest<DimensionWrapper>::SetUp() {
   L_.compress(dealii::VectorOperation::insert);
   U_.compress(dealii::VectorOperation::insert);
   b_.compress(dealii::VectorOperation::insert);
+  true_scalar_flux_.compress(dealii::VectorOperation::insert);
 
   for (int group = 0; group < this->total_groups; ++group) {
     dealii::PETScWrappers::MPI::Vector group_solution(MPI_COMM_WORLD, 4, 4),
@@ -278,7 +279,8 @@ TYPED_TEST(IterationGroupSourceSystemSolvingTest, Iterate) {
     for (int l = 0; l <= this->max_harmonic_l; ++l) {
       for (int m = -l; m <= l; ++m) {
         system::moments::MomentIndex index{group, l, m};
-        current_moments.emplace(index, 4);
+        current_moments.emplace(
+            index, system::moments::MomentVector(MPI_COMM_WORLD, 4, 4));
         EXPECT_CALL(*this->moments_obs_ptr_, BracketOp(index))
             .Times(AtLeast(1))
             .WillRepeatedly(ReturnRef(current_moments.at(index)));
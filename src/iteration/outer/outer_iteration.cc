@@ -12,10 +12,12 @@ template <typename ConvergenceType>
 OuterIteration<ConvergenceType>::OuterIteration(
     std::unique_ptr<GroupIterator> group_iterator_ptr,
     std::unique_ptr<ConvergenceChecker> convergence_checker_ptr,
-    const std::shared_ptr<Reporter> &reporter_ptr)
+    const std::shared_ptr<Reporter> &reporter_ptr,
+    const std::shared_ptr<InnerTolerance> &inner_tolerance_ptr)
     : group_iterator_ptr_(std::move(group_iterator_ptr)),
       convergence_checker_ptr_(std::move(convergence_checker_ptr)),
-      reporter_ptr_(reporter_ptr) {
+      reporter_ptr_(reporter_ptr),
+      inner_tolerance_ptr_(inner_tolerance_ptr) {
 
   AssertThrow(group_iterator_ptr_ != nullptr,
               dealii::ExcMessage("GroupSolveIteration pointer passed to "
@@ -34,6 +36,9 @@ void OuterIteration<ConvergenceType>::IterateToConvergence(
 
   convergence::Status convergence_status;
 
+  if (inner_tolerance_ptr_ != nullptr)
+    inner_tolerance_ptr_->Reset();
+
   do {
 
     if (!convergence_status.is_complete) {
@@ -48,6 +53,9 @@ void OuterIteration<ConvergenceType>::IterateToConvergence(
 
     convergence_status = CheckConvergence(system);
 
+    if (inner_tolerance_ptr_ != nullptr && convergence_status.delta.has_value())
+      inner_tolerance_ptr_->Update(convergence_status.delta.value());
+
     if (reporter_ptr_ != nullptr) {
       reporter_ptr_->Report("Outer iteration Status: ");
       reporter_ptr_->Report(convergence_status);
@@ -4,6 +4,7 @@
 #include <memory>
 
 #include "convergence/final_i.h"
+#include "convergence/inner_tolerance_i.h"
 #include "convergence/reporter/mpi_i.h"
 #include "iteration/group/group_solve_iteration_i.h"
 #include "iteration/outer/outer_iteration_i.h"
@@ -21,11 +22,13 @@ class OuterIteration : public OuterIterationI {
   using GroupIterator = iteration::group::GroupSolveIterationI;
   using ConvergenceChecker = convergence::FinalI<ConvergenceType>;
   using Reporter = convergence::reporter::MpiI;
+  using InnerTolerance = convergence::InnerToleranceI;
 
   OuterIteration(
       std::unique_ptr<GroupIterator> group_iterator_ptr,
       std::unique_ptr<ConvergenceChecker> convergence_checker_ptr,
-      const std::shared_ptr<Reporter> &reporter_ptr = nullptr);
+      const std::shared_ptr<Reporter> &reporter_ptr = nullptr,
+      const std::shared_ptr<InnerTolerance> &inner_tolerance_ptr = nullptr);
   virtual ~OuterIteration() = default;
   virtual void IterateToConvergence(system::System &system);
 
@@ -41,6 +44,10 @@ class OuterIteration : public OuterIterationI {
     return reporter_ptr_.get();
   }
 
+  InnerTolerance* inner_tolerance_ptr() const {
+    return inner_tolerance_ptr_.get();
+  }
+
  protected:
   virtual void InnerIterationToConvergence(system::System &system);
   virtual convergence::Status CheckConvergence(system::System &system) = 0;
@@ -50,6 +57,8 @@ class OuterIteration : public OuterIterationI {
   std::unique_ptr<GroupIterator> group_iterator_ptr_ = nullptr;
   std::unique_ptr<ConvergenceChecker> convergence_checker_ptr_ = nullptr;
   std::shared_ptr<Reporter> reporter_ptr_ = nullptr;
+  //! Inner tolerance policy updated after each outer iteration (optional)
+  std::shared_ptr<InnerTolerance> inner_tolerance_ptr_ = nullptr;
 };
 
 } // namespace outer
@@ -17,13 +17,15 @@ class OuterPowerIteration : public OuterIteration<double> {
   using K_EffectiveUpdater = eigenvalue::k_effective::K_EffectiveUpdaterI;
   using SourceUpdaterType = formulation::updater::FissionSourceUpdaterI;
   using OuterIteration<double>::Reporter;
+  using OuterIteration<double>::InnerTolerance;
 
   OuterPowerIteration(
       std::unique_ptr<GroupIterator> group_iterator_ptr,
       std::unique_ptr<ConvergenceChecker> convergence_checker_ptr,
       std::unique_ptr<K_EffectiveUpdater> k_effective_updater_ptr,
       const std::shared_ptr<SourceUpdaterType> &source_updater_ptr,
-      const std::shared_ptr<Reporter> &reporter_ptr = nullptr);
+      const std::shared_ptr<Reporter> &reporter_ptr = nullptr,
+      const std::shared_ptr<InnerTolerance> &inner_tolerance_ptr = nullptr);
   virtual ~OuterPowerIteration() = default;
 
   SourceUpdaterType* source_updater_ptr() const {
@@ -6,6 +6,7 @@
 #include "eigenvalue/k_effective/tests/k_effective_updater_mock.h"
 #include "convergence/reporter/tests/mpi_mock.h"
 #include "convergence/tests/final_checker_mock.h"
+#include "convergence/tests/inner_tolerance_mock.h"
 #include "formulation/updater/tests/fission_source_updater_mock.h"
 #include "test_helpers/gmock_wrapper.h"
 #include "system/system.h"
@@ -81,6 +82,7 @@ TEST_F(IterationOuterPowerIterationTest, Constructor) {
   EXPECT_NE(this->test_iterator->k_effective_updater_ptr(), nullptr);
   EXPECT_NE(this->test_iterator->reporter_ptr(), nullptr);
   EXPECT_EQ(this->source_updater_ptr_.use_count(), 2);
+  EXPECT_EQ(this->test_iterator->inner_tolerance_ptr(), nullptr);
 }
 
 TEST_F(IterationOuterPowerIterationTest, ConstructorErrors) {
@@ -150,4 +152,44 @@ TEST_F(IterationOuterPowerIterationTest, IterateToConvergenceTest) {
 
 
 
-} // namespace
\ No newline at end of file
+TEST_F(IterationOuterPowerIterationTest, IterateWithInnerTolerance) {
+  using ::testing::NiceMock;
+  auto inner_tolerance_ptr =
+      std::make_shared<convergence::InnerToleranceMock>();
+  auto group_iterator_ptr = std::make_unique<NiceMock<GroupIterator>>();
+  auto convergence_checker_ptr =
+      std::make_unique<NiceMock<ConvergenceChecker>>();
+  auto convergence_checker_obs_ptr = convergence_checker_ptr.get();
+  auto k_effective_updater_ptr =
+      std::make_unique<NiceMock<K_EffectiveUpdater>>();
+  auto source_updater_ptr = std::make_shared<NiceMock<SourceUpdater>>();
+
+  OuterPowerIteration test_iterator(std::move(group_iterator_ptr),
+                                    std::move(convergence_checker_ptr),
+                                    std::move(k_effective_updater_ptr),
+                                    source_updater_ptr,
+                                    nullptr,
+                                    inner_tolerance_ptr);
+  EXPECT_EQ(test_iterator.inner_tolerance_ptr(), inner_tolerance_ptr.get());
+
+  std::array<double, iterations_> deltas{1e-1, 1e-2, 1e-3, 1e-4};
+  Sequence outer_iterations;
+  EXPECT_CALL(*inner_tolerance_ptr, Reset())
+      .InSequence(outer_iterations);
+
+  for (int i = 0; i < this->iterations_; ++i) {
+    convergence::Status convergence_status;
+    convergence_status.is_complete = (i == (this->iterations_ - 1));
+    convergence_status.delta = deltas.at(i);
+
+    EXPECT_CALL(*convergence_checker_obs_ptr, CheckFinalConvergence(_, _))
+        .InSequence(outer_iterations)
+        .WillOnce(Return(convergence_status));
+    EXPECT_CALL(*inner_tolerance_ptr, Update(deltas.at(i)))
+        .InSequence(outer_iterations);
+  }
+
+  test_iterator.IterateToConvergence(this->test_system);
+}
+
+} // namespace
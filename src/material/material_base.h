@@ -49,6 +49,15 @@ class MaterialBase {
   virtual std::unordered_map<int, dealii::FullMatrix<double>>
   GetSigSPerSter() const = 0;
 
+  /*!
+    returns the Legendre moments \f$\sigma_{\mathrm{s},\ell}\f$,
+    \f$\ell = 1, \dots, L\f$, of the scattering transfer matrices, entry
+    \f$\ell - 1\f$ is the \f$P_\ell\f$ moment. Materials that scatter
+    isotropically are not included.
+  */
+  virtual std::unordered_map<int, std::vector<dealii::FullMatrix<double>>>
+  GetSigSLegendre() const = 0;
+
   //! Returns \f$\chi\nu\sigma_\mathrm{f}\f$ for all fissile materials.
   virtual std::unordered_map<int, dealii::FullMatrix<double>>
   GetChiNuSigF() const = 0;
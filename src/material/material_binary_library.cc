@@ -0,0 +1,384 @@
+#include "material/material_binary_library.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <map>
+
+#include <deal.II/base/exceptions.h>
+
+namespace  {
+
+using VectorMap = std::unordered_map<int, std::vector<double>>;
+using MatrixMap = std::unordered_map<int, dealii::FullMatrix<double>>;
+using MatrixListMap =
+    std::unordered_map<int, std::vector<dealii::FullMatrix<double>>>;
+
+constexpr char kMagic[8] = {'B', 'A', 'R', 'T', 'X', 'S', 'L', 'B'};
+
+struct Header {
+  char magic[8];
+  std::uint32_t version;
+  std::uint32_t is_eigen_problem;
+  std::uint64_t payload_size;
+  std::uint64_t checksum;
+  std::uint64_t source_hash;
+  std::uint32_t n_groups;
+  std::uint32_t n_materials;
+};
+
+constexpr std::uint64_t kChecksumBasis = 14695981039346656037ULL;
+
+//! 64-bit FNV-1a hash, continuing from hash
+std::uint64_t Checksum(const char* data, const std::uint64_t size,
+                       std::uint64_t hash = kChecksumBasis) {
+  for (std::uint64_t i = 0; i < size; ++i) {
+    hash ^= static_cast<unsigned char>(data[i]);
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+/* Hash of the ids and contents of the source material files, in order of
+ * increasing id. Returns false and sets error_message if a file cannot be
+ * read. */
+bool HashSource(const MaterialBinaryLibrary::Source& source,
+                std::uint64_t& source_hash, std::string& error_message) {
+  std::map<int, std::string> ordered_filenames(
+      source.material_filenames.cbegin(), source.material_filenames.cend());
+  source_hash = kChecksumBasis;
+  for (const auto& [id, filename] : ordered_filenames) {
+    std::ifstream source_file(filename, std::ios::binary);
+    if (!source_file.good()) {
+      error_message = "cannot read source material file " + filename;
+      return false;
+    }
+    const std::string contents{std::istreambuf_iterator<char>(source_file),
+                               std::istreambuf_iterator<char>()};
+    const std::int32_t id_value = id;
+    source_hash = Checksum(reinterpret_cast<const char*>(&id_value),
+                           sizeof(id_value), source_hash);
+    source_hash = Checksum(contents.data(), contents.size(), source_hash);
+  }
+  return true;
+}
+
+class PayloadWriter {
+ public:
+  template <typename T>
+  void Add(const T value) {
+    const char* bytes = reinterpret_cast<const char*>(&value);
+    payload_.insert(payload_.end(), bytes, bytes + sizeof(T));
+  }
+  void Add(const double* values, const std::size_t n) {
+    const char* bytes = reinterpret_cast<const char*>(values);
+    payload_.insert(payload_.end(), bytes, bytes + n * sizeof(double));
+  }
+  void Add(const VectorMap& map) {
+    Add<std::int32_t>(map.size());
+    for (const auto& [id, values] : map) {
+      Add<std::int32_t>(id);
+      Add<std::int32_t>(values.size());
+      Add(values.data(), values.size());
+    }
+  }
+  void Add(const dealii::FullMatrix<double>& matrix) {
+    Add<std::int32_t>(matrix.m());
+    Add<std::int32_t>(matrix.n());
+    for (unsigned int i = 0; i < matrix.m(); ++i) {
+      for (unsigned int j = 0; j < matrix.n(); ++j)
+        Add<double>(matrix(i, j));
+    }
+  }
+  void Add(const MatrixMap& map) {
+    Add<std::int32_t>(map.size());
+    for (const auto& [id, matrix] : map) {
+      Add<std::int32_t>(id);
+      Add(matrix);
+    }
+  }
+  void Add(const MatrixListMap& map) {
+    Add<std::int32_t>(map.size());
+    for (const auto& [id, matrices] : map) {
+      Add<std::int32_t>(id);
+      Add<std::int32_t>(matrices.size());
+      for (const auto& matrix : matrices)
+        Add(matrix);
+    }
+  }
+  const std::vector<char>& payload() const { return payload_; }
+ private:
+  std::vector<char> payload_;
+};
+
+class PayloadReader {
+ public:
+  PayloadReader(const char* data, const std::uint64_t size)
+      : data_(data), size_(size) {}
+  template <typename T>
+  T Get() {
+    T value;
+    std::memcpy(&value, Advance(sizeof(T)), sizeof(T));
+    return value;
+  }
+  void Get(double* values, const std::size_t n) {
+    std::memcpy(values, Advance(n * sizeof(double)), n * sizeof(double));
+  }
+  VectorMap GetVectorMap() {
+    VectorMap map;
+    const int n_entries = Get<std::int32_t>();
+    for (int entry = 0; entry < n_entries; ++entry) {
+      const int id = Get<std::int32_t>();
+      std::vector<double> values(Get<std::int32_t>());
+      Get(values.data(), values.size());
+      map.emplace(id, std::move(values));
+    }
+    return map;
+  }
+  dealii::FullMatrix<double> GetMatrix() {
+    const int m = Get<std::int32_t>();
+    const int n = Get<std::int32_t>();
+    dealii::FullMatrix<double> matrix(m, n);
+    for (int i = 0; i < m; ++i) {
+      for (int j = 0; j < n; ++j)
+        matrix(i, j) = Get<double>();
+    }
+    return matrix;
+  }
+  MatrixMap GetMatrixMap() {
+    MatrixMap map;
+    const int n_entries = Get<std::int32_t>();
+    for (int entry = 0; entry < n_entries; ++entry) {
+      const int id = Get<std::int32_t>();
+      map.emplace(id, GetMatrix());
+    }
+    return map;
+  }
+  MatrixListMap GetMatrixListMap() {
+    MatrixListMap map;
+    const int n_entries = Get<std::int32_t>();
+    for (int entry = 0; entry < n_entries; ++entry) {
+      const int id = Get<std::int32_t>();
+      std::vector<dealii::FullMatrix<double>> matrices(Get<std::int32_t>());
+      for (auto& matrix : matrices)
+        matrix = GetMatrix();
+      map.emplace(id, std::move(matrices));
+    }
+    return map;
+  }
+  bool AtEnd() const { return position_ == size_; }
+ private:
+  const char* Advance(const std::uint64_t n_bytes) {
+    AssertThrow(position_ + n_bytes <= size_,
+                dealii::ExcMessage("Error in MaterialBinaryLibrary, library "
+                                   "payload is truncated"));
+    const char* current = data_ + position_;
+    position_ += n_bytes;
+    return current;
+  }
+  const char* data_;
+  const std::uint64_t size_;
+  std::uint64_t position_ = 0;
+};
+
+/* Broadcasts size bytes from root, MPI counts are int so large payloads are
+ * sent in chunks. */
+void Broadcast(char* data, const std::uint64_t size, MPI_Comm comm) {
+  constexpr std::uint64_t kChunkSize = 1u << 30u;
+  for (std::uint64_t offset = 0; offset < size; offset += kChunkSize) {
+    const int count = static_cast<int>(std::min(kChunkSize, size - offset));
+    MPI_Bcast(data + offset, count, MPI_CHAR, 0, comm);
+  }
+}
+
+//! Read-only memory mapping of a file, unmapped on destruction
+struct MappedFile {
+  ~MappedFile() { if (mapping != nullptr) munmap(mapping, mapping_size); }
+  void* mapping = nullptr;
+  std::size_t mapping_size = 0;
+};
+
+/* Memory-maps filename read-only and validates the header, checksum and that
+ * it was built from source. Returns a pointer to the payload (nullptr on failure) and sets
+ * error_message. */
+const char* MapAndValidate(const std::string& filename,
+                           const MaterialBinaryLibrary::Source& source,
+                           MappedFile& mapped_file,
+                           std::uint64_t& payload_size,
+                           std::string& error_message) {
+  auto& [mapping, mapping_size] = mapped_file;
+  const int file_descriptor = open(filename.c_str(), O_RDONLY);
+  if (file_descriptor < 0) {
+    error_message = "cannot open file " + filename;
+    return nullptr;
+  }
+  struct stat file_status{};
+  fstat(file_descriptor, &file_status);
+  mapping_size = file_status.st_size;
+  if (mapping_size < sizeof(Header)) {
+    close(file_descriptor);
+    error_message = "file " + filename + " is too small to be a library";
+    return nullptr;
+  }
+  mapping = mmap(nullptr, mapping_size, PROT_READ, MAP_PRIVATE,
+                 file_descriptor, 0);
+  close(file_descriptor);
+  if (mapping == MAP_FAILED) {
+    mapping = nullptr;
+    error_message = "cannot memory-map file " + filename;
+    return nullptr;
+  }
+
+  Header header;
+  std::memcpy(&header, mapping, sizeof(Header));
+  const char* payload = static_cast<const char*>(mapping) + sizeof(Header);
+  if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0) {
+    error_message = filename + " is not a binary material library";
+  } else if (header.version != MaterialBinaryLibrary::kVersion) {
+    error_message = "library " + filename + " has format version " +
+        std::to_string(header.version) + ", expected " +
+        std::to_string(MaterialBinaryLibrary::kVersion);
+  } else if (header.payload_size != mapping_size - sizeof(Header)) {
+    error_message = "library " + filename + " is truncated";
+  } else if (Checksum(payload, header.payload_size) != header.checksum) {
+    error_message = "library " + filename + " failed checksum";
+  } else if (header.n_groups != static_cast<std::uint32_t>(source.n_groups) ||
+             header.n_materials !=
+                 static_cast<std::uint32_t>(source.n_materials)) {
+    error_message = "library " + filename + " was built for " +
+        std::to_string(header.n_groups) + " groups and " +
+        std::to_string(header.n_materials) + " materials, expected " +
+        std::to_string(source.n_groups) + " groups and " +
+        std::to_string(source.n_materials) + " materials";
+  } else if (header.is_eigen_problem !=
+                 static_cast<std::uint32_t>(source.is_eigen_problem)) {
+    error_message = "library " + filename + " was built for " +
+        (header.is_eigen_problem ? "an eigenvalue" : "a fixed source") +
+        " problem, expected " +
+        (source.is_eigen_problem ? "an eigenvalue" : "a fixed source") +
+        " problem";
+  } else if (std::uint64_t source_hash;
+             !HashSource(source, source_hash, error_message)) {
+    // error_message set by HashSource
+  } else if (source_hash != header.source_hash) {
+    error_message = "library " + filename + " is stale, source material "
+        "files have changed since it was written";
+  } else {
+    payload_size = header.payload_size;
+    return payload;
+  }
+  return nullptr;
+}
+
+} // namespace
+
+MaterialBinaryLibrary::MaterialBinaryLibrary(const std::string& filename,
+                                             const Source& expected_source,
+                                             MPI_Comm mpi_communicator) {
+  const bool is_root =
+      dealii::Utilities::MPI::this_mpi_process(mpi_communicator) == 0;
+
+  MappedFile mapped_file;
+  std::uint64_t payload_size = 0;
+  std::string error_message;
+  const char* payload = nullptr;
+
+  if (is_root) {
+    payload = MapAndValidate(filename, expected_source, mapped_file,
+                             payload_size, error_message);
+  }
+
+  // A payload size of zero signals all ranks that the library is invalid
+  MPI_Bcast(&payload_size, 1, MPI_UINT64_T, 0, mpi_communicator);
+
+  if (payload_size > 0) {
+    std::vector<char> received_payload;
+    if (!is_root) {
+      received_payload.resize(payload_size);
+      payload = received_payload.data();
+    }
+    Broadcast(const_cast<char*>(payload), payload_size, mpi_communicator);
+    Deserialize(payload, payload_size);
+  }
+
+  if (error_message.empty() && payload_size == 0)
+    error_message = "rank 0 failed to read library " + filename;
+  AssertThrow(payload_size > 0,
+              dealii::ExcMessage("Error in MaterialBinaryLibrary, " +
+                                 error_message));
+}
+
+void MaterialBinaryLibrary::Write(const MaterialBase& materials,
+                                  const Source& source,
+                                  const std::string& filename) {
+  PayloadWriter writer;
+  for (const auto& vector_map : {materials.GetDiffusionCoef(),
+                                 materials.GetSigT(), materials.GetInvSigT(),
+                                 materials.GetQ(), materials.GetQPerSter(),
+                                 materials.GetNuSigF()})
+    writer.Add(vector_map);
+  for (const auto& matrix_map : {materials.GetSigS(),
+                                 materials.GetSigSPerSter(),
+                                 materials.GetChiNuSigF(),
+                                 materials.GetChiNuSigFPerSter()})
+    writer.Add(matrix_map);
+  writer.Add(materials.GetSigSLegendre());
+
+  const auto is_material_fissile = materials.GetFissileIDMap();
+  writer.Add<std::int32_t>(is_material_fissile.size());
+  for (const auto& [id, is_fissile] : is_material_fissile) {
+    writer.Add<std::int32_t>(id);
+    writer.Add<std::int32_t>(is_fissile);
+  }
+
+  const auto& payload = writer.payload();
+  Header header{};
+  std::memcpy(header.magic, kMagic, sizeof(kMagic));
+  header.version = kVersion;
+  header.payload_size = payload.size();
+  header.checksum = Checksum(payload.data(), payload.size());
+  std::string error_message;
+  AssertThrow(HashSource(source, header.source_hash, error_message),
+              dealii::ExcMessage("Error in MaterialBinaryLibrary, " +
+                                 error_message));
+  header.n_groups = source.n_groups;
+  header.n_materials = source.n_materials;
+  header.is_eigen_problem = source.is_eigen_problem;
+
+  std::ofstream output(filename, std::ios::binary | std::ios::trunc);
+  AssertThrow(output.good(),
+              dealii::ExcMessage("Error in MaterialBinaryLibrary, cannot "
+                                 "open " + filename + " for writing"));
+  output.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+  output.write(payload.data(), payload.size());
+  AssertThrow(output.good(),
+              dealii::ExcMessage("Error in MaterialBinaryLibrary, failed "
+                                 "writing " + filename));
+}
+
+void MaterialBinaryLibrary::Deserialize(const char* payload,
+                                        const std::uint64_t payload_size) {
+  PayloadReader reader(payload, payload_size);
+  for (auto vector_map : {&diffusion_coef_, &sigma_t_, &inverse_sigma_t_, &q_,
+                          &q_per_ster_, &nu_sigma_f_})
+    *vector_map = reader.GetVectorMap();
+  for (auto matrix_map : {&sigma_s_, &sigma_s_per_ster_, &chi_nu_sigma_f_,
+                          &chi_nu_sigma_f_per_ster_})
+    *matrix_map = reader.GetMatrixMap();
+  sigma_s_legendre_ = reader.GetMatrixListMap();
+
+  const int n_fissile_entries = reader.Get<std::int32_t>();
+  for (int entry = 0; entry < n_fissile_entries; ++entry) {
+    const int id = reader.Get<std::int32_t>();
+    is_material_fissile_[id] = reader.Get<std::int32_t>() != 0;
+  }
+  AssertThrow(reader.AtEnd(),
+              dealii::ExcMessage("Error in MaterialBinaryLibrary, library "
+                                 "payload has trailing data"));
+}
@@ -0,0 +1,113 @@
+#ifndef BART_SRC_MATERIAL_MATERIAL_BINARY_LIBRARY_H_
+#define BART_SRC_MATERIAL_MATERIAL_BINARY_LIBRARY_H_
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <deal.II/base/mpi.h>
+#include <deal.II/lac/full_matrix.h>
+
+#include "material_base.h"
+
+//! Material properties loaded from a precompiled binary library.
+/*!
+ A binary library holds the fully pre-processed material data of another
+ MaterialBase (for example MaterialProtobuf), so that derived quantities such
+ as \f$1/\sigma_\mathrm{t}\f$ and \f$\chi\nu\sigma_\mathrm{f}\f$ are not
+ recomputed and text-format files are not parsed on every run.
+
+ A library is written once with MaterialBinaryLibrary::Write, together with a
+ description of the Source it was built from: a hash of the contents of the
+ material files, the number of energy groups and materials, and whether it was
+ built for an eigenvalue problem, which changes the fixed source and fissile
+ materials of a MaterialProtobuf. When loading,
+ only rank 0 of the communicator memory-maps the file read-only and validates
+ its magic string, format version and payload checksum, and that the library
+ was built from the expected source. The validated payload is then broadcast
+ to all other ranks, so the shared filesystem is read once regardless of the
+ number of ranks. Invalid or stale libraries throw on all ranks.
+
+ File layout (native byte order):
+ - header: magic "BARTXSLB", uint32 version, uint32 1 if built for an eigenvalue problem and 0 otherwise,
+   uint64 payload size in bytes, uint64 FNV-1a checksum of the payload,
+   uint64 FNV-1a hash of the source material files, uint32 number of energy
+   groups, uint32 number of materials.
+ - payload: the vector properties (diffusion coefficient, \f$\sigma_\mathrm{t}\f$,
+   \f$1/\sigma_\mathrm{t}\f$, \f$Q\f$, \f$Q/(4\pi)\f$, \f$\nu\sigma_\mathrm{f}\f$),
+   the matrix properties (\f$\sigma_\mathrm{s}\f$, \f$\sigma_\mathrm{s}/(4\pi)\f$,
+   \f$\chi\nu\sigma_\mathrm{f}\f$, \f$\chi\nu\sigma_\mathrm{f}/(4\pi)\f$), the
+   Legendre moments \f$\ell > 0\f$ of \f$\sigma_\mathrm{s}\f$ (a matrix count
+   followed by the matrices for each material) and the fissile flags, each
+   stored as an entry count followed by the entries.
+ */
+class MaterialBinaryLibrary : public MaterialBase {
+ public:
+  //! Current binary library format version.
+  static constexpr std::uint32_t kVersion = 4;
+
+  //! Inputs a library is built from, used to detect stale libraries.
+  struct Source {
+    //! Mapping of material ids to the files holding their properties
+    std::unordered_map<int, std::string> material_filenames;
+    int n_groups = 0;
+    int n_materials = 0;
+    //! Eigenvalue problems have no fixed source and require fissile materials
+    bool is_eigen_problem = false;
+  };
+
+  /*!
+    loads the library in filename, throws on all ranks of the communicator if
+    the file cannot be read, has the wrong format, version or checksum, or was
+    not built from the expected source (including if any source file has been
+    changed since it was written, or it was built for the other problem type)
+   */
+  MaterialBinaryLibrary(const std::string& filename,
+                        const Source& expected_source,
+                        MPI_Comm mpi_communicator = MPI_COMM_WORLD);
+  ~MaterialBinaryLibrary() override = default;
+
+  //! Writes the material properties of materials, built from source, to a binary library.
+  static void Write(const MaterialBase& materials, const Source& source,
+                    const std::string& filename);
+
+  std::unordered_map<int, bool> GetFissileIDMap() const override {
+    return is_material_fissile_; }
+  std::unordered_map<int, std::vector<double>> GetDiffusionCoef() const override {
+    return diffusion_coef_; }
+  std::unordered_map<int, std::vector<double>> GetSigT() const override {
+    return sigma_t_; }
+  std::unordered_map<int, std::vector<double>> GetInvSigT() const override {
+    return inverse_sigma_t_; }
+  std::unordered_map<int, std::vector<double>> GetQ() const override {
+    return q_; }
+  std::unordered_map<int, std::vector<double>> GetQPerSter() const override {
+    return q_per_ster_; }
+  std::unordered_map<int, std::vector<double>> GetNuSigF() const override {
+    return nu_sigma_f_; }
+  std::unordered_map<int, dealii::FullMatrix<double>> GetSigS() const override {
+    return sigma_s_; }
+  std::unordered_map<int, dealii::FullMatrix<double>>
+  GetSigSPerSter() const override { return sigma_s_per_ster_; }
+  std::unordered_map<int, std::vector<dealii::FullMatrix<double>>>
+  GetSigSLegendre() const override { return sigma_s_legendre_; }
+  std::unordered_map<int, dealii::FullMatrix<double>>
+  GetChiNuSigF() const override { return chi_nu_sigma_f_; }
+  std::unordered_map<int, dealii::FullMatrix<double>>
+  GetChiNuSigFPerSter() const override { return chi_nu_sigma_f_per_ster_; }
+
+ private:
+  //! Fills all properties from a validated payload.
+  void Deserialize(const char* payload, std::uint64_t payload_size);
+
+  std::unordered_map<int, std::vector<double>> diffusion_coef_, sigma_t_,
+      inverse_sigma_t_, q_, q_per_ster_, nu_sigma_f_;
+  std::unordered_map<int, dealii::FullMatrix<double>> sigma_s_,
+      sigma_s_per_ster_, chi_nu_sigma_f_, chi_nu_sigma_f_per_ster_;
+  std::unordered_map<int, std::vector<dealii::FullMatrix<double>>>
+      sigma_s_legendre_;
+  std::unordered_map<int, bool> is_material_fissile_;
+};
+
+#endif // BART_SRC_MATERIAL_MATERIAL_BINARY_LIBRARY_H_
@@ -120,6 +120,9 @@ void MaterialProtobuf::PopulateData() {
 
     sigt_[id] = vector_props.at(Material::SIGMA_T);
     sigs_[id] = GetScatteringMatrix(material);
+    auto legendre_matrices = GetScatteringLegendreMatrices(material);
+    if (!legendre_matrices.empty())
+      sigs_legendre_[id] = std::move(legendre_matrices);
     if (vector_props.count(Material::DIFFUSION_COEFF) > 0) {
       diffusion_coef_[id] = vector_props.at(Material::DIFFUSION_COEFF);
     } else {
@@ -264,6 +267,12 @@ void MaterialProtobuf::CheckValid(const Material& material,
       AssertThrow((unsigned int)mat_prop.value().size() == n*n,
           WrongNumberOfValues(name, Material_MatrixId_descriptor()->value(Material::SIGMA_S)->name(),
             mat_prop.value().size(), material.number_of_groups()));
+    } else if (mat_prop.id() == Material::SIGMA_S_LEGENDRE) {
+      // Any number of Legendre moments, each n by n
+      AssertThrow(mat_prop.value().size() > 0 &&
+                  (unsigned int)mat_prop.value().size() % (n*n) == 0,
+          WrongNumberOfValues(name, Material_MatrixId_descriptor()->value(Material::SIGMA_S_LEGENDRE)->name(),
+            mat_prop.value().size(), material.number_of_groups()));
     }
   }
 
@@ -393,6 +402,27 @@ dealii::FullMatrix<double> MaterialProtobuf::GetScatteringMatrix(const Material&
   return dealii::FullMatrix<double>();
 }
 
+std::vector<dealii::FullMatrix<double>>
+MaterialProtobuf::GetScatteringLegendreMatrices(const Material& material) {
+  const unsigned int n = material.number_of_groups();
+  for (const Material_MatrixProperty& mat_prop : material.matrix_property()) {
+    if (mat_prop.id() == Material::SIGMA_S_LEGENDRE) {
+      std::vector<double> raw_values(mat_prop.value().cbegin(), mat_prop.value().cend());
+
+      AssertThrow(!raw_values.empty() && raw_values.size() % (n*n) == 0,
+        WrongNumberOfValues(CombinedName(material), Material_MatrixId_descriptor()->value(Material::SIGMA_S_LEGENDRE)->name(),
+          raw_values.size(), n));
+
+      std::vector<dealii::FullMatrix<double>> legendre_matrices(
+          raw_values.size() / (n*n), dealii::FullMatrix<double>(n, n));
+      for (unsigned int l = 0; l < legendre_matrices.size(); ++l)
+        legendre_matrices[l].fill(raw_values.data() + l*n*n);
+      return legendre_matrices;
+    }
+  }
+  return {};
+}
+
 std::unordered_map<int, bool> MaterialProtobuf::GetFissileIDMap() const {
   return is_material_fissile_;
 }
@@ -431,6 +461,11 @@ std::unordered_map<int, dealii::FullMatrix<double>> MaterialProtobuf::GetSigSPer
   return sigs_per_ster_;
 }
 
+std::unordered_map<int, std::vector<dealii::FullMatrix<double>>>
+MaterialProtobuf::GetSigSLegendre() const {
+  return sigs_legendre_;
+}
+
 std::unordered_map<int, dealii::FullMatrix<double>> MaterialProtobuf::GetChiNuSigF() const {
   return chi_nusigf_;
 }
@@ -88,6 +88,10 @@ class MaterialProtobuf : public MaterialBase {
   std::unordered_map<int, dealii::FullMatrix<double>>
   GetSigSPerSter() const override;
 
+  //! Returns the Legendre moments \f$\ell > 0\f$ of the scattering matrices.
+  std::unordered_map<int, std::vector<dealii::FullMatrix<double>>>
+  GetSigSLegendre() const override;
+
   //! Returns fission transfer matrix \f$\chi\nu\sigma_\mathrm{f}\f$ for all fissile materials.
   /*! Returns the fission transfer matrix for all fissile materials. Entries
       are given by:
@@ -116,6 +120,9 @@ class MaterialProtobuf : public MaterialBase {
     nu Sigma_f and Chi (normalized to 1) are required for fissile materials.
 
     If the material contains Q, the Q data will be required to be valid.
+    If the material contains Legendre moments of the scattering matrix, they
+    are required to be a whole number of number_of_groups squared matrices,
+    they are not required to be non-negative.
     Other properties are not checked except for MultipleDefinition,
     which will not be thrown for UNKNOWN_VECTOR.
 
@@ -193,6 +200,10 @@ class MaterialProtobuf : public MaterialBase {
   //! Scattering transfer matrices scaled by \f$4\pi\f$
   std::unordered_map<int, dealii::FullMatrix<double>> sigs_per_ster_;
 
+  //! Legendre moments \f$\ell > 0\f$ of the scattering transfer matrices.
+  std::unordered_map<int, std::vector<dealii::FullMatrix<double>>>
+      sigs_legendre_;
+
   /*!
     \f$\chi\nu\sigma_\mathrm{f}\f$ for all materials.
     It is pre-computed and transformed into a form of transfer matrix
@@ -293,6 +304,15 @@ class MaterialProtobuf : public MaterialBase {
   static dealii::FullMatrix<double>
   GetScatteringMatrix(const Material& material);
 
+  /*!
+    returns the Legendre moments l = 1, ..., L of the scattering matrix from
+    the first instance of SIGMA_S_LEGENDRE found in the Material
+    will return an empty vector if SIGMA_S_LEGENDRE isn't found
+    can throw WrongNumberOfValues exception
+  */
+  static std::vector<dealii::FullMatrix<double>>
+  GetScatteringLegendreMatrices(const Material& material);
+
  public:
   /*
     dealII macros for declaring exceptions are documented in
@@ -0,0 +1,176 @@
+#include "material/material_binary_library.h"
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include <deal.II/base/exceptions.h>
+
+#include "material/tests/mock_material.h"
+#include "test_helpers/gmock_wrapper.h"
+#include "test_helpers/test_helper_functions.h"
+
+namespace {
+
+using ::testing::Return;
+
+class MaterialBinaryLibraryTest : public ::testing::Test {
+ protected:
+  using IdVectorMap = std::unordered_map<int, std::vector<double>>;
+  using IdMatrixMap = std::unordered_map<int, dealii::FullMatrix<double>>;
+  using IdMatrixListMap =
+      std::unordered_map<int, std::vector<dealii::FullMatrix<double>>>;
+
+  void SetUp() override;
+  void TearDown() override;
+  void WriteSourceFile(const std::string& contents);
+
+  const std::string filename_{"material_binary_library_test.bin"};
+  const std::string source_filename_{"material_binary_library_test.material"};
+  MaterialBinaryLibrary::Source source_{{{1, source_filename_},
+                                         {2, source_filename_}}, 7, 2};
+  ::testing::NiceMock<btest::MockMaterial> mock_material_;
+
+  IdVectorMap diffusion_coef_ = bart::test_helpers::RandomIntVectorMap();
+  IdVectorMap sigma_t_ = bart::test_helpers::RandomIntVectorMap();
+  IdVectorMap inverse_sigma_t_ = bart::test_helpers::RandomIntVectorMap();
+  IdVectorMap q_ = bart::test_helpers::RandomIntVectorMap();
+  IdVectorMap q_per_ster_ = bart::test_helpers::RandomIntVectorMap();
+  IdVectorMap nu_sigma_f_ = bart::test_helpers::RandomIntVectorMap();
+  IdMatrixMap sigma_s_ = bart::test_helpers::RandomIntMatrixMap();
+  IdMatrixMap sigma_s_per_ster_ = bart::test_helpers::RandomIntMatrixMap();
+  IdMatrixMap chi_nu_sigma_f_ = bart::test_helpers::RandomIntMatrixMap();
+  IdMatrixMap chi_nu_sigma_f_per_ster_ =
+      bart::test_helpers::RandomIntMatrixMap();
+  IdMatrixListMap sigma_s_legendre_{
+      {1, {bart::test_helpers::RandomMatrix(7, 7),
+           bart::test_helpers::RandomMatrix(7, 7)}}};
+  std::unordered_map<int, bool> is_material_fissile_{{1, true}, {2, false}};
+};
+
+void MaterialBinaryLibraryTest::SetUp() {
+  ON_CALL(mock_material_, GetDiffusionCoef())
+      .WillByDefault(Return(diffusion_coef_));
+  ON_CALL(mock_material_, GetSigT()).WillByDefault(Return(sigma_t_));
+  ON_CALL(mock_material_, GetInvSigT()).WillByDefault(Return(inverse_sigma_t_));
+  ON_CALL(mock_material_, GetQ()).WillByDefault(Return(q_));
+  ON_CALL(mock_material_, GetQPerSter()).WillByDefault(Return(q_per_ster_));
+  ON_CALL(mock_material_, GetNuSigF()).WillByDefault(Return(nu_sigma_f_));
+  ON_CALL(mock_material_, GetSigS()).WillByDefault(Return(sigma_s_));
+  ON_CALL(mock_material_, GetSigSPerSter())
+      .WillByDefault(Return(sigma_s_per_ster_));
+  ON_CALL(mock_material_, GetSigSLegendre())
+      .WillByDefault(Return(sigma_s_legendre_));
+  ON_CALL(mock_material_, GetChiNuSigF()).WillByDefault(Return(chi_nu_sigma_f_));
+  ON_CALL(mock_material_, GetChiNuSigFPerSter())
+      .WillByDefault(Return(chi_nu_sigma_f_per_ster_));
+  ON_CALL(mock_material_, GetFissileIDMap())
+      .WillByDefault(Return(is_material_fissile_));
+  WriteSourceFile("number_of_groups: 7");
+}
+
+void MaterialBinaryLibraryTest::TearDown() {
+  std::remove(filename_.c_str());
+  std::remove(source_filename_.c_str());
+}
+
+void MaterialBinaryLibraryTest::WriteSourceFile(const std::string& contents) {
+  std::ofstream source_file(source_filename_, std::ios::trunc);
+  source_file << contents;
+}
+
+TEST_F(MaterialBinaryLibraryTest, WriteAndRead) {
+  MaterialBinaryLibrary::Write(mock_material_, source_, filename_);
+  MaterialBinaryLibrary library(filename_, source_);
+
+  EXPECT_EQ(library.GetDiffusionCoef(), diffusion_coef_);
+  EXPECT_EQ(library.GetSigT(), sigma_t_);
+  EXPECT_EQ(library.GetInvSigT(), inverse_sigma_t_);
+  EXPECT_EQ(library.GetQ(), q_);
+  EXPECT_EQ(library.GetQPerSter(), q_per_ster_);
+  EXPECT_EQ(library.GetNuSigF(), nu_sigma_f_);
+  EXPECT_EQ(library.GetSigS(), sigma_s_);
+  EXPECT_EQ(library.GetSigSPerSter(), sigma_s_per_ster_);
+  EXPECT_EQ(library.GetSigSLegendre(), sigma_s_legendre_);
+  EXPECT_EQ(library.GetChiNuSigF(), chi_nu_sigma_f_);
+  EXPECT_EQ(library.GetChiNuSigFPerSter(), chi_nu_sigma_f_per_ster_);
+  EXPECT_EQ(library.GetFissileIDMap(), is_material_fissile_);
+}
+
+TEST_F(MaterialBinaryLibraryTest, MissingFileThrows) {
+  EXPECT_THROW(MaterialBinaryLibrary library("no_such_library.bin", source_),
+               dealii::ExceptionBase);
+}
+
+TEST_F(MaterialBinaryLibraryTest, NotALibraryThrows) {
+  std::ofstream output(filename_);
+  output << "this is a text file and not a binary material library";
+  output.close();
+  EXPECT_THROW(MaterialBinaryLibrary library(filename_, source_), dealii::ExceptionBase);
+}
+
+TEST_F(MaterialBinaryLibraryTest, CorruptedPayloadThrows) {
+  MaterialBinaryLibrary::Write(mock_material_, source_, filename_);
+  // Flip the last byte of the payload
+  std::fstream library_file(filename_,
+                            std::ios::in | std::ios::out | std::ios::binary);
+  library_file.seekg(-1, std::ios::end);
+  const char last_byte = library_file.get();
+  library_file.seekp(-1, std::ios::end);
+  library_file.put(static_cast<char>(~last_byte));
+  library_file.close();
+
+  EXPECT_THROW(MaterialBinaryLibrary library(filename_, source_), dealii::ExceptionBase);
+}
+
+TEST_F(MaterialBinaryLibraryTest, ChangedSourceFileThrows) {
+  MaterialBinaryLibrary::Write(mock_material_, source_, filename_);
+  WriteSourceFile("number_of_groups: 8");
+  EXPECT_THROW(MaterialBinaryLibrary library(filename_, source_),
+               dealii::ExceptionBase);
+}
+
+TEST_F(MaterialBinaryLibraryTest, MissingSourceFileThrows) {
+  MaterialBinaryLibrary::Write(mock_material_, source_, filename_);
+  std::remove(source_filename_.c_str());
+  EXPECT_THROW(MaterialBinaryLibrary library(filename_, source_),
+               dealii::ExceptionBase);
+}
+
+TEST_F(MaterialBinaryLibraryTest, ChangedSourceMappingThrows) {
+  MaterialBinaryLibrary::Write(mock_material_, source_, filename_);
+  auto changed_source = source_;
+  changed_source.material_filenames.erase(2);
+  EXPECT_THROW(MaterialBinaryLibrary library(filename_, changed_source),
+               dealii::ExceptionBase);
+}
+
+TEST_F(MaterialBinaryLibraryTest, ChangedGroupsOrMaterialsThrows) {
+  MaterialBinaryLibrary::Write(mock_material_, source_, filename_);
+  auto changed_groups = source_, changed_materials = source_;
+  changed_groups.n_groups = 8;
+  changed_materials.n_materials = 3;
+  EXPECT_THROW(MaterialBinaryLibrary library(filename_, changed_groups),
+               dealii::ExceptionBase);
+  EXPECT_THROW(MaterialBinaryLibrary library(filename_, changed_materials),
+               dealii::ExceptionBase);
+}
+
+/* Fixed source and fissile materials depend on the problem type, a library
+ * written for one type should not be loaded for the other. */
+TEST_F(MaterialBinaryLibraryTest, ChangedProblemTypeThrows) {
+  auto eigen_source = source_;
+  eigen_source.is_eigen_problem = true;
+
+  MaterialBinaryLibrary::Write(mock_material_, eigen_source, filename_);
+  EXPECT_NO_THROW(MaterialBinaryLibrary library(filename_, eigen_source));
+  EXPECT_THROW(MaterialBinaryLibrary library(filename_, source_),
+               dealii::ExceptionBase);
+
+  MaterialBinaryLibrary::Write(mock_material_, source_, filename_);
+  EXPECT_NO_THROW(MaterialBinaryLibrary library(filename_, source_));
+  EXPECT_THROW(MaterialBinaryLibrary library(filename_, eigen_source),
+               dealii::ExceptionBase);
+}
+
+} // namespace
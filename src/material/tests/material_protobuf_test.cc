@@ -1557,4 +1557,57 @@ TEST_F(MaterialProtobufTest, DiffusionCoefficientInvalidTest) {
     }, MaterialProtobuf::WrongNumberOfValues);
 }
 
+TEST_F(MaterialProtobufTest, ScatteringLegendreValuesTest) {
+
+  auto &anisotropic_material = test_materials_.at(1);
+
+  auto legendre_ptr = anisotropic_material.add_matrix_property();
+
+  legendre_ptr->set_id(Material::SIGMA_S_LEGENDRE);
+
+  // P_1 and P_2 moments, which can be negative
+  const std::vector<double> legendre_values(
+      test_helpers::RandomVector(2*7*7, -1, 1));
+  for (const double& val : legendre_values) {
+    legendre_ptr->add_value(val);
+  }
+
+  MaterialProtobuf mp_1(test_materials_, false, false, 7, 4);
+
+  auto legendre_map = mp_1.GetSigSLegendre();
+
+  ASSERT_EQ(legendre_map.size(), 1)
+      << "Isotropic materials should not have Legendre moments";
+  ASSERT_EQ(legendre_map.at(1).size(), 2)
+      << "Incorrect number of Legendre moments";
+  for (int l = 0; l < 2; ++l) {
+    for (int i = 0; i < 7; ++i) {
+      for (int j = 0; j < 7; ++j) {
+        EXPECT_EQ(legendre_map.at(1).at(l)(i, j),
+                  legendre_values.at(l*49 + i*7 + j));
+      }
+    }
+  }
+}
+
+TEST_F(MaterialProtobufTest, ScatteringLegendreInvalidTest) {
+
+  auto &anisotropic_material = test_materials_.at(1);
+
+  auto legendre_ptr = anisotropic_material.add_matrix_property();
+
+  legendre_ptr->set_id(Material::SIGMA_S_LEGENDRE);
+
+  // Not a whole number of 7 by 7 matrices
+  const std::vector<double> legendre_values(
+      test_helpers::RandomVector(7*7 + 3, -1, 1));
+  for (const double& val : legendre_values) {
+    legendre_ptr->add_value(val);
+  }
+
+  ASSERT_THROW({
+      MaterialProtobuf mp_1(test_materials_, false, false, 7, 4);
+    }, MaterialProtobuf::WrongNumberOfValues);
+}
+
 } // namespace
\ No newline at end of file
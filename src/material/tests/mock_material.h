@@ -17,6 +17,8 @@ class MockMaterial : public MaterialBase {
   using int_bool_map = std::unordered_map<int, bool>;
   using int_vector_map = std::unordered_map<int, std::vector<double>>;
   using int_matrix_map = std::unordered_map<int, dealii::FullMatrix<double>>;
+  using int_matrix_list_map =
+      std::unordered_map<int, std::vector<dealii::FullMatrix<double>>>;
   
   MOCK_CONST_METHOD0(GetFissileIDMap, int_bool_map());
 
@@ -43,6 +45,9 @@ class MockMaterial : public MaterialBase {
   //! Returns all scattering transfer matrices scaled by \f$4\pi\f$.
   MOCK_CONST_METHOD0(GetSigSPerSter, int_matrix_map());
 
+  //! Returns the Legendre moments \f$\ell > 0\f$ of the scattering matrices.
+  MOCK_CONST_METHOD0(GetSigSLegendre, int_matrix_list_map());
+
   //! Returns \f$\chi\nu\sigma_\mathrm{f}\f$ for all fissile materials.
   MOCK_CONST_METHOD0(GetChiNuSigF, int_matrix_map());
 
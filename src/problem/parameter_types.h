@@ -8,6 +8,8 @@ namespace problem {
 enum class AngularQuadType {
   kNone,
   kLevelSymmetricGaussian,
+  kProductGaussLegendreChebyshev,
+  kGaussLegendre,
 };
 
 enum class DiscretizationType {
@@ -16,6 +18,13 @@ enum class DiscretizationType {
   kContinuousFEM,
 };
 
+enum class DoFRenumberingType {
+  kNone,
+  kCuthillMcKee,
+  kHilbert,
+  kDownstream,
+};
+
 enum class Boundary {
   kXMin = 0,
   kXMax = 1,
@@ -35,6 +44,7 @@ enum class EquationType {
   kDiffusion,
   kEvenParity,
   kSelfAdjointAngularFlux,
+  kDiscreteOrdinates,
 };
 
 enum class FuelPinTriangulationType {
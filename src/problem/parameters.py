@@ -11,6 +11,7 @@ class ReflectiveBoundaries(Enum):
 class TransportModelType(Enum):
     Diffusion = "diffusion"
     SAAF = "saaf"
+    DiscreteOrdinates = "sn"
 
 class Standard:
     newHolder = [] 
@@ -53,6 +54,16 @@ class Standard:
         self.fieldAdder("mesh file name",value,limit)
     def setUniformRefinements(self, value, limit=None):
         self.fieldAdder("uniform refinements",value,limit)
+    def setDoFRenumbering(self, value, limit=None):
+        self.fieldAdder("dof renumbering",value,limit)
+    def setFissileCellCost(self, value, limit=None):
+        self.fieldAdder("fissile cell cost",value,limit)
+    def setAdaptiveRefinementCycles(self, value, limit=None):
+        self.fieldAdder("adaptive refinement cycles",value,limit)
+    def setRefineFraction(self, value, limit=None):
+        self.fieldAdder("refine fraction",value,limit)
+    def setCoarsenFraction(self, value, limit=None):
+        self.fieldAdder("coarsen fraction",value,limit)
     def setFuelPinRadius(self, value, limit=None):
         self.fieldAdder("fuel Pin radius",value,limit)
     def setFuelPinTriangulation(self, value, limit=None):
@@ -71,6 +82,12 @@ class Standard:
         self.fieldAdder("number of materials",value,limit)
     def setFuelPinMaterialMapFilename(self, value, limit=None):
         self.fieldAdder("fuel pin material id file name",value,limit)
+    def setMaterialLibraryFilename(self, value, limit=None):
+        self.fieldAdder("material library file name",value,limit)
+    def setUseNodeSharedMaterialData(self, value, limit=None):
+        self.fieldAdder("use node shared material data",value,limit)
+    def setScatteringOrder(self, value, limit=None):
+        self.fieldAdder("scattering order",value,limit)
 
     # Acceleration Parameters
     def setPreconditioner(self, value, limit=None):
@@ -97,12 +114,22 @@ class Standard:
         self.fieldAdder("ho linear solver name",value,limit)
     def setMultiGroupSolver(self, value, limit=None):
         self.fieldAdder("mg solver name",value,limit)
+    def setAdaptiveInnerTolerance(self, value, limit=None):
+        self.fieldAdder("do adaptive inner tolerance",value,limit)
+    def setKrylovRecyclingVectors(self, value, limit=None):
+        self.fieldAdder("krylov recycling vectors",value,limit)
+    def setKrylovRecyclingTotalVectors(self, value, limit=None):
+        self.fieldAdder("krylov recycling total vectors",value,limit)
+    def setStoreAngularFlux(self, value, limit=None):
+        self.fieldAdder("store angular flux",value,limit)
 
     # Angular Quadrature
     def setAngularQuad(self, value, limit=None):
         self.fieldAdder("angular quadrature name",value,limit)
     def setAngularQuadOrder(self, value, limit=None):
         self.fieldAdder("angular quadrature order",value,limit)
+    def setAngularQuadAzimuthalOrder(self, value, limit=None):
+        self.fieldAdder("angular quadrature azimuthal order",value,limit)
 
 
     def fieldAdder(self,field,value,limitations=None):
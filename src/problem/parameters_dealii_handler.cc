@@ -41,6 +41,13 @@ void ParametersDealiiHandler::Parse(dealii::ParameterHandler &handler) {
   is_mesh_generated_ = handler.get_bool(key_words_.kMeshGenerated_);
   mesh_file_name_ = handler.get(key_words_.kMeshFilename_);
   uniform_refinements_ = handler.get_integer(key_words_.kUniformRefinements_);
+  dof_renumbering_ = kDoFRenumberingTypeMap_.at(
+      handler.get(key_words_.kDoFRenumbering_));
+  fissile_cell_cost_ = handler.get_double(key_words_.kFissileCellCost_);
+  adaptive_refinement_cycles_ = handler.get_integer(
+      key_words_.kAdaptiveRefinementCycles_);
+  refine_fraction_ = handler.get_double(key_words_.kRefineFraction_);
+  coarsen_fraction_ = handler.get_double(key_words_.kCoarsenFraction_);
   fuel_pin_radius_ = handler.get_double(key_words_.kFuelPinRadius_);
   fuel_pin_triangulation_ = kFuelPinTriangulationTypeMap_.at(
       handler.get(key_words_.kFuelPinTriangulation_));
@@ -55,6 +62,11 @@ void ParametersDealiiHandler::Parse(dealii::ParameterHandler &handler) {
     material_map_filename_ = handler.get(key_words_.kMaterialMapFilename_);
     fuel_pin_material_map_filename_ = handler.get(
         key_words_.kFuelPinMaterialMapFilename_);
+    material_library_filename_ = handler.get(
+        key_words_.kMaterialLibraryFilename_);
+    use_node_shared_material_data_ = handler.get_bool(
+        key_words_.kUseNodeSharedMaterialData_);
+    scattering_order_ = handler.get_integer(key_words_.kScatteringOrder_);
   }
   handler.leave_subsection();
   
@@ -80,10 +92,19 @@ void ParametersDealiiHandler::Parse(dealii::ParameterHandler &handler) {
       handler.get(key_words_.kLinearSolver_));
   multi_group_solver_ =
       kMultiGroupSolverTypeMap_.at(handler.get(key_words_.kMultiGroupSolver_));
+  do_adaptive_inner_tolerance_ =
+      handler.get_bool(key_words_.kAdaptiveInnerTolerance_);
+  krylov_recycling_vectors_ =
+      handler.get_integer(key_words_.kKrylovRecyclingVectors_);
+  krylov_recycling_total_vectors_ =
+      handler.get_integer(key_words_.kKrylovRecyclingTotalVectors_);
+  store_angular_flux_ = handler.get_bool(key_words_.kStoreAngularFlux_);
 
   // Angular Quadrature parameters
   angular_quad_ = kAngularQuadTypeMap_.at(handler.get(key_words_.kAngularQuad_));
   angular_quad_order_ = handler.get_integer(key_words_.kAngularQuadOrder_);
+  angular_quad_azimuthal_order_ =
+      handler.get_integer(key_words_.kAngularQuadAzimuthalOrder_);
 }
 
 void ParametersDealiiHandler::SetUp(dealii::ParameterHandler &handler) {
@@ -183,6 +204,29 @@ void ParametersDealiiHandler::SetUpMeshParameters(
                         Pattern::Integer(0),
                         "number of uniform refinements desired");
 
+  handler.declare_entry(key_words_.kDoFRenumbering_, "none",
+                        Pattern::Selection(
+                            GetOptionString(kDoFRenumberingTypeMap_)),
+                        "ordering of cells and degrees of freedom");
+
+  handler.declare_entry(key_words_.kFissileCellCost_, "1.0",
+                        Pattern::Double(0),
+                        "cost of fissile cells relative to non-fissile cells "
+                        "used to balance the cells between processors");
+
+  handler.declare_entry(key_words_.kAdaptiveRefinementCycles_, "0",
+                        Pattern::Integer(0),
+                        "number of adaptive refinement cycles, each refines "
+                        "the mesh based on the scalar flux error and solves "
+                        "again");
+  handler.declare_entry(key_words_.kRefineFraction_, "0.3",
+                        Pattern::Double(0, 1),
+                        "fraction of cells refined in each refinement cycle");
+  handler.declare_entry(key_words_.kCoarsenFraction_, "0.03",
+                        Pattern::Double(0, 1),
+                        "fraction of cells coarsened in each refinement "
+                        "cycle");
+
   handler.declare_entry(key_words_.kFuelPinRadius_, "0.5", Pattern::Double(0),
                         "radius of fuel Pin");
 
@@ -212,6 +256,21 @@ void ParametersDealiiHandler::SetUpMaterialParameters(
                         Pattern::Map(Pattern::Integer(), Pattern::Anything()));
   handler.declare_entry(key_words_.kFuelPinMaterialMapFilename_, "",
                         Pattern::Anything(), "file name for pin material map");
+  handler.declare_entry(key_words_.kMaterialLibraryFilename_, "",
+                        Pattern::Anything(),
+                        "file name for the precompiled binary material "
+                        "library, written from the material files if it does "
+                        "not exist, empty to always read the material files");
+  handler.declare_entry(key_words_.kUseNodeSharedMaterialData_, "false",
+                        Pattern::Bool(),
+                        "Boolean to determine if read-only cross-section "
+                        "tables are stored once per node in MPI shared memory "
+                        "instead of once per process");
+  handler.declare_entry(key_words_.kScatteringOrder_, "0",
+                        Pattern::Integer(0),
+                        "Legendre order L of the scattering expansion, "
+                        "angular moments up to degree L are calculated for "
+                        "the scattering source, 0 for isotropic scattering");
   
   handler.leave_subsection();
 }
@@ -280,7 +339,28 @@ void ParametersDealiiHandler::SetUpSolverParameters(
                         Pattern::Selection(
                             GetOptionString(kMultiGroupSolverTypeMap_)),
                         "Multi-group solvers");
-  
+
+  handler.declare_entry(key_words_.kAdaptiveInnerTolerance_, "false",
+                        Pattern::Bool(),
+                        "Boolean to determine if inner solve tolerances are "
+                        "loosened while the outer iteration is unconverged");
+
+  handler.declare_entry(key_words_.kKrylovRecyclingVectors_, "0",
+                        Pattern::Integer(0),
+                        "number of recycled Krylov vectors retained per group "
+                        "and angle, 0 for no recycling");
+
+  handler.declare_entry(key_words_.kKrylovRecyclingTotalVectors_, "200",
+                        Pattern::Integer(1),
+                        "number of recycled Krylov vectors retained across all "
+                        "groups and angles, the least recently solved are "
+                        "discarded first");
+
+  handler.declare_entry(key_words_.kStoreAngularFlux_, "true",
+                        Pattern::Bool(),
+                        "Boolean to determine if angular fluxes are stored, if "
+                        "false only the scalar flux is accumulated during "
+                        "angular solves (isotropic scattering only)");
 }
 
 void ParametersDealiiHandler::SetUpAngularQuadratureParameters(
@@ -291,9 +371,13 @@ void ParametersDealiiHandler::SetUpAngularQuadratureParameters(
   handler.declare_entry(key_words_.kAngularQuad_, "none",
                         Pattern::Selection(
                             GetOptionString(kAngularQuadTypeMap_)),
-                        "angular quadrature types. only LS-GC for multi-D and GL for 1D implemented for now.");
+                        "angular quadrature types. 2D sets are projections of the 3D sets, all types give GL in 1D.");
   handler.declare_entry(key_words_.kAngularQuadOrder_, "4", Pattern::Integer(),
                         "Gauss-Chebyshev level-symmetric-like quadrature");
+  handler.declare_entry(key_words_.kAngularQuadAzimuthalOrder_, "0",
+                        Pattern::Integer(0),
+                        "azimuthal order of product quadratures, 0 uses twice "
+                        "the angular quadrature order");
 }
 
 template<typename Key>
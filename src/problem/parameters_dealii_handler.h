@@ -46,6 +46,12 @@ class ParametersDealiiHandler : public ParametersI {
     const std::string kMeshGenerated_ = "is mesh generated by deal.II";
     const std::string kMeshFilename_ = "mesh file name";
     const std::string kUniformRefinements_ = "uniform refinements";
+    const std::string kDoFRenumbering_ = "dof renumbering";
+    const std::string kFissileCellCost_ = "fissile cell cost";
+    const std::string kAdaptiveRefinementCycles_ =
+        "adaptive refinement cycles";
+    const std::string kRefineFraction_ = "refine fraction";
+    const std::string kCoarsenFraction_ = "coarsen fraction";
     const std::string kFuelPinRadius_ = "fuel Pin radius";
     const std::string kFuelPinTriangulation_ = "triangulation type of fuel Pin";
     const std::string kMeshPinResolved_ = "is mesh pin-resolved";
@@ -57,6 +63,11 @@ class ParametersDealiiHandler : public ParametersI {
     const std::string kNumberOfMaterials_ = "number of materials";
     const std::string kFuelPinMaterialMapFilename_ =
         "fuel pin material id file name";
+    const std::string kMaterialLibraryFilename_ =
+        "material library file name";
+    const std::string kUseNodeSharedMaterialData_ =
+        "use node shared material data";
+    const std::string kScatteringOrder_ = "scattering order";
     
     // Acceleration parameters
     const std::string kPreconditioner_ = "ho preconditioner name";
@@ -72,10 +83,17 @@ class ParametersDealiiHandler : public ParametersI {
     const std::string kInGroupSolver_ = "in group solver name";
     const std::string kLinearSolver_ = "ho linear solver name";
     const std::string kMultiGroupSolver_ = "mg solver name";
+    const std::string kAdaptiveInnerTolerance_ = "do adaptive inner tolerance";
+    const std::string kKrylovRecyclingVectors_ = "krylov recycling vectors";
+    const std::string kKrylovRecyclingTotalVectors_ =
+        "krylov recycling total vectors";
+    const std::string kStoreAngularFlux_ = "store angular flux";
 
     // Angular quadrature
     const std::string kAngularQuad_ = "angular quadrature name";
     const std::string kAngularQuadOrder_ = "angular quadrature order";
+    const std::string kAngularQuadAzimuthalOrder_ =
+        "angular quadrature azimuthal order";
   };
   
   ParametersDealiiHandler() = default;
@@ -125,6 +143,18 @@ class ParametersDealiiHandler : public ParametersI {
   // MESH PARAMETERS ===========================================================
   int UniformRefinements() const override { return uniform_refinements_; }
 
+  DoFRenumberingType DoFRenumbering() const override {
+    return dof_renumbering_; }
+
+  double FissileCellCost() const override { return fissile_cell_cost_; }
+
+  int AdaptiveRefinementCycles() const override {
+    return adaptive_refinement_cycles_; }
+
+  double RefineFraction() const override { return refine_fraction_; }
+
+  double CoarsenFraction() const override { return coarsen_fraction_; }
+
   bool IsMeshGenerated() const override { return is_mesh_generated_; }
 
   std::string MeshFilename() const override { return mesh_file_name_; }
@@ -148,6 +178,14 @@ class ParametersDealiiHandler : public ParametersI {
   std::string FuelPinMaterialMapFilename() const override {
     return fuel_pin_material_map_filename_; }
 
+  std::string MaterialLibraryFilename() const override {
+    return material_library_filename_; }
+
+  bool UseNodeSharedMaterialData() const override {
+    return use_node_shared_material_data_; }
+
+  int ScatteringOrder() const override { return scattering_order_; }
+
   // Acceleration parameters ===================================================
   
   PreconditionerType Preconditioner() const override { return preconditioner_; }
@@ -179,11 +217,24 @@ class ParametersDealiiHandler : public ParametersI {
   MultiGroupSolverType MultiGroupSolver() const override {
     return multi_group_solver_; }
 
+  bool DoAdaptiveInnerTolerance() const override {
+    return do_adaptive_inner_tolerance_; }
+
+  int KrylovRecyclingVectors() const override {
+    return krylov_recycling_vectors_; }
+  int KrylovRecyclingTotalVectors() const override {
+    return krylov_recycling_total_vectors_; }
+
+  bool StoreAngularFlux() const override { return store_angular_flux_; }
+
   // Angular Quadrature Parameters =============================================
   AngularQuadType AngularQuad() const override { return angular_quad_; }
 
   int AngularQuadOrder() const override { return angular_quad_order_; }
 
+  int AngularQuadAzimuthalOrder() const override {
+    return angular_quad_azimuthal_order_; }
+
   KeyWords GetKeyWords() const { return key_words_; }
   
  private:
@@ -205,6 +256,11 @@ class ParametersDealiiHandler : public ParametersI {
   bool                                 is_mesh_generated_;
   std::string                          mesh_file_name_;
   int                                  uniform_refinements_;
+  DoFRenumberingType                   dof_renumbering_;
+  double                               fissile_cell_cost_;
+  int                                  adaptive_refinement_cycles_;
+  double                               refine_fraction_;
+  double                               coarsen_fraction_;
   double                               fuel_pin_radius_;
   FuelPinTriangulationType             fuel_pin_triangulation_;
   bool                                 is_mesh_pin_resolved_;
@@ -214,6 +270,9 @@ class ParametersDealiiHandler : public ParametersI {
   std::unordered_map<int, std::string> material_filenames_;
   int                                  n_materials_;
   std::string                          fuel_pin_material_map_filename_;
+  std::string                          material_library_filename_;
+  bool                                 use_node_shared_material_data_;
+  int                                  scattering_order_;
                                        
   // Acceleration parameters
   PreconditionerType                   preconditioner_;
@@ -229,10 +288,15 @@ class ParametersDealiiHandler : public ParametersI {
   InGroupSolverType                    in_group_solver_;
   LinearSolverType                     linear_solver_;
   MultiGroupSolverType                 multi_group_solver_;
+  bool                                 do_adaptive_inner_tolerance_;
+  int                                  krylov_recycling_vectors_;
+  int                                  krylov_recycling_total_vectors_;
+  bool                                 store_angular_flux_;
                                        
   // Angular Quadrature                
   AngularQuadType                      angular_quad_;
   int                                  angular_quad_order_;
+  int                                  angular_quad_azimuthal_order_;
                                        
   // Key-words struct                  
   KeyWords                             key_words_;
@@ -256,10 +320,20 @@ class ParametersDealiiHandler : public ParametersI {
         }; /*!< Maps discretization type to strings used in parsed input
             * files. */
 
+  const std::unordered_map<std::string, DoFRenumberingType>
+  kDoFRenumberingTypeMap_ {
+    {"none",          DoFRenumberingType::kNone},
+    {"cuthill_mckee", DoFRenumberingType::kCuthillMcKee},
+    {"hilbert",       DoFRenumberingType::kHilbert},
+    {"downstream",    DoFRenumberingType::kDownstream},
+        }; /*!< Maps DoF renumbering type to strings used in parsed input
+            * files. */
+
   const std::unordered_map<std::string, EquationType> kEquationTypeMap_ {
     {"diffusion", EquationType::kDiffusion},
     {"ep",        EquationType::kEvenParity},
     {"saaf",      EquationType::kSelfAdjointAngularFlux},
+    {"sn",        EquationType::kDiscreteOrdinates},
     {"none",      EquationType::kNone},
         }; /*!< Maps equation type to strings used in parsed input files. */
 
@@ -311,6 +385,9 @@ class ParametersDealiiHandler : public ParametersI {
 
   const std::unordered_map<std::string, AngularQuadType> kAngularQuadTypeMap_ {
     {"level_symmetric_gaussian", AngularQuadType::kLevelSymmetricGaussian},
+    {"product_gauss_legendre_chebyshev",
+     AngularQuadType::kProductGaussLegendreChebyshev},
+    {"gauss_legendre", AngularQuadType::kGaussLegendre},
     {"none", AngularQuadType::kNone},
   }; /*!< Maps angular quadrature type to strings used in parsed input files. */
 
@@ -61,6 +61,16 @@ class ParametersI {
   virtual std::string                MeshFilename()                   const = 0;
   /*! \brief Gets the number of uniform refinements */
   virtual int                        UniformRefinements()             const = 0;
+  /*! \brief Gets the renumbering applied to the degrees of freedom */
+  virtual DoFRenumberingType         DoFRenumbering()                 const = 0;
+  /*! \brief Gets the relative partitioning cost of fissile cells */
+  virtual double                     FissileCellCost()                const = 0;
+  /*! \brief Gets the number of adaptive refinement cycles after the first solve */
+  virtual int                        AdaptiveRefinementCycles()       const = 0;
+  /*! \brief Gets the fraction of cells refined in each refinement cycle */
+  virtual double                     RefineFraction()                 const = 0;
+  /*! \brief Gets the fraction of cells coarsened in each refinement cycle */
+  virtual double                     CoarsenFraction()                const = 0;
   /*! \brief Gets the radius of the fuel pin if the problem has them */
   virtual double                     FuelPinRadius()                  const = 0;
   /*! \brief Gets the triangulation type of the fuel pin if present */
@@ -80,6 +90,14 @@ class ParametersI {
   /*! \brief Gets the filename that shows the layout of materials in the fuel
    * pin if present */
   virtual std::string                FuelPinMaterialMapFilename()        const = 0;
+  /*! \brief Gets the filename of the precompiled binary material library,
+   * empty if none is used */
+  virtual std::string                MaterialLibraryFilename()        const = 0;
+  /*! \brief Gets if read-only material data is stored once per node */
+  virtual bool                       UseNodeSharedMaterialData()      const = 0;
+  /*! \brief Gets the Legendre order of the scattering expansion, 0 if
+   * scattering is isotropic */
+  virtual int                        ScatteringOrder()                const = 0;
                                                             
   // Acceleration parameters
   /*! \brief Gets the type of preconditioner to use */
@@ -106,12 +124,27 @@ class ParametersI {
   virtual LinearSolverType           LinearSolver()                   const = 0;
   /*! \brief Gets solver type for multi-group solves */
   virtual MultiGroupSolverType       MultiGroupSolver()               const = 0;
+  /*! \brief Gets if inner solve tolerances should be driven by the outer
+   * iteration convergence */
+  virtual bool                       DoAdaptiveInnerTolerance()       const = 0;
+  /*! \brief Gets the maximum number of recycled Krylov vectors retained for
+   * each group and angle (0 for no recycling) */
+  virtual int                        KrylovRecyclingVectors()         const = 0;
+  /*! \brief Gets the maximum number of recycled Krylov vectors retained across
+   * all groups and angles */
+  virtual int                        KrylovRecyclingTotalVectors()    const = 0;
+  /*! \brief Gets if angular fluxes are stored, if not only the scalar flux is
+   * accumulated as each angle is solved */
+  virtual bool                       StoreAngularFlux()               const = 0;
                                                                       
   // Angular quadrature parameters
   /*! \brief Gets type of angular quadrature to use */
   virtual AngularQuadType            AngularQuad()                    const = 0;
   /*! \brief Gets angular quadrature order */
   virtual int                        AngularQuadOrder()               const = 0;
+  /*! \brief Gets azimuthal order of product angular quadratures, 0 for twice
+   * the angular quadrature order */
+  virtual int                        AngularQuadAzimuthalOrder()      const = 0;
   
 };
 
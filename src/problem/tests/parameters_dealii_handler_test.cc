@@ -65,6 +65,17 @@ TEST_F(ParametersDealiiHandlerTest, MeshParametersDefault) {
       << "Default mesh filename";
   ASSERT_EQ(test_parameters.UniformRefinements(), 0)
       << "Default number of uniform refinements";
+  ASSERT_EQ(test_parameters.DoFRenumbering(),
+            bart::problem::DoFRenumberingType::kNone)
+      << "Default DoF renumbering";
+  ASSERT_EQ(test_parameters.FissileCellCost(), 1.0)
+      << "Default fissile cell cost";
+  ASSERT_EQ(test_parameters.AdaptiveRefinementCycles(), 0)
+      << "Default adaptive refinement cycles";
+  ASSERT_EQ(test_parameters.RefineFraction(), 0.3)
+      << "Default refine fraction";
+  ASSERT_EQ(test_parameters.CoarsenFraction(), 0.03)
+      << "Default coarsen fraction";
   ASSERT_EQ(test_parameters.FuelPinRadius(), 0.5)
       << "Default fuel Pin radius";
   ASSERT_EQ(test_parameters.FuelPinTriangulation(),
@@ -87,6 +98,12 @@ TEST_F(ParametersDealiiHandlerTest, MaterialParametersDefault) {
       << "Default number of materials";
   ASSERT_EQ(test_parameters.FuelPinMaterialMapFilename(), "")
       << "Default fuel pin filename";
+  ASSERT_EQ(test_parameters.MaterialLibraryFilename(), "")
+      << "Default material library filename";
+  ASSERT_EQ(test_parameters.UseNodeSharedMaterialData(), false)
+      << "Default node shared material data";
+  ASSERT_EQ(test_parameters.ScatteringOrder(), 0)
+      << "Default scattering order";
   
 }
 
@@ -128,6 +145,14 @@ TEST_F(ParametersDealiiHandlerTest, SolverParametersDefault) {
   ASSERT_EQ(test_parameters.MultiGroupSolver(),
             bart::problem::MultiGroupSolverType::kGaussSeidel)
       << "Default multi-group solver";
+  ASSERT_EQ(test_parameters.DoAdaptiveInnerTolerance(), false)
+      << "Default adaptive inner tolerance";
+  ASSERT_EQ(test_parameters.KrylovRecyclingVectors(), 0)
+      << "Default Krylov recycling vectors";
+  ASSERT_EQ(test_parameters.KrylovRecyclingTotalVectors(), 200)
+      << "Default Krylov recycling total vectors";
+  ASSERT_EQ(test_parameters.StoreAngularFlux(), true)
+      << "Default store angular flux";
 
 }
 
@@ -139,6 +164,8 @@ TEST_F(ParametersDealiiHandlerTest, AngularQuadParametersDefault) {
       << "Default angular quadrature";
   ASSERT_EQ(test_parameters.AngularQuadOrder(), 4)
       << "Default angular quadrature order";
+  ASSERT_EQ(test_parameters.AngularQuadAzimuthalOrder(), 0)
+      << "Default angular quadrature azimuthal order";
 }
 
 TEST_F(ParametersDealiiHandlerTest, BasicParametersParse) {
@@ -204,6 +231,11 @@ TEST_F(ParametersDealiiHandlerTest, MeshParametersParsed) {
 
   test_parameter_handler.set(key_words.kMeshGenerated_, "false");
   test_parameter_handler.set(key_words.kUniformRefinements_, "1");
+  test_parameter_handler.set(key_words.kDoFRenumbering_, "hilbert");
+  test_parameter_handler.set(key_words.kFissileCellCost_, "4.0");
+  test_parameter_handler.set(key_words.kAdaptiveRefinementCycles_, "3");
+  test_parameter_handler.set(key_words.kRefineFraction_, "0.5");
+  test_parameter_handler.set(key_words.kCoarsenFraction_, "0.1");
   test_parameter_handler.set(key_words.kMeshFilename_, "test_mesh.msh");
   test_parameter_handler.set(key_words.kFuelPinRadius_, "1.0");
   test_parameter_handler.set(key_words.kFuelPinTriangulation_, "simple");
@@ -217,6 +249,17 @@ TEST_F(ParametersDealiiHandlerTest, MeshParametersParsed) {
       << "Parsed mesh file name";
   ASSERT_EQ(test_parameters.UniformRefinements(), 1)
       << "Parsed number of uniform refinements";
+  ASSERT_EQ(test_parameters.DoFRenumbering(),
+            bart::problem::DoFRenumberingType::kHilbert)
+      << "Parsed DoF renumbering";
+  ASSERT_EQ(test_parameters.FissileCellCost(), 4.0)
+      << "Parsed fissile cell cost";
+  ASSERT_EQ(test_parameters.AdaptiveRefinementCycles(), 3)
+      << "Parsed adaptive refinement cycles";
+  ASSERT_EQ(test_parameters.RefineFraction(), 0.5)
+      << "Parsed refine fraction";
+  ASSERT_EQ(test_parameters.CoarsenFraction(), 0.1)
+      << "Parsed coarsen fraction";
   ASSERT_EQ(test_parameters.FuelPinRadius(), 1.0)
       << "Default fuel Pin radius";
   ASSERT_EQ(test_parameters.FuelPinTriangulation(),
@@ -241,6 +284,9 @@ TEST_F(ParametersDealiiHandlerTest, MaterialParametersParsed) {
   test_parameter_handler.set(key_words.kMaterialFilenames_,
                              "1: file_1, 2: file_2");
   test_parameter_handler.set(key_words.kFuelPinMaterialMapFilename_, "pin.txt");
+  test_parameter_handler.set(key_words.kMaterialLibraryFilename_, "xs.bin");
+  test_parameter_handler.set(key_words.kUseNodeSharedMaterialData_, "true");
+  test_parameter_handler.set(key_words.kScatteringOrder_, "3");
   test_parameter_handler.leave_subsection();
   
   test_parameters.Parse(test_parameter_handler);
@@ -253,6 +299,12 @@ TEST_F(ParametersDealiiHandlerTest, MaterialParametersParsed) {
       << "Parsed number of materials";
   ASSERT_EQ(test_parameters.FuelPinMaterialMapFilename(), "pin.txt")
       << "Parsed fuel pin filename";
+  ASSERT_EQ(test_parameters.MaterialLibraryFilename(), "xs.bin")
+      << "Parsed material library filename";
+  ASSERT_EQ(test_parameters.UseNodeSharedMaterialData(), true)
+      << "Parsed node shared material data";
+  ASSERT_EQ(test_parameters.ScatteringOrder(), 3)
+      << "Parsed scattering order";
 }
 
 TEST_F(ParametersDealiiHandlerTest, AccelerationParametersParsed) {
@@ -292,6 +344,10 @@ TEST_F(ParametersDealiiHandlerTest, SolverParametersParsed) {
   test_parameter_handler.set(key_words.kInGroupSolver_, "none");
   test_parameter_handler.set(key_words.kLinearSolver_, "gmres");
   test_parameter_handler.set(key_words.kMultiGroupSolver_, "none");
+  test_parameter_handler.set(key_words.kAdaptiveInnerTolerance_, "true");
+  test_parameter_handler.set(key_words.kKrylovRecyclingVectors_, "8");
+  test_parameter_handler.set(key_words.kKrylovRecyclingTotalVectors_, "64");
+  test_parameter_handler.set(key_words.kStoreAngularFlux_, "false");
   
   test_parameters.Parse(test_parameter_handler);
   
@@ -307,6 +363,14 @@ TEST_F(ParametersDealiiHandlerTest, SolverParametersParsed) {
   ASSERT_EQ(test_parameters.MultiGroupSolver(),
             bart::problem::MultiGroupSolverType::kNone)
       << "Parsed multi-group solver";
+  ASSERT_EQ(test_parameters.DoAdaptiveInnerTolerance(), true)
+      << "Parsed adaptive inner tolerance";
+  ASSERT_EQ(test_parameters.KrylovRecyclingVectors(), 8)
+      << "Parsed Krylov recycling vectors";
+  ASSERT_EQ(test_parameters.KrylovRecyclingTotalVectors(), 64)
+      << "Parsed Krylov recycling total vectors";
+  ASSERT_EQ(test_parameters.StoreAngularFlux(), false)
+      << "Parsed store angular flux";
 
 }
 
@@ -323,3 +387,32 @@ TEST_F(ParametersDealiiHandlerTest, AngularQuadParametersParsed) {
   ASSERT_EQ(test_parameters.AngularQuadOrder(), 8)
       << "Parsed angular quadrature order";
 }
+
+TEST_F(ParametersDealiiHandlerTest, GaussLegendreAngularQuadParametersParsed) {
+
+  test_parameter_handler.set(key_words.kAngularQuad_, "gauss_legendre");
+
+  test_parameters.Parse(test_parameter_handler);
+
+  ASSERT_EQ(test_parameters.AngularQuad(),
+            bart::problem::AngularQuadType::kGaussLegendre)
+      << "Parsed angular quadrature";
+}
+
+TEST_F(ParametersDealiiHandlerTest, ProductAngularQuadParametersParsed) {
+
+  test_parameter_handler.set(key_words.kAngularQuad_,
+                             "product_gauss_legendre_chebyshev");
+  test_parameter_handler.set(key_words.kAngularQuadOrder_, "24");
+  test_parameter_handler.set(key_words.kAngularQuadAzimuthalOrder_, "12");
+
+  test_parameters.Parse(test_parameter_handler);
+
+  ASSERT_EQ(test_parameters.AngularQuad(),
+            bart::problem::AngularQuadType::kProductGaussLegendreChebyshev)
+      << "Parsed angular quadrature";
+  ASSERT_EQ(test_parameters.AngularQuadOrder(), 24)
+      << "Parsed angular quadrature order";
+  ASSERT_EQ(test_parameters.AngularQuadAzimuthalOrder(), 12)
+      << "Parsed angular quadrature azimuthal order";
+}
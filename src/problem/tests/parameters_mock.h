@@ -41,6 +41,16 @@ class ParametersMock : public ParametersI {
 
   MOCK_CONST_METHOD0(UniformRefinements, int());
 
+  MOCK_CONST_METHOD0(DoFRenumbering, DoFRenumberingType());
+
+  MOCK_CONST_METHOD0(FissileCellCost, double());
+
+  MOCK_CONST_METHOD0(AdaptiveRefinementCycles, int());
+
+  MOCK_CONST_METHOD0(RefineFraction, double());
+
+  MOCK_CONST_METHOD0(CoarsenFraction, double());
+
   MOCK_CONST_METHOD0(FuelPinRadius, double());
 
   MOCK_CONST_METHOD0(FuelPinTriangulation, FuelPinTriangulationType());
@@ -55,6 +65,12 @@ class ParametersMock : public ParametersI {
   
   MOCK_CONST_METHOD0(FuelPinMaterialMapFilename, std::string());
 
+  MOCK_CONST_METHOD0(MaterialLibraryFilename, std::string());
+
+  MOCK_CONST_METHOD0(UseNodeSharedMaterialData, bool());
+
+  MOCK_CONST_METHOD0(ScatteringOrder, int());
+
   MOCK_CONST_METHOD0(Preconditioner, PreconditionerType());
 
   MOCK_CONST_METHOD0(BlockSSORFactor, double());
@@ -77,9 +93,19 @@ class ParametersMock : public ParametersI {
 
   MOCK_CONST_METHOD0(MultiGroupSolver, MultiGroupSolverType());
 
+  MOCK_CONST_METHOD0(DoAdaptiveInnerTolerance, bool());
+
+  MOCK_CONST_METHOD0(KrylovRecyclingVectors, int());
+
+  MOCK_CONST_METHOD0(KrylovRecyclingTotalVectors, int());
+
+  MOCK_CONST_METHOD0(StoreAngularFlux, bool());
+
   MOCK_CONST_METHOD0(AngularQuad, AngularQuadType());
 
   MOCK_CONST_METHOD0(AngularQuadOrder, int());
+
+  MOCK_CONST_METHOD0(AngularQuadAzimuthalOrder, int());
   
 };
 
@@ -0,0 +1,47 @@
+#include "quadrature/angular/gauss_legendre.h"
+
+#include <cmath>
+
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/quadrature_lib.h>
+
+namespace bart {
+
+namespace quadrature {
+
+namespace angular {
+
+GaussLegendre::GaussLegendre(quadrature::Order order)
+    : order_(order.get()) {
+  AssertThrow(order_ >= 2,
+              dealii::ExcMessage("Error in constructor of "
+                                 "GaussLegendre order must be >= 2"))
+  AssertThrow(order_ % 2 == 0,
+              dealii::ExcMessage("Error in constructor of "
+                                 "GaussLegendre order must be even"))
+}
+
+std::vector<std::pair<CartesianPosition<1>, Weight>>
+GaussLegendre::GenerateSet() const {
+  std::vector<std::pair<CartesianPosition<1>, Weight>> generated_set;
+
+  // Gaussian quadrature on [0, 1], the first half of the points map to the
+  // positive half of [-1, 1]
+  dealii::QGauss<1> gaussian_quadrature(order_);
+
+  for (int i = 0; i < order_/2; ++i) {
+    const double mu = 1 - gaussian_quadrature.point(i)[0] * 2;
+    // Gauss weight on [-1, 1] is twice the weight on [0, 1], then integrated
+    // over 2pi in azimuth
+    const double weight = 4 * M_PI * gaussian_quadrature.weight(i);
+    std::array<double, 1> position{mu};
+    generated_set.emplace_back(CartesianPosition<1>(position), Weight(weight));
+  }
+  return generated_set;
+}
+
+} // namespace angular
+
+} // namespace quadrature
+
+} //namespace bart
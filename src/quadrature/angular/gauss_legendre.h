@@ -0,0 +1,52 @@
+#ifndef BART_SRC_QUADRATURE_ANGULAR_GAUSS_LEGENDRE_H_
+#define BART_SRC_QUADRATURE_ANGULAR_GAUSS_LEGENDRE_H_
+
+#include "quadrature/quadrature_generator_i.h"
+
+namespace bart {
+
+namespace quadrature {
+
+namespace angular {
+
+/*! \brief Generates a one-dimensional Gauss-Legendre quadrature set in
+ * \f$\mu\f$.
+ *
+ * In slab geometry the angular flux depends only on
+ * \f$\mu = \cos\theta\f$, integrating over the azimuthal angle gives
+ *
+ * \f[
+ * \int_{0}^{2\pi}\int_{-1}^{1} f(\mu) d\mu d\phi \approx
+ * 2\pi\sum_{i = 1}^{N}w_i f(\mu_i)\;,
+ * \f]
+ *
+ * where \f$\mu_i\f$ and \f$w_i\f$ are the \f$N\f$ Gauss-Legendre nodes and
+ * weights on \f$[-1, 1]\f$. The weights therefore sum to \f$4\pi\f$, the same
+ * as the multi-dimensional sets. Only the \f$N/2\f$ points with
+ * \f$\mu > 0\f$ are generated, the remaining points are their reflections
+ * across the origin.
+ */
+class GaussLegendre : public QuadratureGeneratorI<1> {
+ public:
+  /*! \brief Constructor.
+   *
+   * @param order number of Gauss-Legendre points on \f$[-1, 1]\f$, must be
+   * even and >= 2.
+   */
+  explicit GaussLegendre(quadrature::Order order);
+  std::vector<std::pair<CartesianPosition<1>, Weight>>
+  GenerateSet() const override;
+
+  int order() const override { return order_; }
+
+ private:
+  const int order_;
+};
+
+} // namespace angular
+
+} // namespace quadrature
+
+} //namespace bart
+
+#endif //BART_SRC_QUADRATURE_ANGULAR_GAUSS_LEGENDRE_H_
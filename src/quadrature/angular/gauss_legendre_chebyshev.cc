@@ -0,0 +1,67 @@
+#include "quadrature/angular/gauss_legendre_chebyshev.h"
+
+#include <cmath>
+
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/quadrature_lib.h>
+
+namespace bart {
+
+namespace quadrature {
+
+namespace angular {
+
+GaussLegendreChebyshev::GaussLegendreChebyshev(
+    quadrature::Order polar_order,
+    quadrature::Order azimuthal_order)
+    : polar_order_(polar_order.get()),
+      azimuthal_order_(azimuthal_order.get()) {
+  AssertThrow(polar_order_ >= 2,
+              dealii::ExcMessage("Error in constructor of "
+                                 "GaussLegendreChebyshev polar order must be "
+                                 ">= 2"))
+  AssertThrow(polar_order_ % 2 == 0,
+              dealii::ExcMessage("Error in constructor of "
+                                 "GaussLegendreChebyshev polar order must be "
+                                 "even"))
+  AssertThrow(azimuthal_order_ >= 4 && azimuthal_order_ % 4 == 0,
+              dealii::ExcMessage("Error in constructor of "
+                                 "GaussLegendreChebyshev azimuthal order must "
+                                 "be a positive multiple of 4"))
+}
+
+std::vector<std::pair<CartesianPosition<3>, Weight>>
+GaussLegendreChebyshev::GenerateSet() const {
+  std::vector<std::pair<CartesianPosition<3>, Weight>> generated_set;
+  const int n_polar_levels = polar_order_/2;
+  const int n_azimuthal_points = azimuthal_order_/4;
+
+  // Gaussian quadrature on [0, 1], the first half of the points map to the
+  // positive half of [-1, 1]
+  dealii::QGauss<1> gaussian_quadrature(polar_order_);
+  const double dphi = 2 * M_PI/azimuthal_order_;
+
+  for (int level = 0; level < n_polar_levels; ++level) {
+    const double mu = 1 - gaussian_quadrature.point(level)[0] * 2;
+    // Gauss weight on [-1, 1] is twice the weight on [0, 1]
+    const double weight =
+        2 * gaussian_quadrature.weight(level) * dphi;
+    const double sin_theta = std::sqrt(1 - mu*mu);
+
+    for (int j = 0; j < n_azimuthal_points; ++j) {
+      const double phi = (j + 0.5)*dphi;
+      std::array<double, 3> position{sin_theta * std::cos(phi),
+                                     sin_theta * std::sin(phi),
+                                     mu};
+      generated_set.emplace_back(CartesianPosition<3>(position),
+                                 Weight(weight));
+    }
+  }
+  return generated_set;
+}
+
+} // namespace angular
+
+} // namespace quadrature
+
+} //namespace bart
@@ -0,0 +1,64 @@
+#ifndef BART_SRC_QUADRATURE_ANGULAR_GAUSS_LEGENDRE_CHEBYSHEV_H_
+#define BART_SRC_QUADRATURE_ANGULAR_GAUSS_LEGENDRE_CHEBYSHEV_H_
+
+#include "quadrature/quadrature_generator_i.h"
+
+namespace bart {
+
+namespace quadrature {
+
+namespace angular {
+
+/*! \brief Generates a product Gauss-Legendre-Chebyshev quadrature set.
+ *
+ * The product set integrates a function \f$f(\mu, \phi)\f$ over the unit
+ * sphere using the approximation,
+ *
+ * \f[
+ * \int_{0}^{2\pi}\int_{-1}^{1} f(\mu, \phi) d\mu d\phi \approx
+ * \frac{2\pi}{N_{\phi}}\sum_{i = 1}^{N_{\mu}}\sum_{j = 1}^{N_{\phi}}
+ * w_i f(\mu_i, \phi_j)\;,
+ * \f]
+ *
+ * where \f$\mu_i\f$ and \f$w_i\f$ are the \f$N_{\mu}\f$ Gauss-Legendre nodes
+ * and weights on \f$[-1, 1]\f$ and \f$\phi_j = (j - 0.5)\frac{2\pi}{N_{\phi}}\f$
+ * are the Chebyshev nodes, equally spaced with equal weights. Unlike the
+ * level-symmetric set, the polar and azimuthal orders are independent and all
+ * weights are positive for any order, so there is no upper limit on either.
+ * The set has \f$N_{\mu}N_{\phi}\f$ points in total.
+ *
+ * As with LevelSymmetricGaussian, only the points in the first octant are
+ * generated, the remaining points are found using
+ * quadrature::utility::GenerateAllPositiveX and reflections across the origin.
+ */
+class GaussLegendreChebyshev : public QuadratureGeneratorI<3> {
+ public:
+  /*! \brief Constructor.
+   *
+   * @param polar_order number of Gauss-Legendre points in \f$\mu\f$ on
+   * \f$[-1, 1]\f$, must be even and >= 2.
+   * @param azimuthal_order number of Chebyshev points in \f$\phi\f$ on
+   * \f$[0, 2\pi)\f$, must be a multiple of 4.
+   */
+  GaussLegendreChebyshev(quadrature::Order polar_order,
+                         quadrature::Order azimuthal_order);
+  std::vector<std::pair<CartesianPosition<3>, Weight>>
+  GenerateSet() const override;
+
+  //! Returns the polar order
+  int order() const override { return polar_order_; }
+  int polar_order() const { return polar_order_; }
+  int azimuthal_order() const { return azimuthal_order_; }
+
+ private:
+  const int polar_order_;
+  const int azimuthal_order_;
+};
+
+} // namespace angular
+
+} // namespace quadrature
+
+} //namespace bart
+
+#endif //BART_SRC_QUADRATURE_ANGULAR_GAUSS_LEGENDRE_CHEBYSHEV_H_
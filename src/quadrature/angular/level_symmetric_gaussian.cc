@@ -17,9 +17,6 @@ LevelSymmetricGaussian::LevelSymmetricGaussian(bart::quadrature::Order order)
   AssertThrow(order_ % 2 == 0,
               dealii::ExcMessage("Error in constructor of "
                                  "LevelSymmetricGaussian order must be even"))
-  AssertThrow(order_ <= 16,
-              dealii::ExcMessage("Error in constructor of "
-                                 "LevelSymmetricGaussian order must be <= 16"))
 }
 
 std::vector<std::pair<CartesianPosition<3>, Weight>>
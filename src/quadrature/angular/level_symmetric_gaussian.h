@@ -61,7 +61,10 @@ class LevelSymmetricGaussian : public QuadratureGeneratorI<3> {
    * The constructor requires specification of the quadrature order. The order
    * indicates the order of the Gauss-Legendre quadrature used for
    * the \f$\cos{\theta_i}\f$ nodes. This also means it is the total number of
-   * points in the level with the most points.
+   * points in the level with the most points. The order must be even and
+   * >= 2, there is no upper limit because the weights are products of
+   * Gauss-Legendre weights and equal azimuthal weights, which are positive for
+   * all orders, unlike the weights of true level-symmetric sets above S20.
    */
   explicit LevelSymmetricGaussian(quadrature::Order);
   std::vector<std::pair<CartesianPosition<3>, Weight>>
@@ -0,0 +1,87 @@
+#include "quadrature/angular/gauss_legendre_chebyshev.h"
+
+#include <cmath>
+
+#include "test_helpers/gmock_wrapper.h"
+
+namespace  {
+
+using namespace bart;
+
+class QuadratureAngularGaussLegendreChebyshevTest : public ::testing::Test {
+ public:
+  // Integrates a function over the sphere using the first octant and symmetry
+  template <typename Function>
+  double Integrate(const quadrature::angular::GaussLegendreChebyshev& quad,
+                   Function function) {
+    double sum = 0;
+    for (const auto& [position, weight] : quad.GenerateSet())
+      sum += weight.get() * function(position.get());
+    return 8 * sum;
+  }
+};
+
+// Constructor should set order values properly.
+TEST_F(QuadratureAngularGaussLegendreChebyshevTest, Constructor) {
+  quadrature::angular::GaussLegendreChebyshev test_quadrature{
+      quadrature::Order(4), quadrature::Order(12)};
+  EXPECT_EQ(test_quadrature.order(), 4);
+  EXPECT_EQ(test_quadrature.polar_order(), 4);
+  EXPECT_EQ(test_quadrature.azimuthal_order(), 12);
+}
+
+// Bad polar orders (odd, < 2) and azimuthal orders (not a multiple of 4)
+// should throw an error.
+TEST_F(QuadratureAngularGaussLegendreChebyshevTest, BadOrders) {
+  std::array bad_polar_orders{0, 1, 3, 5, 33, -2};
+  std::array bad_azimuthal_orders{0, 2, 6, 10, -4};
+
+  for (auto bad_order : bad_polar_orders) {
+    EXPECT_ANY_THROW({
+      quadrature::angular::GaussLegendreChebyshev test_quad(
+          quadrature::Order(bad_order), quadrature::Order(8));
+    });
+  }
+  for (auto bad_order : bad_azimuthal_orders) {
+    EXPECT_ANY_THROW({
+      quadrature::angular::GaussLegendreChebyshev test_quad(
+          quadrature::Order(4), quadrature::Order(bad_order));
+    });
+  }
+}
+
+/* Orders beyond S16, with independent polar and azimuthal orders, should
+ * generate N_mu * N_phi / 8 points with positive weights that integrate
+ * polynomials exactly. */
+TEST_F(QuadratureAngularGaussLegendreChebyshevTest, Integration) {
+  std::array polar_orders{4, 8, 18, 32};
+  std::array azimuthal_orders{8, 16, 36, 64};
+  for (const auto polar_order : polar_orders) {
+    for (const auto azimuthal_order : azimuthal_orders) {
+      quadrature::angular::GaussLegendreChebyshev test_quad{
+          quadrature::Order(polar_order), quadrature::Order(azimuthal_order)};
+      const auto quadrature_set = test_quad.GenerateSet();
+      EXPECT_EQ(quadrature_set.size(), polar_order*azimuthal_order/8);
+      for (const auto& [position, weight] : quadrature_set) {
+        EXPECT_GT(weight.get(), 0);
+        for (const double component : position.get())
+          EXPECT_GT(component, 0);
+      }
+
+      using Position = std::array<double, 3>;
+      EXPECT_NEAR(Integrate(test_quad, [](const Position&) { return 1.0; }),
+                  4*M_PI, 1e-10);
+      EXPECT_NEAR(Integrate(test_quad, [](const Position& p) {
+                    return p[0]*p[0] + p[1]*p[1]; }),
+                  8*M_PI/3, 1e-10);
+      EXPECT_NEAR(Integrate(test_quad, [](const Position& p) {
+                    return std::pow(p[2], 4); }),
+                  4*M_PI/5, 1e-10);
+      EXPECT_NEAR(Integrate(test_quad, [](const Position& p) {
+                    return std::pow(p[0], 4); }),
+                  4*M_PI/5, 1e-10);
+    }
+  }
+}
+
+} // namespace
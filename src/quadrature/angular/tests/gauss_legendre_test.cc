@@ -0,0 +1,53 @@
+#include "quadrature/angular/gauss_legendre.h"
+
+#include <cmath>
+
+#include "test_helpers/gmock_wrapper.h"
+
+namespace  {
+
+using namespace bart;
+
+class QuadratureAngularGaussLegendreTest : public ::testing::Test {};
+
+// Constructor should set order value properly.
+TEST_F(QuadratureAngularGaussLegendreTest, Constructor) {
+  quadrature::angular::GaussLegendre test_quadrature{quadrature::Order(4)};
+  EXPECT_EQ(test_quadrature.order(), 4);
+}
+
+// Bad values of order (negative, odd, and zero) should throw an error.
+TEST_F(QuadratureAngularGaussLegendreTest, BadOrders) {
+  std::array bad_orders{0, 1, 3, 5, 33, -1, -2};
+
+  for (auto bad_order : bad_orders) {
+    EXPECT_ANY_THROW({
+      quadrature::angular::GaussLegendre test_quad{quadrature::Order(bad_order)};
+    });
+  }
+}
+
+/* Generated sets should have N/2 points with positive mu, and integrate
+ * polynomials in mu exactly over the sphere using the reflection symmetry. */
+TEST_F(QuadratureAngularGaussLegendreTest, Integration) {
+  std::array orders{2, 4, 8, 16, 32, 64};
+  for (const auto order : orders) {
+    quadrature::angular::GaussLegendre test_quad{quadrature::Order(order)};
+    const auto quadrature_set = test_quad.GenerateSet();
+    EXPECT_EQ(quadrature_set.size(), order/2);
+
+    double weight_sum = 0, mu_squared_sum = 0;
+    for (const auto& [position, weight] : quadrature_set) {
+      const double mu = position.get().at(0);
+      EXPECT_GT(mu, 0);
+      EXPECT_LT(mu, 1);
+      EXPECT_GT(weight.get(), 0);
+      weight_sum += weight.get();
+      mu_squared_sum += weight.get() * mu * mu;
+    }
+    EXPECT_NEAR(2*weight_sum, 4*M_PI, 1e-10);
+    EXPECT_NEAR(2*mu_squared_sum, 4*M_PI/3, 1e-10);
+  }
+}
+
+} // namespace
@@ -30,9 +30,9 @@ TEST_F(QuadratureAngularLevelSymmetricGaussianTest, Constructor) {
   EXPECT_EQ(test_quadrature.order(), 4);
 }
 
-// Bad values of order (negative, odd, and too large) should throw an error.
+// Bad values of order (negative, zero and odd) should throw an error.
 TEST_F(QuadratureAngularLevelSymmetricGaussianTest, BadOrders) {
-  std::array bad_orders{0, 1, 3, 5, 18, -1, -3, -18};
+  std::array bad_orders{0, 1, 3, 5, 33, -1, -3, -18};
 
   for (auto bad_order : bad_orders) {
     EXPECT_ANY_THROW({
@@ -43,7 +43,7 @@ TEST_F(QuadratureAngularLevelSymmetricGaussianTest, BadOrders) {
 
 // All orders should integrate a spherical harmonic exactly.
 TEST_F(QuadratureAngularLevelSymmetricGaussianTest, Integration) {
-  std::array orders{2, 4, 6, 8, 10, 12, 14, 16};
+  std::array orders{2, 4, 6, 8, 10, 12, 14, 16, 18, 24, 32};
   for (const auto order : orders) {
     quadrature::angular::LevelSymmetricGaussian test_quad{quadrature::Order(order)};
     const auto quadrature_set = test_quad.GenerateSet();
@@ -58,4 +58,21 @@ TEST_F(QuadratureAngularLevelSymmetricGaussianTest, Integration) {
   }
 }
 
+// Orders beyond S16 should generate positive weights that sum to 4pi.
+TEST_F(QuadratureAngularLevelSymmetricGaussianTest, HighOrderWeights) {
+  quadrature::angular::LevelSymmetricGaussian test_quad{quadrature::Order(32)};
+  const auto quadrature_set = test_quad.GenerateSet();
+  ASSERT_EQ(quadrature_set.size(), 32*34/8);
+
+  double weight_sum = 0;
+  for (const auto& [position, weight] : quadrature_set) {
+    EXPECT_GT(weight.get(), 0);
+    for (const double component : position.get())
+      EXPECT_GT(component, 0);
+    weight_sum += weight.get();
+  }
+  // Only the first octant is generated
+  EXPECT_NEAR(8*weight_sum, 4*M_PI, 1e-10);
+}
+
 } // namespace
\ No newline at end of file
@@ -0,0 +1,57 @@
+#include "quadrature/angular/xy_projection.h"
+
+#include <cmath>
+
+#include "quadrature/angular/level_symmetric_gaussian.h"
+#include "test_helpers/gmock_wrapper.h"
+
+namespace  {
+
+using namespace bart;
+
+/* Tests for the XYProjection class, the projected set is compared to the
+ * first octant of a level symmetric gaussian set of order 8. */
+class QuadratureAngularXYProjectionTest : public ::testing::Test {
+ public:
+  const int order = 8;
+  std::shared_ptr<quadrature::QuadratureGeneratorI<3>> generator_ptr_ =
+      std::make_shared<quadrature::angular::LevelSymmetricGaussian>(
+          quadrature::Order(order));
+};
+
+// Constructor should store the generator and report its order.
+TEST_F(QuadratureAngularXYProjectionTest, Constructor) {
+  quadrature::angular::XYProjection test_quadrature(generator_ptr_);
+  EXPECT_EQ(test_quadrature.generator_ptr(), generator_ptr_.get());
+  EXPECT_EQ(test_quadrature.order(), order);
+}
+
+// Constructor should throw if the generator is null.
+TEST_F(QuadratureAngularXYProjectionTest, ConstructorNullGenerator) {
+  EXPECT_ANY_THROW({
+    quadrature::angular::XYProjection test_quadrature(nullptr);
+  });
+}
+
+/* Each point should be the projection of the 3D point with twice the weight,
+ * so that the first quadrant holds the weight of two octants. */
+TEST_F(QuadratureAngularXYProjectionTest, GenerateSet) {
+  quadrature::angular::XYProjection test_quadrature(generator_ptr_);
+
+  const auto generated_set = generator_ptr_->GenerateSet();
+  const auto projected_set = test_quadrature.GenerateSet();
+  ASSERT_EQ(projected_set.size(), generated_set.size());
+
+  double weight_sum = 0;
+  for (std::size_t i = 0; i < projected_set.size(); ++i) {
+    const auto& [position, weight] = generated_set.at(i);
+    const auto& [projected_position, projected_weight] = projected_set.at(i);
+    EXPECT_DOUBLE_EQ(projected_position.get().at(0), position.get().at(0));
+    EXPECT_DOUBLE_EQ(projected_position.get().at(1), position.get().at(1));
+    EXPECT_DOUBLE_EQ(projected_weight.get(), 2 * weight.get());
+    weight_sum += projected_weight.get();
+  }
+  EXPECT_NEAR(4 * weight_sum, 4 * M_PI, 1e-10);
+}
+
+} // namespace
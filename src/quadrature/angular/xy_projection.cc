@@ -0,0 +1,40 @@
+#include "quadrature/angular/xy_projection.h"
+
+#include <deal.II/base/exceptions.h>
+
+namespace bart {
+
+namespace quadrature {
+
+namespace angular {
+
+XYProjection::XYProjection(
+    std::shared_ptr<QuadratureGeneratorI<3>> generator_ptr)
+    : generator_ptr_(generator_ptr) {
+  AssertThrow(generator_ptr_ != nullptr,
+              dealii::ExcMessage("Error in constructor of XYProjection, "
+                                 "generator pointer is null"))
+}
+
+std::vector<std::pair<CartesianPosition<2>, Weight>>
+XYProjection::GenerateSet() const {
+  std::vector<std::pair<CartesianPosition<2>, Weight>> generated_set;
+
+  for (const auto& [position, weight] : generator_ptr_->GenerateSet()) {
+    const auto& [x, y, z] = position.get();
+    AssertThrow(z > 0,
+                dealii::ExcMessage("Error in XYProjection, generated points "
+                                   "must have a positive z component"))
+    // Each point also represents its reflection across the xy-plane
+    std::array<double, 2> projected_position{x, y};
+    generated_set.emplace_back(CartesianPosition<2>(projected_position),
+                               Weight(2 * weight.get()));
+  }
+  return generated_set;
+}
+
+} // namespace angular
+
+} // namespace quadrature
+
+} //namespace bart
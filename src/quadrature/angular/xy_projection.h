@@ -0,0 +1,54 @@
+#ifndef BART_SRC_QUADRATURE_ANGULAR_XY_PROJECTION_H_
+#define BART_SRC_QUADRATURE_ANGULAR_XY_PROJECTION_H_
+
+#include <memory>
+
+#include "quadrature/quadrature_generator_i.h"
+
+namespace bart {
+
+namespace quadrature {
+
+namespace angular {
+
+/*! \brief Generates a two-dimensional quadrature set by projecting a
+ * three-dimensional set onto the xy-plane.
+ *
+ * In two dimensions the solution is symmetric across the xy-plane, the
+ * directions \f$(\Omega_x, \Omega_y, \Omega_z)\f$ and
+ * \f$(\Omega_x, \Omega_y, -\Omega_z)\f$ have the same angular flux. Only
+ * the directions with \f$\Omega_z > 0\f$ are kept, with their projection
+ * \f$(\Omega_x, \Omega_y)\f$ as the position and twice their weight, so the
+ * weights still sum to \f$4\pi\f$ with half of the points of the
+ * three-dimensional set.
+ *
+ * The first-octant points of the provided generator are projected, giving the
+ * first-quadrant points of the two-dimensional set. The order is the order of
+ * the provided generator.
+ */
+class XYProjection : public QuadratureGeneratorI<2> {
+ public:
+  /*! \brief Constructor.
+   *
+   * @param generator_ptr three-dimensional quadrature generator to project.
+   */
+  explicit XYProjection(std::shared_ptr<QuadratureGeneratorI<3>> generator_ptr);
+  std::vector<std::pair<CartesianPosition<2>, Weight>>
+  GenerateSet() const override;
+
+  int order() const override { return generator_ptr_->order(); }
+
+  QuadratureGeneratorI<3>* generator_ptr() const {
+    return generator_ptr_.get(); }
+
+ private:
+  std::shared_ptr<QuadratureGeneratorI<3>> generator_ptr_;
+};
+
+} // namespace angular
+
+} // namespace quadrature
+
+} //namespace bart
+
+#endif //BART_SRC_QUADRATURE_ANGULAR_XY_PROJECTION_H_
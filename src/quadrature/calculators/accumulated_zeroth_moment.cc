@@ -0,0 +1,37 @@
+#include "quadrature/calculators/accumulated_zeroth_moment.h"
+
+#include "system/solution/mpi_group_moment_accumulator.h"
+
+namespace bart {
+
+namespace quadrature {
+
+namespace calculators {
+
+system::moments::MomentVector AccumulatedZerothMoment::CalculateMoment(
+    system::solution::MPIGroupAngularSolutionI *solution,
+    system::GroupNumber /*group*/,
+    system::moments::HarmonicL harmonic_l,
+    system::moments::HarmonicL harmonic_m) const {
+
+  AssertThrow(harmonic_l == 0 && harmonic_m == 0,
+      dealii::ExcMessage("Error: AccumulatedZerothMoment quadrature calculator "
+                         "can only return the zeroth moment"));
+
+  auto accumulator_ptr =
+      dynamic_cast<system::solution::MPIGroupMomentAccumulator*>(solution);
+  AssertThrow(accumulator_ptr != nullptr,
+      dealii::ExcMessage("Error: Using AccumulatedZerothMoment quadrature "
+                         "calculator but solution does not accumulate "
+                         "moments"));
+
+  system::moments::MomentVector return_vector(accumulator_ptr->scalar_flux());
+
+  return return_vector;
+}
+
+} // namespace calculators
+
+} // namespace quadrature
+
+} // namespace bart
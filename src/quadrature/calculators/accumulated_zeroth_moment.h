@@ -0,0 +1,33 @@
+#ifndef BART_SRC_QUADRATURE_CALCULATORS_ACCUMULATED_ZEROTH_MOMENT_H_
+#define BART_SRC_QUADRATURE_CALCULATORS_ACCUMULATED_ZEROTH_MOMENT_H_
+
+#include "quadrature/calculators/spherical_harmonic_moments_i.h"
+
+namespace bart {
+
+namespace quadrature {
+
+namespace calculators {
+/*! \brief Moment calculator for solutions that accumulate the scalar flux.
+ * The quadrature sum is performed by system::solution::MPIGroupMomentAccumulator
+ * as each angle is solved, this class returns the accumulated scalar flux as a
+ * moment vector. The provided solution must be an MPIGroupMomentAccumulator
+ * and only the zeroth moment can be requested, otherwise an exception will be
+ * thrown.
+ */
+class AccumulatedZerothMoment : public SphericalHarmonicMomentsI {
+ public:
+  system::moments::MomentVector CalculateMoment(
+      system::solution::MPIGroupAngularSolutionI *solution,
+      system::GroupNumber group,
+      system::moments::HarmonicL harmonic_l,
+      system::moments::HarmonicL harmonic_m) const override;
+};
+
+} // namespace calculators
+
+} // namespace quadrature
+
+} //namespace bart
+
+#endif //BART_SRC_QUADRATURE_CALCULATORS_ACCUMULATED_ZEROTH_MOMENT_H_
@@ -18,9 +18,7 @@ system::moments::MomentVector ScalarMoment::CalculateMoment(
       dealii::ExcMessage("Error: Using ScalarMoment quadrature calculator "
                          "but solution appears to have more than one angle"));
 
-  auto mpi_solution = solution->GetSolution(0);
-
-  system::moments::MomentVector return_vector(mpi_solution);
+  system::moments::MomentVector return_vector(solution->GetSolution(0));
 
   return return_vector;
 }
@@ -56,6 +56,30 @@ class SphericalHarmonicMomentsI {
       system::GroupNumber group,
       system::moments::HarmonicL harmonic_l,
       system::moments::HarmonicL harmonic_m) const = 0;
+
+  /*! \brief Calculates all moments of a group up to a maximum degree.
+   *
+   * The default implementation calls CalculateMoment for each moment,
+   * implementations that can calculate all moments in a single pass over the
+   * angular solutions should override it.
+   *
+   * @param solution angular solutions of the group
+   * @param group group number, used to index the returned moments
+   * @param max_harmonic_l maximum degree \f$\ell\f$ to calculate
+   * @return moments \f$\phi_{g}^{\ell, m}\f$ for all \f$\ell \leq
+   * \ell_{\text{max}}\f$, indexed by \f$[g, \ell, m]\f$
+   */
+  virtual system::moments::MomentsMap CalculateMoments(
+      system::solution::MPIGroupAngularSolutionI* solution,
+      system::GroupNumber group,
+      system::moments::HarmonicL max_harmonic_l) const {
+    system::moments::MomentsMap moments;
+    for (int l = 0; l <= max_harmonic_l; ++l) {
+      for (int m = -l; m <= l; ++m)
+        moments[{group, l, m}] = CalculateMoment(solution, group, l, m);
+    }
+    return moments;
+  }
 };
 
 } // namespace calculators
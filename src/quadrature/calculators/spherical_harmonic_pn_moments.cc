@@ -0,0 +1,145 @@
+#include "quadrature/calculators/spherical_harmonic_pn_moments.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <numeric>
+
+#include "quadrature/quadrature_set_view.h"
+#include "quadrature/utility/quadrature_utilities.h"
+#include "system/solution/mpi_group_angular_solution_i.h"
+
+namespace bart {
+
+namespace quadrature {
+
+namespace calculators {
+
+template <int dim>
+SphericalHarmonicPNMoments<dim>::SphericalHarmonicPNMoments(
+    std::shared_ptr<QuadratureSetI<dim>> quadrature_set_ptr,
+    const system::moments::HarmonicL max_harmonic_l)
+    : SphericalHarmonicMoments<dim>(quadrature_set_ptr),
+      max_harmonic_l_(max_harmonic_l) {
+  std::string error{"Error in constructor of SphericalHarmonicPNMoments, "};
+  AssertThrow(quadrature_set_ptr_ != nullptr,
+              dealii::ExcMessage(error + "quadrature set pointer is null"))
+  AssertThrow(max_harmonic_l_ >= 0,
+              dealii::ExcMessage(error + "maximum harmonic degree must be "
+                                         ">= 0"))
+
+  const QuadratureSetView<dim> quadrature_set_view(*quadrature_set_ptr_);
+  const int n_moments = (max_harmonic_l_ + 1) * (max_harmonic_l_ + 1);
+  discrete_to_moment_.reinit(n_moments, quadrature_set_view.size());
+
+  for (int angle = 0; angle < quadrature_set_view.size(); ++angle) {
+    const double weight = quadrature_set_view.weight(angle);
+    const auto position = quadrature_set_view.cartesian_position(angle);
+    for (int l = 0; l <= max_harmonic_l_; ++l) {
+      for (int m = -l; m <= l; ++m) {
+        discrete_to_moment_(l * l + l + m, angle) =
+            weight * utility::RealSphericalHarmonic<dim>(l, m, position);
+      }
+    }
+  }
+}
+
+template <int dim>
+system::moments::MomentVector SphericalHarmonicPNMoments<dim>::CalculateMoment(
+    system::solution::MPIGroupAngularSolutionI* solution,
+    system::GroupNumber,
+    system::moments::HarmonicL harmonic_l,
+    system::moments::HarmonicL harmonic_m) const {
+  AssertThrow(harmonic_l >= 0 && harmonic_l <= max_harmonic_l_ &&
+              std::abs(harmonic_m) <= harmonic_l,
+              dealii::ExcMessage("Error in SphericalHarmonicPNMoments, "
+                                 "requested moment is not calculated"))
+  const int row = harmonic_l * harmonic_l + harmonic_l + harmonic_m;
+  return std::move(CalculateMomentRows(solution, {row}).front());
+}
+
+template <int dim>
+system::moments::MomentsMap SphericalHarmonicPNMoments<dim>::CalculateMoments(
+    system::solution::MPIGroupAngularSolutionI* solution,
+    system::GroupNumber group,
+    system::moments::HarmonicL max_harmonic_l) const {
+  AssertThrow(max_harmonic_l >= 0 && max_harmonic_l <= max_harmonic_l_,
+              dealii::ExcMessage("Error in SphericalHarmonicPNMoments, "
+                                 "requested moments are not calculated"))
+  std::vector<int> rows((max_harmonic_l + 1) * (max_harmonic_l + 1));
+  std::iota(rows.begin(), rows.end(), 0);
+  auto moments = CalculateMomentRows(solution, rows);
+
+  system::moments::MomentsMap return_map;
+  for (int l = 0; l <= max_harmonic_l; ++l) {
+    for (int m = -l; m <= l; ++m)
+      return_map[{group, l, m}] = std::move(moments.at(l * l + l + m));
+  }
+  return return_map;
+}
+
+template <int dim>
+std::vector<system::moments::MomentVector>
+SphericalHarmonicPNMoments<dim>::CalculateMomentRows(
+    system::solution::MPIGroupAngularSolutionI* solution,
+    const std::vector<int>& rows) const {
+  const int total_angles = solution->total_angles();
+  AssertThrow(static_cast<int>(discrete_to_moment_.n_cols()) == total_angles,
+              dealii::ExcMessage("Error: angular quadrature set and solution "
+                                 "must have the same number of angles."))
+  const int n_rows = rows.size();
+
+  const auto& first_solution = solution->GetSolution(0);
+  std::vector<system::moments::MomentVector> moments(n_rows);
+  for (auto& moment : moments)
+    moment.reinit(first_solution);
+
+  const auto [first_entry, last_entry] = first_solution.local_range();
+  const int n_local_entries = last_entry - first_entry;
+  const int block_size = std::min(kBlockSize, n_local_entries);
+  std::vector<dealii::types::global_dof_index> indices(block_size);
+  std::vector<double> angular_block(block_size);
+  std::vector<double> moment_block(n_rows * block_size);
+
+  for (int block_start = 0; block_start < n_local_entries;
+       block_start += block_size) {
+    const int n_entries = std::min(block_size, n_local_entries - block_start);
+    indices.resize(n_entries);
+    std::iota(indices.begin(), indices.end(), first_entry + block_start);
+    std::fill(moment_block.begin(), moment_block.end(), 0);
+
+    // Each angular solution is read once, and added to all moments
+    for (int angle = 0; angle < total_angles; ++angle) {
+      solution->GetSolution(angle).extract_subvector_to(
+          indices.begin(), indices.end(), angular_block.begin());
+      for (int row = 0; row < n_rows; ++row) {
+        const double coefficient = discrete_to_moment_(rows[row], angle);
+        if (coefficient == 0)
+          continue;
+        double* moment_values = moment_block.data() + row * block_size;
+        for (int i = 0; i < n_entries; ++i)
+          moment_values[i] += coefficient * angular_block[i];
+      }
+    }
+
+    for (int row = 0; row < n_rows; ++row) {
+      const auto moment_values = moment_block.cbegin() + row * block_size;
+      moments[row].set(indices, std::vector<double>(moment_values,
+                                                    moment_values + n_entries));
+    }
+  }
+
+  for (auto& moment : moments)
+    moment.compress(dealii::VectorOperation::insert);
+
+  return moments;
+}
+
+template class SphericalHarmonicPNMoments<1>;
+template class SphericalHarmonicPNMoments<2>;
+template class SphericalHarmonicPNMoments<3>;
+
+} // namespace calculators
+
+} // namespace quadrature
+
+} // namespace bart
@@ -0,0 +1,83 @@
+#ifndef BART_SRC_QUADRATURE_CALCULATORS_SPHERICAL_HARMONIC_PN_MOMENTS_H_
+#define BART_SRC_QUADRATURE_CALCULATORS_SPHERICAL_HARMONIC_PN_MOMENTS_H_
+
+#include <vector>
+
+#include <deal.II/lac/full_matrix.h>
+
+#include "quadrature/calculators/spherical_harmonic_moments.h"
+
+namespace bart {
+
+namespace quadrature {
+
+namespace calculators {
+
+/*! \brief Calculates spherical harmonic moments up to a maximum degree.
+ *
+ * The discrete-to-moment matrix \f$\mathbf{D}\f$, with one row per moment and
+ * one column per angle,
+ * \f[
+ * \mathbf{D}_{k, n} = w_nY_{\ell}^{m}(\hat{\Omega}_n), \quad
+ * k = \ell^2 + \ell + m,
+ * \f]
+ * is calculated once during construction (see
+ * quadrature::utility::RealSphericalHarmonic). Moments are then the product
+ * \f$\Phi = \mathbf{D}\Psi\f$ with the angular solutions. CalculateMoments
+ * forms the product for all moments in a single pass over the angular
+ * solutions, the locally owned entries are processed in blocks so that the
+ * block of all moments stays in cache while each angle is added.
+ *
+ * @tparam dim spatial dimension
+ */
+template <int dim>
+class SphericalHarmonicPNMoments : public SphericalHarmonicMoments<dim> {
+ public:
+  /*! \brief Constructor.
+   *
+   * @param quadrature_set_ptr angular quadrature set, must not be null
+   * @param max_harmonic_l maximum degree \f$\ell\f$ of calculated moments
+   */
+  SphericalHarmonicPNMoments(
+      std::shared_ptr<QuadratureSetI<dim>> quadrature_set_ptr,
+      const system::moments::HarmonicL max_harmonic_l);
+  virtual ~SphericalHarmonicPNMoments() = default;
+
+  system::moments::MomentVector CalculateMoment(
+      system::solution::MPIGroupAngularSolutionI* solution,
+      system::GroupNumber group,
+      system::moments::HarmonicL harmonic_l,
+      system::moments::HarmonicL harmonic_m) const override;
+
+  system::moments::MomentsMap CalculateMoments(
+      system::solution::MPIGroupAngularSolutionI* solution,
+      system::GroupNumber group,
+      system::moments::HarmonicL max_harmonic_l) const override;
+
+  system::moments::HarmonicL max_harmonic_l() const { return max_harmonic_l_; }
+  /*! \brief Returns the discrete-to-moment matrix. */
+  const dealii::FullMatrix<double>& discrete_to_moment() const {
+    return discrete_to_moment_; }
+
+ protected:
+  using SphericalHarmonicMoments<dim>::quadrature_set_ptr_;
+
+ private:
+  //! Calculates the moments for the given rows of the discrete-to-moment matrix
+  std::vector<system::moments::MomentVector> CalculateMomentRows(
+      system::solution::MPIGroupAngularSolutionI* solution,
+      const std::vector<int>& rows) const;
+
+  const system::moments::HarmonicL max_harmonic_l_;
+  dealii::FullMatrix<double> discrete_to_moment_;
+  //! Number of locally owned entries processed together
+  static constexpr int kBlockSize = 512;
+};
+
+} // namespace calculators
+
+} // namespace quadrature
+
+} // namespace bart
+
+#endif //BART_SRC_QUADRATURE_CALCULATORS_SPHERICAL_HARMONIC_PN_MOMENTS_H_
@@ -7,6 +7,26 @@ namespace quadrature {
 
 namespace calculators {
 
+namespace {
+
+template <int dim>
+const QuadratureSetI<dim>& ValidatedQuadratureSet(
+    const std::shared_ptr<QuadratureSetI<dim>>& quadrature_set_ptr) {
+  AssertThrow(quadrature_set_ptr != nullptr,
+              dealii::ExcMessage("Error in constructor of "
+                                 "SphericalHarmonicZerothMoment, quadrature "
+                                 "set pointer is null"))
+  return *quadrature_set_ptr;
+}
+
+} // namespace
+
+template <int dim>
+SphericalHarmonicZerothMoment<dim>::SphericalHarmonicZerothMoment(
+    std::shared_ptr<QuadratureSetI<dim>> quadrature_set_ptr)
+    : SphericalHarmonicMoments<dim>(quadrature_set_ptr),
+      quadrature_set_view_(ValidatedQuadratureSet(quadrature_set_ptr)) {}
+
 template<int dim>
 system::moments::MomentVector SphericalHarmonicZerothMoment<dim>::CalculateMoment(
     system::solution::MPIGroupAngularSolutionI* solution,
@@ -18,7 +38,7 @@ system::moments::MomentVector SphericalHarmonicZerothMoment<dim>::CalculateMomen
   // number of angles.
 
   const int total_angles = solution->total_angles();
-  const int quadrature_size = this->quadrature_set_ptr_->size();
+  const int quadrature_size = quadrature_set_view_.size();
 
   AssertThrow(quadrature_size == total_angles,
       dealii::ExcMessage("Error: angular quadrature set and solution must "
@@ -26,21 +46,15 @@ system::moments::MomentVector SphericalHarmonicZerothMoment<dim>::CalculateMomen
 
   system::moments::MomentVector return_vector;
 
-  for (auto quadrature_point_ptr : *quadrature_set_ptr_) {
-    const int angle_index =
-        quadrature_set_ptr_->GetQuadraturePointIndex(quadrature_point_ptr);
-    auto mpi_solution = solution->GetSolution(angle_index);
-
-    system::moments::MomentVector angle_vector(mpi_solution);
-    const double quadrature_point_weight = quadrature_point_ptr->weight();
+  for (int angle_index = 0; angle_index < quadrature_size; ++angle_index) {
+    const auto& mpi_solution = solution->GetSolution(angle_index);
 
     if (return_vector.size() == 0) {
-      return_vector.reinit(angle_vector);
+      return_vector.reinit(mpi_solution);
       return_vector = 0.0;
     }
 
-    return_vector.add(quadrature_point_weight, angle_vector);
-
+    return_vector.add(quadrature_set_view_.weight(angle_index), mpi_solution);
   }
 
   return return_vector;
@@ -2,6 +2,7 @@
 #define BART_SRC_QUADRATURE_CALCULATORS_SPHERICAL_HARMONIC_ZEROTH_MOMENT
 
 #include "quadrature/calculators/spherical_harmonic_moments.h"
+#include "quadrature/quadrature_set_view.h"
 
 namespace bart {
 
@@ -9,12 +10,18 @@ namespace quadrature {
 
 namespace calculators {
 
+/*! \brief Calculates the scalar flux as the weighted sum of angular fluxes.
+ *
+ * The quadrature weights are copied into a flat view of the quadrature set on
+ * construction, the quadrature set must therefore be complete.
+ *
+ * @tparam dim spatial dimension
+ */
 template <int dim>
 class SphericalHarmonicZerothMoment : public SphericalHarmonicMoments<dim> {
  public:
   SphericalHarmonicZerothMoment(
-      std::shared_ptr<QuadratureSetI<dim>> quadrature_set_ptr)
-      : SphericalHarmonicMoments<dim>(quadrature_set_ptr) {}
+      std::shared_ptr<QuadratureSetI<dim>> quadrature_set_ptr);
 
   system::moments::MomentVector CalculateMoment(
       system::solution::MPIGroupAngularSolutionI* solution,
@@ -24,8 +31,13 @@ class SphericalHarmonicZerothMoment : public SphericalHarmonicMoments<dim> {
 
   virtual ~SphericalHarmonicZerothMoment() = default;
 
+  const QuadratureSetView<dim>& quadrature_set_view() const {
+    return quadrature_set_view_; }
+
  protected:
   using SphericalHarmonicMoments<dim>::quadrature_set_ptr_;
+  //! Flat view of the quadrature set
+  const QuadratureSetView<dim> quadrature_set_view_;
 };
 
 } // namespace calculators
@@ -0,0 +1,76 @@
+#include "quadrature/calculators/accumulated_zeroth_moment.h"
+
+#include <deal.II/base/mpi.h>
+#include <deal.II/lac/petsc_vector.h>
+
+#include "system/system_types.h"
+#include "system/solution/mpi_group_moment_accumulator.h"
+#include "system/solution/tests/mpi_group_angular_solution_mock.h"
+#include "test_helpers/gmock_wrapper.h"
+
+namespace {
+
+using namespace bart;
+
+/* Tests for the quadrature::calculators::AccumulatedZerothMoment class.
+ *
+ * Test initial conditions: a moment accumulator with two angles of weights
+ * 1.5 and 2.5. Each angle has been solved with a solution equal to 10, so the
+ * accumulated scalar flux is 40.
+ */
+class QuadratureCalculatorsAccumulatedZerothMomentTest : public ::testing::Test {
+ protected:
+  QuadratureCalculatorsAccumulatedZerothMomentTest()
+      : accumulator_({1.5, 2.5}) {}
+
+  // Supporting objects
+  system::solution::MPIGroupMomentAccumulator accumulator_;
+
+  // Test parameters
+  const int n_processes = dealii::Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD);
+  const int n_entries_per_proc = 10;
+  const double expected_result = 40.0;
+
+  void SetUp() override;
+};
+
+void QuadratureCalculatorsAccumulatedZerothMomentTest::SetUp() {
+  auto& scratch = accumulator_.GetSolution(0);
+  scratch.reinit(MPI_COMM_WORLD, n_processes * n_entries_per_proc,
+                 n_entries_per_proc);
+  for (int angle = 0; angle < accumulator_.total_angles(); ++angle) {
+    scratch = 10.0;
+    accumulator_.AngleSolved(angle);
+  }
+}
+
+TEST_F(QuadratureCalculatorsAccumulatedZerothMomentTest, CalculateMoment) {
+  quadrature::calculators::AccumulatedZerothMoment test_calculator;
+
+  const int result_size = this->n_entries_per_proc*this->n_processes;
+  system::moments::MomentVector expected_vector(MPI_COMM_WORLD, result_size,
+                                                this->n_entries_per_proc);
+  expected_vector = expected_result;
+
+  auto result = test_calculator.CalculateMoment(&accumulator_, 0, 0, 0);
+  ASSERT_NE(result.size(), 0);
+  EXPECT_EQ(result, expected_vector);
+}
+
+// Higher moments are not accumulated
+TEST_F(QuadratureCalculatorsAccumulatedZerothMomentTest, HigherMomentThrows) {
+  quadrature::calculators::AccumulatedZerothMoment test_calculator;
+
+  EXPECT_ANY_THROW(test_calculator.CalculateMoment(&accumulator_, 0, 1, 0));
+  EXPECT_ANY_THROW(test_calculator.CalculateMoment(&accumulator_, 0, 1, -1));
+}
+
+// Solutions that store angular fluxes cannot be used
+TEST_F(QuadratureCalculatorsAccumulatedZerothMomentTest, BadSolutionType) {
+  quadrature::calculators::AccumulatedZerothMoment test_calculator;
+  system::solution::MPIGroupAngularSolutionMock mock_solution;
+
+  EXPECT_ANY_THROW(test_calculator.CalculateMoment(&mock_solution, 0, 0, 0));
+}
+
+} // namespace
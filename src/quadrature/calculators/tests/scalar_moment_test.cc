@@ -66,7 +66,8 @@ TEST_F(QuadratureCalculatorsScalarMomentTest, CalculateMoment) {
       .WillOnce(ReturnRef(mpi_vector_));
 
   const int result_size = this->n_entries_per_proc*this->n_processes;
-  system::moments::MomentVector expected_vector(result_size);
+  system::moments::MomentVector expected_vector(MPI_COMM_WORLD, result_size,
+                                                this->n_entries_per_proc);
   expected_vector = expected_result;
 
   auto result = test_calculator.CalculateMoment(&mock_solution_, 0, 0, 0);
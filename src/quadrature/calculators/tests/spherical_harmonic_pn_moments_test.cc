@@ -0,0 +1,150 @@
+#include "quadrature/calculators/spherical_harmonic_pn_moments.h"
+
+#include <cmath>
+#include <memory>
+
+#include <deal.II/base/mpi.h>
+#include <deal.II/lac/petsc_vector.h>
+
+#include "quadrature/factory/quadrature_factories.h"
+#include "quadrature/utility/quadrature_utilities.h"
+#include "system/solution/mpi_group_angular_solution.h"
+#include "test_helpers/gmock_wrapper.h"
+
+namespace {
+
+using namespace bart;
+
+/* Tests for the SphericalHarmonicPNMoments class.
+ *
+ * Test initial conditions: the quadrature set holds a single direction with
+ * weight 1.5 and its reflection across the origin. The angular solution for
+ * angle n is equal to 10^n. The calculator is built with max degree 2.
+ */
+template <typename DimensionWrapper>
+class QuadCalcSphericalHarmonicPNMomentsTest : public ::testing::Test {
+ protected:
+  static constexpr int dim = DimensionWrapper::value;
+  using MomentCalculatorType =
+      quadrature::calculators::SphericalHarmonicPNMoments<dim>;
+
+  QuadCalcSphericalHarmonicPNMomentsTest() : solution_(2) {}
+
+  // Pointer to tested object
+  std::unique_ptr<MomentCalculatorType> test_calculator;
+
+  // Supporting objects
+  std::shared_ptr<quadrature::QuadratureSetI<dim>> quadrature_set_ptr_;
+  system::solution::MPIGroupAngularSolution solution_;
+
+  // Test parameters
+  const int max_harmonic_l = 2;
+  const int n_processes = dealii::Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD);
+  const int n_entries_per_proc = 10;
+
+  void SetUp() override;
+  //! Expected moment calculated directly from the quadrature set
+  double ExpectedMoment(const int l, const int m) const;
+};
+
+template <typename DimensionWrapper>
+void QuadCalcSphericalHarmonicPNMomentsTest<DimensionWrapper>::SetUp() {
+  const std::array<double, 3> direction{0.48, 0.6, 0.64};
+  std::array<double, dim> position;
+  for (int i = 0; i < dim; ++i)
+    position.at(i) = direction.at(i);
+
+  quadrature_set_ptr_ = quadrature::factory::MakeQuadratureSetPtr<dim>();
+  quadrature::factory::FillQuadratureSet<dim>(
+      quadrature_set_ptr_.get(),
+      {{quadrature::CartesianPosition<dim>(position), quadrature::Weight(1.5)}});
+
+  test_calculator = std::make_unique<MomentCalculatorType>(quadrature_set_ptr_,
+                                                           max_harmonic_l);
+
+  for (int angle = 0; angle < 2; ++angle) {
+    auto& mpi_vector = solution_.GetSolution(angle);
+    mpi_vector.reinit(MPI_COMM_WORLD, n_processes * n_entries_per_proc,
+                      n_entries_per_proc);
+    mpi_vector = std::pow(10, angle);
+  }
+}
+
+template <typename DimensionWrapper>
+double QuadCalcSphericalHarmonicPNMomentsTest<DimensionWrapper>::ExpectedMoment(
+    const int l, const int m) const {
+  double moment = 0;
+  for (const auto& quadrature_point_ptr : *quadrature_set_ptr_) {
+    const int angle =
+        quadrature_set_ptr_->GetQuadraturePointIndex(quadrature_point_ptr);
+    moment += quadrature_point_ptr->weight() * std::pow(10, angle) *
+        quadrature::utility::RealSphericalHarmonic<dim>(
+            l, m, quadrature_point_ptr->cartesian_position());
+  }
+  return moment;
+}
+
+TYPED_TEST_CASE(QuadCalcSphericalHarmonicPNMomentsTest,
+                bart::testing::AllDimensions);
+
+TYPED_TEST(QuadCalcSphericalHarmonicPNMomentsTest, Constructor) {
+  constexpr int dim = this->dim;
+  using MomentCalculatorType =
+      quadrature::calculators::SphericalHarmonicPNMoments<dim>;
+
+  EXPECT_NE(this->test_calculator->quadrature_set_ptr(), nullptr);
+  EXPECT_EQ(this->test_calculator->max_harmonic_l(), this->max_harmonic_l);
+  const auto& discrete_to_moment = this->test_calculator->discrete_to_moment();
+  ASSERT_EQ(discrete_to_moment.m(), 9);
+  ASSERT_EQ(discrete_to_moment.n(), 2);
+  // Zeroth moment row holds the weights
+  EXPECT_DOUBLE_EQ(discrete_to_moment(0, 0), 1.5);
+  EXPECT_DOUBLE_EQ(discrete_to_moment(0, 1), 1.5);
+
+  EXPECT_ANY_THROW(MomentCalculatorType(nullptr, 1));
+  EXPECT_ANY_THROW(MomentCalculatorType(this->quadrature_set_ptr_, -1));
+}
+
+// All moments should be calculated together and match the quadrature sum
+TYPED_TEST(QuadCalcSphericalHarmonicPNMomentsTest, CalculateMoments) {
+  const int group = 1;
+  auto moments = this->test_calculator->CalculateMoments(&this->solution_,
+                                                         group, 2);
+  ASSERT_EQ(moments.size(), 9);
+
+  for (int l = 0; l <= 2; ++l) {
+    for (int m = -l; m <= l; ++m) {
+      const double expected_value = this->ExpectedMoment(l, m);
+      const auto& moment = moments.at({group, l, m});
+      ASSERT_EQ(moment.size(), this->n_processes * this->n_entries_per_proc);
+      auto [first_row, last_row] = moment.local_range();
+      for (unsigned int i = first_row; i < last_row; ++i) {
+        EXPECT_NEAR(moment[i], expected_value, 1e-12)
+            << "l = " << l << ", m = " << m;
+      }
+
+      // Single moments match
+      const auto single_moment = this->test_calculator->CalculateMoment(
+          &this->solution_, group, l, m);
+      EXPECT_EQ(single_moment, moment);
+    }
+  }
+
+  // Lower degrees only return the requested moments
+  EXPECT_EQ(this->test_calculator->CalculateMoments(&this->solution_, group,
+                                                    1).size(), 4);
+}
+
+TYPED_TEST(QuadCalcSphericalHarmonicPNMomentsTest, CalculateBadMoments) {
+  auto& test_calculator = this->test_calculator;
+  auto solution_ptr = &this->solution_;
+
+  EXPECT_ANY_THROW(test_calculator->CalculateMoment(solution_ptr, 0, 3, 0));
+  EXPECT_ANY_THROW(test_calculator->CalculateMoment(solution_ptr, 0, 1, 2));
+  EXPECT_ANY_THROW(test_calculator->CalculateMoments(solution_ptr, 0, 3));
+
+  system::solution::MPIGroupAngularSolution bad_solution(3);
+  EXPECT_ANY_THROW(test_calculator->CalculateMoments(&bad_solution, 0, 2));
+}
+
+} // namespace
@@ -1,13 +1,13 @@
 #include "quadrature/calculators/spherical_harmonic_zeroth_moment.h"
 
 #include <memory>
+#include <set>
 
 #include <deal.II/base/mpi.h>
 #include <deal.II/lac/petsc_vector.h>
 
 #include "system/system_types.h"
 #include "system/moments/spherical_harmonic_types.h"
-#include "quadrature/utility/quadrature_utilities.h"
 #include "quadrature/tests/quadrature_set_mock.h"
 #include "quadrature/tests/quadrature_point_mock.h"
 #include "system/solution/tests/mpi_group_angular_solution_mock.h"
@@ -17,7 +17,7 @@ namespace {
 
 using namespace bart;
 
-using ::testing::Ref, ::testing::Return, ::testing::ReturnRef;
+using ::testing::Ref, ::testing::Return, ::testing::ReturnRef, ::testing::_;
 
 void SetVector(system::MPIVector& to_set, double value) {
   auto [first_row, last_row] = to_set.local_range();
@@ -29,9 +29,10 @@ void SetVector(system::MPIVector& to_set, double value) {
 /* Tests for the SphericalHarmonicMomentsZerothMoment class. Mock quadrature set
  * is required.
  *
- * Test initial conditions: test object is constructed with mock quadrature set,
- * observation pointer is provided to set call expectations. Three mpi vectors
- * are provided with values 1, 10, and 100.
+ * Test initial conditions: mock quadrature set holds three mock points with
+ * weights given by 2.2 + i*1.1 where i is the index of the point. The test
+ * object is constructed with the mock quadrature set, which copies the weights
+ * into its view. Three mpi vectors are provided with values 1, 10, and 100.
  */
 template <typename DimensionWrapper>
 class QuadCalcSphericalHarmonicMomentsOnlyScalar : public ::testing::Test {
@@ -39,6 +40,7 @@ class QuadCalcSphericalHarmonicMomentsOnlyScalar : public ::testing::Test {
   static constexpr int dim = DimensionWrapper::value;
   // Aliases
   using QuadratureSetType = quadrature::QuadratureSetMock<dim>;
+  using QuadraturePointType = quadrature::QuadraturePointMock<dim>;
   using MomentCalculatorType = quadrature::calculators::SphericalHarmonicZerothMoment<dim>;
 
   // Pointer to tested object
@@ -47,14 +49,13 @@ class QuadCalcSphericalHarmonicMomentsOnlyScalar : public ::testing::Test {
   // Supporting objects
   system::solution::MPIGroupAngularSolutionMock mock_solution_;
   std::array<system::MPIVector, 3> mpi_vectors_;
+  std::array<std::shared_ptr<QuadraturePointType>, 3> mock_quadrature_points_;
 
   // Test object dependency
   std::shared_ptr<QuadratureSetType> mock_quadrature_set_ptr_;
 
-  // Observing pointers
-  QuadratureSetType* quadrature_set_obs_ptr_;
-
   // Test parameters
+  const int n_angles = 3;
   const int n_processes = dealii::Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD);
   const int n_entries_per_proc = 10;
 
@@ -65,16 +66,29 @@ template <typename DimensionWrapper>
 void QuadCalcSphericalHarmonicMomentsOnlyScalar<DimensionWrapper>::SetUp() {
 
   // Instantiate mock objects
-  mock_quadrature_set_ptr_ = std::make_shared<QuadratureSetType>();
+  mock_quadrature_set_ptr_ =
+      std::make_shared<::testing::NiceMock<QuadratureSetType>>();
+
+  std::set<int> quadrature_point_indices;
+  for (int angle = 0; angle < n_angles; ++angle) {
+    auto& mock_quadrature_point = mock_quadrature_points_.at(angle);
+    mock_quadrature_point =
+        std::make_shared<::testing::NiceMock<QuadraturePointType>>();
+    // The weight should be retrieved only once, when the view is built
+    EXPECT_CALL(*mock_quadrature_point, weight())
+        .WillOnce(Return(2.2 + angle*1.1));
+    ON_CALL(*mock_quadrature_set_ptr_,
+            GetQuadraturePoint(quadrature::QuadraturePointIndex(angle)))
+        .WillByDefault(Return(mock_quadrature_point));
+    quadrature_point_indices.insert(angle);
+  }
+  ON_CALL(*mock_quadrature_set_ptr_, quadrature_point_indices())
+      .WillByDefault(Return(quadrature_point_indices));
 
   // Instantiate object to be tested
   test_calculator = std::make_unique<MomentCalculatorType>(
       mock_quadrature_set_ptr_);
 
-  // Set up observation pointers
-  quadrature_set_obs_ptr_ = dynamic_cast<QuadratureSetType*>(
-      test_calculator->quadrature_set_ptr());
-
   for (auto& mpi_vector : mpi_vectors_) {
     mpi_vector.reinit(MPI_COMM_WORLD,
                       n_processes * n_entries_per_proc,
@@ -89,89 +103,63 @@ void QuadCalcSphericalHarmonicMomentsOnlyScalar<DimensionWrapper>::SetUp() {
 TYPED_TEST_CASE(QuadCalcSphericalHarmonicMomentsOnlyScalar,
                 bart::testing::AllDimensions);
 
-// Constructor should have set quadrature_set_ptr properly.
+// Constructor should have set quadrature_set_ptr and the view properly.
 TYPED_TEST(QuadCalcSphericalHarmonicMomentsOnlyScalar, Constructor) {
 
   auto quadrature_set_ptr = this->test_calculator->quadrature_set_ptr();
   ASSERT_NE(nullptr, quadrature_set_ptr);
+
+  const auto& quadrature_set_view = this->test_calculator->quadrature_set_view();
+  ASSERT_EQ(quadrature_set_view.size(), this->n_angles);
+  for (int angle = 0; angle < this->n_angles; ++angle)
+    EXPECT_DOUBLE_EQ(quadrature_set_view.weight(angle), 2.2 + angle*1.1);
+}
+
+// Constructor should throw if the quadrature set pointer is null.
+TYPED_TEST(QuadCalcSphericalHarmonicMomentsOnlyScalar, ConstructorNullSet) {
+  using MomentCalculatorType = typename TestFixture::MomentCalculatorType;
+  EXPECT_ANY_THROW({ MomentCalculatorType test_calculator(nullptr); });
 }
 
 /* An error should be thrown if there is a mismatch between the total angles
  * reported by the solution and the size of the quadrature set */
 TYPED_TEST(QuadCalcSphericalHarmonicMomentsOnlyScalar, CalculateBadAngleNumber) {
-  auto& quadrature_set_mock = *this->quadrature_set_obs_ptr_;
   auto& test_calculator = this->test_calculator;
   auto mock_solution_ptr = &this->mock_solution_;
 
-  EXPECT_CALL(quadrature_set_mock, size())
-      .WillOnce(Return(4));
   EXPECT_CALL(*mock_solution_ptr, total_angles())
-      .WillOnce(Return(3));
+      .WillOnce(Return(4));
   EXPECT_ANY_THROW(test_calculator->CalculateMoment(mock_solution_ptr, 0, 0, 0));
 }
 
 /* Moments should be calculated properly.
  *
- * To accomplish this test we will fill a set with mock points with weights
- * given by 2.2 + i*1.1 where i is an index value. These index values will
- * identify one of the mpi_vectors provided by the test, which are equal to 1,
- * 10, and 100, sequentiall. Therefore we expect the final moment to be equal to
- * 2.2 + 3.3*10 + 4.4*100
+ * The solution for each angle is identified by angle index, these identify one
+ * of the mpi_vectors provided by the test, which are equal to 1, 10, and 100,
+ * sequentially. Therefore we expect the final moment to be equal to
+ * 2.2 + 3.3*10 + 4.4*100. The quadrature set itself should not be accessed.
  */
 TYPED_TEST(QuadCalcSphericalHarmonicMomentsOnlyScalar, CalculateMomentsMPI) {
-  auto& quadrature_set_mock = *this->quadrature_set_obs_ptr_;
+  auto& quadrature_set_mock = *this->mock_quadrature_set_ptr_;
   auto& test_calculator = this->test_calculator;
   auto mock_solution_ptr = &this->mock_solution_;
-  constexpr int dim = this->dim;
 
-  const int n_angles = 3;
   const int group = 0;
 
-  EXPECT_CALL(quadrature_set_mock, size())
-      .WillOnce(Return(n_angles));
   EXPECT_CALL(*mock_solution_ptr, total_angles())
-      .WillOnce(Return(n_angles));
-
-  std::set<std::shared_ptr<quadrature::QuadraturePointI<dim>>,
-           quadrature::utility::quadrature_point_compare<dim>>
-      mock_quadrature_point_set;
+      .WillOnce(Return(this->n_angles));
+  EXPECT_CALL(quadrature_set_mock, GetQuadraturePointIndex(_)).Times(0);
+  EXPECT_CALL(quadrature_set_mock, size()).Times(0);
 
-  for (int angle = 0; angle < n_angles; ++angle) {
-    // Solutions are identified by angle index, so we expect a request for
-    // the solution for each angle to be called.
+  for (int angle = 0; angle < this->n_angles; ++angle) {
     EXPECT_CALL(*mock_solution_ptr, GetSolution(angle))
         .WillOnce(ReturnRef(this->mpi_vectors_[angle]));
-
-    // We make our mock quadrature point and set the weight and position
-    auto mock_quadrature_point =
-        std::make_shared<::testing::NiceMock<quadrature::QuadraturePointMock<dim>>>();
-    EXPECT_CALL(*mock_quadrature_point, weight())
-        .WillOnce(Return(2.2 + angle*1.1));
-    // Position is only added for ordering in the set, value doesn't matter as
-    // long as each processor orders them equally (by position)
-    std::array<double, dim> position;
-    position.fill(angle*1.1);
-    ON_CALL(*mock_quadrature_point, cartesian_position())
-        .WillByDefault(Return(position));
-
-    // Insert into our mock set, get an insert pair that includes an interator
-    // to the newly inserted object
-    auto insert_pair = mock_quadrature_point_set.insert(mock_quadrature_point);
-
-    // We expect the function to retrieve the index of the point. This is what
-    // links THIS point to the correct solution.
-    EXPECT_CALL(quadrature_set_mock,
-        GetQuadraturePointIndex(*insert_pair.first))
-        .WillOnce(Return(angle));
   }
 
-  EXPECT_CALL(quadrature_set_mock, begin())
-      .WillOnce(Return(mock_quadrature_point_set.begin()));
-  EXPECT_CALL(quadrature_set_mock, end())
-      .WillOnce(Return(mock_quadrature_point_set.end()));
-
   system::moments::MomentVector expected_result(
-      this->n_entries_per_proc*this->n_processes);
+      MPI_COMM_WORLD,
+      this->n_entries_per_proc*this->n_processes,
+      this->n_entries_per_proc);
 
   expected_result = 4.4*100 + 3.3*10 + 2.2;
 
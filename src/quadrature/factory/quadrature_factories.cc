@@ -4,8 +4,13 @@
 #include "quadrature/ordinate.h"
 #include "quadrature/quadrature_point.h"
 #include "quadrature/quadrature_set.h"
+#include "quadrature/angular/gauss_legendre.h"
+#include "quadrature/angular/gauss_legendre_chebyshev.h"
 #include "quadrature/angular/level_symmetric_gaussian.h"
+#include "quadrature/angular/xy_projection.h"
+#include "quadrature/calculators/accumulated_zeroth_moment.h"
 #include "quadrature/calculators/scalar_moment.h"
+#include "quadrature/calculators/spherical_harmonic_pn_moments.h"
 #include "quadrature/calculators/spherical_harmonic_zeroth_moment.h"
 #include "quadrature/utility/quadrature_utilities.h"
 
@@ -43,11 +48,17 @@ std::shared_ptr<QuadraturePointI<dim>> MakeQuadraturePointPtr(
 template <>
 std::shared_ptr<QuadratureGeneratorI<3>> MakeAngularQuadratureGeneratorPtr(
     const Order order,
-    const AngularQuadratureSetType type) {
+    const AngularQuadratureSetType type,
+    const Order azimuthal_order) {
   std::shared_ptr<QuadratureGeneratorI<3>> generator_ptr = nullptr;
 
   if (type == AngularQuadratureSetType::kLevelSymmetricGaussian) {
     generator_ptr = std::make_shared<angular::LevelSymmetricGaussian>(order);
+  } else if (type == AngularQuadratureSetType::kProductGaussLegendreChebyshev) {
+    const Order product_azimuthal_order = azimuthal_order.get() == 0 ?
+        Order(2 * order.get()) : azimuthal_order;
+    generator_ptr = std::make_shared<angular::GaussLegendreChebyshev>(
+        order, product_azimuthal_order);
   } else {
     AssertThrow(false, dealii::ExcMessage(unsupported_quadrature_error));
   }
@@ -55,15 +66,34 @@ std::shared_ptr<QuadratureGeneratorI<3>> MakeAngularQuadratureGeneratorPtr(
   return generator_ptr;
 }
 
-template <int dim>
-std::shared_ptr<QuadratureGeneratorI<dim>> MakeAngularQuadratureGeneratorPtr(
-    const Order,
-    const AngularQuadratureSetType) {
-  std::shared_ptr<QuadratureGeneratorI<dim>> generator_ptr = nullptr;
-
-  AssertThrow(false, dealii::ExcMessage(unsupported_quadrature_error));
+/* In two dimensions the three-dimensional set of the same type is projected
+ * onto the xy-plane, folding the symmetry across the plane into the weights. */
+template <>
+std::shared_ptr<QuadratureGeneratorI<2>> MakeAngularQuadratureGeneratorPtr(
+    const Order order,
+    const AngularQuadratureSetType type,
+    const Order azimuthal_order) {
+  AssertThrow(type == AngularQuadratureSetType::kLevelSymmetricGaussian ||
+              type == AngularQuadratureSetType::kProductGaussLegendreChebyshev,
+              dealii::ExcMessage(unsupported_quadrature_error));
+
+  return std::make_shared<angular::XYProjection>(
+      MakeAngularQuadratureGeneratorPtr<3>(order, type, azimuthal_order));
+}
 
-  return generator_ptr;
+/* In one dimension the level-symmetric and product sets integrated over the
+ * azimuthal angle are both Gauss-Legendre in mu. */
+template <>
+std::shared_ptr<QuadratureGeneratorI<1>> MakeAngularQuadratureGeneratorPtr(
+    const Order order,
+    const AngularQuadratureSetType type,
+    const Order) {
+  AssertThrow(type == AngularQuadratureSetType::kGaussLegendre ||
+              type == AngularQuadratureSetType::kLevelSymmetricGaussian ||
+              type == AngularQuadratureSetType::kProductGaussLegendreChebyshev,
+              dealii::ExcMessage(unsupported_quadrature_error));
+
+  return std::make_shared<angular::GaussLegendre>(order);
 }
 
 template <int dim>
@@ -82,7 +112,8 @@ std::shared_ptr<QuadratureSetI<dim>> MakeQuadratureSetPtr(
 template<int dim>
 std::unique_ptr<calculators::SphericalHarmonicMomentsI> MakeMomentCalculator(
     const MomentCalculatorImpl impl,
-    std::shared_ptr<QuadratureSetI<dim>> quadrature_set_ptr) {
+    std::shared_ptr<QuadratureSetI<dim>> quadrature_set_ptr,
+    const int max_harmonic_l) {
 
   std::unique_ptr<calculators::SphericalHarmonicMomentsI> return_pointer =
       nullptr;
@@ -98,6 +129,17 @@ std::unique_ptr<calculators::SphericalHarmonicMomentsI> MakeMomentCalculator(
     return_pointer = std::move(
         std::make_unique<calculators::SphericalHarmonicZerothMoment<dim>>(
             quadrature_set_ptr));
+  } else if (impl == MomentCalculatorImpl::kAccumulatedZerothMoment) {
+    return_pointer = std::move(
+        std::make_unique<calculators::AccumulatedZerothMoment>());
+  } else if (impl == MomentCalculatorImpl::kSphericalHarmonicPN) {
+    AssertThrow(quadrature_set_ptr != nullptr,
+                dealii::ExcMessage("Error in factory building moment calculator, "
+                                   "implementation requires quadrature set but provided"
+                                   " set pointer is a nullptr"))
+    return_pointer = std::move(
+        std::make_unique<calculators::SphericalHarmonicPNMoments<dim>>(
+            quadrature_set_ptr, max_harmonic_l));
   }
 
   return std::move(return_pointer);
@@ -137,6 +179,37 @@ void FillQuadratureSet(
   }
 }
 
+template <int dim>
+void FillHalfRangeQuadratureSet(
+    QuadratureSetI<dim>* to_fill,
+    const std::vector<std::pair<quadrature::CartesianPosition<dim>, quadrature::Weight>>& point_vector) {
+
+  AssertThrow(to_fill->size() == 0,
+      dealii::ExcMessage("Error in FillHalfRangeQuadratureSet, set is not "
+                         "empty"));
+
+  for (const auto& [position, weight] : point_vector) {
+    auto ordinate_ptr = MakeOrdinatePtr<dim>();
+    ordinate_ptr->set_cartesian_position(position);
+
+    auto reflection_position = CartesianPosition<dim>(
+        utility::ReflectAcrossOrigin<dim>(*ordinate_ptr));
+    for (const auto& point_ptr : *to_fill) {
+      AssertThrow(point_ptr->cartesian_position() !=
+                  reflection_position.get(),
+                  dealii::ExcMessage("Error in FillHalfRangeQuadratureSet, "
+                                     "points include a point and its "
+                                     "reflection"));
+    }
+
+    // Each point also represents its reflection
+    auto quadrature_point_ptr = MakeQuadraturePointPtr<dim>();
+    quadrature_point_ptr->SetOrdinate(ordinate_ptr)
+        .SetWeight(quadrature::Weight(2.0 * weight.get()));
+
+    to_fill->AddPoint(quadrature_point_ptr);
+  }
+}
 
 template std::shared_ptr<OrdinateI<1>> MakeOrdinatePtr(const OrdinateType);
 template std::shared_ptr<OrdinateI<2>> MakeOrdinatePtr(const OrdinateType);
@@ -146,22 +219,26 @@ template std::shared_ptr<QuadraturePointI<1>> MakeQuadraturePointPtr(const Quadr
 template std::shared_ptr<QuadraturePointI<2>> MakeQuadraturePointPtr(const QuadraturePointImpl);
 template std::shared_ptr<QuadraturePointI<3>> MakeQuadraturePointPtr(const QuadraturePointImpl);
 
-template std::shared_ptr<QuadratureGeneratorI<1>> MakeAngularQuadratureGeneratorPtr(const Order, const AngularQuadratureSetType);
-template std::shared_ptr<QuadratureGeneratorI<2>> MakeAngularQuadratureGeneratorPtr(const Order, const AngularQuadratureSetType);
-template std::shared_ptr<QuadratureGeneratorI<3>> MakeAngularQuadratureGeneratorPtr(const Order, const AngularQuadratureSetType);
+template std::shared_ptr<QuadratureGeneratorI<1>> MakeAngularQuadratureGeneratorPtr(const Order, const AngularQuadratureSetType, const Order);
+template std::shared_ptr<QuadratureGeneratorI<2>> MakeAngularQuadratureGeneratorPtr(const Order, const AngularQuadratureSetType, const Order);
+template std::shared_ptr<QuadratureGeneratorI<3>> MakeAngularQuadratureGeneratorPtr(const Order, const AngularQuadratureSetType, const Order);
 
 template std::shared_ptr<QuadratureSetI<1>> MakeQuadratureSetPtr(const QuadratureSetImpl);
 template std::shared_ptr<QuadratureSetI<2>> MakeQuadratureSetPtr(const QuadratureSetImpl);
 template std::shared_ptr<QuadratureSetI<3>> MakeQuadratureSetPtr(const QuadratureSetImpl);
 
-template std::unique_ptr<calculators::SphericalHarmonicMomentsI> MakeMomentCalculator<1>(const MomentCalculatorImpl, std::shared_ptr<QuadratureSetI<1>>);
-template std::unique_ptr<calculators::SphericalHarmonicMomentsI> MakeMomentCalculator<2>(const MomentCalculatorImpl, std::shared_ptr<QuadratureSetI<2>>);
-template std::unique_ptr<calculators::SphericalHarmonicMomentsI> MakeMomentCalculator<3>(const MomentCalculatorImpl, std::shared_ptr<QuadratureSetI<3>>);
+template std::unique_ptr<calculators::SphericalHarmonicMomentsI> MakeMomentCalculator<1>(const MomentCalculatorImpl, std::shared_ptr<QuadratureSetI<1>>, const int);
+template std::unique_ptr<calculators::SphericalHarmonicMomentsI> MakeMomentCalculator<2>(const MomentCalculatorImpl, std::shared_ptr<QuadratureSetI<2>>, const int);
+template std::unique_ptr<calculators::SphericalHarmonicMomentsI> MakeMomentCalculator<3>(const MomentCalculatorImpl, std::shared_ptr<QuadratureSetI<3>>, const int);
 
 template void FillQuadratureSet<1>(QuadratureSetI<1>*, const std::vector<std::pair<quadrature::CartesianPosition<1>, quadrature::Weight>>&);
 template void FillQuadratureSet<2>(QuadratureSetI<2>*, const std::vector<std::pair<quadrature::CartesianPosition<2>, quadrature::Weight>>&);
 template void FillQuadratureSet<3>(QuadratureSetI<3>*, const std::vector<std::pair<quadrature::CartesianPosition<3>, quadrature::Weight>>&);
 
+template void FillHalfRangeQuadratureSet<1>(QuadratureSetI<1>*, const std::vector<std::pair<quadrature::CartesianPosition<1>, quadrature::Weight>>&);
+template void FillHalfRangeQuadratureSet<2>(QuadratureSetI<2>*, const std::vector<std::pair<quadrature::CartesianPosition<2>, quadrature::Weight>>&);
+template void FillHalfRangeQuadratureSet<3>(QuadratureSetI<3>*, const std::vector<std::pair<quadrature::CartesianPosition<3>, quadrature::Weight>>&);
+
 } // namespace factory
 
 } // namespace quadrature
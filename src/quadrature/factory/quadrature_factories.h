@@ -37,15 +37,22 @@ std::shared_ptr<QuadraturePointI<dim>> MakeQuadraturePointPtr(
     const QuadraturePointImpl impl = QuadraturePointImpl::kDefault);
 
 /*! \brief Factory for objects of type QuadratureGeneratorI.
+ *
+ * Two-dimensional generators project the three-dimensional set of the same
+ * type onto the xy-plane. In one dimension the level-symmetric and product
+ * types both give the Gauss-Legendre set in \f$\mu\f$.
  *
  * @tparam dim spatial dimension of the quadrature generator.
- * @param order quadrature order.
+ * @param order quadrature order, the polar order for product quadratures.
  * @param type type of quadrature generator to be created.
+ * @param azimuthal_order azimuthal order, only used by product quadratures. A
+ * value of 0 uses twice the polar order.
  * @return shared pointer to the quadrature generator.
  */
 template <int dim>
 std::shared_ptr<QuadratureGeneratorI<dim>> MakeAngularQuadratureGeneratorPtr(
-    const Order order, const AngularQuadratureSetType type);
+    const Order order, const AngularQuadratureSetType type,
+    const Order azimuthal_order = Order(0));
 
 /*! \brief Factory for objects of type QuadratureSetI.
  *
@@ -65,12 +72,14 @@ std::shared_ptr<QuadratureSetI<dim>> MakeQuadratureSetPtr(
  * @tparam dim spatial dimension
  * @param impl implementation for the moment calculator.
  * @param quadrature_set_ptr quadrature set pointer (not required for scalar)
+ * @param max_harmonic_l maximum moment degree (only used by P_N calculators)
  * @return unique pointer to moment calculator.
  */
 template <int dim>
 std::unique_ptr<calculators::SphericalHarmonicMomentsI> MakeMomentCalculator(
     const MomentCalculatorImpl impl,
-    std::shared_ptr<QuadratureSetI<dim>> quadrature_set_ptr = nullptr);
+    std::shared_ptr<QuadratureSetI<dim>> quadrature_set_ptr = nullptr,
+    const int max_harmonic_l = 0);
 
 /*! \brief Function to fill a quadrature set.
  *
@@ -102,6 +111,26 @@ void FillQuadratureSet(
     const std::vector<std::pair<quadrature::CartesianPosition<dim>,
                                 quadrature::Weight>>& point_vector);
 
+/*! \brief Function to fill a quadrature set with one direction of each
+ * reflection pair.
+ *
+ * This is intended for formulations that are symmetric under reflection across
+ * the origin, such as the even-parity equations, that only solve for half of
+ * the directions. Each point is added without its reflection and with twice
+ * its weight, so the weights of the set still sum to the total weight of the
+ * full set. Points passed must not contain a point and its reflection, the
+ * output of quadrature::utility::GenerateAllPositiveX satisfies this.
+ *
+ * @tparam dim spatial dimension of quadrature set to fill.
+ * @param to_fill quadrature set to fill, must be empty.
+ * @param point_vector vector containing points to fill the quadrature set.
+ */
+template <int dim>
+void FillHalfRangeQuadratureSet(
+    QuadratureSetI<dim>* to_fill,
+    const std::vector<std::pair<quadrature::CartesianPosition<dim>,
+                                quadrature::Weight>>& point_vector);
+
 } // namespace factory
 
 } // namespace quadrature
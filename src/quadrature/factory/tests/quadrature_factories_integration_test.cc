@@ -1,10 +1,15 @@
 #include "quadrature/factory/quadrature_factories.h"
 
+#include "quadrature/angular/gauss_legendre.h"
+#include "quadrature/angular/gauss_legendre_chebyshev.h"
 #include "quadrature/angular/level_symmetric_gaussian.h"
+#include "quadrature/angular/xy_projection.h"
 #include "quadrature/ordinate.h"
 #include "quadrature/quadrature_point.h"
 #include "quadrature/quadrature_set.h"
+#include "quadrature/calculators/accumulated_zeroth_moment.h"
 #include "quadrature/calculators/scalar_moment.h"
+#include "quadrature/calculators/spherical_harmonic_pn_moments.h"
 #include "quadrature/calculators/spherical_harmonic_zeroth_moment.h"
 #include "quadrature/utility/quadrature_utilities.h"
 
@@ -73,27 +78,111 @@ TYPED_TEST(QuadratureFactoriesIntegrationTest,
 }
 
 /* Call to MakeAngularQuadratureGeneratorPtr specifying a level symmetric gaussian
- * should return the correct type. If dim !=3, should throw an error */
+ * should return the correct type. In 2D this is the projection of the 3D set,
+ * in 1D it is the Gauss-Legendre set. */
 TYPED_TEST(QuadratureFactoriesIntegrationTest,
            MakeAngularQuadratureGenTestLSGaussian) {
   constexpr int dim = this->dim;
   const int order_value = 4;
-  if (dim == 3) {
-        auto quadrature_generator_ptr =
-        quadrature::factory::MakeAngularQuadratureGeneratorPtr<dim>(
-            quadrature::Order(order_value),
-            quadrature::AngularQuadratureSetType::kLevelSymmetricGaussian);
+  auto quadrature_generator_ptr =
+      quadrature::factory::MakeAngularQuadratureGeneratorPtr<dim>(
+          quadrature::Order(order_value),
+          quadrature::AngularQuadratureSetType::kLevelSymmetricGaussian);
 
-    ASSERT_NE(nullptr, quadrature_generator_ptr);
+  ASSERT_NE(nullptr, quadrature_generator_ptr);
+  EXPECT_EQ(quadrature_generator_ptr->order(), order_value);
+  if (dim == 3) {
     using ExpectedType = quadrature::angular::LevelSymmetricGaussian;
     EXPECT_NE(nullptr,
               dynamic_cast<ExpectedType*>(quadrature_generator_ptr.get()));
+  } else if (dim == 2) {
+    using ExpectedType = quadrature::angular::XYProjection;
+    auto dynamic_ptr = dynamic_cast<ExpectedType*>(
+        quadrature_generator_ptr.get());
+    ASSERT_NE(nullptr, dynamic_ptr);
+    EXPECT_NE(nullptr,
+              dynamic_cast<quadrature::angular::LevelSymmetricGaussian*>(
+                  dynamic_ptr->generator_ptr()));
+  } else {
+    using ExpectedType = quadrature::angular::GaussLegendre;
+    EXPECT_NE(nullptr,
+              dynamic_cast<ExpectedType*>(quadrature_generator_ptr.get()));
+  }
+}
+
+/* Call to MakeAngularQuadratureGeneratorPtr specifying a product
+ * Gauss-Legendre-Chebyshev set should return the correct type with the given
+ * orders, or twice the polar order in azimuth if none is given. In 2D this is
+ * the projection of the 3D set, in 1D it is the Gauss-Legendre set. */
+TYPED_TEST(QuadratureFactoriesIntegrationTest,
+           MakeAngularQuadratureGenTestProductGLC) {
+  constexpr int dim = this->dim;
+  const int polar_order = 20, azimuthal_order = 12;
+  const auto type =
+      quadrature::AngularQuadratureSetType::kProductGaussLegendreChebyshev;
+  using ProductType = quadrature::angular::GaussLegendreChebyshev;
+
+  auto quadrature_generator_ptr =
+      quadrature::factory::MakeAngularQuadratureGeneratorPtr<dim>(
+          quadrature::Order(polar_order), type,
+          quadrature::Order(azimuthal_order));
+  auto default_generator_ptr =
+      quadrature::factory::MakeAngularQuadratureGeneratorPtr<dim>(
+          quadrature::Order(polar_order), type);
+  ASSERT_NE(nullptr, quadrature_generator_ptr);
+  ASSERT_NE(nullptr, default_generator_ptr);
+  EXPECT_EQ(quadrature_generator_ptr->order(), polar_order);
+
+  if (dim == 1) {
+    using ExpectedType = quadrature::angular::GaussLegendre;
+    EXPECT_NE(nullptr,
+              dynamic_cast<ExpectedType*>(quadrature_generator_ptr.get()));
+  } else {
+    ProductType* dynamic_ptr = nullptr;
+    ProductType* default_dynamic_ptr = nullptr;
+    if (dim == 3) {
+      dynamic_ptr = dynamic_cast<ProductType*>(quadrature_generator_ptr.get());
+      default_dynamic_ptr =
+          dynamic_cast<ProductType*>(default_generator_ptr.get());
+    } else {
+      using ProjectionType = quadrature::angular::XYProjection;
+      auto projection_ptr =
+          dynamic_cast<ProjectionType*>(quadrature_generator_ptr.get());
+      auto default_projection_ptr =
+          dynamic_cast<ProjectionType*>(default_generator_ptr.get());
+      ASSERT_NE(nullptr, projection_ptr);
+      ASSERT_NE(nullptr, default_projection_ptr);
+      dynamic_ptr = dynamic_cast<ProductType*>(projection_ptr->generator_ptr());
+      default_dynamic_ptr =
+          dynamic_cast<ProductType*>(default_projection_ptr->generator_ptr());
+    }
+    ASSERT_NE(nullptr, dynamic_ptr);
+    ASSERT_NE(nullptr, default_dynamic_ptr);
+    EXPECT_EQ(dynamic_ptr->polar_order(), polar_order);
+    EXPECT_EQ(dynamic_ptr->azimuthal_order(), azimuthal_order);
+    EXPECT_EQ(default_dynamic_ptr->azimuthal_order(), 2 * polar_order);
+  }
+}
+
+/* Call to MakeAngularQuadratureGeneratorPtr specifying a Gauss-Legendre set
+ * should return the correct type in 1D, and throw an error otherwise. */
+TYPED_TEST(QuadratureFactoriesIntegrationTest,
+           MakeAngularQuadratureGenTestGaussLegendre) {
+  constexpr int dim = this->dim;
+  const int order_value = 8;
+  const auto type = quadrature::AngularQuadratureSetType::kGaussLegendre;
+  if (dim == 1) {
+    auto quadrature_generator_ptr =
+        quadrature::factory::MakeAngularQuadratureGeneratorPtr<dim>(
+            quadrature::Order(order_value), type);
+    using ExpectedType = quadrature::angular::GaussLegendre;
+    EXPECT_NE(nullptr,
+              dynamic_cast<ExpectedType*>(quadrature_generator_ptr.get()));
     EXPECT_EQ(quadrature_generator_ptr->order(), order_value);
   } else {
     EXPECT_ANY_THROW({
       quadrature::factory::MakeAngularQuadratureGeneratorPtr<dim>(
-          quadrature::Order(order_value),
-          quadrature::AngularQuadratureSetType::kLevelSymmetricGaussian);
+          quadrature::Order(order_value), type);
     });
   }
 }
@@ -202,6 +291,59 @@ TYPED_TEST(QuadratureFactoriesIntegrationTest, FillQuadratureSetScalar) {
   }
 }
 
+TYPED_TEST(QuadratureFactoriesIntegrationTest, FillHalfRangeQuadratureSet) {
+  const int dim = this->dim;
+  const int n_points = 3;
+  const int n_quadrants = std::pow(2, dim - 1);
+
+  std::vector<std::pair<quadrature::CartesianPosition<dim>, quadrature::Weight>>
+      quadrature_points;
+  for (int i = 0; i < n_points; ++i) {
+    auto random_position = test_helpers::RandomVector(dim, 1, 10);
+    std::array<double, dim> position;
+    for (int j = 0; j < dim; ++j)
+      position.at(j) = random_position.at(j);
+    quadrature_points.emplace_back(quadrature::CartesianPosition<dim>(position),
+                                   quadrature::Weight(0.5 * (i + 1)));
+  }
+  auto distributed_points =
+      quadrature::utility::GenerateAllPositiveX<dim>(quadrature_points);
+
+  auto quadrature_set_ptr = quadrature::factory::MakeQuadratureSetPtr<dim>();
+  quadrature::factory::FillHalfRangeQuadratureSet<dim>(quadrature_set_ptr.get(),
+                                                       distributed_points);
+
+  // Reflections are not added, weights are doubled to keep the total weight
+  ASSERT_EQ(quadrature_set_ptr->size(), n_points * n_quadrants);
+  double total_weight = 0;
+  for (const auto& quadrature_point_ptr : *quadrature_set_ptr) {
+    EXPECT_EQ(quadrature_set_ptr->GetReflection(quadrature_point_ptr), nullptr);
+    EXPECT_GT(quadrature_point_ptr->cartesian_position().at(0), 0);
+    total_weight += quadrature_point_ptr->weight();
+  }
+  EXPECT_DOUBLE_EQ(total_weight, 2.0 * 3.0 * n_quadrants);
+
+  // Subsequent calls should throw an error (quadrature set is not empty)
+  EXPECT_ANY_THROW({
+    quadrature::factory::FillHalfRangeQuadratureSet<dim>(
+        quadrature_set_ptr.get(), distributed_points);
+  });
+
+  // Sets containing a point and its reflection are invalid
+  auto full_points = distributed_points;
+  auto reflected_position = distributed_points.front().first.get();
+  for (auto& coordinate : reflected_position)
+    coordinate *= -1;
+  full_points.emplace_back(
+      quadrature::CartesianPosition<dim>(reflected_position),
+      distributed_points.front().second);
+  auto invalid_set_ptr = quadrature::factory::MakeQuadratureSetPtr<dim>();
+  EXPECT_ANY_THROW({
+    quadrature::factory::FillHalfRangeQuadratureSet<dim>(invalid_set_ptr.get(),
+                                                         full_points);
+  });
+}
+
 // MakeMomentCalculator should return the correct scalar moment implementation
 TYPED_TEST(QuadratureFactoriesIntegrationTest, MakeMomentCalculatorScalar) {
   const int dim = this->dim;
@@ -230,6 +372,40 @@ TYPED_TEST(QuadratureFactoriesIntegrationTest, MakeMomentCalculatorZeroth) {
                 moment_calculator_ptr.get()));
 }
 
+// MakeMomentCalculator should return the accumulated moment implementation
+TYPED_TEST(QuadratureFactoriesIntegrationTest, MakeMomentCalculatorAccumulated) {
+  const int dim = this->dim;
+
+  auto moment_calculator_ptr = quadrature::factory::MakeMomentCalculator<dim>(
+      quadrature::MomentCalculatorImpl::kAccumulatedZerothMoment);
+
+  ASSERT_NE(moment_calculator_ptr, nullptr);
+  EXPECT_NE(nullptr,
+            dynamic_cast<quadrature::calculators::AccumulatedZerothMoment*>(
+                moment_calculator_ptr.get()));
+}
+
+// MakeMomentCalculator should return the P_N implementation
+TYPED_TEST(QuadratureFactoriesIntegrationTest, MakeMomentCalculatorPN) {
+  const int dim = this->dim;
+  using ExpectedType = quadrature::calculators::SphericalHarmonicPNMoments<dim>;
+  auto quadrature_set_ptr = quadrature::factory::MakeQuadratureSetPtr<dim>();
+
+  auto moment_calculator_ptr = quadrature::factory::MakeMomentCalculator<dim>(
+      quadrature::MomentCalculatorImpl::kSphericalHarmonicPN,
+      quadrature_set_ptr, 2);
+
+  ASSERT_NE(moment_calculator_ptr, nullptr);
+  auto pn_calculator_ptr =
+      dynamic_cast<ExpectedType*>(moment_calculator_ptr.get());
+  ASSERT_NE(nullptr, pn_calculator_ptr);
+  EXPECT_EQ(pn_calculator_ptr->max_harmonic_l(), 2);
+  EXPECT_ANY_THROW({
+    quadrature::factory::MakeMomentCalculator<dim>(
+        quadrature::MomentCalculatorImpl::kSphericalHarmonicPN, nullptr, 2);
+  });
+}
+
 // MakeMomentCalculator should throw if quadrature set is null and an
 // implementation is requested that requires a quadrature set
 TYPED_TEST(QuadratureFactoriesIntegrationTest, MakeMomentCalculatorZerothBadSet) {
@@ -0,0 +1,88 @@
+#include "quadrature/quadrature_set_view.h"
+
+#include <algorithm>
+
+namespace bart {
+
+namespace quadrature {
+
+template <int dim>
+QuadratureSetView<dim>::QuadratureSetView(
+    const QuadratureSetI<dim>& quadrature_set) {
+  const auto indices = quadrature_set.quadrature_point_indices();
+  const int n_points = static_cast<int>(indices.size());
+
+  AssertThrow(indices.empty() ||
+              (*indices.begin() == 0 && *indices.rbegin() == n_points - 1),
+              dealii::ExcMessage("Error in QuadratureSetView constructor, "
+                                 "quadrature point indices must be 0 to N - 1"))
+
+  weights_.resize(n_points);
+  for (auto& component : omega_)
+    component.resize(n_points);
+  reflection_indices_.resize(n_points, kNoReflection);
+  point_to_index_.reserve(n_points);
+
+  for (int index = 0; index < n_points; ++index) {
+    const auto quadrature_point_ptr =
+        quadrature_set.GetQuadraturePoint(QuadraturePointIndex(index));
+    AssertThrow(quadrature_point_ptr != nullptr,
+                dealii::ExcMessage("Error in QuadratureSetView constructor, "
+                                   "quadrature set returned a null point"))
+
+    weights_[index] = quadrature_point_ptr->weight();
+    const auto position = quadrature_point_ptr->cartesian_position();
+    for (int i = 0; i < dim; ++i)
+      omega_[i][index] = position[i];
+
+    if (auto reflection_index =
+            quadrature_set.GetReflectionIndex(quadrature_point_ptr);
+        reflection_index.has_value())
+      reflection_indices_[index] = reflection_index.value();
+
+    point_to_index_.emplace_back(quadrature_point_ptr.get(), index);
+  }
+
+  std::sort(point_to_index_.begin(), point_to_index_.end());
+}
+
+template <int dim>
+int QuadratureSetView<dim>::GetQuadraturePointIndex(
+    const QuadraturePointI<dim>* quadrature_point) const {
+  auto it = std::lower_bound(
+      point_to_index_.cbegin(), point_to_index_.cend(), quadrature_point,
+      [](const std::pair<const QuadraturePointI<dim>*, int>& entry,
+         const QuadraturePointI<dim>* point) { return entry.first < point; });
+
+  AssertThrow(it != point_to_index_.cend() && it->first == quadrature_point,
+              dealii::ExcMessage("Error in QuadratureSetView "
+                                 "GetQuadraturePointIndex, quadrature point is "
+                                 "not in the view"))
+  return it->second;
+}
+
+template <int dim>
+dealii::Tensor<1, dim> QuadratureSetView<dim>::omega_tensor(
+    const int index) const {
+  dealii::Tensor<1, dim> return_tensor;
+  for (int i = 0; i < dim; ++i)
+    return_tensor[i] = omega_[i][index];
+  return return_tensor;
+}
+
+template <int dim>
+std::array<double, dim> QuadratureSetView<dim>::cartesian_position(
+    const int index) const {
+  std::array<double, dim> return_array;
+  for (int i = 0; i < dim; ++i)
+    return_array[i] = omega_[i][index];
+  return return_array;
+}
+
+template class QuadratureSetView<1>;
+template class QuadratureSetView<2>;
+template class QuadratureSetView<3>;
+
+} // namespace quadrature
+
+} // namespace bart
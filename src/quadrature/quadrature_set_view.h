@@ -0,0 +1,82 @@
+#ifndef BART_SRC_QUADRATURE_QUADRATURE_SET_VIEW_H_
+#define BART_SRC_QUADRATURE_QUADRATURE_SET_VIEW_H_
+
+#include <array>
+#include <utility>
+#include <vector>
+
+#include <deal.II/base/tensor.h>
+
+#include "quadrature/quadrature_set_i.h"
+
+namespace bart {
+
+namespace quadrature {
+
+/*! \brief Immutable, flat structure-of-arrays copy of a quadrature set.
+ *
+ * The quadrature set stores its points in a set ordered by position and
+ * resolves points and indices through maps keyed by shared pointers. That is
+ * fine while a set is being built but is a poor fit for the loops over cells
+ * and angles during assembly and moment calculation. This view is built once
+ * from a completed quadrature set and holds, indexed by quadrature point index,
+ * contiguous arrays of each component of \f$\vec{\Omega}\f$, the weights, and
+ * the index of the reflection of each point.
+ *
+ * The view does not track later changes to the quadrature set it was built
+ * from. The indices of the quadrature set must be \f$0, \ldots, N - 1\f$.
+ *
+ * @tparam dim spatial dimension
+ */
+template <int dim>
+class QuadratureSetView {
+ public:
+  //! Reflection index stored for points without a reflection
+  static constexpr int kNoReflection = -1;
+
+  explicit QuadratureSetView(const QuadratureSetI<dim>& quadrature_set);
+
+  /*! \brief Returns the index of a quadrature point of the original set.
+   *
+   * Uses a binary search over a sorted, contiguous array of point addresses.
+   * Throws if the point was not in the set when the view was built.
+   */
+  int GetQuadraturePointIndex(
+      const QuadraturePointI<dim>* quadrature_point) const;
+
+  //! Returns \f$\vec{\Omega}\f$ for a quadrature point index as a tensor
+  dealii::Tensor<1, dim> omega_tensor(const int index) const;
+
+  //! Returns the cartesian position of a quadrature point index
+  std::array<double, dim> cartesian_position(const int index) const;
+
+  int size() const { return static_cast<int>(weights_.size()); }
+  double weight(const int index) const { return weights_[index]; }
+  double omega(const int component, const int index) const {
+    return omega_[component][index]; }
+  //! Returns the reflection index, or kNoReflection if there is none
+  int reflection_index(const int index) const {
+    return reflection_indices_[index]; }
+
+  const std::vector<double>& weights() const { return weights_; }
+  const std::vector<double>& omega(const int component) const {
+    return omega_.at(component); }
+  const std::vector<int>& reflection_indices() const {
+    return reflection_indices_; }
+
+ private:
+  //! Quadrature point weights
+  std::vector<double> weights_;
+  //! Components of \f$\vec{\Omega}\f$, one contiguous array per dimension
+  std::array<std::vector<double>, dim> omega_;
+  //! Index of the reflection of each point, kNoReflection if none
+  std::vector<int> reflection_indices_;
+  //! Point addresses paired with their index, sorted by address
+  std::vector<std::pair<const QuadraturePointI<dim>*, int>> point_to_index_;
+};
+
+} // namespace quadrature
+
+} // namespace bart
+
+#endif //BART_SRC_QUADRATURE_QUADRATURE_SET_VIEW_H_
@@ -28,6 +28,8 @@ using QuadraturePointIndex =
 enum class AngularQuadratureSetType {
   kNone = 0,
   kLevelSymmetricGaussian = 1,
+  kProductGaussLegendreChebyshev = 2,
+  kGaussLegendre = 3,
 };
 
 enum class OrdinateType {
@@ -45,6 +47,8 @@ enum class QuadratureSetImpl {
 enum class MomentCalculatorImpl {
   kScalarMoment = 0,
   kZerothMomentOnly = 1,
+  kAccumulatedZerothMoment = 2,
+  kSphericalHarmonicPN = 3,
 };
 
 } // namespace quadrature
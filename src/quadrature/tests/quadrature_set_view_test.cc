@@ -0,0 +1,126 @@
+#include "quadrature/quadrature_set_view.h"
+
+#include <memory>
+
+#include "quadrature/factory/quadrature_factories.h"
+#include "test_helpers/gmock_wrapper.h"
+
+namespace {
+
+using namespace bart;
+
+/* Tests for the QuadratureSetView class.
+ *
+ * SetUp: fills a quadrature set with two points with weights 0.25 and 0.5, the
+ * factory adds the reflection of each across the origin. The view is built from
+ * the filled set.
+ */
+template <typename DimensionWrapper>
+class QuadratureSetViewTest : public ::testing::Test {
+ public:
+  static constexpr int dim = DimensionWrapper::value;
+
+  std::shared_ptr<quadrature::QuadratureSetI<dim>> quadrature_set_ptr_;
+  std::unique_ptr<quadrature::QuadratureSetView<dim>> test_view_ptr_;
+
+  void SetUp() override;
+};
+
+template <typename DimensionWrapper>
+void QuadratureSetViewTest<DimensionWrapper>::SetUp() {
+  const std::array<double, 3> first_direction{0.48, 0.6, 0.64};
+  const std::array<double, 3> second_direction{0.8, 0.36, 0.48};
+  std::array<double, dim> first_position, second_position;
+  for (int i = 0; i < dim; ++i) {
+    first_position.at(i) = first_direction.at(i);
+    second_position.at(i) = second_direction.at(i);
+  }
+
+  quadrature_set_ptr_ = quadrature::factory::MakeQuadratureSetPtr<dim>();
+  quadrature::factory::FillQuadratureSet<dim>(
+      quadrature_set_ptr_.get(),
+      {{quadrature::CartesianPosition<dim>(first_position),
+        quadrature::Weight(0.25)},
+       {quadrature::CartesianPosition<dim>(second_position),
+        quadrature::Weight(0.5)}});
+
+  test_view_ptr_ =
+      std::make_unique<quadrature::QuadratureSetView<dim>>(*quadrature_set_ptr_);
+}
+
+TYPED_TEST_SUITE(QuadratureSetViewTest, bart::testing::AllDimensions);
+
+// The view should hold the weight, position and reflection of each point
+TYPED_TEST(QuadratureSetViewTest, MatchesQuadratureSet) {
+  constexpr int dim = this->dim;
+  auto& quadrature_set = *this->quadrature_set_ptr_;
+  auto& test_view = *this->test_view_ptr_;
+
+  ASSERT_EQ(test_view.size(), static_cast<int>(quadrature_set.size()));
+  ASSERT_EQ(static_cast<int>(test_view.weights().size()), test_view.size());
+  ASSERT_EQ(static_cast<int>(test_view.reflection_indices().size()),
+            test_view.size());
+
+  for (int index = 0; index < test_view.size(); ++index) {
+    auto quadrature_point_ptr = quadrature_set.GetQuadraturePoint(
+        quadrature::QuadraturePointIndex(index));
+    EXPECT_DOUBLE_EQ(test_view.weight(index), quadrature_point_ptr->weight());
+
+    const auto position = quadrature_point_ptr->cartesian_position();
+    const auto omega_tensor = test_view.omega_tensor(index);
+    for (int i = 0; i < dim; ++i) {
+      ASSERT_EQ(static_cast<int>(test_view.omega(i).size()), test_view.size());
+      EXPECT_DOUBLE_EQ(test_view.omega(i, index), position.at(i));
+      EXPECT_DOUBLE_EQ(test_view.omega(i)[index], position.at(i));
+      EXPECT_DOUBLE_EQ(omega_tensor[i], position.at(i));
+    }
+    EXPECT_THAT(test_view.cartesian_position(index),
+                ::testing::ContainerEq(position));
+
+    EXPECT_EQ(test_view.reflection_index(index),
+              quadrature_set.GetReflectionIndex(quadrature_point_ptr).value());
+    EXPECT_EQ(test_view.GetQuadraturePointIndex(quadrature_point_ptr.get()),
+              index);
+  }
+}
+
+// Points without a reflection should be given the no reflection index
+TYPED_TEST(QuadratureSetViewTest, NoReflection) {
+  constexpr int dim = this->dim;
+  auto quadrature_set_ptr = quadrature::factory::MakeQuadratureSetPtr<dim>();
+  auto quadrature_point_ptr = quadrature::factory::MakeQuadraturePointPtr<dim>();
+  auto ordinate_ptr = quadrature::factory::MakeOrdinatePtr<dim>();
+  std::array<double, dim> position;
+  position.fill(0.5);
+  ordinate_ptr->set_cartesian_position(
+      quadrature::CartesianPosition<dim>(position));
+  quadrature_point_ptr->SetOrdinate(ordinate_ptr)
+      .SetWeight(quadrature::Weight(1.0));
+  quadrature_set_ptr->AddPoint(quadrature_point_ptr);
+
+  quadrature::QuadratureSetView<dim> test_view(*quadrature_set_ptr);
+  ASSERT_EQ(test_view.size(), 1);
+  EXPECT_EQ(test_view.reflection_index(0),
+            quadrature::QuadratureSetView<dim>::kNoReflection);
+}
+
+// Retrieving the index of a point that is not in the view should throw
+TYPED_TEST(QuadratureSetViewTest, GetQuadraturePointIndexBadPoint) {
+  constexpr int dim = this->dim;
+  auto quadrature_point_ptr = quadrature::factory::MakeQuadraturePointPtr<dim>();
+  EXPECT_ANY_THROW({
+    [[maybe_unused]] auto index = this->test_view_ptr_->GetQuadraturePointIndex(
+        quadrature_point_ptr.get());
+  });
+}
+
+// An empty quadrature set should give an empty view
+TYPED_TEST(QuadratureSetViewTest, EmptySet) {
+  constexpr int dim = this->dim;
+  auto quadrature_set_ptr = quadrature::factory::MakeQuadratureSetPtr<dim>();
+  quadrature::QuadratureSetView<dim> test_view(*quadrature_set_ptr);
+  EXPECT_EQ(test_view.size(), 0);
+  EXPECT_TRUE(test_view.weights().empty());
+}
+
+} // namespace
@@ -1,6 +1,10 @@
 #include "quadrature/utility/quadrature_utilities.h"
 #include "quadrature/quadrature_set_i.h"
 
+#include <deal.II/base/exceptions.h>
+
+#include <algorithm>
+#include <cmath>
 #include <functional>
 
 namespace bart {
@@ -20,6 +24,89 @@ std::array<double, dim> ReflectAcrossOrigin(const OrdinateI<dim>& ordinate) {
   return position;
 }
 
+template <int dim>
+std::map<int, int> ReflectionIndicesAcrossAxis(
+    const QuadratureSetI<dim>& quadrature_set, const int axis) {
+  AssertThrow(axis >= 0 && axis < dim,
+              dealii::ExcMessage("Error in ReflectionIndicesAcrossAxis, axis "
+                                 "is not valid for the spatial dimension"))
+  std::map<int, int> reflection_indices;
+
+  for (auto it = quadrature_set.cbegin(); it != quadrature_set.cend(); ++it) {
+    auto reflected_position = (*it)->cartesian_position();
+    reflected_position.at(axis) *= -1;
+
+    auto reflection_it = std::find_if(
+        quadrature_set.cbegin(), quadrature_set.cend(),
+        [&reflected_position](const auto& point_ptr) {
+          const auto position = point_ptr->cartesian_position();
+          for (int i = 0; i < dim; ++i) {
+            if (std::abs(position.at(i) - reflected_position.at(i)) > 1e-12)
+              return false;
+          }
+          return true;
+        });
+
+    AssertThrow(reflection_it != quadrature_set.cend(),
+                dealii::ExcMessage("Error in ReflectionIndicesAcrossAxis, "
+                                   "quadrature set is not symmetric across "
+                                   "the reflecting plane"))
+    reflection_indices[quadrature_set.GetQuadraturePointIndex(*it)] =
+        quadrature_set.GetQuadraturePointIndex(*reflection_it);
+  }
+
+  return reflection_indices;
+}
+
+template <int dim>
+double RealSphericalHarmonic(const int harmonic_l, const int harmonic_m,
+                             const std::array<double, dim>& position) {
+  AssertThrow(harmonic_l >= 0 && std::abs(harmonic_m) <= harmonic_l,
+              dealii::ExcMessage("Error in RealSphericalHarmonic, invalid "
+                                 "harmonic degree or order"))
+  const int m = std::abs(harmonic_m);
+  double mu = 0, omega = 0;
+
+  if constexpr (dim == 1) {
+    if (m != 0)
+      return 0;
+    mu = position.at(0);
+  } else {
+    const double x = position.at(0), y = position.at(1);
+    if constexpr (dim == 2) {
+      mu = std::sqrt(std::max(0.0, 1.0 - x * x - y * y));
+    } else {
+      mu = position.at(2);
+    }
+    omega = std::atan2(y, x);
+  }
+
+  // Associated Legendre polynomial by upward recurrence in degree, starting
+  // from P_m^m = (2m - 1)!! (1 - mu^2)^(m/2)
+  const double sin_theta = std::sqrt(std::max(0.0, 1.0 - mu * mu));
+  double legendre = 1.0;
+  for (int i = 1; i <= m; ++i)
+    legendre *= (2 * i - 1) * sin_theta;
+  double previous_legendre = 0;
+  for (int l = m + 1; l <= harmonic_l; ++l) {
+    const double next_legendre = ((2 * l - 1) * mu * legendre -
+        (l + m - 1) * previous_legendre) / (l - m);
+    previous_legendre = legendre;
+    legendre = next_legendre;
+  }
+
+  // Normalization, (l - m)!/(l + m)!
+  double factorial_ratio = 1.0;
+  for (int i = harmonic_l - m + 1; i <= harmonic_l + m; ++i)
+    factorial_ratio /= i;
+  const double normalization = std::sqrt((m == 0 ? 1.0 : 2.0) *
+                                         factorial_ratio);
+
+  const double azimuthal = harmonic_m >= 0 ? std::cos(m * omega)
+                                           : std::sin(m * omega);
+  return normalization * legendre * azimuthal;
+}
+
 template <>
 std::vector<std::pair<CartesianPosition<1>, Weight>> GenerateAllPositiveX<1>(
     const std::vector<std::pair<CartesianPosition<1>, Weight>>& to_distribute) {
@@ -71,6 +158,14 @@ template std::array<double, 1> ReflectAcrossOrigin<1>(const OrdinateI<1>&);
 template std::array<double, 2> ReflectAcrossOrigin<2>(const OrdinateI<2>&);
 template std::array<double, 3> ReflectAcrossOrigin<3>(const OrdinateI<3>&);
 
+template std::map<int, int> ReflectionIndicesAcrossAxis<1>(const QuadratureSetI<1>&, const int);
+template std::map<int, int> ReflectionIndicesAcrossAxis<2>(const QuadratureSetI<2>&, const int);
+template std::map<int, int> ReflectionIndicesAcrossAxis<3>(const QuadratureSetI<3>&, const int);
+
+template double RealSphericalHarmonic<1>(const int, const int, const std::array<double, 1>&);
+template double RealSphericalHarmonic<2>(const int, const int, const std::array<double, 2>&);
+template double RealSphericalHarmonic<3>(const int, const int, const std::array<double, 3>&);
+
 } // namespace utility
 
 } // namespace quadrature
@@ -2,8 +2,11 @@
 #define BART_SRC_QUADRATURE_UTILITY_QUADRATURE_UTILITIES_H_
 
 #include "quadrature/quadrature_point_i.h"
+#include "quadrature/quadrature_set_i.h"
 #include "quadrature/ordinate_i.h"
 
+#include <map>
+
 namespace bart {
 
 namespace quadrature {
@@ -18,6 +21,53 @@ namespace utility {
 template <int dim>
 std::array<double, dim> ReflectAcrossOrigin(const OrdinateI<dim>& ordinate);
 
+/*! \brief Maps each point in a quadrature set to its reflection across the
+ * plane normal to a cartesian axis.
+ *
+ * This is the direction a particle travelling along a quadrature point takes
+ * after a specular reflection off a boundary normal to the given axis. Only the
+ * component along the axis changes sign, so for dim = 1 this is the same as
+ * the reflection across the origin.
+ *
+ * @tparam dim spatial dimension.
+ * @param quadrature_set quadrature set, must be symmetric across the plane.
+ * @param axis index of the axis normal to the reflecting plane.
+ * @return map from each quadrature point index to the index of its reflection.
+ */
+template <int dim>
+std::map<int, int> ReflectionIndicesAcrossAxis(
+    const QuadratureSetI<dim>& quadrature_set, const int axis);
+
+/*! \brief Evaluates a real spherical harmonic at a direction.
+ *
+ * Harmonics are normalized so that \f$Y_{0}^{0} = 1\f$ and their integral
+ * over the unit sphere is \f$4\pi/(2\ell + 1)\f$,
+ * \f[
+ * Y_{\ell}^{m}(\mu, \omega) = \sqrt{(2 - \delta_{m0})
+ * \frac{(\ell - |m|)!}{(\ell + |m|)!}}P_{\ell}^{|m|}(\mu)
+ * \begin{cases}
+ * \cos(m\omega) & m \geq 0 \\
+ * \sin(|m|\omega) & m < 0
+ * \end{cases}
+ * \f]
+ * where \f$P_{\ell}^{m}\f$ is the associated Legendre polynomial (without
+ * the Condon-Shortley phase). In 3D the polar cosine \f$\mu\f$ is the z
+ * component and the azimuthal angle \f$\omega\f$ is measured in the x-y
+ * plane. In 2D directions are taken in the upper hemisphere,
+ * \f$\mu = \sqrt{1 - x^2 - y^2}\f$. In 1D \f$\mu\f$ is the x component and
+ * the flux is azimuthally symmetric, all harmonics with \f$m \neq 0\f$ are
+ * zero.
+ *
+ * @tparam dim spatial dimension.
+ * @param harmonic_l degree \f$\ell \geq 0\f$.
+ * @param harmonic_m order \f$|m| \leq \ell\f$.
+ * @param position cartesian position of the direction on the unit sphere.
+ * @return value of the harmonic.
+ */
+template <int dim>
+double RealSphericalHarmonic(const int harmonic_l, const int harmonic_m,
+                             const std::array<double, dim>& position);
+
 /*! \brief Generates all pairs of positions and weights in the positive X quadrants.
  *
  * This function takes each pair of cartesian positions and weights and
@@ -2,7 +2,9 @@
 
 #include <algorithm>
 #include <cmath>
+#include <map>
 
+#include "quadrature/factory/quadrature_factories.h"
 #include "quadrature/tests/quadrature_point_mock.h"
 #include "quadrature/tests/quadrature_generator_mock.h"
 #include "quadrature/tests/quadrature_set_mock.h"
@@ -114,6 +116,100 @@ TYPED_TEST(QuadratureUtilityTests, GenerateAllPositiveXScalar) {
   EXPECT_EQ(quadrature_set.at(0), distributed_set.at(0));
 }
 
+// ReflectionIndicesAcrossAxis should map each point to its mirror image
+TYPED_TEST(QuadratureUtilityTests, ReflectionIndicesAcrossAxis) {
+  constexpr int dim = this->dim;
+
+  std::array<double, dim> position;
+  for (int i = 0; i < dim; ++i)
+    position.at(i) = 0.25 * (i + 1);
+  auto quadrature_set_ptr = quadrature::factory::MakeQuadratureSetPtr<dim>();
+  quadrature::factory::FillQuadratureSet<dim>(
+      quadrature_set_ptr.get(),
+      quadrature::utility::GenerateAllPositiveX<dim>(
+          {{quadrature::CartesianPosition<dim>(position),
+            quadrature::Weight(1.0)}}));
+
+  for (int axis = 0; axis < dim; ++axis) {
+    auto reflection_indices = quadrature::utility::ReflectionIndicesAcrossAxis(
+        *quadrature_set_ptr, axis);
+    ASSERT_EQ(reflection_indices.size(), quadrature_set_ptr->size());
+    for (const auto [index, reflection_index] : reflection_indices) {
+      auto point_position = quadrature_set_ptr->GetQuadraturePoint(
+          quadrature::QuadraturePointIndex(index))->cartesian_position();
+      auto reflection_position = quadrature_set_ptr->GetQuadraturePoint(
+          quadrature::QuadraturePointIndex(reflection_index))->cartesian_position();
+      for (int i = 0; i < dim; ++i) {
+        const double expected = i == axis ? -point_position.at(i) :
+            point_position.at(i);
+        EXPECT_DOUBLE_EQ(reflection_position.at(i), expected);
+      }
+    }
+  }
+  EXPECT_ANY_THROW({
+    quadrature::utility::ReflectionIndicesAcrossAxis(*quadrature_set_ptr, dim);
+  });
+}
+
+// ReflectionIndicesAcrossAxis should throw if a mirror image is missing
+TYPED_TEST(QuadratureUtilityTests, ReflectionIndicesAcrossAxisNotSymmetric) {
+  constexpr int dim = this->dim;
+
+  std::array<double, dim> position;
+  for (int i = 0; i < dim; ++i)
+    position.at(i) = 0.25 * (i + 1);
+  auto quadrature_set_ptr = quadrature::factory::MakeQuadratureSetPtr<dim>();
+  auto ordinate_ptr = quadrature::factory::MakeOrdinatePtr<dim>();
+  ordinate_ptr->set_cartesian_position(
+      quadrature::CartesianPosition<dim>(position));
+  auto quadrature_point_ptr = quadrature::factory::MakeQuadraturePointPtr<dim>();
+  quadrature_point_ptr->SetOrdinate(ordinate_ptr)
+      .SetWeight(quadrature::Weight(1.0));
+  quadrature_set_ptr->AddPoint(quadrature_point_ptr);
+
+  for (int axis = 0; axis < dim; ++axis) {
+    EXPECT_ANY_THROW({
+      quadrature::utility::ReflectionIndicesAcrossAxis(*quadrature_set_ptr,
+                                                       axis);
+    });
+  }
+}
+
+// RealSphericalHarmonic should return the correct values for low orders
+TYPED_TEST(QuadratureUtilityTests, RealSphericalHarmonic) {
+  constexpr int dim = this->dim;
+  // Direction with x = 0.48, y = 0.6 and polar cosine 0.64, in 1D the polar
+  // cosine is the x component
+  const std::array<double, 3> direction{0.48, 0.6, 0.64};
+  std::array<double, dim> position;
+  if (dim == 1) {
+    position.at(0) = direction.at(2);
+  } else {
+    for (int i = 0; i < dim; ++i)
+      position.at(i) = direction.at(i);
+  }
+  const auto& [x, y, mu] = direction;
+  const double azimuthal_factor = dim == 1 ? 0 : 1;
+
+  const std::map<std::pair<int, int>, double> expected_values{
+      {{0, 0}, 1.0},
+      {{1, -1}, azimuthal_factor * y},
+      {{1, 0}, mu},
+      {{1, 1}, azimuthal_factor * x},
+      {{2, 0}, 0.5 * (3 * mu * mu - 1)},
+      {{2, 1}, azimuthal_factor * std::sqrt(3.0) * x * mu}};
+
+  for (const auto& [harmonic, expected_value] : expected_values) {
+    const auto [l, m] = harmonic;
+    EXPECT_NEAR(quadrature::utility::RealSphericalHarmonic<dim>(l, m, position),
+                expected_value, 1e-12) << "l = " << l << ", m = " << m;
+  }
+
+  EXPECT_ANY_THROW(quadrature::utility::RealSphericalHarmonic<dim>(-1, 0, position));
+  EXPECT_ANY_THROW(quadrature::utility::RealSphericalHarmonic<dim>(1, 2, position));
+  EXPECT_ANY_THROW(quadrature::utility::RealSphericalHarmonic<dim>(1, -2, position));
+}
+
 // QuadraturePointCompare should provide a correct less-than operation.
 TYPED_TEST(QuadratureUtilityTests, QuadraturePointCompare) {
   const int dim = this->dim;
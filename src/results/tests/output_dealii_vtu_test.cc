@@ -58,8 +58,8 @@ void ResultsOutputDealiiVtuTest<DimensionWrapper>::SetUp() {
   this->SetUpDealii();
   test_data_out_.attach_dof_handler(this->dof_handler_);
 
-  group_0_moment.reinit(this->vector_1.size());
-  group_1_moment.reinit(this->vector_1.size());
+  group_0_moment.reinit(this->vector_1);
+  group_1_moment.reinit(this->vector_1);
   group_0_moment = group_phi_values_[0];
   group_1_moment = group_phi_values_[1];
 
@@ -1,22 +1,32 @@
 #include "solver/gmres.h"
 
+#include <algorithm>
+
 #include <deal.II/lac/petsc_solver.h>
 
 namespace bart {
 
 namespace solver {
 
-GMRES::GMRES(int max_iterations, double convergence_tolerance)
-    : solver_control_(max_iterations, convergence_tolerance){}
+GMRES::GMRES(int max_iterations, double convergence_tolerance,
+             const std::shared_ptr<InnerTolerance>& inner_tolerance_ptr)
+    : solver_control_(max_iterations, convergence_tolerance),
+      convergence_tolerance_(convergence_tolerance),
+      inner_tolerance_ptr_(inner_tolerance_ptr) {}
 
 void GMRES::Solve(dealii::PETScWrappers::MatrixBase *A,
                   dealii::PETScWrappers::VectorBase *x,
                   dealii::PETScWrappers::VectorBase *b,
                   dealii::PETScWrappers::PreconditionerBase *preconditioner) {
+  if (inner_tolerance_ptr_ != nullptr) {
+    solver_control_.set_tolerance(
+        std::max(convergence_tolerance_,
+                 inner_tolerance_ptr_->tolerance() * b->l2_norm()));
+  }
   dealii::PETScWrappers::SolverGMRES solver(solver_control_, MPI_COMM_WORLD);
   solver.solve(*A, *x, *b, *preconditioner);
 }
 
 } // namespace solver
 
-} // namespace bart
\ No newline at end of file
+} // namespace bart
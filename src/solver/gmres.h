@@ -8,32 +8,50 @@
 #include <deal.II/lac/petsc_matrix_base.h>
 #include <deal.II/lac/petsc_vector_base.h>
 
+#include "convergence/inner_tolerance_i.h"
 #include "solver/linear_i.h"
 
 namespace bart {
 
 namespace solver {
 
+/*! \brief GMRES linear solver using PETSc.
+ *
+ * If an inner tolerance policy is provided, the residual tolerance for each
+ * solve is \f$\max(\epsilon, \eta|b|_2)\f$ where \f$\epsilon\f$ is the fixed
+ * convergence tolerance and \f$\eta\f$ is the relative tolerance provided by
+ * the policy.
+ *
+ */
 class GMRES : public LinearI {
  public:
-  GMRES(int max_iterations = 100, double convergence_tolerance = 1e-10);
+  using InnerTolerance = convergence::InnerToleranceI;
+
+  GMRES(int max_iterations = 100, double convergence_tolerance = 1e-10,
+        const std::shared_ptr<InnerTolerance>& inner_tolerance_ptr = nullptr);
   ~GMRES() = default;
 
+  using LinearI::Solve;
   void Solve(dealii::PETScWrappers::MatrixBase *A,
              dealii::PETScWrappers::VectorBase *x,
              dealii::PETScWrappers::VectorBase *b,
              dealii::PETScWrappers::PreconditionerBase *preconditioner) override;
   int max_iterations() const { return solver_control_.max_steps(); };
-  double convergence_tolerance() const { return solver_control_.tolerance(); };
+  double convergence_tolerance() const { return convergence_tolerance_; };
 
   const dealii::SolverControl& solver_control() const { return solver_control_;};
 
+  InnerTolerance* inner_tolerance_ptr() const {
+    return inner_tolerance_ptr_.get(); }
+
  private:
   dealii::SolverControl solver_control_;
+  const double convergence_tolerance_;
+  std::shared_ptr<InnerTolerance> inner_tolerance_ptr_ = nullptr;
 };
 
 } // namespace solver
 
 } // namespace bart
 
-#endif // BART_SRC_SOLVER_GMRES_H_
\ No newline at end of file
+#endif // BART_SRC_SOLVER_GMRES_H_
@@ -10,8 +10,10 @@ namespace solver {
 namespace group {
 
 SingleGroupSolver::SingleGroupSolver(
-    std::unique_ptr<LinearSolver> linear_solver_ptr)
-    : linear_solver_ptr_(std::move(linear_solver_ptr)) {}
+    std::unique_ptr<LinearSolver> linear_solver_ptr,
+    std::shared_ptr<const Constraints> constraints_ptr)
+    : linear_solver_ptr_(std::move(linear_solver_ptr)),
+      constraints_ptr_(std::move(constraints_ptr)) {}
 
 void SingleGroupSolver::SolveGroup(const int group,
                                    const system::System &system,
@@ -35,7 +37,12 @@ void SingleGroupSolver::SolveGroup(const int group,
         left_hand_side_ptr.get(),
         &solution,
         right_hand_side_ptr.get(),
-        &no_conditioner);
+        &no_conditioner,
+        index);
+    // Hanging node values are not solved for, they are set from their parents
+    if (constraints_ptr_ != nullptr)
+      constraints_ptr_->distribute(solution);
+    group_solution.AngleSolved(angle);
   }
 }
 
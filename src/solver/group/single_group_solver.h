@@ -3,6 +3,8 @@
 
 #include <memory>
 
+#include <deal.II/lac/affine_constraints.h>
+
 #include "solver/group/single_group_solver_i.h"
 #include "solver/linear_i.h"
 
@@ -16,8 +18,16 @@ class SingleGroupSolver : public SingleGroupSolverI {
  public:
 
   using LinearSolver = solver::LinearI;
-
-  SingleGroupSolver(std::unique_ptr<LinearSolver> linear_solver_ptr);
+  using Constraints = dealii::AffineConstraints<double>;
+
+  /*! \brief Constructor.
+   *
+   * @param linear_solver_ptr solver for each angle of the group.
+   * @param constraints_ptr optional hanging node constraints, if provided each
+   * angular solution is made conforming with them after it is solved.
+   */
+  SingleGroupSolver(std::unique_ptr<LinearSolver> linear_solver_ptr,
+                    std::shared_ptr<const Constraints> constraints_ptr = nullptr);
   virtual ~SingleGroupSolver() = default;
 
   void SolveGroup(const int group,
@@ -27,8 +37,13 @@ class SingleGroupSolver : public SingleGroupSolverI {
   LinearSolver* linear_solver_ptr() const {
     return linear_solver_ptr_.get();
   }
+
+  const Constraints* constraints_ptr() const {
+    return constraints_ptr_.get();
+  }
  protected:
   std::unique_ptr<LinearSolver> linear_solver_ptr_ = nullptr;
+  std::shared_ptr<const Constraints> constraints_ptr_ = nullptr;
 
 };
 
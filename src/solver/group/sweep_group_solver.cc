@@ -0,0 +1,220 @@
+#include "solver/group/sweep_group_solver.h"
+
+#include <deque>
+
+#include <deal.II/base/geometry_info.h>
+
+#include "system/system.h"
+#include "system/solution/mpi_group_angular_solution_i.h"
+
+namespace bart {
+
+namespace solver {
+
+namespace group {
+
+template <int dim>
+SweepGroupSolver<dim>::SweepGroupSolver(
+    std::shared_ptr<FormulationType> formulation_ptr,
+    std::shared_ptr<FiniteElementType> finite_element_ptr,
+    std::shared_ptr<DomainType> domain_ptr,
+    std::shared_ptr<QuadratureSetType> quadrature_set_ptr)
+    : formulation_ptr_(formulation_ptr),
+      finite_element_ptr_(finite_element_ptr),
+      domain_ptr_(domain_ptr),
+      quadrature_set_ptr_(quadrature_set_ptr) {
+  std::string error{"Error in constructor of SweepGroupSolver, "};
+  AssertThrow(formulation_ptr_ != nullptr,
+              dealii::ExcMessage(error + "formulation pointer passed is null"))
+  AssertThrow(finite_element_ptr_ != nullptr,
+              dealii::ExcMessage(error + "finite element pointer passed is "
+                                         "null"))
+  AssertThrow(domain_ptr_ != nullptr,
+              dealii::ExcMessage(error + "domain pointer passed is null"))
+  AssertThrow(quadrature_set_ptr_ != nullptr,
+              dealii::ExcMessage(error + "quadrature set pointer passed is "
+                                         "null"))
+}
+
+template <int dim>
+void SweepGroupSolver<dim>::SolveGroup(
+    const int group,
+    const system::System &system,
+    system::solution::MPIGroupAngularSolutionI &group_solution) {
+  const int total_angles = group_solution.total_angles();
+  AssertThrow(total_angles > 0,
+      dealii::ExcMessage("Error in SolveGroup, total angles provided by group "
+                         "solution must be > 0"));
+  AssertThrow(group >= 0,
+      dealii::ExcMessage("Error in SolveGroup, invalid group index provided, "
+                         "value is less than zero"));
+  UpdateCells();
+
+  constexpr int faces_per_cell = dealii::GeometryInfo<dim>::faces_per_cell;
+  const int n_cells = cells_.size();
+  const int dofs_per_cell = finite_element_ptr_->dofs_per_cell();
+  const system::EnergyGroup energy_group(group);
+
+  formulation::FullMatrix cell_matrix(dofs_per_cell, dofs_per_cell);
+  formulation::Vector cell_rhs(dofs_per_cell), upwind_values(dofs_per_cell);
+  std::vector<formulation::Vector> cell_solutions(
+      n_cells, formulation::Vector(dofs_per_cell));
+  system::MPIVector previous_solution;
+  previous_solution.reinit(domain_ptr_->locally_owned_dofs(),
+                           domain_ptr_->locally_relevant_dofs(),
+                           MPI_COMM_WORLD);
+
+  for (int angle = 0; angle < total_angles; ++angle) {
+    system::Index index{group, angle};
+    auto& solution = group_solution[angle];
+    auto right_hand_side_ptr = system.right_hand_side_ptr_->GetFullTermPtr(index);
+    const auto quadrature_point = quadrature_set_ptr_->GetQuadraturePoint(
+        quadrature::QuadraturePointIndex(angle));
+    const auto omega = quadrature_point->cartesian_position_tensor();
+
+    // Upwind values not swept yet are taken from the previous iteration
+    previous_solution = solution;
+    std::vector<bool> is_swept(n_cells, false);
+
+    for (const int position : SweepOrder(angle)) {
+      const auto& cell = cells_[position];
+
+      cell_matrix = 0;
+      formulation_ptr_->FillCellCollisionTerm(cell_matrix, cell, energy_group);
+      formulation_ptr_->FillCellStreamingTerm(cell_matrix, cell,
+                                              quadrature_point);
+      cell->get_dof_values(*right_hand_side_ptr, cell_rhs);
+
+      for (int face = 0; face < faces_per_cell; ++face) {
+        const domain::FaceIndex face_index(face);
+        formulation_ptr_->FillFaceOutflowTerm(cell_matrix, cell, face_index,
+                                              quadrature_point);
+        // Boundaries are vacuum, outflow faces need no upwind values
+        if (cell->at_boundary(face) ||
+            face_normals_[position][face] * omega >= 0)
+          continue;
+
+        const auto neighbor = cell->neighbor(face);
+        const auto neighbor_position =
+            cell_positions_.find(neighbor->active_cell_index());
+        if (neighbor_position != cell_positions_.end() &&
+            is_swept[neighbor_position->second]) {
+          upwind_values = cell_solutions[neighbor_position->second];
+        } else {
+          neighbor->get_dof_values(previous_solution, upwind_values);
+        }
+        formulation_ptr_->FillFaceInflowTerm(cell_rhs, cell, face_index,
+                                             quadrature_point, upwind_values);
+      }
+
+      cell_matrix.gauss_jordan();
+      cell_matrix.vmult(cell_solutions[position], cell_rhs);
+      is_swept[position] = true;
+      cell->set_dof_values(cell_solutions[position], solution);
+    }
+    solution.compress(dealii::VectorOperation::insert);
+    group_solution.AngleSolved(angle);
+  }
+}
+
+template <int dim>
+const std::vector<int>& SweepGroupSolver<dim>::SweepOrder(const int angle) {
+  UpdateCells();
+  if (auto cached = sweep_orders_.find(angle); cached != sweep_orders_.end())
+    return cached->second;
+
+  constexpr int faces_per_cell = dealii::GeometryInfo<dim>::faces_per_cell;
+  const int n_cells = cells_.size();
+  const auto omega = quadrature_set_ptr_->GetQuadraturePoint(
+      quadrature::QuadraturePointIndex(angle))->cartesian_position_tensor();
+
+  // Dependency graph of the locally owned cells
+  std::vector<int> n_upwind(n_cells, 0);
+  std::vector<std::vector<int>> downwind(n_cells);
+  for (int position = 0; position < n_cells; ++position) {
+    const auto& cell = cells_[position];
+    for (int face = 0; face < faces_per_cell; ++face) {
+      if (cell->at_boundary(face) ||
+          face_normals_[position][face] * omega >= 0)
+        continue;
+      const auto neighbor_position =
+          cell_positions_.find(cell->neighbor(face)->active_cell_index());
+      if (neighbor_position != cell_positions_.end()) {
+        ++n_upwind[position];
+        downwind[neighbor_position->second].push_back(position);
+      }
+    }
+  }
+
+  std::vector<int> order;
+  order.reserve(n_cells);
+  std::vector<bool> is_ordered(n_cells, false);
+  std::deque<int> ready;
+  for (int position = 0; position < n_cells; ++position) {
+    if (n_upwind[position] == 0)
+      ready.push_back(position);
+  }
+
+  while (static_cast<int>(order.size()) < n_cells) {
+    if (ready.empty()) {
+      // Dependency cycle, sweep the cell missing the fewest upwind neighbors
+      int next = -1;
+      for (int position = 0; position < n_cells; ++position) {
+        if (!is_ordered[position] &&
+            (next < 0 || n_upwind[position] < n_upwind[next]))
+          next = position;
+      }
+      n_upwind[next] = 0;
+      ready.push_back(next);
+    }
+    const int position = ready.front();
+    ready.pop_front();
+    order.push_back(position);
+    is_ordered[position] = true;
+    for (const int downwind_position : downwind[position]) {
+      if (--n_upwind[downwind_position] == 0 && !is_ordered[downwind_position])
+        ready.push_back(downwind_position);
+    }
+  }
+
+  return sweep_orders_.insert_or_assign(angle, std::move(order)).first->second;
+}
+
+template <int dim>
+void SweepGroupSolver<dim>::UpdateCells() {
+  auto cells = domain_ptr_->Cells();
+  if (!cells_.empty() && cells == cells_)
+    return;
+
+  constexpr int faces_per_cell = dealii::GeometryInfo<dim>::faces_per_cell;
+  cells_ = std::move(cells);
+  sweep_orders_.clear();
+  cell_positions_.clear();
+  face_normals_.assign(cells_.size(), {});
+
+  for (int position = 0; position < static_cast<int>(cells_.size());
+       ++position) {
+    const auto& cell = cells_[position];
+    cell_positions_[cell->active_cell_index()] = position;
+    for (int face = 0; face < faces_per_cell; ++face) {
+      AssertThrow(cell->at_boundary(face) ||
+                  (!cell->neighbor_is_coarser(face) &&
+                   !cell->neighbor(face)->has_children()),
+                  dealii::ExcMessage("Error in SweepGroupSolver, "
+                                     "non-conforming meshes are not "
+                                     "supported"))
+      finite_element_ptr_->SetFace(cell, domain::FaceIndex(face));
+      face_normals_[position].push_back(finite_element_ptr_->FaceNormal());
+    }
+  }
+}
+
+template class SweepGroupSolver<1>;
+template class SweepGroupSolver<2>;
+template class SweepGroupSolver<3>;
+
+} // namespace group
+
+} // namespace solver
+
+} // namespace bart
@@ -0,0 +1,107 @@
+#ifndef BART_SRC_SOLVER_GROUP_SWEEP_GROUP_SOLVER_H_
+#define BART_SRC_SOLVER_GROUP_SWEEP_GROUP_SOLVER_H_
+
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include <deal.II/base/tensor.h>
+
+#include "domain/definition_i.h"
+#include "domain/finite_element/finite_element_i.h"
+#include "formulation/angular/upwind_dfem_i.h"
+#include "quadrature/quadrature_set_i.h"
+#include "solver/group/single_group_solver_i.h"
+
+namespace bart {
+
+namespace solver {
+
+namespace group {
+
+/*! \brief Solves a group by sweeping the upwind DFEM formulation.
+ *
+ * For each angle the locally owned cells are visited in upwind order, every
+ * cell is solved with a local dense solve using the angular flux of the
+ * already solved upwind neighbors. No global matrix is assembled, only the
+ * right-hand side terms of the system are used.
+ *
+ * The sweep order of each angle is found once from the dependency graph of the
+ * locally owned cells and cached until the domain cells change. Cells with
+ * \f$(\hat{n}\cdot\vec{\Omega}) < 0\f$ on a face depend on the neighbor across
+ * it, faces with \f$(\hat{n}\cdot\vec{\Omega}) = 0\f$ do not couple cells.
+ * Cyclic dependencies, possible on curved or distorted meshes, are broken at the
+ * cell with the fewest unresolved upwind neighbors. Neighbors that are owned
+ * by other processes or that close a cycle use the angular flux of the previous
+ * iteration, the processes therefore sweep concurrently and are coupled as a
+ * block Jacobi iteration converged by the group source iteration.
+ *
+ * This is not a parallel (KBA) sweep, no process waits for the angular flux
+ * of its upwind processes within an iteration. Information crosses one
+ * partition boundary per group source iteration, so the number of iterations
+ * grows with the number of partitions along the direction of flight,
+ * particularly for problems with little scattering.
+ *
+ * Each angle is lagged with its own solution of the previous iteration, so
+ * the group solution must store every angle, an accumulated solution that
+ * shares one vector between angles is rejected when the framework is built.
+ *
+ * All boundaries are vacuum boundaries, reflective boundaries are rejected
+ * when the framework is built.
+ *
+ * @tparam dim spatial dimension
+ */
+template <int dim>
+class SweepGroupSolver : public SingleGroupSolverI {
+ public:
+  using FormulationType = formulation::angular::UpwindDFEMI<dim>;
+  using FiniteElementType = domain::finite_element::FiniteElementI<dim>;
+  using DomainType = domain::DefinitionI<dim>;
+  using QuadratureSetType = quadrature::QuadratureSetI<dim>;
+
+  SweepGroupSolver(std::shared_ptr<FormulationType>,
+                   std::shared_ptr<FiniteElementType>,
+                   std::shared_ptr<DomainType>,
+                   std::shared_ptr<QuadratureSetType>);
+  virtual ~SweepGroupSolver() = default;
+
+  void SolveGroup(const int group,
+                  const system::System &system,
+                  system::solution::MPIGroupAngularSolutionI &group_solution) override;
+
+  /*! \brief Returns the sweep order for an angle as positions in the locally
+   * owned cells of the domain */
+  const std::vector<int>& SweepOrder(const int angle);
+
+  FormulationType* formulation_ptr() const { return formulation_ptr_.get(); }
+  FiniteElementType* finite_element_ptr() const {
+    return finite_element_ptr_.get(); }
+  DomainType* domain_ptr() const { return domain_ptr_.get(); }
+  QuadratureSetType* quadrature_set_ptr() const {
+    return quadrature_set_ptr_.get(); }
+
+ private:
+  //! Caches the cells and face normals, clears sweep orders if cells changed
+  void UpdateCells();
+
+  std::shared_ptr<FormulationType> formulation_ptr_;
+  std::shared_ptr<FiniteElementType> finite_element_ptr_;
+  std::shared_ptr<DomainType> domain_ptr_;
+  std::shared_ptr<QuadratureSetType> quadrature_set_ptr_;
+
+  typename DomainType::CellRange cells_;
+  //! Position in cells_ of each locally owned cell, by active cell index
+  std::unordered_map<unsigned int, int> cell_positions_;
+  //! Face normals of each cell, by position in cells_
+  std::vector<std::vector<dealii::Tensor<1, dim>>> face_normals_;
+  std::map<int, std::vector<int>> sweep_orders_;
+};
+
+} // namespace group
+
+} // namespace solver
+
+} // namespace bart
+
+#endif //BART_SRC_SOLVER_GROUP_SWEEP_GROUP_SOLVER_H_
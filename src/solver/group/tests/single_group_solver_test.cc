@@ -71,6 +71,7 @@ TEST_F(SolverGroupSingleGroupSolverTest, Constructor) {
   auto test_ptr = dynamic_cast<LinearSolver*>(test_solver.linear_solver_ptr());
 
   EXPECT_NE(test_ptr, nullptr);
+  EXPECT_EQ(test_solver.constraints_ptr(), nullptr);
 }
 
 TEST_F(SolverGroupSingleGroupSolverTest, SolveGroupOperation) {
@@ -113,6 +114,8 @@ TEST_F(SolverGroupSingleGroupSolverTest, SolveGroupOperation) {
         Pointee(solution_vectors_[angle]),
         rhs_vectors_[angle].get(),
         _));
+    // Expect to report each solved angle
+    EXPECT_CALL(solution_, AngleSolved(angle));
   }
 
   test_solver.SolveGroup(test_group_, test_system_, solution_);
@@ -0,0 +1,169 @@
+#include "solver/group/sweep_group_solver.h"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+
+#include <deal.II/base/geometry_info.h>
+
+#include "data/cross_sections.h"
+#include "domain/definition.h"
+#include "domain/finite_element/finite_element_gaussian.h"
+#include "domain/mesh/mesh_cartesian.h"
+#include "formulation/angular/upwind_dfem.h"
+#include "material/tests/mock_material.h"
+#include "quadrature/tests/quadrature_point_mock.h"
+#include "quadrature/tests/quadrature_set_mock.h"
+#include "system/solution/mpi_group_angular_solution.h"
+#include "system/system.h"
+#include "system/system_functions.h"
+#include "system/terms/tests/linear_term_mock.h"
+#include "test_helpers/gmock_wrapper.h"
+
+namespace {
+
+using namespace bart;
+
+using ::testing::NiceMock, ::testing::Return, ::testing::_;
+
+/* Sweeps the upwind DFEM formulation on a cartesian mesh of [0, 2]^dim with a
+ * purely absorbing material, sigma_t = 1, and two directions, the first
+ * pointing into the positive octant and the second its reflection. */
+template <typename DimensionWrapper>
+class SolverGroupSweepGroupSolverTest : public ::testing::Test {
+ protected:
+  static constexpr int dim = DimensionWrapper::value;
+  using SweepSolverType = solver::group::SweepGroupSolver<dim>;
+  using QuadraturePointType = NiceMock<quadrature::QuadraturePointMock<dim>>;
+
+  std::shared_ptr<domain::Definition<dim>> domain_ptr_;
+  std::shared_ptr<domain::finite_element::FiniteElementGaussian<dim>>
+      finite_element_ptr_;
+  std::shared_ptr<NiceMock<quadrature::QuadratureSetMock<dim>>>
+      quadrature_set_ptr_;
+  std::shared_ptr<formulation::angular::UpwindDFEM<dim>> formulation_ptr_;
+  std::unique_ptr<SweepSolverType> test_solver_ptr_;
+  NiceMock<btest::MockMaterial> mock_material_;
+
+  std::array<dealii::Tensor<1, dim>, 2> directions_;
+  const int n_cells_ = (dim == 1) ? 20 : 4;
+
+  void SetUp() override;
+};
+
+template <typename DimensionWrapper>
+void SolverGroupSweepGroupSolverTest<DimensionWrapper>::SetUp() {
+  using DiscretizationType = problem::DiscretizationType;
+  finite_element_ptr_ = std::make_shared<
+      domain::finite_element::FiniteElementGaussian<dim>>(
+          DiscretizationType::kDiscontinuousFEM, 1);
+  domain_ptr_ = std::make_shared<domain::Definition<dim>>(
+      std::make_unique<domain::mesh::MeshCartesian<dim>>(
+          std::vector<double>(dim, 2.0), std::vector<int>(dim, n_cells_), "1"),
+      finite_element_ptr_, DiscretizationType::kDiscontinuousFEM);
+  domain_ptr_->SetUpMesh();
+  domain_ptr_->SetUpDOF();
+
+  const std::unordered_map<int, std::vector<double>> sigma_t{{1, {1.0}}};
+  ON_CALL(mock_material_, GetSigT()).WillByDefault(Return(sigma_t));
+  formulation_ptr_ = std::make_shared<formulation::angular::UpwindDFEM<dim>>(
+      finite_element_ptr_,
+      std::make_shared<data::CrossSections>(mock_material_));
+
+  quadrature_set_ptr_ =
+      std::make_shared<NiceMock<quadrature::QuadratureSetMock<dim>>>();
+  for (int angle = 0; angle < 2; ++angle) {
+    for (int i = 0; i < dim; ++i)
+      directions_[angle][i] = (angle == 0 ? 1.0 : -1.0) * (i + 1);
+    directions_[angle] /= directions_[angle].norm();
+    auto quadrature_point_ptr = std::make_shared<QuadraturePointType>();
+    ON_CALL(*quadrature_point_ptr, cartesian_position_tensor())
+        .WillByDefault(Return(directions_[angle]));
+    ON_CALL(*quadrature_set_ptr_,
+            GetQuadraturePoint(quadrature::QuadraturePointIndex(angle)))
+        .WillByDefault(Return(quadrature_point_ptr));
+  }
+
+  test_solver_ptr_ = std::make_unique<SweepSolverType>(
+      formulation_ptr_, finite_element_ptr_, domain_ptr_, quadrature_set_ptr_);
+}
+
+TYPED_TEST_CASE(SolverGroupSweepGroupSolverTest, bart::testing::AllDimensions);
+
+TYPED_TEST(SolverGroupSweepGroupSolverTest, ConstructorBadDependencies) {
+  constexpr int dim = this->dim;
+  using SweepSolverType = solver::group::SweepGroupSolver<dim>;
+
+  EXPECT_NE(this->test_solver_ptr_->formulation_ptr(), nullptr);
+  EXPECT_NE(this->test_solver_ptr_->domain_ptr(), nullptr);
+  EXPECT_ANY_THROW({
+    SweepSolverType test_solver(nullptr, this->finite_element_ptr_,
+                                this->domain_ptr_, this->quadrature_set_ptr_);
+  });
+  EXPECT_ANY_THROW({
+    SweepSolverType test_solver(this->formulation_ptr_, this->finite_element_ptr_,
+                                nullptr, this->quadrature_set_ptr_);
+  });
+}
+
+TYPED_TEST(SolverGroupSweepGroupSolverTest, SweepOrderIsUpwind) {
+  constexpr int dim = this->dim;
+  const auto cells = this->domain_ptr_->Cells();
+
+  for (int angle = 0; angle < 2; ++angle) {
+    const auto& order = this->test_solver_ptr_->SweepOrder(angle);
+    ASSERT_EQ(order.size(), cells.size());
+    // Every cell is swept after all of its upwind neighbors
+    std::vector<int> sweep_step(cells.size(), -1);
+    for (int step = 0; step < static_cast<int>(order.size()); ++step)
+      sweep_step[order[step]] = step;
+    for (int position = 0; position < static_cast<int>(cells.size());
+         ++position) {
+      const auto& cell = cells[position];
+      ASSERT_GE(sweep_step[position], 0);
+      for (unsigned int face = 0;
+           face < dealii::GeometryInfo<dim>::faces_per_cell; ++face) {
+        if (cell->at_boundary(face))
+          continue;
+        const auto to_neighbor = cell->neighbor(face)->center() - cell->center();
+        if (to_neighbor * this->directions_[angle] < 0) {
+          const auto neighbor_position = std::find(
+              cells.begin(), cells.end(), cell->neighbor(face)) - cells.begin();
+          EXPECT_LT(sweep_step[neighbor_position], sweep_step[position]);
+        }
+      }
+    }
+    // Cached orders are returned for repeated calls
+    EXPECT_EQ(&order, &this->test_solver_ptr_->SweepOrder(angle));
+  }
+}
+
+TYPED_TEST(SolverGroupSweepGroupSolverTest, PureAbsorberSlab) {
+  constexpr int dim = this->dim;
+  if (dim != 1)
+    return;
+
+  // A uniform source q = 1 with a vacuum boundary gives, for mu = 1,
+  // psi(x) = 1 - exp(-x), the maximum is at the outflow boundary
+  auto source_ptr = this->domain_ptr_->MakeSystemVector();
+  const double cell_width = 2.0 / this->n_cells_;
+  *source_ptr = cell_width / 2;
+
+  system::System test_system;
+  auto rhs_ptr = std::make_unique<NiceMock<system::terms::LinearTermMock>>();
+  EXPECT_CALL(*rhs_ptr, GetFullTermPtr(_))
+      .Times(2)
+      .WillRepeatedly(Return(source_ptr));
+  test_system.right_hand_side_ptr_ = std::move(rhs_ptr);
+
+  system::solution::MPIGroupAngularSolution group_solution(2);
+  system::SetUpMPIAngularSolution(group_solution, *this->domain_ptr_, 0.0);
+
+  this->test_solver_ptr_->SolveGroup(0, test_system, group_solution);
+
+  const double expected_outflow = 1.0 - std::exp(-2.0);
+  for (int angle = 0; angle < 2; ++angle)
+    EXPECT_NEAR(group_solution[angle].max(), expected_outflow, 1e-4);
+}
+
+} // namespace
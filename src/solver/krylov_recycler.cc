@@ -0,0 +1,157 @@
+#include "solver/krylov_recycler.h"
+
+namespace bart {
+
+namespace solver {
+
+namespace {
+
+void InitializeLike(system::MPIVector &to_initialize,
+                    const dealii::PETScWrappers::VectorBase &layout) {
+  to_initialize.reinit(layout.locally_owned_elements(),
+                       layout.get_mpi_communicator());
+}
+
+} // namespace
+
+KrylovRecycler::KrylovRecycler(std::unique_ptr<LinearSolver> linear_solver_ptr,
+                               const int max_vectors,
+                               const int max_total_vectors)
+    : linear_solver_ptr_(std::move(linear_solver_ptr)),
+      max_vectors_(max_vectors),
+      max_total_vectors_(max_total_vectors) {
+  AssertThrow(linear_solver_ptr_ != nullptr,
+              dealii::ExcMessage("Linear solver pointer passed to "
+                                 "KrylovRecycler constructor is null"));
+  AssertThrow(max_vectors_ > 0,
+              dealii::ExcMessage("Maximum recycled vectors passed to "
+                                 "KrylovRecycler constructor must be > 0"));
+  AssertThrow(max_total_vectors_ >= max_vectors_,
+              dealii::ExcMessage("Maximum total recycled vectors passed to "
+                                 "KrylovRecycler constructor must be >= the "
+                                 "maximum recycled vectors per index"));
+}
+
+void KrylovRecycler::Solve(
+    dealii::PETScWrappers::MatrixBase *A,
+    dealii::PETScWrappers::VectorBase *x,
+    dealii::PETScWrappers::VectorBase *b,
+    dealii::PETScWrappers::PreconditionerBase *preconditioner) {
+  linear_solver_ptr_->Solve(A, x, b, preconditioner);
+}
+
+void KrylovRecycler::Solve(
+    dealii::PETScWrappers::MatrixBase *A,
+    dealii::PETScWrappers::VectorBase *x,
+    dealii::PETScWrappers::VectorBase *b,
+    dealii::PETScWrappers::PreconditionerBase *preconditioner,
+    const system::Index index) {
+  auto [space_it, inserted] = recycled_spaces_.try_emplace(index);
+  auto& space = space_it->second;
+
+  // Mark this index as the most recently used
+  if (inserted) {
+    usage_order_.push_front(index);
+    space.usage_position = usage_order_.begin();
+  } else {
+    usage_order_.splice(usage_order_.begin(), usage_order_,
+                        space.usage_position);
+  }
+
+  if (!space.c.empty())
+    ProjectInitialGuess(*A, *x, *b, space);
+
+  linear_solver_ptr_->Solve(A, x, b, preconditioner, index);
+
+  AddToSpace(*A, *x, space);
+  EvictLeastRecentlyUsed(index);
+}
+
+void KrylovRecycler::ClearRecycledSpaces() {
+  recycled_spaces_.clear();
+  usage_order_.clear();
+  total_vectors_ = 0;
+}
+
+void KrylovRecycler::EvictLeastRecentlyUsed(const system::Index current_index) {
+  while (total_vectors_ > max_total_vectors_) {
+    const auto least_recent_index = usage_order_.back();
+    // The current space is bounded by max_vectors <= max_total_vectors
+    if (least_recent_index == current_index)
+      break;
+    const auto space_it = recycled_spaces_.find(least_recent_index);
+    total_vectors_ -= static_cast<int>(space_it->second.c.size());
+    recycled_spaces_.erase(space_it);
+    usage_order_.pop_back();
+  }
+}
+
+int KrylovRecycler::recycled_vectors(const system::Index index) const {
+  const auto space_it = recycled_spaces_.find(index);
+  if (space_it == recycled_spaces_.cend())
+    return 0;
+  return static_cast<int>(space_it->second.c.size());
+}
+
+void KrylovRecycler::ProjectInitialGuess(
+    dealii::PETScWrappers::MatrixBase &A,
+    dealii::PETScWrappers::VectorBase &x,
+    const dealii::PETScWrappers::VectorBase &b,
+    const RecycledSpace &space) const {
+  // Residual r = b - Ax
+  system::MPIVector residual;
+  InitializeLike(residual, b);
+  A.vmult(residual, x);
+  residual.sadd(-1.0, 1.0, b);
+
+  const int n_vectors = space.c.size();
+  for (int i = 0; i < n_vectors; ++i) {
+    const double alpha = space.c[i] * residual;
+    x.add(alpha, space.u[i]);
+    residual.add(-alpha, space.c[i]);
+  }
+}
+
+void KrylovRecycler::AddToSpace(dealii::PETScWrappers::MatrixBase &A,
+                                const dealii::PETScWrappers::VectorBase &x,
+                                RecycledSpace &space) {
+  system::MPIVector u, c;
+  InitializeLike(u, x);
+  InitializeLike(c, x);
+  u.equ(1.0, x);
+  A.vmult(c, u);
+
+  const double initial_norm = c.l2_norm();
+  if (initial_norm == 0)
+    return;
+
+  // Modified Gram-Schmidt against the recycled images
+  const int n_vectors = space.c.size();
+  for (int i = 0; i < n_vectors; ++i) {
+    const double beta = space.c[i] * c;
+    c.add(-beta, space.c[i]);
+    u.add(-beta, space.u[i]);
+  }
+
+  // Skip directions that are already (numerically) in the recycled space
+  const double norm = c.l2_norm();
+  if (norm <= 1e-8 * initial_norm)
+    return;
+
+  c /= norm;
+  u /= norm;
+
+  space.u.push_back(std::move(u));
+  space.c.push_back(std::move(c));
+  ++total_vectors_;
+
+  if (static_cast<int>(space.c.size()) > max_vectors_) {
+    space.u.pop_front();
+    space.c.pop_front();
+    --total_vectors_;
+  }
+}
+
+} // namespace solver
+
+} // namespace bart
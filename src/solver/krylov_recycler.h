@@ -0,0 +1,108 @@
+#ifndef BART_SRC_SOLVER_KRYLOV_RECYCLER_H_
+#define BART_SRC_SOLVER_KRYLOV_RECYCLER_H_
+
+#include <deque>
+#include <list>
+#include <map>
+#include <memory>
+
+#include "solver/linear_i.h"
+#include "system/system_types.h"
+
+namespace bart {
+
+namespace solver {
+
+/*! \brief Retains a recycled subspace for each (group, angle) system between
+ * solves.
+ *
+ * Each system \f$Ax = b\f$ identified by a (group, angle) index is solved many
+ * times with a fixed matrix and a slowly changing right hand side. For each
+ * index this class retains a set of vectors \f$U\f$ and \f$C = AU\f$ where
+ * \f$C\f$ is orthonormal (as in GCRO methods). Before each solve the initial
+ * guess is corrected by the minimal residual projection onto the recycled
+ * space,
+ *
+ * \f[
+ * x_0 \leftarrow x_0 + UC^T(b - Ax_0),
+ * \f]
+ *
+ * and the provided Krylov solver then only has to resolve the residual
+ * component outside \f$\text{span}(C)\f$. After the solve, the new solution
+ * direction is orthogonalized against \f$C\f$ and added to the space. At most
+ * `max_vectors` pairs are retained per index; the oldest pair is discarded
+ * when the cap is reached. At most `max_total_vectors` pairs are retained
+ * across all indices, when this cap is reached the recycled spaces of the
+ * least recently solved indices are discarded, bounding the total memory used
+ * independent of the number of groups and angles.
+ *
+ * Solves that are not identified by an index are passed directly to the
+ * Krylov solver.
+ *
+ */
+class KrylovRecycler : public LinearI {
+ public:
+  using LinearSolver = solver::LinearI;
+
+  KrylovRecycler(std::unique_ptr<LinearSolver> linear_solver_ptr,
+                 const int max_vectors = 10,
+                 const int max_total_vectors = 200);
+  ~KrylovRecycler() = default;
+
+  void Solve(dealii::PETScWrappers::MatrixBase *A,
+             dealii::PETScWrappers::VectorBase *x,
+             dealii::PETScWrappers::VectorBase *b,
+             dealii::PETScWrappers::PreconditionerBase *preconditioner) override;
+  void Solve(dealii::PETScWrappers::MatrixBase *A,
+             dealii::PETScWrappers::VectorBase *x,
+             dealii::PETScWrappers::VectorBase *b,
+             dealii::PETScWrappers::PreconditionerBase *preconditioner,
+             const system::Index index) override;
+
+  /*! \brief Discards all recycled subspaces, must be called if the system
+   * matrices change. */
+  void ClearRecycledSpaces();
+
+  /*! \brief Returns the number of vectors recycled for a given index. */
+  int recycled_vectors(const system::Index index) const;
+  /*! \brief Returns the number of vectors recycled for all indices. */
+  int total_recycled_vectors() const { return total_vectors_; }
+  int max_vectors() const { return max_vectors_; }
+  int max_total_vectors() const { return max_total_vectors_; }
+  LinearSolver* linear_solver_ptr() const { return linear_solver_ptr_.get(); }
+
+ private:
+  struct RecycledSpace {
+    //! Recycled solution directions, \f$U\f$
+    std::deque<system::MPIVector> u;
+    //! Orthonormal images of the recycled directions, \f$C = AU\f$
+    std::deque<system::MPIVector> c;
+    //! Position of the index in the usage order
+    std::list<system::Index>::iterator usage_position;
+  };
+
+  void ProjectInitialGuess(dealii::PETScWrappers::MatrixBase &A,
+                           dealii::PETScWrappers::VectorBase &x,
+                           const dealii::PETScWrappers::VectorBase &b,
+                           const RecycledSpace &space) const;
+  void AddToSpace(dealii::PETScWrappers::MatrixBase &A,
+                  const dealii::PETScWrappers::VectorBase &x,
+                  RecycledSpace &space);
+  /*! \brief Discards least recently used spaces, other than the space for the
+   * given index, until the total cap is met. */
+  void EvictLeastRecentlyUsed(const system::Index current_index);
+
+  std::unique_ptr<LinearSolver> linear_solver_ptr_ = nullptr;
+  const int max_vectors_;
+  const int max_total_vectors_;
+  int total_vectors_ = 0;
+  std::map<system::Index, RecycledSpace> recycled_spaces_;
+  //! Indices with recycled spaces, most recently solved first
+  std::list<system::Index> usage_order_;
+};
+
+} // namespace solver
+
+} // namespace bart
+
+#endif //BART_SRC_SOLVER_KRYLOV_RECYCLER_H_
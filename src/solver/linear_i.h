@@ -5,6 +5,8 @@
 #include <deal.II/lac/petsc_matrix_base.h>
 #include <deal.II/lac/petsc_vector_base.h>
 
+#include "system/system_types.h"
+
 namespace bart {
 
 namespace solver {
@@ -22,10 +24,25 @@ class LinearI {
       dealii::PETScWrappers::VectorBase *x,
       dealii::PETScWrappers::VectorBase *b,
       dealii::PETScWrappers::PreconditionerBase *preconditioner) = 0;
+
+  /*! \brief Solve a system identified by its (group, angle) index.
+   *
+   * Solvers that retain information between repeated solves of the same
+   * system (such as recycled Krylov subspaces) use the index to identify the
+   * system. The default implementation ignores the index.
+   */
+  virtual void Solve(
+      dealii::PETScWrappers::MatrixBase *A,
+      dealii::PETScWrappers::VectorBase *x,
+      dealii::PETScWrappers::VectorBase *b,
+      dealii::PETScWrappers::PreconditionerBase *preconditioner,
+      const system::Index /*index*/) {
+    Solve(A, x, b, preconditioner);
+  }
 };
 
 } // namespace solver
 
 } // namespace bart
 
-#endif // BART_SOLVER_LINEAR_I_H_
\ No newline at end of file
+#endif // BART_SOLVER_LINEAR_I_H_
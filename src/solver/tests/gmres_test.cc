@@ -6,6 +6,7 @@
 #include <deal.II/base/tensor.h>
 #include <deal.II/lac/petsc_vector.h>
 
+#include "convergence/tests/inner_tolerance_mock.h"
 #include "test_helpers/test_helper_functions.h"
 #include "test_helpers/gmock_wrapper.h"
 
@@ -28,6 +29,12 @@ TEST_F(SolverGMRESTest, Constructor) {
   bart::solver::GMRES solver_2(210, 1e-6);
   EXPECT_EQ(solver_2.solver_control().max_steps(), 210);
   EXPECT_EQ(solver_2.solver_control().tolerance(), 1e-6);
+  EXPECT_EQ(solver_2.inner_tolerance_ptr(), nullptr);
+
+  auto inner_tolerance_ptr =
+      std::make_shared<bart::convergence::InnerToleranceMock>();
+  bart::solver::GMRES solver_3(100, 1e-10, inner_tolerance_ptr);
+  EXPECT_EQ(solver_3.inner_tolerance_ptr(), inner_tolerance_ptr.get());
 }
 
 TEST_F(SolverGMRESTest, SolveTestNoPrecon) {
@@ -65,4 +72,59 @@ TEST_F(SolverGMRESTest, SolveTestNoPrecon) {
   for (int i = 0; i < 3; ++i) {
     EXPECT_NEAR(petsc_x[i], x[i], 1e-6);
   }
-}
\ No newline at end of file
+}
+
+TEST_F(SolverGMRESTest, SolveTestInnerTolerance) {
+  using ::testing::Return;
+
+  std::vector<double> b{5,7,8};
+  std::vector<double> x{-15, 8, 2};
+  std::vector<std::vector<double>> A = {
+      {1, 3, -2}, {3, 5, 6}, {2, 4, 3}
+  };
+
+  std::vector<unsigned int> indices{0,1,2};
+  std::vector<double> zeroes(3,0);
+
+  Vector petsc_b(MPI_COMM_WORLD, 3, 3);
+  petsc_b.set(indices, b);
+  petsc_b.compress(dealii::VectorOperation::insert);
+  Vector petsc_x(MPI_COMM_WORLD, 3, 3);
+  petsc_x.set(indices, zeroes);
+  petsc_x.compress(dealii::VectorOperation::insert);
+
+  FullMatrix petsc_A(3,3);
+
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      petsc_A.set(i, j, A[i][j]);
+    }
+  }
+  petsc_A.compress(dealii::VectorOperation::insert);
+
+  dealii::PETScWrappers::PreconditionNone no_conditioner(petsc_A);
+
+  auto inner_tolerance_ptr =
+      std::make_shared<bart::convergence::InnerToleranceMock>();
+  const double relative_tolerance = 1e-4;
+  EXPECT_CALL(*inner_tolerance_ptr, tolerance())
+      .WillOnce(Return(relative_tolerance))
+      .WillOnce(Return(1e-20));
+
+  bart::solver::GMRES solver(100, 1e-10, inner_tolerance_ptr);
+  solver.Solve(&petsc_A, &petsc_x, &petsc_b, &no_conditioner);
+
+  EXPECT_NEAR(solver.solver_control().tolerance(),
+              relative_tolerance * petsc_b.l2_norm(), 1e-12);
+  EXPECT_LE(solver.solver_control().last_value(),
+            relative_tolerance * petsc_b.l2_norm());
+
+  // Fixed convergence tolerance is used as a floor
+  petsc_x.set(indices, zeroes);
+  petsc_x.compress(dealii::VectorOperation::insert);
+  solver.Solve(&petsc_A, &petsc_x, &petsc_b, &no_conditioner);
+  EXPECT_EQ(solver.solver_control().tolerance(), 1e-10);
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_NEAR(petsc_x[i], x[i], 1e-6);
+  }
+}
@@ -0,0 +1,174 @@
+#include "solver/krylov_recycler.h"
+
+#include <deal.II/lac/petsc_full_matrix.h>
+#include <deal.II/lac/petsc_vector.h>
+
+#include "solver/gmres.h"
+#include "solver/tests/linear_mock.h"
+#include "test_helpers/gmock_wrapper.h"
+
+namespace {
+
+using namespace bart;
+
+using ::testing::_;
+
+class SolverKrylovRecyclerTest : public ::testing::Test {
+ protected:
+  using FullMatrix = dealii::PETScWrappers::FullMatrix;
+  using Vector = dealii::PETScWrappers::MPI::Vector;
+
+  FullMatrix petsc_A{3, 3};
+  Vector petsc_x, petsc_b;
+  std::vector<unsigned int> indices{0, 1, 2};
+
+  void SetUp() override;
+  void SetVector(Vector& to_set, std::vector<double> values);
+};
+
+void SolverKrylovRecyclerTest::SetUp() {
+  std::vector<std::vector<double>> A = {
+      {1, 3, -2}, {3, 5, 6}, {2, 4, 3}
+  };
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      petsc_A.set(i, j, A[i][j]);
+    }
+  }
+  petsc_A.compress(dealii::VectorOperation::insert);
+
+  petsc_x.reinit(MPI_COMM_WORLD, 3, 3);
+  petsc_b.reinit(MPI_COMM_WORLD, 3, 3);
+  SetVector(petsc_x, {0, 0, 0});
+  SetVector(petsc_b, {5, 7, 8});
+}
+
+void SolverKrylovRecyclerTest::SetVector(Vector& to_set,
+                                         std::vector<double> values) {
+  to_set.set(indices, values);
+  to_set.compress(dealii::VectorOperation::insert);
+}
+
+TEST_F(SolverKrylovRecyclerTest, Constructor) {
+  auto linear_solver_ptr = std::make_unique<solver::LinearMock>();
+  auto linear_solver_obs_ptr = linear_solver_ptr.get();
+  solver::KrylovRecycler test_recycler(std::move(linear_solver_ptr), 5, 20);
+
+  EXPECT_EQ(test_recycler.linear_solver_ptr(), linear_solver_obs_ptr);
+  EXPECT_EQ(test_recycler.max_vectors(), 5);
+  EXPECT_EQ(test_recycler.max_total_vectors(), 20);
+  EXPECT_EQ(test_recycler.recycled_vectors({0, 0}), 0);
+  EXPECT_EQ(test_recycler.total_recycled_vectors(), 0);
+}
+
+TEST_F(SolverKrylovRecyclerTest, ConstructorBadDependencies) {
+  EXPECT_ANY_THROW({
+    solver::KrylovRecycler test_recycler(nullptr);
+  });
+  EXPECT_ANY_THROW({
+    solver::KrylovRecycler test_recycler(
+        std::make_unique<solver::LinearMock>(), 0);
+  });
+  EXPECT_ANY_THROW({
+    solver::KrylovRecycler test_recycler(
+        std::make_unique<solver::LinearMock>(), 5, 4);
+  });
+}
+
+TEST_F(SolverKrylovRecyclerTest, SolveWithoutIndex) {
+  auto linear_solver_ptr = std::make_unique<solver::LinearMock>();
+  auto linear_solver_obs_ptr = linear_solver_ptr.get();
+  solver::KrylovRecycler test_recycler(std::move(linear_solver_ptr));
+  dealii::PETScWrappers::PreconditionNone no_conditioner(petsc_A);
+
+  EXPECT_CALL(*linear_solver_obs_ptr, Solve(&petsc_A, &petsc_x, &petsc_b,
+                                            &no_conditioner));
+  test_recycler.Solve(&petsc_A, &petsc_x, &petsc_b, &no_conditioner);
+  EXPECT_EQ(test_recycler.recycled_vectors({0, 0}), 0);
+}
+
+TEST_F(SolverKrylovRecyclerTest, RecycledSolve) {
+  std::vector<double> x{-15, 8, 2};
+  const system::Index index{1, 2};
+  dealii::PETScWrappers::PreconditionNone no_conditioner(petsc_A);
+
+  solver::KrylovRecycler test_recycler(
+      std::make_unique<solver::GMRES>(100, 1e-10));
+  auto gmres_ptr = dynamic_cast<solver::GMRES*>(
+      test_recycler.linear_solver_ptr());
+  ASSERT_NE(gmres_ptr, nullptr);
+
+  test_recycler.Solve(&petsc_A, &petsc_x, &petsc_b, &no_conditioner, index);
+  EXPECT_EQ(test_recycler.recycled_vectors(index), 1);
+  EXPECT_EQ(test_recycler.recycled_vectors({0, 0}), 0);
+  EXPECT_GT(gmres_ptr->solver_control().last_step(), 0);
+
+  // Solving again from a zero initial guess, the solution is recovered by the
+  // projection onto the recycled space.
+  SetVector(petsc_x, {0, 0, 0});
+  test_recycler.Solve(&petsc_A, &petsc_x, &petsc_b, &no_conditioner, index);
+  EXPECT_EQ(gmres_ptr->solver_control().last_step(), 0);
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_NEAR(petsc_x[i], x[i], 1e-6);
+  }
+  // No new direction was found
+  EXPECT_EQ(test_recycler.recycled_vectors(index), 1);
+}
+
+TEST_F(SolverKrylovRecyclerTest, MaxVectors) {
+  const system::Index index{0, 1};
+  dealii::PETScWrappers::PreconditionNone no_conditioner(petsc_A);
+
+  solver::KrylovRecycler test_recycler(
+      std::make_unique<solver::GMRES>(100, 1e-10), 2);
+
+  std::vector<std::vector<double>> right_hand_sides{
+      {5, 7, 8}, {1, 0, 0}, {0, 1, 0}, {0, 0, 1}};
+
+  for (int i = 0; i < 4; ++i) {
+    SetVector(petsc_b, right_hand_sides.at(i));
+    test_recycler.Solve(&petsc_A, &petsc_x, &petsc_b, &no_conditioner, index);
+    EXPECT_EQ(test_recycler.recycled_vectors(index), std::min(i + 1, 2));
+  }
+
+  test_recycler.ClearRecycledSpaces();
+  EXPECT_EQ(test_recycler.recycled_vectors(index), 0);
+  EXPECT_EQ(test_recycler.total_recycled_vectors(), 0);
+}
+
+/* The total number of recycled vectors is capped across all indices, the
+ * spaces of the least recently solved indices are discarded first. */
+TEST_F(SolverKrylovRecyclerTest, MaxTotalVectorsEviction) {
+  dealii::PETScWrappers::PreconditionNone no_conditioner(petsc_A);
+
+  solver::KrylovRecycler test_recycler(
+      std::make_unique<solver::GMRES>(100, 1e-10), 1, 2);
+
+  const system::Index index_a{0, 0}, index_b{0, 1}, index_c{1, 0};
+
+  auto solve = [&](const system::Index index) {
+    SetVector(petsc_x, {0, 0, 0});
+    test_recycler.Solve(&petsc_A, &petsc_x, &petsc_b, &no_conditioner, index);
+  };
+
+  solve(index_a);
+  solve(index_b);
+  EXPECT_EQ(test_recycler.total_recycled_vectors(), 2);
+
+  // Solving index a again makes b the least recently used
+  solve(index_a);
+  solve(index_c);
+  EXPECT_EQ(test_recycler.total_recycled_vectors(), 2);
+  EXPECT_EQ(test_recycler.recycled_vectors(index_a), 1);
+  EXPECT_EQ(test_recycler.recycled_vectors(index_b), 0);
+  EXPECT_EQ(test_recycler.recycled_vectors(index_c), 1);
+
+  // Now a is the least recently used
+  solve(index_b);
+  EXPECT_EQ(test_recycler.total_recycled_vectors(), 2);
+  EXPECT_EQ(test_recycler.recycled_vectors(index_a), 0);
+  EXPECT_EQ(test_recycler.recycled_vectors(index_b), 1);
+  EXPECT_EQ(test_recycler.recycled_vectors(index_c), 1);
+}
+
+} // namespace
@@ -10,6 +10,7 @@ namespace solver {
 
 class LinearMock : public LinearI {
  public:
+  using LinearI::Solve;
   MOCK_METHOD4(Solve, void(
       dealii::PETScWrappers::MatrixBase *A,
       dealii::PETScWrappers::VectorBase *x,
@@ -0,0 +1,57 @@
+#include "system/moments/moment_store.h"
+
+namespace bart {
+
+namespace system {
+
+namespace moments {
+
+MomentStore::MomentStore(const int total_groups, const int max_harmonic_l)
+    : total_groups_(total_groups),
+      max_harmonic_l_(max_harmonic_l) {
+  AssertThrow(total_groups > 0,
+              dealii::ExcMessage("Error system::moments::MomentStore "
+                                 "constructor, total_groups must be > 0"));
+  AssertThrow(max_harmonic_l >= 0 ,
+              dealii::ExcMessage("Error system::moments::MomentStore "
+                                 "constructor, l_max must be >= 0"));
+  moments_.resize(total_groups * (max_harmonic_l + 1) * (max_harmonic_l + 1));
+}
+
+MomentIndex MomentStore::GetMomentIndex(const int flat_index) const {
+  AssertThrow(flat_index >= 0 && flat_index < static_cast<int>(size()),
+              dealii::ExcMessage("Error in MomentStore::GetMomentIndex, flat "
+                                 "index is out of range"));
+  const int group = flat_index % total_groups_;
+  const int harmonic_index = flat_index / total_groups_;
+  int harmonic_l = 0;
+  while ((harmonic_l + 1) * (harmonic_l + 1) <= harmonic_index)
+    ++harmonic_l;
+  const int harmonic_m = harmonic_index - harmonic_l * harmonic_l - harmonic_l;
+  return {group, harmonic_l, harmonic_m};
+}
+
+MomentVector& MomentStore::at(const MomentIndex index) {
+  const auto& const_this = *this;
+  return const_cast<MomentVector&>(const_this.at(index));
+}
+
+const MomentVector& MomentStore::at(const MomentIndex index) const {
+  const auto& [group, harmonic_l, harmonic_m] = index;
+  AssertThrow(group >= 0 && group < total_groups_,
+              dealii::ExcMessage("Error in MomentStore::at, group is out of "
+                                 "range"));
+  AssertThrow(harmonic_l >= 0 && harmonic_l <= max_harmonic_l_,
+              dealii::ExcMessage("Error in MomentStore::at, harmonic l is out "
+                                 "of range"));
+  AssertThrow(harmonic_m >= -harmonic_l && harmonic_m <= harmonic_l,
+              dealii::ExcMessage("Error in MomentStore::at, harmonic m is out "
+                                 "of range"));
+  return moments_[FlatIndex(index)];
+}
+
+} // namespace moments
+
+} // namespace system
+
+} // namespace bart
@@ -0,0 +1,108 @@
+#ifndef BART_SRC_SYSTEM_MOMENTS_MOMENT_STORE_H_
+#define BART_SRC_SYSTEM_MOMENTS_MOMENT_STORE_H_
+
+#include <vector>
+
+#include "system/moments/spherical_harmonic_types.h"
+
+namespace bart {
+
+namespace system {
+
+namespace moments {
+
+/*! \brief Flat, index-addressed storage for spherical harmonic moments.
+ *
+ * All moments are held in a single contiguous array and addressed
+ * arithmetically by group \f$g\f$, degree \f$\ell\f$ and order \f$m\f$. Moments
+ * are ordered by harmonic first and group second, the moment
+ * \f$\phi_{g}^{\ell, m}\f$ is stored at
+ * \f[
+ * (\ell^2 + \ell + m)G + g
+ * \f]
+ * where \f$G\f$ is the total number of groups. The scalar flux moments
+ * (\f$\ell = m = 0\f$) for all groups are therefore the first \f$G\f$ entries
+ * and can be iterated over directly, without visiting higher moments.
+ *
+ * \code{cpp}
+ * system::moments::MomentStore store(2, 1);
+ * for (auto it = store.scalar_cbegin(); it != store.scalar_cend(); ++it) {
+ *   // *it is the scalar flux for group (it - store.scalar_cbegin())
+ * }
+ * \endcode
+ */
+class MomentStore {
+ public:
+  using iterator = std::vector<MomentVector>::iterator;
+  using const_iterator = std::vector<MomentVector>::const_iterator;
+
+  /*! \brief Constructor, allocates all moments (uninitialized).
+   *
+   * @param total_groups total number of energy groups, must be > 0.
+   * @param max_harmonic_l maximum harmonic degree, must be >= 0.
+   */
+  MomentStore(const int total_groups, const int max_harmonic_l);
+
+  /*! \brief Returns the flat index of moment \f$\phi_{g}^{\ell, m}\f$. No
+   * bounds checking is performed. */
+  int FlatIndex(const int group, const HarmonicL harmonic_l,
+                const HarmonicM harmonic_m) const {
+    return (harmonic_l * harmonic_l + harmonic_l + harmonic_m) * total_groups_
+        + group; }
+  /*! \brief Returns the flat index of the moment with index \f$[g, \ell, m]\f$.
+   * No bounds checking is performed. */
+  int FlatIndex(const MomentIndex index) const {
+    return FlatIndex(index[0], index[1], index[2]); }
+  /*! \brief Returns the moment index \f$[g, \ell, m]\f$ of a flat index. */
+  MomentIndex GetMomentIndex(const int flat_index) const;
+
+  /*! \brief Returns a moment, no bounds checking is performed. */
+  MomentVector& operator[](const MomentIndex index) {
+    return moments_[FlatIndex(index)]; }
+  /*! \brief Returns a moment, no bounds checking is performed. */
+  const MomentVector& operator[](const MomentIndex index) const {
+    return moments_[FlatIndex(index)]; }
+
+  /*! \brief Returns a moment, throws if the index is out of range. */
+  MomentVector& at(const MomentIndex index);
+  /*! \brief Returns a moment, throws if the index is out of range. */
+  const MomentVector& at(const MomentIndex index) const;
+
+  /*! \brief Returns the scalar flux moment \f$\phi_{g}^{0, 0}\f$. */
+  const MomentVector& scalar_moment(const int group) const {
+    return moments_[group]; }
+  /*! \brief Returns the scalar flux moment \f$\phi_{g}^{0, 0}\f$. */
+  MomentVector& scalar_moment(const int group) { return moments_[group]; }
+
+  /*! \brief Iterator to the scalar flux moment for group 0. */
+  const_iterator scalar_cbegin() const { return moments_.cbegin(); }
+  /*! \brief Iterator past the scalar flux moment of the last group. */
+  const_iterator scalar_cend() const {
+    return moments_.cbegin() + total_groups_; }
+
+  iterator begin() { return moments_.begin(); }
+  iterator end() { return moments_.end(); }
+  const_iterator begin() const { return moments_.cbegin(); }
+  const_iterator end() const { return moments_.cend(); }
+  const_iterator cbegin() const { return moments_.cbegin(); }
+  const_iterator cend() const { return moments_.cend(); }
+
+  /*! \brief Returns the total number of stored moments,
+   * \f$G(\ell_{\text{max}} + 1)^2\f$. */
+  std::size_t size() const { return moments_.size(); }
+  int total_groups() const { return total_groups_; }
+  int max_harmonic_l() const { return max_harmonic_l_; }
+
+ private:
+  int total_groups_ = 0;
+  int max_harmonic_l_ = 0;
+  std::vector<MomentVector> moments_;
+};
+
+} // namespace moments
+
+} // namespace system
+
+} // namespace bart
+
+#endif // BART_SRC_SYSTEM_MOMENTS_MOMENT_STORE_H_
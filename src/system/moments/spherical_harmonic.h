@@ -1,6 +1,7 @@
 #ifndef BART_SRC_SYSTEM_MOMENTS_SPHERICAL_HARMONIC_H_
 #define BART_SRC_SYSTEM_MOMENTS_SPHERICAL_HARMONIC_H_
 
+#include "system/moments/moment_store.h"
 #include "system/moments/spherical_harmonic_types.h"
 #include "system/moments/spherical_harmonic_i.h"
 
@@ -15,12 +16,14 @@ namespace moments {
  * using a unique index made up of the group, degree, and order of the moment
  * (See the documentation for system::moments::SphericalHarmonicI for the
  * definition of these values). After construction, the value of
- * \f$\ell_{\text{max}}\f$ and \f$g\f$ cannot be changed. The moments map will
- * be of length \f$g\cdot(\ell + 1)^2\f$.
+ * \f$\ell_{\text{max}}\f$ and \f$g\f$ cannot be changed. Moments are held in a
+ * system::moments::MomentStore of length \f$g\cdot(\ell + 1)^2\f$, this class
+ * adapts it to the SphericalHarmonicI interface.
  *
- * The underlying vectors are stored as type dealii::Vector<double> and are
- * constructed but unitialized. The `reinit` function must be called or they
- * must be set equal to an existing vector.
+ * The underlying vectors are stored as distributed
+ * dealii::PETScWrappers::MPI::Vector objects and are constructed but
+ * unitialized. The `reinit` function must be called (see
+ * system::SetUpSystemMoments) or they must be set equal to an existing vector.
  *
  * \code{cpp}
  * // initialize object with two groups, and l_max = 2
@@ -36,7 +39,7 @@ class SphericalHarmonic : public SphericalHarmonicI {
                     const int max_harmonic_l);
   virtual ~SphericalHarmonic() = default;
 
-  const MomentsMap& moments() const override { return moments_; }
+  const MomentStore& moments() const override { return moments_; }
 
   const MomentVector& GetMoment(const MomentIndex index) const override {
     return moments_.at(index);
@@ -53,14 +56,15 @@ class SphericalHarmonic : public SphericalHarmonicI {
   int total_groups() const override { return total_groups_; }
   int max_harmonic_l() const override { return max_harmonic_l_;}
 
-  std::map<MomentIndex, MomentVector>::const_iterator cbegin() const override;
-  std::map<MomentIndex, MomentVector>::iterator begin() override;
-  std::map<MomentIndex, MomentVector>::const_iterator cend() const override;
-  std::map<MomentIndex, MomentVector>::iterator end() override;
+  MomentStore::const_iterator cbegin() const override {
+    return moments_.cbegin(); }
+  MomentStore::iterator begin() override { return moments_.begin(); }
+  MomentStore::const_iterator cend() const override { return moments_.cend(); }
+  MomentStore::iterator end() override { return moments_.end(); }
  private:
-  MomentsMap moments_ = {};
   const int total_groups_ = 0;
   const int max_harmonic_l_ = 0;
+  MomentStore moments_;
 };
 
 } // namespace moments
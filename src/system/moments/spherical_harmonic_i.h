@@ -1,6 +1,7 @@
 #ifndef BART_SRC_SYSTEM_MOMENTS_SPHERICAL_HARMONIC_I_H_
 #define BART_SRC_SYSTEM_MOMENTS_SPHERICAL_HARMONIC_I_H_
 
+#include "system/moments/moment_store.h"
 #include "system/moments/spherical_harmonic_types.h"
 
 namespace bart {
@@ -30,13 +31,13 @@ class SphericalHarmonicI {
  public:
   virtual ~SphericalHarmonicI() = default;
 
-  /*! \brief Returns the full mapping of moments.
+  /*! \brief Returns the flat store holding all moments.
    *
    * By default this interface does not provide a method for modifying the
-   * map (it is returned as a constant).
+   * store (it is returned as a constant).
    *
    */
-  virtual const MomentsMap& moments() const = 0;
+  virtual const MomentStore& moments() const = 0;
 
   virtual const MomentVector& GetMoment(const MomentIndex) const = 0;
 
@@ -49,10 +50,10 @@ class SphericalHarmonicI {
   /*! \brief Returns the value of \f$\ell_{\text{max}}\f$. */
   virtual int max_harmonic_l() const = 0;
 
-  virtual MomentsMap::const_iterator cbegin() const = 0;
-  virtual MomentsMap::iterator begin() = 0;
-  virtual MomentsMap::const_iterator cend() const = 0;
-  virtual MomentsMap::iterator end() = 0;
+  virtual MomentStore::const_iterator cbegin() const = 0;
+  virtual MomentStore::iterator begin() = 0;
+  virtual MomentStore::const_iterator cend() const = 0;
+  virtual MomentStore::iterator end() = 0;
 };
 
 } // namespace moments
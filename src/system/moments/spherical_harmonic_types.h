@@ -3,7 +3,7 @@
 
 #include <map>
 
-#include <deal.II/lac/vector.h>
+#include <deal.II/lac/petsc_parallel_vector.h>
 
 namespace bart {
 
@@ -23,7 +23,15 @@ using HarmonicM = int;
  */
 using MomentIndex = std::array<int, 3>;
 
-using MomentVector = dealii::Vector<double>; //!< Vector for storing moments
+/*! \typedef MomentVector
+ * \brief Distributed vector for storing moments.
+ *
+ * Each processor only stores the entries of the moment it needs. Moments held
+ * by the system are ghosted with the locally relevant degrees of freedom so
+ * they can be evaluated on any locally owned cell, while moments returned by
+ * calculators only hold the locally owned entries.
+ */
+using MomentVector = dealii::PETScWrappers::MPI::Vector;
 
 using MomentsMap = std::map<MomentIndex, MomentVector>;
 
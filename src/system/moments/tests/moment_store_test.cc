@@ -0,0 +1,85 @@
+#include "system/moments/moment_store.h"
+
+#include <set>
+
+#include "test_helpers/gmock_wrapper.h"
+#include "test_helpers/test_helper_functions.h"
+
+namespace  {
+
+using namespace bart;
+
+using ::testing::Ref;
+
+class SystemMomentsMomentStoreTest : public ::testing::Test {
+ protected:
+  SystemMomentsMomentStoreTest()
+      : test_store(total_groups, max_harmonic_l) {}
+
+  system::moments::MomentStore test_store;
+
+  static constexpr int max_harmonic_l = 2;
+  static constexpr int total_groups = 3;
+};
+
+TEST_F(SystemMomentsMomentStoreTest, Constructor) {
+  EXPECT_EQ(test_store.total_groups(), total_groups);
+  EXPECT_EQ(test_store.max_harmonic_l(), max_harmonic_l);
+  EXPECT_EQ(test_store.size(),
+            total_groups * (max_harmonic_l + 1) * (max_harmonic_l + 1));
+}
+
+TEST_F(SystemMomentsMomentStoreTest, BadGroupsAndHarmonics) {
+  EXPECT_ANY_THROW(system::moments::MomentStore(0, 0));
+  EXPECT_ANY_THROW(system::moments::MomentStore(-1, 0));
+  EXPECT_ANY_THROW(system::moments::MomentStore(1, -1));
+}
+
+// Every moment index maps to a unique flat index and back
+TEST_F(SystemMomentsMomentStoreTest, FlatIndex) {
+  std::set<int> flat_indices;
+  for (int group = 0; group < total_groups; ++group) {
+    for (int l = 0; l <= max_harmonic_l; ++l) {
+      for (int m = -l; m <= l; ++m) {
+        const int flat_index = test_store.FlatIndex(group, l, m);
+        EXPECT_GE(flat_index, 0);
+        EXPECT_LT(flat_index, static_cast<int>(test_store.size()));
+        EXPECT_EQ(test_store.FlatIndex({group, l, m}), flat_index);
+        system::moments::MomentIndex expected{group, l, m};
+        EXPECT_EQ(test_store.GetMomentIndex(flat_index), expected);
+        flat_indices.insert(flat_index);
+        EXPECT_THAT(test_store.at({group, l, m}),
+                    Ref(*(test_store.cbegin() + flat_index)));
+      }
+    }
+  }
+  EXPECT_EQ(flat_indices.size(), test_store.size());
+  EXPECT_ANY_THROW(test_store.GetMomentIndex(test_store.size()));
+}
+
+TEST_F(SystemMomentsMomentStoreTest, ScalarMoments) {
+  EXPECT_EQ(test_store.scalar_cend() - test_store.scalar_cbegin(),
+            total_groups);
+  for (int group = 0; group < total_groups; ++group) {
+    EXPECT_THAT(test_store.scalar_moment(group),
+                Ref(test_store[{group, 0, 0}]));
+    EXPECT_THAT(*(test_store.scalar_cbegin() + group),
+                Ref(test_store[{group, 0, 0}]));
+  }
+}
+
+TEST_F(SystemMomentsMomentStoreTest, Assignment) {
+  auto moment = test_helpers::MakeMPIVector(std::vector<double>(10, 5));
+  test_store[{1, 2, -1}] = moment;
+  EXPECT_EQ(test_store.at({1, 2, -1}), moment);
+}
+
+TEST_F(SystemMomentsMomentStoreTest, BadIndex) {
+  EXPECT_ANY_THROW(test_store.at({total_groups, 0, 0}));
+  EXPECT_ANY_THROW(test_store.at({-1, 0, 0}));
+  EXPECT_ANY_THROW(test_store.at({0, max_harmonic_l + 1, 0}));
+  EXPECT_ANY_THROW(test_store.at({0, 1, 2}));
+  EXPECT_ANY_THROW(test_store.at({0, 1, -2}));
+}
+
+} // namespace
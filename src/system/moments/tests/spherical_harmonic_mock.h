@@ -15,14 +15,14 @@ class SphericalHarmonicMock : public SphericalHarmonicI {
  public:
   MOCK_CONST_METHOD0(total_groups, int());
   MOCK_CONST_METHOD0(max_harmonic_l, int());
-  MOCK_CONST_METHOD0(moments, const MomentsMap&());
+  MOCK_CONST_METHOD0(moments, const MomentStore&());
   MOCK_CONST_METHOD1(GetMoment, const MomentVector&(const MomentIndex));
   MOCK_CONST_METHOD1(BracketOp, const MomentVector&(const MomentIndex));
   MOCK_METHOD1(BracketOp, MomentVector&(const MomentIndex));
-  MOCK_METHOD(MomentsMap::const_iterator, cbegin, (), (const, override));
-  MOCK_METHOD(MomentsMap::iterator, begin, (), (override));
-  MOCK_METHOD(MomentsMap::const_iterator, cend, (), (const, override));
-  MOCK_METHOD(MomentsMap::iterator, end, (), (override));
+  MOCK_METHOD(MomentStore::const_iterator, cbegin, (), (const, override));
+  MOCK_METHOD(MomentStore::iterator, begin, (), (override));
+  MOCK_METHOD(MomentStore::const_iterator, cend, (), (const, override));
+  MOCK_METHOD(MomentStore::iterator, end, (), (override));
 
 
   const MomentVector& operator[](const MomentIndex index) const override {
@@ -3,6 +3,7 @@
 #include <array>
 
 #include "test_helpers/gmock_wrapper.h"
+#include "test_helpers/test_helper_functions.h"
 
 namespace  {
 
@@ -45,26 +46,34 @@ TEST_F(SystemMomentsSphericalHarmonicTest, BadGroupsAndHarmonics) {
 }
 
 TEST_F(SystemMomentsSphericalHarmonicTest, BracketOperator) {
-  for (const auto& moment_pair : test_moments.moments()) {
-    const auto& moment = test_moments[moment_pair.first];
-    const auto& moment_from_get = test_moments.GetMoment(moment_pair.first);
-    EXPECT_THAT(moment, Ref(moment_pair.second));
-    EXPECT_THAT(moment_from_get, Ref(moment_pair.second));
+  const auto& store = test_moments.moments();
+  for (int i = 0; i < static_cast<int>(store.size()); ++i) {
+    const auto index = store.GetMomentIndex(i);
+    const auto& moment = test_moments[index];
+    const auto& moment_from_get = test_moments.GetMoment(index);
+    EXPECT_THAT(moment, Ref(*(store.cbegin() + i)));
+    EXPECT_THAT(moment_from_get, Ref(*(store.cbegin() + i)));
   }
 
   const auto& const_test_moments = test_moments;
 
-  for (const auto& moment_pair : const_test_moments.moments()) {
-    const auto& moment = const_test_moments[moment_pair.first];
-    EXPECT_THAT(moment, Ref(moment_pair.second));
+  for (int i = 0; i < static_cast<int>(store.size()); ++i) {
+    const auto index = store.GetMomentIndex(i);
+    const auto& moment = const_test_moments[index];
+    EXPECT_THAT(moment, Ref(*(store.cbegin() + i)));
   }
 
 }
 
+TEST_F(SystemMomentsSphericalHarmonicTest, BadIndex) {
+  EXPECT_ANY_THROW(test_moments[{total_groups, 0, 0}]);
+  EXPECT_ANY_THROW(test_moments[{0, max_harmonic_l + 1, 0}]);
+  EXPECT_ANY_THROW(test_moments.GetMoment({0, 1, 2}));
+}
+
 TEST_F(SystemMomentsSphericalHarmonicTest, Assignment) {
-  system::moments::MomentVector moment{10};
+  auto moment = test_helpers::MakeMPIVector(std::vector<double>(10, 5));
   system::moments::MomentIndex index{0,0,0};
-  moment = 5;
 
   test_moments[index] = moment;
   EXPECT_EQ(test_moments[index], moment);
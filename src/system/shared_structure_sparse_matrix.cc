@@ -0,0 +1,24 @@
+#include "system/shared_structure_sparse_matrix.h"
+
+#include <deal.II/base/exceptions.h>
+#include <deal.II/lac/exceptions.h>
+
+namespace bart {
+
+namespace system {
+
+SharedStructureSparseMatrix::SharedStructureSparseMatrix(
+    const MPISparseMatrix& prototype)
+    : communicator_(prototype.get_mpi_communicator()) {
+  // Replaces the empty matrix created by the default constructor of the base
+  PetscErrorCode ierr = MatDestroy(&this->matrix);
+  AssertThrow(ierr == 0, dealii::ExcPETScError(ierr));
+  ierr = MatDuplicate(prototype.petsc_matrix(), MAT_SHARE_NONZERO_PATTERN,
+                      &this->matrix);
+  AssertThrow(ierr == 0, dealii::ExcPETScError(ierr));
+  this->last_action = dealii::VectorOperation::unknown;
+}
+
+} // namespace system
+
+} // namespace bart
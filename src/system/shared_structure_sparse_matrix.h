@@ -0,0 +1,49 @@
+#ifndef BART_SRC_SYSTEM_SHARED_STRUCTURE_SPARSE_MATRIX_H_
+#define BART_SRC_SYSTEM_SHARED_STRUCTURE_SPARSE_MATRIX_H_
+
+#include <deal.II/base/config.h>
+#include <deal.II/lac/petsc_sparse_matrix.h>
+
+#include "system/system_types.h"
+
+namespace bart {
+
+namespace system {
+
+/*! \brief MPI sparse matrix that shares the nonzero structure of another.
+ *
+ * The PETSc matrix is a values-only duplicate of the prototype
+ * (MatDuplicate with MAT_SHARE_NONZERO_PATTERN), so the row pointers and column
+ * indices are stored once for all matrices duplicated from the same prototype.
+ * Values start at zero and are independent of the prototype. The matrix owns
+ * its PETSc matrix and reports the communicator of the prototype, it can be
+ * used anywhere an MPISparseMatrix is expected.
+ */
+class SharedStructureSparseMatrix : public MPISparseMatrix {
+ public:
+  /*! \brief Constructor, collective over the communicator of the prototype.
+   *
+   * \param prototype matrix that holds the nonzero structure, it must have
+   * been initialized with a sparsity pattern.
+   */
+  explicit SharedStructureSparseMatrix(const MPISparseMatrix& prototype);
+
+#if !DEAL_II_VERSION_GTE(9, 5, 0)
+  /*! \brief Communicator of the prototype.
+   *
+   * Older deal.II versions cache the communicator in the wrapper instead of
+   * querying the PETSc matrix, the base class would report the communicator of
+   * the empty default constructed matrix. */
+  const MPI_Comm& get_mpi_communicator() const override {
+    return communicator_; }
+#endif
+
+ private:
+  MPI_Comm communicator_;
+};
+
+} // namespace system
+
+} // namespace bart
+
+#endif // BART_SRC_SYSTEM_SHARED_STRUCTURE_SPARSE_MATRIX_H_
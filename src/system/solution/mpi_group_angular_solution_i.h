@@ -28,6 +28,20 @@ class MPIGroupAngularSolutionI :
 
   /*! \brief Returns the total number of angles */
   virtual int total_angles() const = 0;
+
+  /*! \brief Returns the number of angular solutions held in storage.
+   *
+   * Implementations that do not keep a solution for each angle override this
+   * to report how many solution vectors they actually store.
+   */
+  virtual int stored_angles() const { return total_angles(); }
+
+  /*! \brief Signals that the solution for an angle has been solved for.
+   *
+   * Group solvers call this after each angle is solved, the default
+   * implementation does nothing as solutions for all angles are stored.
+   */
+  virtual void AngleSolved(const AngleIndex /*angle*/) {}
 };
 
 
@@ -0,0 +1,77 @@
+#include "system/solution/mpi_group_moment_accumulator.h"
+
+#include <utility>
+
+namespace bart {
+
+namespace system {
+
+namespace solution {
+
+MPIGroupMomentAccumulator::MPIGroupMomentAccumulator(
+    std::vector<double> angle_weights)
+    : angle_weights_(std::move(angle_weights)) {
+  AssertThrow(!angle_weights_.empty(),
+              dealii::ExcMessage("Error in MPIGroupMomentAccumulator "
+                                 "constructor, no angle weights provided"))
+  // Uninitialized scratch vector shared by all angles
+  MPIVector scratch_vector;
+  solutions_[0] = scratch_vector;
+  this->set_description("Group moment accumulator (MPI), total angles = " +
+      std::to_string(angle_weights_.size()),
+      utility::DefaultImplementation(false));
+}
+
+auto MPIGroupMomentAccumulator::GetSolution(const AngleIndex angle)
+-> MPIVector& {
+  ValidateAngle(angle);
+  return solutions_.at(0);
+}
+
+auto MPIGroupMomentAccumulator::operator[](const AngleIndex angle) const
+-> const MPIVector& {
+  ValidateAngle(angle);
+  return solutions_.at(0);
+}
+
+auto MPIGroupMomentAccumulator::operator[](const AngleIndex angle)
+-> MPIVector& {
+  ValidateAngle(angle);
+  return solutions_.at(0);
+}
+
+void MPIGroupMomentAccumulator::AngleSolved(const AngleIndex angle) {
+  ValidateAngle(angle);
+  AssertThrow(angle == accumulated_angles_,
+              dealii::ExcMessage("Error in MPIGroupMomentAccumulator "
+                                 "AngleSolved, angles must be solved in "
+                                 "order"))
+  const auto& scratch_vector = solutions_.at(0);
+
+  if (accumulated_angles_ == 0) {
+    scalar_flux_.reinit(scratch_vector);
+    scalar_flux_ = 0.0;
+  }
+  scalar_flux_.add(angle_weights_[angle], scratch_vector);
+  accumulated_angles_ = (accumulated_angles_ + 1) % total_angles();
+}
+
+auto MPIGroupMomentAccumulator::scalar_flux() const -> const MPIVector& {
+  AssertThrow(accumulated_angles_ == 0 && scalar_flux_.size() > 0,
+              dealii::ExcMessage("Error in MPIGroupMomentAccumulator, scalar "
+                                 "flux requested before all angles were "
+                                 "solved"))
+  return scalar_flux_;
+}
+
+void MPIGroupMomentAccumulator::ValidateAngle(const AngleIndex angle) const {
+  AssertThrow(angle >= 0 && angle < total_angles(),
+              dealii::ExcMessage("Error in MPIGroupMomentAccumulator, angle "
+                                 "index is out of range"))
+}
+
+} // namespace solution
+
+} // namespace system
+
+} // namespace bart
@@ -0,0 +1,74 @@
+#ifndef BART_SRC_SYSTEM_SOLUTION_MPI_GROUP_MOMENT_ACCUMULATOR_H_
+#define BART_SRC_SYSTEM_SOLUTION_MPI_GROUP_MOMENT_ACCUMULATOR_H_
+
+#include <vector>
+
+#include "system/solution/mpi_group_angular_solution_i.h"
+
+namespace bart {
+
+namespace system {
+
+namespace solution {
+
+/*! \brief Group solution that accumulates the scalar flux instead of storing
+ * angular solutions.
+ *
+ * A single MPI vector is stored and used as scratch space by the group solver
+ * for every angle, all angles return the same vector. Each time an angle is
+ * reported as solved, the scratch vector is added to the scalar flux with the
+ * weight of that angle:
+ * \f[
+ * \phi = \sum_{n}w_n\psi_n
+ * \f]
+ * Storage for the group solution is therefore two vectors regardless of the
+ * number of angles. Only the scalar flux is available, so this can only be
+ * used with isotropic scattering and when angular fluxes are not needed
+ * (e.g. reflective boundaries).
+ */
+class MPIGroupMomentAccumulator : public MPIGroupAngularSolutionI {
+ public:
+  /*! \brief Constructor.
+   *
+   * @param angle_weights quadrature weight for each angle, the size
+   * determines the total number of angles.
+   */
+  explicit MPIGroupMomentAccumulator(std::vector<double> angle_weights);
+  virtual ~MPIGroupMomentAccumulator() = default;
+
+  int total_angles() const override { return angle_weights_.size(); }
+  int stored_angles() const override { return 1; }
+
+  MPIVector& GetSolution(const AngleIndex) override;
+  const MPIVector& operator[](const AngleIndex) const override;
+  MPIVector& operator[](const AngleIndex) override;
+
+  /*! \brief Adds the scratch solution for an angle to the scalar flux.
+   *
+   * Angles must be reported in order, the scalar flux is reset when the first
+   * angle of a new sweep through the angles is reported.
+   */
+  void AngleSolved(const AngleIndex angle) override;
+
+  /*! \brief Returns the scalar flux, throws if not all angles have been
+   * accumulated since the last reset. */
+  const MPIVector& scalar_flux() const;
+
+  std::vector<double> angle_weights() const { return angle_weights_; }
+
+ private:
+  void ValidateAngle(const AngleIndex angle) const;
+
+  const std::vector<double> angle_weights_;
+  MPIVector scalar_flux_;
+  //! Number of angles added to the scalar flux since the last reset
+  int accumulated_angles_ = 0;
+};
+
+} // namespace solution
+
+} // namespace system
+
+} // namespace bart
+
+#endif //BART_SRC_SYSTEM_SOLUTION_MPI_GROUP_MOMENT_ACCUMULATOR_H_
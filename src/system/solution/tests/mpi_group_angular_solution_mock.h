@@ -14,6 +14,7 @@ namespace solution {
 class MPIGroupAngularSolutionMock : public MPIGroupAngularSolutionI {
  public:
   MOCK_METHOD(int, total_angles, (), (override, const));
+  MOCK_METHOD(void, AngleSolved, (const AngleIndex), (override));
   MOCK_METHOD(const SolutionMap&, solutions, (), (override, const));
   MOCK_METHOD(SolutionMap&, solutions, (), (override));
   MOCK_METHOD(const MPIVector&, BracketOp, (const AngleIndex), (const));
@@ -0,0 +1,94 @@
+#include "system/solution/mpi_group_moment_accumulator.h"
+
+#include <cmath>
+
+#include <deal.II/base/mpi.h>
+#include <deal.II/lac/petsc_vector.h>
+
+#include "test_helpers/gmock_wrapper.h"
+
+namespace {
+
+using namespace bart;
+
+using ::testing::Ref;
+
+void SetVector(system::MPIVector& to_set, double value) {
+  auto [first_row, last_row] = to_set.local_range();
+  for (unsigned int i = first_row; i < last_row; ++i)
+    to_set[i] = value;
+  to_set.compress(dealii::VectorOperation::insert);
+}
+
+class SolutionMPIGroupMomentAccumulatorTest : public ::testing::Test {
+ protected:
+  SolutionMPIGroupMomentAccumulatorTest() : test_accumulator(weights_) {}
+
+  // Test parameters
+  const std::vector<double> weights_{0.5, 1.5, 2.5};
+  const int n_processes = dealii::Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD);
+  const int n_entries_per_proc = 10;
+
+  // Object to be tested
+  system::solution::MPIGroupMomentAccumulator test_accumulator;
+
+  void SetUp() override {
+    test_accumulator.GetSolution(0).reinit(MPI_COMM_WORLD,
+                                           n_processes * n_entries_per_proc,
+                                           n_entries_per_proc);
+  }
+
+  // Solves each angle, setting the scratch vector to 10^angle
+  void SolveAllAngles() {
+    for (int angle = 0; angle < test_accumulator.total_angles(); ++angle) {
+      SetVector(test_accumulator[angle], std::pow(10, angle));
+      test_accumulator.AngleSolved(angle);
+    }
+  }
+};
+
+TEST_F(SolutionMPIGroupMomentAccumulatorTest, Constructor) {
+  EXPECT_EQ(test_accumulator.total_angles(), 3);
+  EXPECT_EQ(test_accumulator.stored_angles(), 1);
+  EXPECT_EQ(test_accumulator.solutions().size(), 1);
+  EXPECT_EQ(test_accumulator.angle_weights(), weights_);
+  EXPECT_ANY_THROW({
+    system::solution::MPIGroupMomentAccumulator bad_accumulator({});
+  });
+}
+
+TEST_F(SolutionMPIGroupMomentAccumulatorTest, AllAnglesShareScratch) {
+  const auto& const_test_accumulator = test_accumulator;
+  const auto& scratch = test_accumulator.solutions().at(0);
+
+  for (int angle = 0; angle < test_accumulator.total_angles(); ++angle) {
+    EXPECT_THAT(test_accumulator[angle], Ref(scratch));
+    EXPECT_THAT(const_test_accumulator[angle], Ref(scratch));
+    EXPECT_THAT(test_accumulator.GetSolution(angle), Ref(scratch));
+  }
+  EXPECT_ANY_THROW(test_accumulator.GetSolution(3));
+  EXPECT_ANY_THROW(test_accumulator[-1]);
+}
+
+TEST_F(SolutionMPIGroupMomentAccumulatorTest, AccumulatesScalarFlux) {
+  EXPECT_ANY_THROW(test_accumulator.scalar_flux());
+
+  // Accumulating twice verifies the scalar flux is reset between sweeps
+  for (int sweep = 0; sweep < 2; ++sweep) {
+    SolveAllAngles();
+    const auto& scalar_flux = test_accumulator.scalar_flux();
+    ASSERT_EQ(scalar_flux.size(), n_processes * n_entries_per_proc);
+    auto [first_row, last_row] = scalar_flux.local_range();
+    for (unsigned int i = first_row; i < last_row; ++i)
+      EXPECT_DOUBLE_EQ(scalar_flux[i], 0.5 + 15 + 250);
+  }
+}
+
+TEST_F(SolutionMPIGroupMomentAccumulatorTest, PartialAccumulationThrows) {
+  SetVector(test_accumulator[0], 1.0);
+  test_accumulator.AngleSolved(0);
+  EXPECT_ANY_THROW(test_accumulator.scalar_flux());
+  EXPECT_ANY_THROW(test_accumulator.AngleSolved(2));
+}
+
+} // namespace
@@ -1,5 +1,11 @@
 #include "system/system_functions.h"
 
+#include <map>
+
+#include <deal.II/base/function.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/numerics/error_estimator.h>
+
 #include "system/terms/term.h"
 #include "system/moments/spherical_harmonic.h"
 
@@ -13,8 +19,8 @@ void SetUpMPIAngularSolution(
     const domain::DefinitionI<dim>& domain_definition,
     const double value_to_set) {
   auto& solution_map = to_initialize.solutions();
-  AssertThrow(static_cast<int>(solution_map.size()) == to_initialize.total_angles(),
-      dealii::ExcMessage("Error in SetUpMPIAngularSolution, MPIGroupAngularSolution solution map size does not match total_angles"))
+  AssertThrow(static_cast<int>(solution_map.size()) == to_initialize.stored_angles(),
+      dealii::ExcMessage("Error in SetUpMPIAngularSolution, MPIGroupAngularSolution solution map size does not match stored_angles"))
   const auto locally_owned_dofs = domain_definition.locally_owned_dofs();
 
   for (auto& solution_pair : solution_map) {
@@ -31,7 +37,9 @@ void SetUpMPIAngularSolution(
 void InitializeSystem(system::System &system_to_setup,
                  const int total_groups,
                  const int total_angles,
-                 const bool is_eigenvalue_problem) {
+                 const bool is_eigenvalue_problem,
+                 const bool has_left_hand_side,
+                 const int max_harmonic_l) {
   using VariableLinearTerms = system::terms::VariableLinearTerms;
 
   std::string error_start{"Error: attempting to call Initialize System on a "
@@ -58,12 +66,16 @@ void InitializeSystem(system::System &system_to_setup,
 
   system_to_setup.right_hand_side_ptr_ = std::move(
       std::make_unique<system::terms::MPILinearTerm>(rhs_variable_terms));
-  system_to_setup.left_hand_side_ptr_ = std::move(
-      std::make_unique<system::terms::MPIBilinearTerm>());
+  if (has_left_hand_side) {
+    system_to_setup.left_hand_side_ptr_ = std::move(
+        std::make_unique<system::terms::MPIBilinearTerm>());
+  }
   system_to_setup.current_moments = std::move(
-      std::make_unique<system::moments::SphericalHarmonic>(total_groups, 0));
+      std::make_unique<system::moments::SphericalHarmonic>(total_groups,
+                                                           max_harmonic_l));
   system_to_setup.previous_moments = std::move(
-      std::make_unique<system::moments::SphericalHarmonic>(total_groups, 0));
+      std::make_unique<system::moments::SphericalHarmonic>(total_groups,
+                                                           max_harmonic_l));
 }
 
 template <int dim>
@@ -80,7 +92,8 @@ void SetUpSystemTerms(system::System& system_to_setup,
       auto& lhs = system_to_setup.left_hand_side_ptr_;
       auto& rhs = system_to_setup.right_hand_side_ptr_;
 
-      lhs->SetFixedTermPtr(index, domain_definition.MakeSystemMatrix());
+      if (lhs != nullptr)
+        lhs->SetFixedTermPtr(index, domain_definition.MakeSystemMatrix());
       rhs->SetFixedTermPtr(index, domain_definition.MakeSystemVector());
 
       for (const auto variable_term : variable_terms) {
@@ -91,13 +104,22 @@ void SetUpSystemTerms(system::System& system_to_setup,
   }
 }
 
+template <int dim>
 void SetUpSystemMoments(system::System& system_to_setup,
-                        const std::size_t solution_size) {
+                        const domain::DefinitionI<dim>& domain_definition) {
+  const auto locally_owned_dofs = domain_definition.locally_owned_dofs();
+  const auto locally_relevant_dofs = domain_definition.locally_relevant_dofs();
 
-  auto initialize_moments = [=](system::moments::SphericalHarmonicI& to_initialize) {
+  // Ghosted vectors cannot be written to directly, values are set on a vector
+  // of locally owned entries and copied in, updating the ghost entries.
+  system::moments::MomentVector initial_values;
+  initial_values.reinit(locally_owned_dofs, MPI_COMM_WORLD);
+  initial_values = 1;
+
+  auto initialize_moments = [&](system::moments::SphericalHarmonicI& to_initialize) {
     for (auto& moment : to_initialize) {
-      moment.second.reinit(solution_size);
-      moment.second = 1;
+      moment.reinit(locally_owned_dofs, locally_relevant_dofs, MPI_COMM_WORLD);
+      moment = initial_values;
     }
   };
 
@@ -105,6 +127,54 @@ void SetUpSystemMoments(system::System& system_to_setup,
   initialize_moments(*system_to_setup.previous_moments);
 }
 
+template <int dim>
+dealii::Vector<float> EstimateCellErrors(
+    const system::System& system_to_estimate,
+    const domain::DefinitionI<dim>& domain_definition) {
+  const auto& dof_handler = domain_definition.dof_handler();
+  const int n_cells = dof_handler.get_triangulation().n_active_cells();
+  dealii::Vector<float> cell_errors(n_cells), group_errors(n_cells);
+  const dealii::QGauss<dim - 1> face_quadrature(
+      dof_handler.get_fe().degree + 1);
+  const std::map<dealii::types::boundary_id, const dealii::Function<dim>*>
+      no_neumann_boundaries;
+
+  for (int group = 0; group < system_to_estimate.total_groups; ++group) {
+    const auto& scalar_flux =
+        system_to_estimate.current_moments->GetMoment({group, 0, 0});
+    dealii::KellyErrorEstimator<dim>::estimate(dof_handler, face_quadrature,
+                                               no_neumann_boundaries,
+                                               scalar_flux, group_errors);
+    const double scalar_flux_norm = scalar_flux.l2_norm();
+    if (scalar_flux_norm > 0)
+      cell_errors.add(1.0 / scalar_flux_norm, group_errors);
+  }
+  return cell_errors;
+}
+
+template <int dim>
+void RefineSystem(system::System& system_to_refine,
+                  system::solution::MPIGroupAngularSolutionI& angular_solution,
+                  domain::DefinitionI<dim>& domain_definition,
+                  const double refine_fraction,
+                  const double coarsen_fraction) {
+  const auto cell_errors = EstimateCellErrors(system_to_refine,
+                                              domain_definition);
+
+  std::vector<system::MPIVector*> to_transfer;
+  for (auto& moments : {system_to_refine.current_moments.get(),
+                        system_to_refine.previous_moments.get()}) {
+    for (auto& moment : *moments)
+      to_transfer.push_back(&moment);
+  }
+  for (auto& solution_pair : angular_solution.solutions())
+    to_transfer.push_back(&solution_pair.second);
+
+  domain_definition.RefineAndCoarsen(cell_errors, refine_fraction,
+                                     coarsen_fraction, to_transfer);
+  SetUpSystemTerms(system_to_refine, domain_definition);
+}
+
 template void SetUpMPIAngularSolution<1>(system::solution::MPIGroupAngularSolutionI&, const domain::DefinitionI<1>&, const double);
 template void SetUpMPIAngularSolution<2>(system::solution::MPIGroupAngularSolutionI&, const domain::DefinitionI<2>&, const double);
 template void SetUpMPIAngularSolution<3>(system::solution::MPIGroupAngularSolutionI&, const domain::DefinitionI<3>&, const double);
@@ -113,6 +183,18 @@ template void SetUpSystemTerms(system::System&, const domain::DefinitionI<1>&);
 template void SetUpSystemTerms(system::System&, const domain::DefinitionI<2>&);
 template void SetUpSystemTerms(system::System&, const domain::DefinitionI<3>&);
 
+template void SetUpSystemMoments(system::System&, const domain::DefinitionI<1>&);
+template void SetUpSystemMoments(system::System&, const domain::DefinitionI<2>&);
+template void SetUpSystemMoments(system::System&, const domain::DefinitionI<3>&);
+
+template dealii::Vector<float> EstimateCellErrors(const system::System&, const domain::DefinitionI<1>&);
+template dealii::Vector<float> EstimateCellErrors(const system::System&, const domain::DefinitionI<2>&);
+template dealii::Vector<float> EstimateCellErrors(const system::System&, const domain::DefinitionI<3>&);
+
+template void RefineSystem(system::System&, system::solution::MPIGroupAngularSolutionI&, domain::DefinitionI<1>&, const double, const double);
+template void RefineSystem(system::System&, system::solution::MPIGroupAngularSolutionI&, domain::DefinitionI<2>&, const double, const double);
+template void RefineSystem(system::System&, system::solution::MPIGroupAngularSolutionI&, domain::DefinitionI<3>&, const double, const double);
+
 } // namespace system
 
 } // namespace bart
@@ -20,24 +20,75 @@ void SetUpMPIAngularSolution(
  *
  * This function initializes a system by setting total groups, total angles,
  * initial keffective (set to 1.0) and instantiating the RHS, LHS, and moments
- * classes.
+ * classes. Solvers that do not assemble a global matrix, such as transport
+ * sweeps, can skip the LHS, it is then left null.
  *
  * @param system_to_setup system to initialize
  * @param total_groups total number of energy group
  * @param total_angles total number of angles
  * @param is_eigenvalue_problem identifies if problem is an eigenvalue problem
+ * @param has_left_hand_side identifies if the LHS should be instantiated
+ * @param max_harmonic_l maximum degree of the stored flux moments
  */
 void InitializeSystem(system::System& system_to_setup,
                       const int total_groups,
                       const int total_angles,
-                      const bool is_eigenvalue_problem = true);
+                      const bool is_eigenvalue_problem = true,
+                      const bool has_left_hand_side = true,
+                      const int max_harmonic_l = 0);
 
 template <int dim>
 void SetUpSystemTerms(system::System& system_to_setup,
                       const domain::DefinitionI<dim>& domain_definition);
 
+/*! \brief Initializes all system moments and sets them to 1.0.
+ *
+ * Moments are distributed over the locally owned degrees of freedom of the
+ * domain and ghosted with the locally relevant degrees of freedom.
+ *
+ * @param system_to_setup system with moments to initialize
+ * @param domain_definition domain used to get the degree of freedom layout
+ */
+template <int dim>
 void SetUpSystemMoments(system::System& system_to_setup,
-                        const std::size_t solution_size);
+                        const domain::DefinitionI<dim>& domain_definition);
+
+/*! \brief Estimates the error of each active cell from the scalar fluxes.
+ *
+ * The Kelly error indicator (the jump of the gradient across the cell faces)
+ * of the current scalar flux of each group is normalized by the norm of that
+ * scalar flux and summed over groups, so every group contributes relative to
+ * its own magnitude.
+ *
+ * @param system_to_estimate system with ghosted current moments
+ * @param domain_definition domain the moments are defined on
+ * @return error indicator of each active cell, zero on cells that are not
+ * locally owned
+ */
+template <int dim>
+dealii::Vector<float> EstimateCellErrors(
+    const system::System& system_to_estimate,
+    const domain::DefinitionI<dim>& domain_definition);
+
+/*! \brief Adaptively refines the domain and carries the system along.
+ *
+ * The domain is refined and coarsened based on EstimateCellErrors, the
+ * current and previous moments and the angular solutions are transferred to
+ * the new mesh, and the system terms are set up again for the new degrees of
+ * freedom. Fixed terms must be stamped again before the next solve.
+ *
+ * @param system_to_refine system with moments and terms to carry over
+ * @param angular_solution angular solutions to transfer
+ * @param domain_definition domain to refine
+ * @param refine_fraction fraction of cells with the largest errors to refine
+ * @param coarsen_fraction fraction of cells with the smallest errors to coarsen
+ */
+template <int dim>
+void RefineSystem(system::System& system_to_refine,
+                  system::solution::MPIGroupAngularSolutionI& angular_solution,
+                  domain::DefinitionI<dim>& domain_definition,
+                  double refine_fraction,
+                  double coarsen_fraction);
 
 } // namespace system
 
@@ -0,0 +1,48 @@
+#include "system/shared_structure_sparse_matrix.h"
+
+#include "test_helpers/gmock_wrapper.h"
+#include "test_helpers/dealii_test_domain.h"
+
+namespace  {
+
+using namespace bart;
+
+template <typename DimensionWrapper>
+class SystemSharedStructureSparseMatrixTest
+    : public ::testing::Test,
+      public bart::testing::DealiiTestDomain<DimensionWrapper::value> {
+ public:
+  void SetUp() override { this->SetUpDealii(); }
+};
+
+TYPED_TEST_SUITE(SystemSharedStructureSparseMatrixTest,
+                 bart::testing::AllDimensions);
+
+TYPED_TEST(SystemSharedStructureSparseMatrixTest, DuplicateMPI) {
+  system::SharedStructureSparseMatrix test_matrix(this->matrix_1);
+
+  EXPECT_EQ(test_matrix.m(), this->matrix_1.m());
+  EXPECT_EQ(test_matrix.n(), this->matrix_1.n());
+  EXPECT_EQ(test_matrix.local_range(), this->matrix_1.local_range());
+  EXPECT_EQ(test_matrix.n_nonzero_elements(),
+            this->matrix_1.n_nonzero_elements());
+
+  int comparison;
+  MPI_Comm_compare(test_matrix.get_mpi_communicator(),
+                   this->matrix_1.get_mpi_communicator(), &comparison);
+  EXPECT_NE(comparison, MPI_UNEQUAL);
+  MPI_Comm_compare(test_matrix.get_mpi_communicator(), MPI_COMM_SELF,
+                   &comparison);
+  EXPECT_NE(comparison, MPI_IDENT);
+
+  // Values start at zero and are not shared with the prototype
+  for (const auto index : this->locally_owned_dofs_)
+    test_matrix.set(index, index, 2);
+  test_matrix.compress(dealii::VectorOperation::insert);
+  for (const auto index : this->locally_owned_dofs_) {
+    EXPECT_EQ(test_matrix(index, index), 2);
+    EXPECT_EQ(this->matrix_1(index, index), 0);
+  }
+}
+
+} // namespace
@@ -187,6 +187,37 @@ TEST_F(SystemFunctionsInitializeSystemTest, NonEigenvalueProblem) {
   EXPECT_EQ(test_system.previous_moments->moments().size(), total_groups);
 }
 
+TEST_F(SystemFunctionsInitializeSystemTest, NoLeftHandSide) {
+  using ExpectedRHSType = bart::system::terms::MPILinearTerm;
+
+  const int total_groups = bart::test_helpers::RandomDouble(1, 10);
+  const int total_angles = total_groups + 1;
+
+  system::InitializeSystem(test_system, total_groups, total_angles, true,
+                           false);
+
+  EXPECT_EQ(test_system.k_effective, 1.0);
+  ASSERT_THAT(test_system.right_hand_side_ptr_.get(),
+              WhenDynamicCastTo<ExpectedRHSType *>(NotNull()));
+  EXPECT_EQ(test_system.left_hand_side_ptr_, nullptr);
+}
+
+TEST_F(SystemFunctionsInitializeSystemTest, HigherMoments) {
+  const int total_groups = bart::test_helpers::RandomDouble(1, 10);
+  const int total_angles = total_groups + 1;
+  const int max_harmonic_l = 2;
+
+  system::InitializeSystem(test_system, total_groups, total_angles, true,
+                           true, max_harmonic_l);
+
+  for (const auto& moments : {test_system.current_moments.get(),
+                              test_system.previous_moments.get()}) {
+    ASSERT_NE(moments, nullptr);
+    EXPECT_EQ(moments->max_harmonic_l(), max_harmonic_l);
+    EXPECT_EQ(moments->moments().size(), total_groups * 9);
+  }
+}
+
 TEST_F(SystemFunctionsInitializeSystemTest, ErrorOnSecondCall) {
   using VariableLinearTerms = system::terms::VariableLinearTerms;
   using ExpectedRHSType = bart::system::terms::MPILinearTerm;
@@ -291,34 +322,57 @@ TYPED_TEST(SystemFunctionsSetUpSystemTermsTests, SetUpProperly) {
   bart::system::SetUpSystemTerms(test_system, *this->definition_ptr);
 }
 
+TYPED_TEST(SystemFunctionsSetUpSystemTermsTests, NoLeftHandSide) {
+  auto& test_system = this->test_system;
+  test_system.left_hand_side_ptr_ = nullptr;
+  const int total_groups = test_system.total_groups;
+  const int total_angles = test_system.total_angles;
+
+  EXPECT_CALL(*this->rhs_mock_obs_ptr_, GetVariableTerms())
+      .WillOnce(DoDefault());
+  EXPECT_CALL(*this->domain_mock_obs_ptr_, MakeSystemMatrix()).Times(0);
+  EXPECT_CALL(*this->domain_mock_obs_ptr_, MakeSystemVector())
+      .Times(total_groups * total_angles * (1 + this->source_terms_.size()))
+      .WillRepeatedly(DoDefault());
+
+  bart::system::SetUpSystemTerms(test_system, *this->definition_ptr);
+}
+
 // ===== SetUpSystemMomentsTests ===============================================
 
-class SystemFunctionsSetUpSystemMomentsTests : public ::testing::Test {
+template <typename DimensionWrapper>
+class SystemFunctionsSetUpSystemMomentsTests :
+    public ::testing::Test,
+    public bart::testing::DealiiTestDomain<DimensionWrapper::value> {
  public:
+  static constexpr int dim = DimensionWrapper::value;
   using MomentsType = NiceMock<bart::system::moments::SphericalHarmonicMock>;
 
   bart::system::System test_system;
+  domain::DefinitionMock<dim> mock_definition;
   MomentsType* current_moments_obs_ptr_;
   MomentsType* previous_moments_obs_ptr_;
 
   template <typename T> inline MomentsType* MockCast(T* to_cast) {
     return dynamic_cast<MomentsType*>(to_cast); }
 
-  const int solution_size = test_helpers::RandomDouble(1, 100);
-  bart::system::moments::MomentsMap current_moments_, previous_moments_;
+  const int n_groups = bart::test_helpers::RandomDouble(1, 4);
+  const int max_harmonic_l = bart::test_helpers::RandomDouble(0, 3);
+  bart::system::moments::MomentStore current_moments_{n_groups, max_harmonic_l};
+  bart::system::moments::MomentStore previous_moments_{n_groups, max_harmonic_l};
 
   void SetUp() override;
 };
 
-void SystemFunctionsSetUpSystemMomentsTests::SetUp() {
+template <typename DimensionWrapper>
+void SystemFunctionsSetUpSystemMomentsTests<DimensionWrapper>::SetUp() {
+  this->SetUpDealii();
   test_system.current_moments = std::make_unique<MomentsType>();
   test_system.previous_moments = std::make_unique<MomentsType>();
 
   current_moments_obs_ptr_ = MockCast(test_system.current_moments.get());
   previous_moments_obs_ptr_ = MockCast(test_system.previous_moments.get());
 
-  const int n_groups = bart::test_helpers::RandomDouble(1, 4);
-  const int max_harmonic_l = bart::test_helpers::RandomDouble(0, 3);
   test_system.total_groups = n_groups;
 
   for (auto& mock_moment_ptr : {current_moments_obs_ptr_,
@@ -330,16 +384,6 @@ void SystemFunctionsSetUpSystemMomentsTests::SetUp() {
   }
 
 
-  for (int group = 0; group < n_groups; ++group) {
-    for (int harmonic_l = 0; harmonic_l <= max_harmonic_l; ++harmonic_l) {
-      for (int harmonic_m = -harmonic_l; harmonic_m <= harmonic_l; ++harmonic_m) {
-        system::moments::MomentIndex index{group, harmonic_l, harmonic_m};
-        current_moments_.emplace(index, dealii::Vector<double>{});
-        previous_moments_.emplace(index, dealii::Vector<double>{});
-      }
-    }
-  }
-
   ON_CALL(*current_moments_obs_ptr_, moments())
       .WillByDefault(ReturnRef(current_moments_));
   ON_CALL(*current_moments_obs_ptr_, begin())
@@ -352,26 +396,100 @@ void SystemFunctionsSetUpSystemMomentsTests::SetUp() {
       .WillByDefault(Return(previous_moments_.begin()));
   ON_CALL(*previous_moments_obs_ptr_, end())
       .WillByDefault(Return(previous_moments_.end()));
+  ON_CALL(mock_definition, locally_owned_dofs())
+      .WillByDefault(Return(this->locally_owned_dofs_));
+  ON_CALL(mock_definition, locally_relevant_dofs())
+      .WillByDefault(Return(this->locally_owned_dofs_));
 }
 
-TEST_F(SystemFunctionsSetUpSystemMomentsTests, SetUpProperly) {
-  for (auto& mock_obs_ptr : {current_moments_obs_ptr_,
-                             previous_moments_obs_ptr_}) {
+TYPED_TEST_SUITE(SystemFunctionsSetUpSystemMomentsTests,
+                 bart::testing::AllDimensions);
+
+TYPED_TEST(SystemFunctionsSetUpSystemMomentsTests, SetUpProperly) {
+  for (auto& mock_obs_ptr : {this->current_moments_obs_ptr_,
+                             this->previous_moments_obs_ptr_}) {
     EXPECT_CALL(*mock_obs_ptr, begin()).WillOnce(DoDefault());
     EXPECT_CALL(*mock_obs_ptr, end()).WillOnce(DoDefault());
   }
+  EXPECT_CALL(this->mock_definition, locally_owned_dofs())
+      .WillOnce(DoDefault());
+  EXPECT_CALL(this->mock_definition, locally_relevant_dofs())
+      .WillOnce(DoDefault());
 
-  system::SetUpSystemMoments(test_system, solution_size);
-  dealii::Vector<double> expected(solution_size);
+  system::SetUpSystemMoments(this->test_system, this->mock_definition);
+  system::moments::MomentVector expected;
+  expected.reinit(this->locally_owned_dofs_, MPI_COMM_WORLD);
   expected = 1;
 
-  for (const auto& moment_map : {current_moments_, previous_moments_}) {
-    for (const auto& moment_pair : moment_map) {
-      const auto& moment_vector = moment_pair.second;
-      ASSERT_EQ(moment_vector.size(), solution_size);
-      EXPECT_EQ(moment_vector, expected);
+  for (const auto& moment_store : {this->current_moments_,
+                                 this->previous_moments_}) {
+    for (const auto& moment_vector : moment_store) {
+      ASSERT_EQ(moment_vector.size(), expected.size());
+      EXPECT_TRUE(test_helpers::CompareMPIVectors(expected, moment_vector));
     }
   }
 }
 
-} // namespace
\ No newline at end of file
+// ===== EstimateCellErrors Tests ==============================================
+
+template <typename DimensionWrapper>
+class SystemFunctionsEstimateCellErrorsTests :
+    public ::testing::Test,
+    public bart::testing::DealiiTestDomain<DimensionWrapper::value> {
+ public:
+  static constexpr int dim = DimensionWrapper::value;
+  using MomentsType = NiceMock<bart::system::moments::SphericalHarmonicMock>;
+
+  bart::system::System test_system;
+  domain::DefinitionMock<dim> mock_definition;
+  bart::system::moments::MomentVector scalar_flux_;
+
+  void SetUp() override;
+};
+
+template <typename DimensionWrapper>
+void SystemFunctionsEstimateCellErrorsTests<DimensionWrapper>::SetUp() {
+  this->SetUpDealii();
+  test_system.total_groups = 2;
+  test_system.current_moments = std::make_unique<MomentsType>();
+  auto current_moments_obs_ptr =
+      dynamic_cast<MomentsType*>(test_system.current_moments.get());
+
+  bart::system::MPIVector owned_flux;
+  owned_flux.reinit(this->locally_owned_dofs_, MPI_COMM_WORLD);
+  owned_flux = 1.0;
+  scalar_flux_.reinit(this->locally_owned_dofs_, this->locally_relevant_dofs,
+                      MPI_COMM_WORLD);
+  scalar_flux_ = owned_flux;
+
+  ON_CALL(*current_moments_obs_ptr, GetMoment(_))
+      .WillByDefault(ReturnRef(scalar_flux_));
+  ON_CALL(mock_definition, dof_handler())
+      .WillByDefault(ReturnRef(this->dof_handler_));
+}
+
+using MultiDimensions = ::testing::Types<bart::testing::TwoD,
+                                         bart::testing::ThreeD>;
+TYPED_TEST_SUITE(SystemFunctionsEstimateCellErrorsTests, MultiDimensions);
+
+TYPED_TEST(SystemFunctionsEstimateCellErrorsTests, ConstantFluxHasNoError) {
+  auto current_moments_obs_ptr = dynamic_cast<
+      typename TestFixture::MomentsType*>(
+          this->test_system.current_moments.get());
+  for (int group = 0; group < this->test_system.total_groups; ++group) {
+    bart::system::moments::MomentIndex index{group, 0, 0};
+    EXPECT_CALL(*current_moments_obs_ptr, GetMoment(index))
+        .WillOnce(DoDefault());
+  }
+  EXPECT_CALL(this->mock_definition, dof_handler())
+      .WillOnce(DoDefault());
+
+  const auto cell_errors = bart::system::EstimateCellErrors(
+      this->test_system, this->mock_definition);
+
+  ASSERT_EQ(cell_errors.size(), this->triangulation_.n_active_cells());
+  for (const auto error : cell_errors)
+    EXPECT_NEAR(error, 0.0, 1e-10);
+}
+
+} // namespace
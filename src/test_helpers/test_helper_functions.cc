@@ -67,6 +67,17 @@ RandomIntMatrixMap(std::size_t map_size, std::size_t m, std::size_t n,
   return return_map;
 }
 
+dealii::PETScWrappers::MPI::Vector MakeMPIVector(
+    const std::vector<double>& values) {
+  dealii::PETScWrappers::MPI::Vector return_vector(MPI_COMM_WORLD,
+                                                   values.size(),
+                                                   values.size());
+  for (std::size_t i = 0; i < values.size(); ++i)
+    return_vector(i) = values[i];
+  return_vector.compress(dealii::VectorOperation::insert);
+  return return_vector;
+}
+
 } // namespace test_helpers
 
 } // namespace bart
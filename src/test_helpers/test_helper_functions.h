@@ -7,6 +7,7 @@
 #include <vector>
 
 #include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/petsc_parallel_vector.h>
 
 namespace bart {
 
@@ -40,6 +41,13 @@ std::unordered_map<int, dealii::FullMatrix<double>>
 RandomIntMatrixMap(std::size_t map_size = 4, std::size_t m = 5,
                    std::size_t n = 5, double min = 0, double max = 100);
 
+//! Generates a dealii::PETScWrappers::MPI::Vector holding the given values.
+/*! The returned vector is not ghosted and all entries are owned by the
+  current process, so it should only be used in serial tests.
+*/
+dealii::PETScWrappers::MPI::Vector MakeMPIVector(
+    const std::vector<double>& values);
+
 } // namespace test_helpers
 
 } // namespace bart
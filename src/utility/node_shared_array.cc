@@ -0,0 +1,59 @@
+#include "utility/node_shared_array.h"
+
+namespace bart {
+
+namespace utility {
+
+template <typename T>
+NodeSharedArray<T>::NodeSharedArray(const std::size_t size,
+                                    const FillFunction& fill,
+                                    MPI_Comm mpi_communicator)
+    : size_(size),
+      n_uncaught_exceptions_(std::uncaught_exceptions()) {
+  MPI_Comm_split_type(mpi_communicator, MPI_COMM_TYPE_SHARED, 0,
+                      MPI_INFO_NULL, &node_communicator_);
+  int node_rank;
+  MPI_Comm_rank(node_communicator_, &node_rank);
+  is_node_root_ = (node_rank == 0);
+
+  // Only the node root allocates memory, the other ranks query its segment
+  const MPI_Aint local_size = is_node_root_ ? size_ * sizeof(T) : 0;
+  MPI_Win_allocate_shared(local_size, sizeof(T), MPI_INFO_NULL,
+                          node_communicator_, &data_, &window_);
+  if (!is_node_root_) {
+    MPI_Aint root_size;
+    int displacement_unit;
+    MPI_Win_shared_query(window_, 0, &root_size, &displacement_unit, &data_);
+  }
+
+  if (is_node_root_ && size_ > 0)
+    fill(data_);
+
+  // Make the filled data visible to all ranks of the node
+  MPI_Win_fence(0, window_);
+  MPI_Barrier(node_communicator_);
+}
+
+template <typename T>
+NodeSharedArray<T>::~NodeSharedArray() {
+  // Freeing is collective, skip it while unwinding instead of blocking
+  if (std::uncaught_exceptions() <= n_uncaught_exceptions_)
+    Free();
+}
+
+template <typename T>
+void NodeSharedArray<T>::Free() {
+  if (is_freed_)
+    return;
+  MPI_Win_free(&window_);
+  MPI_Comm_free(&node_communicator_);
+  data_ = nullptr;
+  is_freed_ = true;
+}
+
+template class NodeSharedArray<double>;
+template class NodeSharedArray<int>;
+
+} // namespace utility
+
+} // namespace bart
@@ -0,0 +1,75 @@
+#ifndef BART_SRC_UTILITY_NODE_SHARED_ARRAY_H_
+#define BART_SRC_UTILITY_NODE_SHARED_ARRAY_H_
+
+#include <cstddef>
+#include <exception>
+#include <functional>
+
+#include <deal.II/base/mpi.h>
+
+#include "utility/uncopyable.h"
+
+namespace bart {
+
+namespace utility {
+
+/*! \brief Read-only array allocated once per compute node.
+ *
+ * The ranks of the given communicator are split into one communicator per
+ * shared-memory node. The first rank on each node allocates the full array in
+ * an MPI shared-memory window (MPI_Win_allocate_shared) and fills it, every
+ * other rank on the node receives a pointer into the same memory. Data that is
+ * identical on all ranks is therefore held once per node instead of once per
+ * rank.
+ *
+ * Construction and Free are collective over the communicator. The destructor
+ * calls Free if the array was not freed, so on the normal shutdown path it must
+ * run on all ranks of the node. If the array is destroyed while an exception
+ * is propagating the destructor does not free the shared memory, a rank that
+ * unwinds alone would otherwise block in MPI_Win_free waiting for the other
+ * ranks; the memory is released when MPI is finalized or aborted.
+ *
+ * \code{cpp}
+ * NodeSharedArray<double> values(n, [&](double* to_fill) {
+ *   std::copy(local.begin(), local.end(), to_fill); });
+ * const double* data = values.data();
+ * \endcode
+ */
+template <typename T>
+class NodeSharedArray : private Uncopyable {
+ public:
+  using FillFunction = std::function<void(T* const)>;
+
+  /*! \brief Allocates size elements per node, fill is called on the first rank
+   * of each node only, all ranks of the node are synchronized before
+   * returning. */
+  NodeSharedArray(std::size_t size, const FillFunction& fill,
+                  MPI_Comm mpi_communicator = MPI_COMM_WORLD);
+  ~NodeSharedArray();
+
+  /*! \brief Frees the shared memory, collective over the communicator.
+   *
+   * Calling Free more than once has no effect, data() is null afterwards. */
+  void Free();
+
+  const T* data() const { return data_; }
+  std::size_t size() const { return size_; }
+  /*! \brief Returns true if this rank allocated and filled the array. */
+  bool is_node_root() const { return is_node_root_; }
+
+ private:
+  const std::size_t size_;
+  MPI_Comm node_communicator_;
+  MPI_Win window_;
+  T* data_ = nullptr;
+  bool is_node_root_ = false;
+  bool is_freed_ = false;
+  //! Exceptions in flight at construction, used to detect unwinding
+  const int n_uncaught_exceptions_;
+};
+
+} // namespace utility
+
+} // namespace bart
+
+#endif // BART_SRC_UTILITY_NODE_SHARED_ARRAY_H_
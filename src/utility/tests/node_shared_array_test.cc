@@ -0,0 +1,58 @@
+#include "utility/node_shared_array.h"
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+
+#include "test_helpers/gmock_wrapper.h"
+
+namespace {
+
+using namespace bart;
+
+TEST(NodeSharedArrayTest, FilledOnceReadableByAllMPI) {
+  const std::size_t size = 10;
+  int times_filled = 0;
+
+  utility::NodeSharedArray<double> test_array(size, [&](double* const to_fill) {
+    std::iota(to_fill, to_fill + size, 0.0);
+    ++times_filled;
+  });
+
+  ASSERT_EQ(test_array.size(), size);
+  EXPECT_EQ(times_filled, test_array.is_node_root() ? 1 : 0);
+  for (std::size_t i = 0; i < size; ++i)
+    EXPECT_EQ(test_array.data()[i], static_cast<double>(i));
+}
+
+TEST(NodeSharedArrayTest, EmptyArrayMPI) {
+  int times_filled = 0;
+  utility::NodeSharedArray<int> test_array(0, [&](int* const) {
+    ++times_filled; });
+  EXPECT_EQ(test_array.size(), 0u);
+  EXPECT_EQ(times_filled, 0);
+}
+
+TEST(NodeSharedArrayTest, FreeMPI) {
+  utility::NodeSharedArray<int> test_array(4, [](int* const to_fill) {
+    std::fill(to_fill, to_fill + 4, 1); });
+  ASSERT_NE(test_array.data(), nullptr);
+  test_array.Free();
+  EXPECT_EQ(test_array.data(), nullptr);
+  EXPECT_EQ(test_array.size(), 4u);
+  // A second call and the destructor do not free again
+  test_array.Free();
+  EXPECT_EQ(test_array.data(), nullptr);
+}
+
+TEST(NodeSharedArrayTest, DestroyedWhileUnwindingMPI) {
+  // All ranks throw, so no rank would be waiting in a collective free. The
+  // destructor must return without calling it
+  EXPECT_THROW({
+    utility::NodeSharedArray<int> test_array(4, [](int* const to_fill) {
+      std::fill(to_fill, to_fill + 4, 1); });
+    throw std::runtime_error("unwinding");
+  }, std::runtime_error);
+}
+
+} // namespace